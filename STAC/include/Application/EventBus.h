@@ -0,0 +1,152 @@
+#ifndef STAC_EVENT_BUS_H
+#define STAC_EVENT_BUS_H
+
+#include <atomic>
+#include <cstdint>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include "../Config/Types.h"
+
+
+namespace Application {
+
+    /**
+     * @brief Kinds of event delivered through the EventBus
+     */
+    enum class AppEventType : uint8_t {
+        BUTTON_PRESSED,     ///< Main button went down (debounced)
+        BUTTON_RELEASED,    ///< Main button went up (debounced)
+        BUTTON_B_PRESSED,   ///< Button B went down (boards with BUTTON_B_PIN)
+        WIFI_STATE,         ///< WiFi state changed, value = Net::WiFiState
+        WIFI_EVENT,         ///< WiFi driver event queued, WiFiManager::update() should run
+        TALLY_RESULT,       ///< Tally state changed, value = TallyState
+        TIMER_TICK,         ///< Periodic work is due, value = millis()
+        COUNT
+    };
+
+    /**
+     * @brief A single event; small and trivially copyable so it fits a FreeRTOS queue
+     */
+    struct AppEvent {
+        AppEventType type;
+        uint32_t value;
+        int64_t postedAtUs;     ///< esp_timer time the event was created
+    };
+
+    /**
+     * @brief Handler signature; context is the pointer given to subscribe()
+     */
+    using AppEventHandler = void ( * )( const AppEvent &event, void *context );
+
+    /**
+     * @brief Snapshot of the event bus counters
+     */
+    struct EventBusStats {
+        uint32_t posted = 0;            ///< Events queued by post()
+        uint32_t dropped = 0;           ///< Events lost because the queue was full
+        uint32_t dispatched = 0;        ///< Events delivered to at least one handler
+        uint32_t maxLatencyUs = 0;      ///< Longest time from creation to dispatch
+    };
+
+    /**
+     * @brief Fixed-capacity, allocation-free event queue with per-mode handlers
+     *
+     * Producers on other tasks (button timer, WiFi events) call post(),
+     * which never blocks. The application loop blocks in receive() until
+     * an event arrives or its next periodic tick is due, then calls
+     * dispatch(). Code already running on the loop task can call
+     * dispatch() directly for immediate delivery.
+     *
+     * Handlers are registered per OperatingMode, so each mode only sees
+     * the events it subscribed to. The counters are atomic because post()
+     * runs on the producers' tasks.
+     */
+    class EventBus {
+      public:
+        static constexpr uint8_t QUEUE_CAPACITY = 16;
+        static constexpr uint8_t MAX_HANDLERS = 16;
+
+        EventBus();
+
+        /**
+         * @brief Create the queue in the bus's own static storage
+         * @return true on success
+         */
+        bool begin();
+
+        /**
+         * @brief Register a handler for one event type in one operating mode
+         * @param mode Operating mode the handler is active in
+         * @param type Event type to receive
+         * @param handler Function to call
+         * @param context Passed back to the handler
+         * @return false if the handler table is full
+         */
+        bool subscribe( OperatingMode mode, AppEventType type, AppEventHandler handler, void *context );
+
+        /**
+         * @brief Queue an event from any task (never blocks)
+         * @param type Event type
+         * @param value Event payload
+         * @return false if the queue is full or not started (event dropped)
+         */
+        bool post( AppEventType type, uint32_t value = 0 );
+
+        /**
+         * @brief Wait for the next queued event
+         * @param event Receives the event
+         * @param timeoutMs Longest time to block
+         * @return true if an event was received, false on timeout
+         */
+        bool receive( AppEvent &event, uint32_t timeoutMs );
+
+        /**
+         * @brief Deliver an event to the handlers registered for a mode
+         * @param event Event to deliver
+         * @param mode Current operating mode
+         * @return Number of handlers called
+         */
+        uint8_t dispatch( const AppEvent &event, OperatingMode mode );
+
+        /**
+         * @brief Build an event stamped with the current time
+         * @param type Event type
+         * @param value Event payload
+         * @return The event
+         */
+        static AppEvent makeEvent( AppEventType type, uint32_t value = 0 );
+
+        /**
+         * @brief Get bus counters
+         * @return Posted, dropped and dispatched counts and worst-case latency
+         */
+        EventBusStats getStats() const;
+
+      private:
+        struct Subscription {
+            OperatingMode mode;
+            AppEventType type;
+            AppEventHandler handler;
+            void *context;
+        };
+
+        StaticQueue_t queueControl;
+        uint8_t queueStorage[ QUEUE_CAPACITY * sizeof( AppEvent ) ];
+        QueueHandle_t queue;
+
+        Subscription subscriptions[ MAX_HANDLERS ];
+        uint8_t subscriptionCount;
+
+        std::atomic<uint32_t> posted;
+        std::atomic<uint32_t> dropped;
+        std::atomic<uint32_t> dispatched;
+        std::atomic<uint32_t> maxLatencyUs;
+    };
+
+} // namespace Application
+
+
+#endif // STAC_EVENT_BUS_H
+
+
+//  --- EOF --- //
@@ -4,18 +4,25 @@
 #include <memory>
 #include <esp_timer.h>
 #include "Hardware/Display/IDisplay.h"
+#include "Hardware/Display/DisplayFactory.h"
+#include "Hardware/Display/Animator.h"
+#include "Hardware/Display/DisplayScene.h"
 #include "Hardware/Display/GlyphManager.h"
 #include "Hardware/Sensors/IIMU.h"
+#include "Hardware/Sensors/IMUFactory.h"
 #include "Hardware/Input/IButton.h"
 #if HAS_PERIPHERAL_MODE_CAPABILITY
     #include "Hardware/Interface/GrovePort.h"
     #include "Hardware/Interface/PeripheralMode.h"
 #endif
 #include "Network/WiFiManager.h"
+#include "Network/FleetUpdater.h"
+#include "Hardware/Power/PowerManager.h"
 #include "Network/Protocol/IRolandClient.h"
 #include "Storage/ConfigManager.h"
 #include "State/SystemState.h"
 #include "Application/StartupConfig.h"
+#include "Application/EventBus.h"
 
 namespace Application {
 
@@ -63,9 +70,20 @@ namespace Application {
         }
 
       private:
+        // Board hardware types: concrete classes (static dispatch) or interfaces
+        #if STAC_STATIC_DISPATCH
+        using DisplayType = Display::BoardDisplay;
+        using IMUType = Hardware::BoardIMU;
+        #else
+        using DisplayType = Display::IDisplay;
+        using IMUType = Hardware::IIMU;
+        #endif
+
         // Hardware - use correct namespaces!
-        std::unique_ptr<Display::IDisplay> display;              // Display namespace
-        std::unique_ptr<Hardware::IIMU> imu;                     // Hardware namespace
+        std::unique_ptr<DisplayType> display;                    // Display namespace
+        std::unique_ptr<Display::Animator> animator;             // Non-blocking display animations
+        Display::SceneTracker tallyScene;                        // Skips redraws of the tally already shown
+        std::unique_ptr<IMUType> imu;                            // Hardware namespace
         Button *button;                                          // XP_Button library - primary button (A)
         #if defined(BUTTON_B_PIN)
         Button *buttonB;                                     // XP_Button library - secondary button (B) for reset
@@ -89,6 +107,8 @@ namespace Application {
         std::unique_ptr<Net::WiFiManager> wifiManager;
         std::unique_ptr<Net::IRolandClient> rolandClient;
         std::unique_ptr<Storage::ConfigManager> configManager;
+        std::unique_ptr<Net::FleetUpdater> fleetUpdater;        // Only when an update server is configured
+        std::unique_ptr<Hardware::PowerManager> powerManager;   // Normal mode only
 
         // State
         std::unique_ptr<State::SystemState> systemState;
@@ -105,6 +125,11 @@ namespace Application {
         unsigned long lastRolandPoll;
         uint32_t rolandPollInterval;
         bool rolandClientInitialized;
+        bool warmResume;                    // Warm start after an unplanned reset, until the first valid tally
+
+        // Event-driven main loop
+        EventBus eventBus;
+        unsigned long nextTickAtMs;         // millis() when the next TIMER_TICK is due
 
         /**
          * @brief Initialize hardware subsystems
@@ -118,6 +143,13 @@ namespace Application {
          */
         bool initializeNetworkAndStorage();
 
+        /**
+         * @brief Start WiFi association in the background if this boot will run in normal mode
+         *
+         * handleNormalMode() later joins the attempt with connect().
+         */
+        void startEarlyWiFi();
+
         /**
          * @brief Determine initial operating mode
          * @return Operating mode to start in
@@ -134,6 +166,13 @@ namespace Application {
          */
         void handleButtonB();
 
+        /**
+         * @brief Run commands typed on the serial console (normal mode)
+         *
+         * - update: check the update server now rather than at the next scheduled check
+         */
+        void handleSerialCommand();
+
         /**
          * @brief Update display based on current state
          */
@@ -144,6 +183,34 @@ namespace Application {
          */
         void handleNormalMode();
 
+        /**
+         * @brief Register the per-mode event handlers
+         */
+        void registerEventHandlers();
+
+        /**
+         * @brief Periodic work in normal mode (TIMER_TICK handler)
+         */
+        void handleNormalTick();
+
+        /**
+         * @brief Refresh display and GROVE output after a tally change (TALLY_RESULT handler)
+         * @param newState New tally state
+         */
+        void handleTallyResult( TallyState newState );
+
+        /**
+         * @brief Pause or resume tally polling and show WiFi status (WIFI_STATE handler)
+         * @param state New WiFi state
+         */
+        void handleWiFiState( Net::WiFiState state );
+
+        /**
+         * @brief Time until the next TIMER_TICK for the current mode
+         * @return Milliseconds the loop may sleep on the event queue
+         */
+        uint32_t tickIntervalMs();
+
         /**
          * @brief Display WiFi connection status with visual feedback
          * @param state Current WiFi state
@@ -168,7 +235,7 @@ namespace Application {
 
         #if HAS_PERIPHERAL_MODE_CAPABILITY
         /**
-         * @brief Handle peripheral operating mode
+         * @brief Handle peripheral operating mode (one pass per TIMER_TICK or BUTTON_RELEASED)
          */
         void handlePeripheralMode();
         #endif
@@ -197,6 +264,15 @@ namespace Application {
          */
         void handleFactoryReset();
 
+        /**
+         * @brief Confirm a factory reset on the display and wait for a restart
+         *
+         * Plays the confirmation flash through the animator, then parks with
+         * the factory reset glyph shown. Button B (where fitted) restarts.
+         * Never returns.
+         */
+        void parkAfterFactoryReset();
+
         /**
          * @brief Check for button hold at boot
          *
@@ -212,7 +288,8 @@ namespace Application {
         /**
          * @brief Show confirmation checkmark after boot button selection
          *
-         * Clears display, shows green checkmark, pauses, then clears again
+         * Clears display, shows green checkmark, pauses, then clears again.
+         * Plays through the animator and returns immediately.
          */
         void showConfirmationCheckmark();
 
@@ -176,6 +176,14 @@
 // #define TFT_READABLE false     // Display supports read-back operations
 // #define TFT_BUS_SHARED false   // SPI bus shared with other devices
 
+// -------------------------------------------------------------------------
+// Off-screen Canvas
+// -------------------------------------------------------------------------
+// 1 = 4-bit palette canvas (about 1/4 of the heap), 0 = full RGB565 canvas
+// #define TFT_CANVAS_PALETTE 1   // Uncomment to override default (1)
+// 1 = digits/icons from the pre-rasterised atlas, 0 = GFX font and primitives
+// #define TFT_GLYPH_ATLAS 1      // Uncomment to override default (1)
+
 // TFT doesn't use display data pin like LED matrix
 #define PIN_DISPLAY_DATA 0     // Not used for TFT, placeholder
 
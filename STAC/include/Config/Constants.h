@@ -68,6 +68,11 @@ namespace Config {
         constexpr unsigned long ERROR_REPOLL_MS = TIMING_ERROR_REPOLL_MS;
         constexpr unsigned long PM_POLL_INTERVAL_MS = TIMING_PM_POLL_INTERVAL_MS;
         constexpr unsigned long OP_MODE_TIMEOUT_MS = TIMING_OP_MODE_TIMEOUT_MS;
+        constexpr unsigned long PORTAL_PULSE_MS = 1000;         // Config glyph pulse phase while the portal waits
+
+        // Main loop tick (the loop sleeps on the event queue between ticks)
+        constexpr unsigned long EVENT_TICK_ACTIVE_MS = 10;      // While animating or a button is held
+        constexpr unsigned long EVENT_TICK_IDLE_MS = 50;        // Otherwise
     }
 
     // ============================================================================
@@ -88,6 +93,58 @@ namespace Config {
         constexpr uint8_t MAX_POLL_ERRORS = NETWORK_MAX_POLL_ERRORS;
         constexpr uint16_t DEFAULT_PORT = 80;
         constexpr uint32_t CONNECT_TIMEOUT_MS = 1000;
+
+        // Directed reconnect to the last access point before falling back to a full scan
+        constexpr unsigned long FAST_CONNECT_TIMEOUT_MS = 3000;
+        constexpr bool REUSE_DHCP_LEASE = STAC_WIFI_REUSE_LEASE;
+
+        // Background reconnection: WiFi.begin() retried after BASE, 2 x BASE, ... up to MAX, each jittered
+        constexpr unsigned long RECONNECT_BACKOFF_BASE_MS = 1000;
+        constexpr unsigned long RECONNECT_BACKOFF_MAX_MS = 30000;
+        constexpr unsigned long RECONNECT_TIMEOUT_MS = 10000;       // Reported FAILED after this, retries continue
+        constexpr unsigned long RSSI_SAMPLE_MS = 1000;              // Link quality sampling while connected
+
+        // Roaming between access points with the same SSID: a poor link starts a background
+        // scan; a candidate must beat the current average by the hysteresis to be joined
+        constexpr int8_t ROAM_RSSI_THRESHOLD_DBM = -72;
+        constexpr uint8_t ROAM_POLL_ERROR_PERCENT = 50;             // Of the last 8 tally polls
+        constexpr int8_t ROAM_HYSTERESIS_DB = 8;
+        constexpr unsigned long ROAM_SCAN_INTERVAL_MS = 30000;      // At most one background scan per interval
+        constexpr uint32_t ROAM_SCAN_DWELL_MS = 80;                 // Per channel, home channel revisited between
+        constexpr unsigned long ROAM_REASSOC_TIMEOUT_MS = 3000;     // Treated as link lost after this
+    }
+
+    // ============================================================================
+    // POWER PROFILES
+    // ============================================================================
+
+    namespace Power {
+        constexpr uint32_t WAKE_LEAD_MS = 20;               // Radio (and CPU) brought up this long before a poll
+        constexpr uint16_t SAVER_LISTEN_INTERVAL = 10;      // Beacon intervals between wakes (BATTERY_SAVER)
+        constexpr uint32_t SAVER_CPU_MHZ = 80;              // Lowest clock WiFi runs at
+        constexpr unsigned long PMU_SAMPLE_MS = 5000;       // Battery discharge current sampling (AXP192)
+        constexpr unsigned long REPORT_INTERVAL_MS = 10UL * 60 * 1000;
+
+        // Energy model: average supply current of each part, in mA (ESP32 datasheet
+        // modem-sleep figures; display and other board loads are not included)
+        constexpr float CPU_FULL_MA = 50.0f;                // 160/240 MHz
+        constexpr float CPU_SLOW_MA = 25.0f;                // 80 MHz
+        constexpr float RADIO_AWAKE_MA = 70.0f;             // Receiver on (no modem sleep)
+        constexpr float RADIO_MIN_MODEM_MA = 8.0f;          // Waking for every DTIM beacon
+        constexpr float RADIO_MAX_MODEM_MA = 3.0f;          // Waking every SAVER_LISTEN_INTERVAL beacons
+    }
+
+    // ============================================================================
+    // FLEET UPDATES (pulled from a local update server)
+    // ============================================================================
+
+    namespace FleetOTA {
+        constexpr unsigned long STAGGER_WINDOW_MS = 10UL * 60 * 1000;     ///< First check spread over this window by STAC ID
+        constexpr unsigned long RECHECK_INTERVAL_MS = 60UL * 60 * 1000;   ///< Manifest re-checked this often
+        constexpr uint32_t RATE_LIMIT_BPS = 100UL * 1024;                 ///< Download rate cap per unit
+        constexpr uint16_t HTTP_TIMEOUT_MS = 5000;
+        constexpr size_t MAX_MANIFEST_SIZE = 1024;
+        constexpr size_t MAX_URL_LENGTH = 96;
     }
 
     // ============================================================================
@@ -109,15 +166,18 @@ namespace Config {
      *
      * NOM_PREFS_VERSION: Normal Operating Mode schema (wifi, switch, v60hd, v160hd, identity namespaces)
      *   - Stored in 'wifi' namespace only
-     *   - Checked on boot, mismatch triggers warning and requires factory reset
+     *   - Checked on boot; older versions are migrated, a newer one triggers a
+     *     warning and requires factory reset
+     *   - v5: one record blob per namespace (v3/v4 stored one key per value)
      *
      * PM_PREFS_VERSION: Peripheral Mode schema (peripheral namespace)
      *   - Stored in 'peripheral' namespace
      *   - Independent versioning from NOM
+     *   - v3: record blob (v1/v2 stored one key per value)
      */
     namespace NVS {
-        constexpr uint8_t NOM_PREFS_VERSION = 4;  ///< Normal operating mode schema version
-        constexpr uint8_t PM_PREFS_VERSION = 2;   ///< Peripheral mode schema version
+        constexpr uint8_t NOM_PREFS_VERSION = 5;  ///< Normal operating mode schema version
+        constexpr uint8_t PM_PREFS_VERSION = 3;   ///< Peripheral mode schema version
     };
 
     // ============================================================================
@@ -137,6 +197,7 @@ namespace Config {
         constexpr const char *ID_PREFIX = "STAC";  ///< Global prefix for all STAC instances
         constexpr const char *BOARD_NAME = STAC_BOARD_NAME;
         constexpr const char *SOFTWARE_VERSION = BUILD_VERSION;  // From auto-generated build_info.h
+        constexpr const char *OTA_TARGET = STAC_OTA_TARGET;       ///< Board/build name used by OTA binaries and manifests
     }
 
 } // namespace Config
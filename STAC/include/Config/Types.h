@@ -72,6 +72,26 @@ enum class OperatingMode : uint8_t {
     PROVISIONING    // Configuration mode
 };
 
+/**
+ * @brief How a WiFi station connection was made
+ */
+enum class WiFiConnectPath : uint8_t {
+    NONE = 0,           // Not connected yet
+    SCAN,               // Full channel scan, DHCP
+    DIRECTED,           // Cached BSSID and channel, DHCP
+    DIRECTED_STATIC,    // Cached BSSID and channel, cached lease as static IP
+    FALLBACK_SCAN       // Directed attempt failed, then a full scan
+};
+
+/**
+ * @brief WiFi latency/power trade-off (stored as its value, append only)
+ */
+enum class PowerProfile : uint8_t {
+    BALANCED = 0,       // Modem sleep between polls, radio fully awake for each poll
+    LOW_LATENCY,        // No modem sleep
+    BATTERY_SAVER       // Long listen interval and low CPU clock between polls
+};
+
 // ============================================================================
 // STRUCTURES
 // ============================================================================
@@ -180,6 +200,27 @@ struct WiFiInfo {
     {}
 };
 
+/**
+ * @brief Last successful association, reused for a directed reconnect
+ *
+ * Plain data with no padding: it is kept in RTC memory and compared
+ * bytewise. Zero-initialise with `WiFiLink link = {};`.
+ */
+struct WiFiLink {
+    uint32_t ip;                    ///< DHCP lease: address (IPAddress as uint32_t)
+    uint32_t gateway;               ///< Gateway
+    uint32_t subnet;                ///< Subnet mask
+    uint32_t dns;                   ///< Primary DNS server
+    uint32_t ssidHash;              ///< CRC32 of the SSID this link belongs to, 0 = no link
+    uint8_t bssid[ 6 ];             ///< Access point joined
+    uint8_t channel;                ///< Its primary channel
+    uint8_t reserved;               ///< Keep zero
+
+    bool isValid() const {
+        return ssidHash != 0 && channel != 0;
+    }
+};
+
 /**
  * @brief Provisioning data from web configuration
  */
@@ -197,6 +238,8 @@ struct ProvisioningData {
     uint8_t maxHDMIChannel;         ///< Max HDMI channel (V-160HD)
     uint8_t maxSDIChannel;          ///< Max SDI channel (V-160HD)
     unsigned long pollInterval;     ///< Status polling interval in ms
+    String updateURL;               ///< Fleet update server base URL (empty = off)
+    PowerProfile powerProfile;      ///< WiFi latency/power trade-off
 
     // Default constructor
     ProvisioningData()
@@ -211,6 +254,8 @@ struct ProvisioningData {
         , maxHDMIChannel( 8 )
         , maxSDIChannel( 8 )
         , pollInterval( 300 )
+        , updateURL( "" )
+        , powerProfile( PowerProfile::BALANCED )
     {}
 };
 
@@ -34,6 +34,34 @@
     // Version string used by build system
     #define STAC_SOFTWARE_VERSION "3.0.0"
 
+    // Board/build name in OTA binary and fleet manifest names (e.g. "ATOM_Matrix_D3");
+    // set by scripts/custom_targets.py from the PlatformIO environment
+    #ifndef STAC_OTA_TARGET
+        #define STAC_OTA_TARGET "Unknown_Device"
+    #endif
+
+    // ============================================================================
+    // HARDWARE DISPATCH
+    // ============================================================================
+    // 1 = STACApp holds the board's concrete display/IMU classes, so calls are
+    //     bound at compile time (no vtable lookups on the hot paths)
+    // 0 = STACApp holds IDisplay/IIMU interface pointers (for mocks and host builds)
+
+    #ifndef STAC_STATIC_DISPATCH
+        #define STAC_STATIC_DISPATCH 1
+    #endif
+
+    // ============================================================================
+    // WIFI FAST RECONNECT
+    // ============================================================================
+    // 1 = a directed reconnect also reuses the last DHCP lease as a static address,
+    //     skipping DHCP. Only safe when the DHCP server reserves that address for
+    //     this STAC; otherwise leave at 0 (DHCP runs after every association)
+
+    #ifndef STAC_WIFI_REUSE_LEASE
+        #define STAC_WIFI_REUSE_LEASE 0
+    #endif
+
     // ============================================================================
     // COMPILE-TIME VALIDATION
     // ============================================================================
@@ -0,0 +1,176 @@
+#ifndef STAC_ANIMATOR_H
+#define STAC_ANIMATOR_H
+
+#include <cstdint>
+#include "IDisplay.h"
+
+
+namespace Display {
+
+    /**
+     * @brief What a keyframe does to the display when it starts
+     */
+    enum class KeyframeAction : uint8_t {
+        GLYPH,          ///< drawGlyph( glyph, foreground, background )
+        OVERLAY,        ///< drawGlyphOverlay( glyph, foreground )
+        FILL,           ///< fill( foreground )
+        CORNERS_ON,     ///< pulseCorners( glyph, true, foreground )
+        CORNERS_OFF,    ///< pulseCorners( glyph, false, foreground )
+        HOLD            ///< No content change (brightness only, or a pause)
+    };
+
+    /**
+     * @brief One step of an animation
+     *
+     * The action is applied when the keyframe starts and the display then
+     * holds for durationMs before the next keyframe starts.
+     */
+    struct Keyframe {
+        static constexpr int16_t KEEP_BRIGHTNESS = -1;
+
+        KeyframeAction action;
+        const uint8_t* glyph;
+        color_t foreground;
+        color_t background;
+        int16_t brightness;     ///< 0-255, or KEEP_BRIGHTNESS to leave it unchanged
+        uint16_t durationMs;
+    };
+
+    /**
+     * @brief Fixed-capacity, declarative keyframe sequence
+     *
+     * Built with the chainable helpers below, then handed to an Animator.
+     * No heap is used; keyframes past MAX_KEYFRAMES are dropped with an error.
+     *
+     * @code
+     * Animation armed;
+     * armed.glyph( cfgGlyph, ORANGE, BLACK, 500 ).flash( 4, 250, brightness );
+     * animator.play( armed, millis() );
+     * @endcode
+     */
+    class Animation {
+      public:
+        static constexpr uint8_t MAX_KEYFRAMES = 24;
+
+        Animation();
+
+        /**
+         * @brief Append a raw keyframe
+         * @param frame Keyframe to append
+         * @return true if there was room for it
+         */
+        bool add( const Keyframe &frame );
+
+        Animation &glyph( const uint8_t* glyph, color_t foreground, color_t background, uint16_t durationMs );
+        Animation &overlay( const uint8_t* glyph, color_t color, uint16_t durationMs );
+        Animation &fill( color_t color, uint16_t durationMs );
+        Animation &corners( const uint8_t* cornersGlyph, bool state, color_t color, uint16_t durationMs );
+        Animation &brightness( uint8_t brightness, uint16_t durationMs );
+        Animation &hold( uint16_t durationMs );
+
+        /**
+         * @brief Append the equivalent of IDisplay::flash()
+         * @param times Number of OFF/ON cycles
+         * @param interval Duration of each OFF and each ON phase (ms)
+         * @param brightness Brightness for the ON phase
+         */
+        Animation &flash( uint8_t times, uint16_t interval, uint8_t brightness );
+
+        uint8_t size() const {
+            return count;
+        }
+
+        const Keyframe &operator[]( uint8_t index ) const {
+            return frames[ index ];
+        }
+
+        /**
+         * @brief Total duration of one pass through the sequence
+         * @return Sum of all keyframe durations in ms
+         */
+        uint32_t durationMs() const;
+
+      private:
+        Keyframe frames[ MAX_KEYFRAMES ];
+        uint8_t count;
+    };
+
+    /**
+     * @brief Non-blocking player for Animation sequences
+     *
+     * Keyframe start times are derived from the time play() was called plus
+     * the accumulated durations, not from when update() happens to run, so
+     * timing does not drift with loop latency. If update() runs late, all
+     * keyframes that are due are applied and the display is shown once.
+     *
+     * The clock is passed in by the caller (normally millis()), so the same
+     * code can be driven from the main loop, a timer, or a virtual clock.
+     */
+    class Animator {
+      public:
+        static constexpr uint8_t REPEAT_FOREVER = 0;
+
+        /**
+         * @brief Construct an animator for a display
+         * @param display Display to animate (not owned)
+         */
+        explicit Animator( IDisplay* display );
+
+        /**
+         * @brief Start playing an animation (replaces any running animation)
+         * @param animation Sequence to play (copied)
+         * @param nowMs Current time in ms
+         * @param repeats Number of passes, or REPEAT_FOREVER
+         * @note The first keyframe is applied immediately
+         */
+        void play( const Animation &animation, unsigned long nowMs, uint8_t repeats = 1 );
+
+        /**
+         * @brief Stop the running animation
+         *
+         * Restores the brightness that was in effect when play() was called,
+         * so an animation cut short during an OFF phase does not leave the
+         * display dark. The display content is left as-is for the caller to redraw.
+         */
+        void stop();
+
+        /**
+         * @brief Advance the animation
+         * @param nowMs Current time in ms
+         * @return true while the animation is still running
+         */
+        bool update( unsigned long nowMs );
+
+        /**
+         * @brief Check if an animation is playing
+         * @return true if running
+         */
+        bool isRunning() const {
+            return running;
+        }
+
+      private:
+        IDisplay* display;
+        Animation animation;
+        uint8_t repeats;
+        uint8_t pass;
+        uint8_t index;
+        unsigned long nextFrameMs;
+        uint8_t startBrightness;
+        bool running;
+
+        /**
+         * @brief Apply a keyframe's action and brightness without showing
+         * @param frame Keyframe to apply
+         * @return true if the display needs a show() to make the change visible
+         */
+        bool applyFrame( const Keyframe &frame );
+    };
+
+} // namespace Display
+
+
+#endif // STAC_ANIMATOR_H
+
+
+//  --- EOF --- //
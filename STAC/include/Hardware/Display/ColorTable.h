@@ -0,0 +1,193 @@
+#ifndef STAC_COLOR_TABLE_H
+#define STAC_COLOR_TABLE_H
+
+#include <cstdint>
+#include "Colors.h"
+#include "Config/Constants.h"
+
+
+namespace Display {
+
+    /**
+     * @brief Order an LED strip clocks the colour bytes out in
+     */
+    enum class WireOrder : uint8_t {
+        RGB,
+        GRB         // WS2812
+    };
+
+    /**
+     * @brief Scale one colour byte by a brightness value, as LiteLED does on show()
+     *
+     * LiteLED uses FastLED's "video" scaling: a lit channel stays lit at
+     * any non-zero brightness, and 255 leaves it unchanged.
+     * @param channel Colour byte
+     * @param brightness 0-255
+     * @return Scaled byte
+     */
+    constexpr uint8_t scaleChannel( uint8_t channel, uint8_t brightness ) {
+        return static_cast<uint8_t>( ( ( channel * brightness ) >> 8 ) + ( ( channel != 0 && brightness != 0 ) ? 1 : 0 ) );
+    }
+
+    /**
+     * @brief The bytes a strip clocks out for a colour at a brightness
+     * @param color 24-bit RGB colour
+     * @param brightness 0-255
+     * @param order Byte order of the strip
+     * @return Wire bytes, first out in bits 23-16 (0x00GGRRBB for GRB)
+     */
+    constexpr uint32_t toWire( color_t color, uint8_t brightness, WireOrder order ) {
+        return order == WireOrder::GRB ?
+               ( ( uint32_t )scaleChannel( ( color >> 8 ) & 0xFF, brightness ) << 16 ) |
+               ( ( uint32_t )scaleChannel( ( color >> 16 ) & 0xFF, brightness ) << 8 ) |
+               scaleChannel( color & 0xFF, brightness ) :
+               ( ( uint32_t )scaleChannel( ( color >> 16 ) & 0xFF, brightness ) << 16 ) |
+               ( ( uint32_t )scaleChannel( ( color >> 8 ) & 0xFF, brightness ) << 8 ) |
+               scaleChannel( color & 0xFF, brightness );
+    }
+
+    /**
+     * @brief Convert a 24-bit RGB colour to RGB565
+     * @param color 24-bit RGB colour
+     * @return 16-bit RGB565 value
+     */
+    constexpr uint16_t toRGB565( color_t color ) {
+        return static_cast<uint16_t>( ( ( ( color >> 16 ) & 0xF8 ) << 8 ) |
+                                      ( ( ( color >> 8 ) & 0xFC ) << 3 ) |
+                                      ( ( color & 0xFF ) >> 3 ) );
+    }
+
+    /**
+     * @brief Wire-format values of the fixed colour palette, built at compile time
+     *
+     * For the LED displays there is one row per BRIGHTNESS_MAP level and
+     * wire order, holding the bytes LiteLED would clock out for each
+     * palette colour at that level. A brightness change only swaps the row
+     * pointer. Colours outside the palette, and brightness values not in
+     * the map (pulse dimming), fall back to toWire().
+     *
+     * TFT brightness is the backlight, not the pixel values, so the RGB565
+     * row is the same at every level.
+     */
+    namespace ColorTable {
+
+        constexpr color_t PALETTE[] = {
+            StandardColors::BLACK,
+            StandardColors::WHITE,
+            StandardColors::RED,
+            StandardColors::GREEN,
+            StandardColors::BLUE,
+            StandardColors::LIGHT_GREEN,
+            StandardColors::BRIGHT_GREEN,
+            StandardColors::PURPLE,
+            StandardColors::ORANGE,
+            StandardColors::YELLOW,
+            StandardColors::DARK_BLUE,
+            StandardColors::DARK_GREEN,
+            StandardColors::DARK_ORANGE,
+            StandardColors::DARK_PURPLE,
+            StandardColors::TEAL,
+            StandardColors::DARK_TEAL,
+            StandardColors::PINK
+        };
+        constexpr uint8_t PALETTE_SIZE = sizeof( PALETTE ) / sizeof( PALETTE[ 0 ] );
+        constexpr uint8_t LEVEL_COUNT = Config::Display::BRIGHTNESS_LEVELS + 1;
+        constexpr uint8_t ORDER_COUNT = 2;
+
+        struct WireLevels {
+            uint32_t row[ ORDER_COUNT ][ LEVEL_COUNT ][ PALETTE_SIZE ];
+        };
+
+        struct RGB565Row {
+            uint16_t entry[ PALETTE_SIZE ];
+        };
+
+        constexpr WireLevels buildWireLevels() {
+            WireLevels levels{};
+            for ( uint8_t order = 0; order < ORDER_COUNT; order++ ) {
+                for ( uint8_t level = 0; level < LEVEL_COUNT; level++ ) {
+                    for ( uint8_t i = 0; i < PALETTE_SIZE; i++ ) {
+                        levels.row[ order ][ level ][ i ] = toWire( PALETTE[ i ], Config::Display::BRIGHTNESS_MAP[ level ],
+                                                                   static_cast<WireOrder>( order ) );
+                    }
+                }
+            }
+            return levels;
+        }
+
+        constexpr RGB565Row buildRGB565Row() {
+            RGB565Row row{};
+            for ( uint8_t i = 0; i < PALETTE_SIZE; i++ ) {
+                row.entry[ i ] = toRGB565( PALETTE[ i ] );
+            }
+            return row;
+        }
+
+        constexpr WireLevels WIRE = buildWireLevels();
+        constexpr RGB565Row RGB565 = buildRGB565Row();
+
+        constexpr bool inPalette( color_t color ) {
+            for ( uint8_t i = 0; i < PALETTE_SIZE; i++ ) {
+                if ( PALETTE[ i ] == color ) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Find the LED row for a brightness value
+         * @param brightness 0-255
+         * @param order Byte order of the strip
+         * @return Row of PALETTE_SIZE wire values, or nullptr if brightness is not in the map
+         */
+        inline const uint32_t* wireRow( uint8_t brightness, WireOrder order ) {
+            for ( uint8_t level = 0; level < LEVEL_COUNT; level++ ) {
+                if ( Config::Display::BRIGHTNESS_MAP[ level ] == brightness ) {
+                    return WIRE.row[ static_cast<uint8_t>( order ) ][ level ];
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Find the TFT row for a brightness value
+         * @param brightness 0-255 (backlight only)
+         * @return Row of PALETTE_SIZE RGB565 values, shared by every brightness
+         */
+        inline const uint16_t* rgb565Row( uint8_t brightness ) {
+            ( void )brightness;
+            return RGB565.entry;
+        }
+
+        /**
+         * @brief Find a colour in the palette
+         * @param color 24-bit RGB colour
+         * @return Palette index, or -1 if the colour is not in the palette
+         */
+        inline int8_t paletteIndex( color_t color ) {
+            for ( uint8_t i = 0; i < PALETTE_SIZE; i++ ) {
+                if ( PALETTE[ i ] == color ) {
+                    return static_cast<int8_t>( i );
+                }
+            }
+            return -1;
+        }
+
+        // Every semantic colour must resolve to a table entry
+        static_assert( inPalette( STACColors::PROGRAM ) && inPalette( STACColors::PREVIEW ) &&
+                       inPalette( STACColors::UNSELECTED ) && inPalette( STACColors::WARNING ) &&
+                       inPalette( STACColors::ALERT ) && inPalette( STACColors::GTG ) &&
+                       inPalette( STACColors::POWER_ON ) && inPalette( STACColors::HDMI_VALUE ) &&
+                       inPalette( STACColors::SDI_VALUE ) && inPalette( STACColors::AUTOSTART_PULSE ),
+                       "STACColors entry missing from ColorTable::PALETTE" );
+        static_assert( PALETTE_SIZE < 128, "Palette index must fit an int8_t" );
+    }
+
+} // namespace Display
+
+
+#endif // STAC_COLOR_TABLE_H
+
+
+//  --- EOF --- //
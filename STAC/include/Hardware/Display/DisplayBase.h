@@ -2,6 +2,7 @@
 #define STAC_DISPLAY_BASE_H
 
 #include "IDisplay.h"
+#include "ColorTable.h"
 #include <LiteLED.h>
 #include <Arduino.h>
 
@@ -41,11 +42,24 @@ namespace Display {
      */
     class DisplayBase : public IDisplay {
       protected:
+        static constexpr uint8_t MAX_LEDS = 64;             ///< Largest supported matrix (8x8)
+        static constexpr uint32_t LED_WIRE_US_PER_LED = 30;  ///< 24 bits @ 800 kHz
+        static constexpr uint32_t LED_LATCH_US = 300;       ///< Reset/latch low time after a frame
+
         LiteLED display;
         uint8_t pin;
         uint8_t numLeds;
         uint8_t currentBrightness;
 
+        WireOrder order;                    ///< Byte order of the strip, applied by ColorTable
+        const uint32_t* levelRow;           ///< ColorTable row for currentBrightness (nullptr if off-map)
+        color_t frame[ MAX_LEDS ];          ///< Colours of the frame being built, before scaling
+        color_t sentFrame[ MAX_LEDS ];      ///< Content of the last frame put on the wire
+        uint8_t sentBrightness;             ///< Brightness of the last frame put on the wire
+        bool sentValid;                     ///< sentFrame holds a real frame
+        int64_t transferDoneAtUs;           ///< esp_timer time the last transfer completes
+        DisplayStats stats;
+
         /**
          * @brief Constructor for derived classes
          * @param pin GPIO pin for LED data
@@ -70,6 +84,24 @@ namespace Display {
          */
         bool isValidPosition( uint8_t position ) const;
 
+        /**
+         * @brief Write a pixel to the frame (converted and handed to LiteLED on show())
+         * @param position Position in LED strip (must be valid)
+         * @param color Color value
+         */
+        void writePixel( uint8_t position, color_t color );
+
+        /**
+         * @brief Load the frame into LiteLED as wire bytes for the current brightness
+         */
+        void loadWireFrame();
+
+        /**
+         * @brief Wait for the previous frame to finish clocking out, if still in flight
+         * @return true if the caller had to wait
+         */
+        bool waitForTransfer();
+
       public:
         virtual ~DisplayBase() = default;
 
@@ -88,6 +120,13 @@ namespace Display {
         void pulseDisplay( const uint8_t* glyph, color_t foreground, color_t background,
                            bool& pulseState, uint8_t normalBrightness, uint8_t dimBrightness ) override;
         void pulseCorners( const uint8_t* cornersGlyph, bool state, color_t color ) override;
+        DisplayStats getStats() const override;
+
+        /**
+         * @brief Check whether the last frame has finished clocking out to the LEDs
+         * @return true if a new frame can be sent without waiting
+         */
+        bool isTransferComplete() const;
 
         // Size-specific methods must be implemented by derived classes
         // getWidth(), getHeight(), getPixelCount() - dimension-specific
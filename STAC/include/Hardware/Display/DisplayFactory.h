@@ -23,6 +23,17 @@
 
 namespace Display {
 
+    /**
+     * @brief Concrete display class for the configured board
+     */
+    #if defined(DISPLAY_TYPE_TFT)
+    using BoardDisplay = DisplayTFT;
+    #elif defined(GLYPH_WIDTH_5)
+    using BoardDisplay = Display5x5;
+    #elif defined(GLYPH_WIDTH_8)
+    using BoardDisplay = Display8x8;
+    #endif
+
     /**
      * @brief Factory for creating display instances
      *
@@ -36,6 +47,17 @@ namespace Display {
          * @return Unique pointer to IDisplay implementation
          */
         static std::unique_ptr<IDisplay> create() {
+            return createBoard();
+        }
+
+        /**
+         * @brief Create the board's display as its concrete type
+         *
+         * Calls made through the returned pointer bind at compile time
+         * (BoardDisplay is final), see STAC_STATIC_DISPATCH.
+         * @return Unique pointer to BoardDisplay
+         */
+        static std::unique_ptr<BoardDisplay> createBoard() {
             #if defined(DISPLAY_TYPE_TFT)
             return std::make_unique<DisplayTFT>(
                        DISPLAY_WIDTH,
@@ -0,0 +1,109 @@
+#ifndef STAC_DISPLAY_SCENE_H
+#define STAC_DISPLAY_SCENE_H
+
+#include <cstdint>
+#include "IDisplay.h"
+
+
+namespace Display {
+
+    /**
+     * @brief Compact description of a full-screen display state
+     *
+     * Two scenes that compare equal produce identical pixels, so a
+     * redraw of the scene already on screen can be skipped.
+     */
+    struct DisplayScene {
+        uint8_t id = 0;                     ///< Caller-defined scene identifier (e.g. tally state)
+        const uint8_t* glyph = nullptr;     ///< Base glyph, or nullptr for a solid fill
+        color_t foreground = 0;             ///< Glyph foreground colour
+        color_t background = 0;             ///< Fill or glyph background colour
+        const uint8_t* overlay = nullptr;   ///< Overlay glyph, or nullptr for none
+        color_t overlayColor = 0;           ///< Overlay colour
+        uint8_t brightness = 0;             ///< Display brightness
+
+        bool operator==( const DisplayScene& other ) const {
+            return id == other.id && glyph == other.glyph &&
+                   foreground == other.foreground && background == other.background &&
+                   overlay == other.overlay && overlayColor == other.overlayColor &&
+                   brightness == other.brightness;
+        }
+
+        bool operator!=( const DisplayScene& other ) const {
+            return !( *this == other );
+        }
+    };
+
+    /**
+     * @brief Redraw counters reported by SceneTracker
+     */
+    struct SceneCounters {
+        uint32_t redrawsPerformed = 0;      ///< Scenes drawn and shown
+        uint32_t redrawsSuppressed = 0;     ///< Scenes skipped because they were already on screen
+    };
+
+    /**
+     * @brief Remembers which scene is on a display so identical redraws can be skipped
+     *
+     * Anything else that reaches the panel goes through IDisplay::show(),
+     * which bumps DisplayStats::showRequests. The tracker records that count
+     * when a scene is shown, so any other drawing in between (animations,
+     * error glyphs, brightness flashes) makes the next redraw go ahead.
+     */
+    class SceneTracker {
+      public:
+        /**
+         * @brief Check whether a scene is still exactly what the display shows
+         * @param display Display the scene would be drawn on
+         * @param scene Requested scene
+         * @return true if the redraw can be skipped (counted as suppressed)
+         */
+        bool isShown( const IDisplay& display, const DisplayScene& scene ) {
+            if ( valid && scene == shown && display.getStats().showRequests == shownAtShowRequest ) {
+                counters.redrawsSuppressed++;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Record a scene that has just been drawn and shown
+         * @param display Display the scene was shown on
+         * @param scene Scene now on screen
+         */
+        void markShown( const IDisplay& display, const DisplayScene& scene ) {
+            shown = scene;
+            shownAtShowRequest = display.getStats().showRequests;
+            valid = true;
+            counters.redrawsPerformed++;
+        }
+
+        /**
+         * @brief Forget the current scene so the next request always redraws
+         */
+        void invalidate() {
+            valid = false;
+        }
+
+        /**
+         * @brief Get redraw counters
+         * @return Performed and suppressed redraw counts
+         */
+        SceneCounters getCounters() const {
+            return counters;
+        }
+
+      private:
+        DisplayScene shown;
+        uint32_t shownAtShowRequest = 0;
+        bool valid = false;
+        SceneCounters counters;
+    };
+
+} // namespace Display
+
+
+#endif // STAC_DISPLAY_SCENE_H
+
+
+//  --- EOF --- //
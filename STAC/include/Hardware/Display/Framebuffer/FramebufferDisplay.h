@@ -0,0 +1,149 @@
+#ifndef STAC_FRAMEBUFFER_DISPLAY_H
+#define STAC_FRAMEBUFFER_DISPLAY_H
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "Hardware/Display/IDisplay.h"
+
+
+namespace Display {
+
+    /**
+     * @brief In-memory IDisplay with no hardware behind it
+     *
+     * Renders into an RGB framebuffer with the same geometry as a board's
+     * display, so rendering paths can be exercised and measured without
+     * LiteLED or Arduino_GFX:
+     * - Drawing goes to a back buffer; show() copies it to the front buffer
+     *   (what the panel would be showing), which is what dumpPPM() writes
+     * - Every draw call, pixel write and show() is counted
+     * - flash() applies its end state immediately instead of blocking
+     *
+     * Two glyph formats are supported, matching the real displays:
+     * - Matrix geometry (width * height <= MAX_MATRIX_PIXELS): glyphs are
+     *   unpacked bitmaps, one byte per pixel, exactly as DisplayBase draws them
+     * - TFT geometry: glyphs are 1-byte index stubs; the glyph is rendered as a
+     *   centred foreground block on the background and its index is recorded
+     *   in getLastGlyphIndex() so callers can check which glyph was requested
+     */
+    class FramebufferDisplay : public IDisplay {
+      public:
+        static constexpr uint16_t MAX_MATRIX_PIXELS = 64;   ///< Largest LED matrix (8x8)
+
+        /**
+         * @brief Rendering work counters
+         */
+        struct RenderCounters {
+            uint32_t drawCalls = 0;         ///< Public drawing calls (fill, drawGlyph, setPixel...)
+            uint32_t pixelsWritten = 0;     ///< Individual framebuffer pixel writes
+            uint32_t showCalls = 0;         ///< Calls to show() (explicit or via show = true)
+        };
+
+        /**
+         * @brief Construct a framebuffer display
+         * @param width Width in pixels
+         * @param height Height in pixels
+         */
+        FramebufferDisplay( uint16_t width, uint16_t height );
+
+        /**
+         * @brief Create a framebuffer display with the geometry of the configured board
+         * @return Framebuffer display sized like the board's physical display
+         */
+        static std::unique_ptr<FramebufferDisplay> createForBoard();
+
+        // IDisplay
+        bool begin() override;
+        void clear( bool show = true ) override;
+        void setPixel( uint8_t position, color_t color, bool show = true ) override;
+        void setPixelXY( uint8_t x, uint8_t y, color_t color, bool show = true ) override;
+        void fill( color_t color, bool show = true ) override;
+        void drawGlyph( const uint8_t* glyph, color_t foreground, color_t background, bool show = true ) override;
+        void setBrightness( uint8_t brightness, bool show = true ) override;
+        uint8_t getBrightness() const override;
+        void show() override;
+        void flash( uint8_t times, uint16_t interval, uint8_t brightness ) override;
+        void drawGlyphOverlay( const uint8_t* glyph, color_t color, bool show = true ) override;
+        void pulseCorners( const uint8_t* cornersGlyph, bool state, color_t color ) override;
+        void pulseDisplay( const uint8_t* glyph, color_t foreground, color_t background,
+                           bool& pulseState, uint8_t normalBrightness, uint8_t dimBrightness ) override;
+        uint8_t getWidth() const override;
+        uint8_t getHeight() const override;
+        uint8_t getPixelCount() const override;
+        DisplayStats getStats() const override;
+
+        /**
+         * @brief Read a pixel of the shown frame
+         * @param x X coordinate
+         * @param y Y coordinate
+         * @return Color of the pixel at the last show(), BLACK if out of range
+         */
+        color_t getShownPixel( uint16_t x, uint16_t y ) const;
+
+        /**
+         * @brief Get the brightness in effect at the last show()
+         * @return Brightness (0-255)
+         */
+        uint8_t getShownBrightness() const {
+            return shownBrightness;
+        }
+
+        /**
+         * @brief Get the index of the last TFT-style glyph drawn
+         * @return Glyph index (glyph[0]), or 0xFF if none drawn yet or matrix geometry
+         */
+        uint8_t getLastGlyphIndex() const {
+            return lastGlyphIndex;
+        }
+
+        const RenderCounters &getCounters() const {
+            return counters;
+        }
+
+        /**
+         * @brief Reset render counters and frame statistics to zero
+         */
+        void resetCounters();
+
+        /**
+         * @brief Write the shown frame as a binary PPM (P6) image
+         * @param file Open file to write to
+         * @param scale Integer upscale factor (e.g. 20 to make a 5x5 matrix viewable)
+         * @return true if the whole image was written
+         */
+        bool dumpPPM( FILE* file, uint8_t scale = 1 ) const;
+
+        /**
+         * @brief Write the shown frame as a binary PPM (P6) file
+         * @param path File path to create/overwrite
+         * @param scale Integer upscale factor
+         * @return true if the file was written
+         */
+        bool dumpPPM( const char* path, uint8_t scale = 1 ) const;
+
+      private:
+        uint16_t width;
+        uint16_t height;
+        bool matrixGeometry;
+        std::vector<color_t> backBuffer;
+        std::vector<color_t> frontBuffer;
+        uint8_t brightness;
+        uint8_t shownBrightness;
+        uint8_t lastGlyphIndex;
+        RenderCounters counters;
+        DisplayStats stats;
+
+        void writePixel( uint32_t index, color_t color );
+        void fillRect( uint16_t x, uint16_t y, uint16_t w, uint16_t h, color_t color );
+        void fillCentredSquare( uint16_t size, color_t color );
+    };
+
+} // namespace Display
+
+
+#endif // STAC_FRAMEBUFFER_DISPLAY_H
+
+
+//  --- EOF --- //
@@ -8,6 +8,19 @@
 
 namespace Display {
 
+    /**
+     * @brief Frame update counters reported by a display implementation
+     *
+     * Lets the application (and the serial log) see how many updates
+     * reached the hardware versus how many were dropped as redundant.
+     */
+    struct DisplayStats {
+        uint32_t showRequests = 0;      ///< Calls to show() (explicit or via show = true)
+        uint32_t framesSent = 0;        ///< Frames actually pushed to the hardware
+        uint32_t framesSkipped = 0;     ///< Frames dropped because content was unchanged
+        uint32_t framesCoalesced = 0;   ///< Frames that had to wait for the previous transfer
+    };
+
     /**
      * @brief Abstract interface for STAC display devices
      *
@@ -87,7 +100,8 @@ namespace Display {
          * @param times Number of times to flash
          * @param interval Duration in milliseconds for each on/off cycle
          * @param brightness Brightness level during "on" phase (0-255)
-         * @note This is a blocking operation
+         * @note This is a blocking operation - use Animation::flash() with
+         *       an Animator where the main loop must keep running
          */
         virtual void flash( uint8_t times, uint16_t interval, uint8_t brightness ) = 0;
 
@@ -174,6 +188,15 @@ namespace Display {
         virtual void setInitialRotation( uint8_t rotation ) {
             ( void )rotation;
         }
+
+        /**
+         * @brief Get frame update counters
+         * @return Snapshot of the display's frame statistics
+         * @note Default implementation returns all zeros (for displays that don't track them)
+         */
+        virtual DisplayStats getStats() const {
+            return DisplayStats();
+        }
     };
 
 } // namespace Display
@@ -12,7 +12,7 @@ namespace Display {
      * Inherits from DisplayBase and only implements size-specific methods.
      * Uses unpacked glyph format (25 bytes per glyph, 1 byte per pixel).
      */
-    class Display5x5 : public DisplayBase {
+    class Display5x5 final : public DisplayBase {
       public:
         /**
          * @brief Construct a new Display5x5 object
@@ -12,7 +12,7 @@ namespace Display {
      * Inherits from DisplayBase and only implements size-specific methods.
      * Uses unpacked glyph format (64 bytes per glyph, 1 byte per pixel).
      */
-    class Display8x8 : public DisplayBase {
+    class Display8x8 final : public DisplayBase {
       public:
         /**
          * @brief Construct a new Display8x8 object
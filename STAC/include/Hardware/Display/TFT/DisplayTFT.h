@@ -19,8 +19,15 @@
 #pragma once
 
 #include "../IDisplay.h"
+#include "../ColorTable.h"
 #include "Config/Types.h"  // For Orientation enum
 #include <Arduino_GFX_Library.h>
+#include "Hardware/Display/TFT/PaletteCanvas.h"
+
+// Off-screen canvas format: 1 = 4-bit PaletteCanvas (default), 0 = RGB565 Arduino_Canvas
+#ifndef TFT_CANVAS_PALETTE
+    #define TFT_CANVAS_PALETTE 1
+#endif
 
 // Conditionally include AXP192 PMU for boards that use PMU-controlled backlight
 #if defined(DISPLAY_BACKLIGHT_PMU)
@@ -29,6 +36,14 @@
 
 namespace Display {
 
+    struct AtlasGlyph;
+
+    #if TFT_CANVAS_PALETTE
+    using TFTCanvas = PaletteCanvas;
+    #else
+    using TFTCanvas = Arduino_Canvas;
+    #endif
+
     /**
      * @brief TFT display implementation for M5StickC Plus, LilyGo T-Display, etc.
      *
@@ -40,7 +55,7 @@ namespace Display {
      * - Brightness controlled via PMU or PWM backlight, not LED current
      * - Uses sprite buffering for flicker-free updates
      */
-    class DisplayTFT : public IDisplay {
+    class DisplayTFT final : public IDisplay {
       public:
         /**
          * @brief Construct a TFT display
@@ -72,6 +87,7 @@ namespace Display {
         uint8_t getWidth() const override;
         uint8_t getHeight() const override;
         uint8_t getPixelCount() const override;
+        DisplayStats getStats() const override;
 
         // ====================================================================
         // TFT-Specific Methods
@@ -94,21 +110,24 @@ namespace Display {
         void drawChannelNumber( uint8_t channel, color_t color, color_t bgColor );
 
         /**
-         * @brief Draw WiFi icon using primitives
+         * @brief Draw WiFi icon from the glyph atlas (or primitives)
          * @param x Center X position
          * @param y Center Y position
          * @param color Icon color
          * @param connected If true, show connected state; if false, show searching
+         * @param bgColor Background the anti-aliased edges are blended with
          */
-        void drawWiFiIcon( int16_t x, int16_t y, color_t color, bool connected = true );
+        void drawWiFiIcon( int16_t x, int16_t y, color_t color, bool connected = true,
+                           color_t bgColor = StandardColors::BLACK );
 
         /**
-         * @brief Draw configuration/gear icon using primitives
+         * @brief Draw configuration/gear icon from the glyph atlas (or primitives)
          * @param x Center X position
          * @param y Center Y position
          * @param color Icon color
+         * @param bgColor Background the anti-aliased edges are blended with
          */
-        void drawConfigIcon( int16_t x, int16_t y, color_t color );
+        void drawConfigIcon( int16_t x, int16_t y, color_t color, color_t bgColor = StandardColors::BLACK );
 
         /**
          * @brief Draw update/download icon using primitives
@@ -185,7 +204,30 @@ namespace Display {
       private:
         // Arduino_GFX display and canvas objects
         Arduino_GFX *_gfx;        // Main display instance
-        Arduino_Canvas *_canvas;  // Off-screen buffer for flicker-free updates
+        TFTCanvas *_canvas;       // Off-screen buffer for flicker-free updates
+
+        /**
+         * @brief Solid-colour frame drawn straight to the panel
+         *
+         * Tally frames are a full-screen fill plus at most one small
+         * rectangle (the power indicator). fill() and rectangle overlays
+         * only record them here; show() then issues hardware fills for the
+         * frame and skips the canvas. The canvas is only filled in
+         * (materializeSolidFrame) when something else has to draw on top.
+         */
+        struct SolidFrame {
+            bool active = false;        // Frame is described here; canvas content is stale
+            bool dirty = false;         // Changed since it was last pushed to the panel
+            bool hasOverlay = false;
+            uint16_t fill = 0;
+            uint16_t overlay = 0;
+            int16_t x = 0;
+            int16_t y = 0;
+            int16_t w = 0;
+            int16_t h = 0;
+        };
+        SolidFrame _solid;
+        DisplayStats _stats;
 
         // Power management (backlight control) - only for boards with PMU
         #if defined(DISPLAY_BACKLIGHT_PMU)
@@ -197,9 +239,17 @@ namespace Display {
         uint16_t _height;
         uint8_t _brightness;
         uint8_t _rotation;
+        const uint16_t* _rgb565Row;     // ColorTable row for _brightness
 
         // Internal helpers
-        uint16_t colorToRGB565( color_t color ) const;
+        bool createCanvas();
+        bool overlaySolidFrame( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color );
+        void materializeSolidFrame();
+        void pushSolidFrame();
+        uint16_t colorToRGB565( color_t color ) const {
+            int8_t index = ColorTable::paletteIndex( color );
+            return index >= 0 ? _rgb565Row[ index ] : toRGB565( color );
+        }
         void updateBacklight();
 
         // Rotation-aware dimension helpers
@@ -208,6 +258,11 @@ namespace Display {
 
         // Note: Font remapping moved to global remapCharToSTACSansFont() in STACSansBold24pt7b.h
 
+        // Glyph atlas blitter (GlyphAtlasTFT.h)
+        void drawAtlasGlyph( const AtlasGlyph &glyph, int16_t x, int16_t y, uint16_t fg, uint16_t bg );
+        void drawAtlasDigits( const char *digits, uint8_t size, uint16_t fg, uint16_t bg );
+        static uint16_t blendRGB565( uint16_t fg, uint16_t bg, uint8_t alpha );
+
         // Icon drawing helpers (primitives)
         void drawArc( int16_t cx, int16_t cy, int16_t r, float startAngle, float endAngle,
                       uint16_t color, uint8_t thickness = 2 );
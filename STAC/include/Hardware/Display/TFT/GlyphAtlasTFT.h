@@ -0,0 +1,785 @@
+/**
+ * @file GlyphAtlasTFT.h
+ * @brief Pre-rasterised, anti-aliased TFT digits and icons
+ *
+ * GENERATED by scripts/build_glyph_atlas.py - DO NOT EDIT
+ * Source hash: 1efb3e2a051a18278cdc54c85b6ec60a
+ *
+ * Glyph data is 2-bit alpha, run-length encoded: each byte is
+ * (alpha << 6) | (run - 1); runs continue across rows.
+ *
+ * Flash footprint:
+ *   Digits, text size 1:    816 bytes
+ *   Digits, text size 2:   2423 bytes
+ *   Digits, text size 3:   3271 bytes
+ *   Icon config:               623 bytes
+ *   Icon wifi:                 786 bytes
+ *   Icon wifiSmall:            407 bytes
+ *   Total RLE data:        8326 bytes (+ 264 bytes glyph table)
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace Display {
+
+    /**
+     * @brief One atlas glyph
+     *
+     * The top-left pixel is drawn at (originX + xOffset, originY + yOffset).
+     * For digits the origin is the text cursor (baseline), as for GFX fonts;
+     * for icons it is the icon centre.
+     */
+    struct AtlasGlyph {
+        uint16_t offset;    ///< Start of this glyph's runs in GlyphAtlasData
+        uint8_t width;
+        uint8_t height;
+        int16_t xOffset;
+        int16_t yOffset;
+        uint8_t xAdvance;   ///< Cursor advance (digits only)
+    };
+
+    const uint8_t GlyphAtlasData[] PROGMEM = {
+        0x07, 0xC7, 0x0D, 0xCB, 0x09, 0xCF, 0x06, 0xD1, 0x05, 0xD1, 0x04, 0xD3,
+        0x03, 0xC7, 0x03, 0xC7, 0x02, 0xC7, 0x05, 0xC7, 0x01, 0xC6, 0x07, 0xC6,
+        0x01, 0xC6, 0x07, 0xC6, 0x01, 0xC6, 0x07, 0xC6, 0x00, 0xC6, 0x09, 0xCD,
+        0x09, 0xCD, 0x09, 0xCD, 0x09, 0xCD, 0x09, 0xCD, 0x09, 0xCD, 0x09, 0xCD,
+        0x09, 0xCD, 0x09, 0xCD, 0x09, 0xCD, 0x09, 0xCD, 0x09, 0xCD, 0x09, 0xC6,
+        0x00, 0xC6, 0x07, 0xC6, 0x01, 0xC6, 0x07, 0xC6, 0x01, 0xC6, 0x07, 0xC6,
+        0x01, 0xC7, 0x05, 0xC7, 0x02, 0xC7, 0x03, 0xC7, 0x03, 0xD3, 0x04, 0xD1,
+        0x05, 0xD1, 0x06, 0xCF, 0x09, 0xCB, 0x0D, 0xC7, 0x07, 0x09, 0xC3, 0x08,
+        0xC4, 0x08, 0xC4, 0x07, 0xC5, 0x06, 0xC6, 0x03, 0xFF, 0xC1, 0x06, 0xC6,
+        0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6,
+        0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6,
+        0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6,
+        0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC6, 0x06, 0xC7, 0x0C, 0xCC,
+        0x08, 0xCE, 0x06, 0xD0, 0x04, 0xD2, 0x02, 0xD4, 0x01, 0xC7, 0x04, 0xC7,
+        0x00, 0xC7, 0x06, 0xCE, 0x07, 0xCE, 0x08, 0xCD, 0x08, 0xCD, 0x08, 0xC6,
+        0x0F, 0xC6, 0x0F, 0xC6, 0x0E, 0xC7, 0x0E, 0xC6, 0x0E, 0xC7, 0x0D, 0xC7,
+        0x0C, 0xC8, 0x0C, 0xC8, 0x0C, 0xC7, 0x0C, 0xC8, 0x0C, 0xC7, 0x0D, 0xC7,
+        0x0D, 0xC7, 0x0D, 0xC7, 0x0E, 0xC6, 0x0E, 0xC6, 0x0F, 0xD4, 0x01, 0xD4,
+        0x00, 0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x06, 0xC7, 0x0C, 0xCC,
+        0x07, 0xCF, 0x05, 0xD1, 0x03, 0xD3, 0x02, 0xD3, 0x02, 0xC7, 0x03, 0xC8,
+        0x00, 0xC7, 0x05, 0xC7, 0x00, 0xC6, 0x07, 0xC6, 0x00, 0xC6, 0x07, 0xC6,
+        0x00, 0xC6, 0x07, 0xC6, 0x0F, 0xC6, 0x0F, 0xC5, 0x0F, 0xC6, 0x0E, 0xC6,
+        0x0C, 0xC8, 0x0D, 0xC7, 0x0E, 0xC8, 0x0D, 0xCA, 0x0E, 0xC8, 0x0F, 0xC6,
+        0x0F, 0xC7, 0x0F, 0xC6, 0x0F, 0xC6, 0x0F, 0xCD, 0x08, 0xCD, 0x07, 0xCF,
+        0x06, 0xC7, 0x00, 0xC7, 0x04, 0xC7, 0x01, 0xD4, 0x01, 0xD3, 0x03, 0xD1,
+        0x05, 0xCF, 0x08, 0xCC, 0x0B, 0xC7, 0x07, 0x0A, 0xC7, 0x0D, 0xC7, 0x0C,
+        0xC8, 0x0C, 0xC8, 0x0B, 0xC9, 0x0A, 0xCA, 0x0A, 0xCA, 0x09, 0xC3, 0x00,
+        0xC6, 0x09, 0xC3, 0x00, 0xC6, 0x08, 0xC3, 0x01, 0xC6, 0x07, 0xC3, 0x02,
+        0xC6, 0x07, 0xC3, 0x02, 0xC6, 0x06, 0xC3, 0x03, 0xC6, 0x06, 0xC2, 0x04,
+        0xC6, 0x05, 0xC3, 0x04, 0xC6, 0x05, 0xC2, 0x05, 0xC6, 0x04, 0xC3, 0x05,
+        0xC6, 0x03, 0xC3, 0x06, 0xC6, 0x03, 0xC2, 0x07, 0xC6, 0x02, 0xC3, 0x07,
+        0xC6, 0x02, 0xFF, 0xFF, 0xC3, 0x0B, 0xC6, 0x0E, 0xC6, 0x0E, 0xC6, 0x0E,
+        0xC6, 0x0E, 0xC6, 0x0E, 0xC6, 0x0E, 0xC6, 0x02, 0x02, 0xD2, 0x03, 0xD2,
+        0x03, 0xD2, 0x03, 0xD2, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xC4, 0x11, 0xC4,
+        0x11, 0xC4, 0x11, 0xC3, 0x11, 0xC4, 0x02, 0xC5, 0x08, 0xC4, 0x00, 0xCA,
+        0x05, 0xD1, 0x04, 0xD2, 0x03, 0xD3, 0x01, 0xD4, 0x01, 0xC6, 0x05, 0xC8,
+        0x0E, 0xC7, 0x0F, 0xC7, 0x0F, 0xC6, 0x0F, 0xC6, 0x0F, 0xC6, 0x0F, 0xC6,
+        0x0F, 0xC6, 0x0F, 0xCC, 0x08, 0xCE, 0x06, 0xC7, 0x00, 0xC7, 0x04, 0xC8,
+        0x00, 0xD4, 0x02, 0xD3, 0x03, 0xD1, 0x05, 0xCE, 0x08, 0xCC, 0x0C, 0xC6,
+        0x08, 0x07, 0xC7, 0x0C, 0xCB, 0x09, 0xCE, 0x06, 0xCF, 0x05, 0xD1, 0x03,
+        0xD3, 0x02, 0xC7, 0x03, 0xC7, 0x01, 0xC7, 0x05, 0xC6, 0x01, 0xC6, 0x0F,
+        0xC6, 0x0F, 0xC6, 0x0E, 0xC6, 0x0F, 0xC6, 0x02, 0xC5, 0x06, 0xC6, 0x00,
+        0xC9, 0x04, 0xD3, 0x02, 0xD4, 0x01, 0xD4, 0x01, 0xC9, 0x03, 0xC7, 0x00,
+        0xC7, 0x06, 0xC6, 0x00, 0xC7, 0x06, 0xCE, 0x08, 0xCD, 0x08, 0xCD, 0x08,
+        0xCD, 0x08, 0xC6, 0x00, 0xC5, 0x08, 0xC6, 0x00, 0xC5, 0x08, 0xC6, 0x00,
+        0xC6, 0x06, 0xC7, 0x00, 0xC6, 0x06, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x02,
+        0xD2, 0x04, 0xD1, 0x04, 0xD0, 0x06, 0xCE, 0x09, 0xCB, 0x0C, 0xC6, 0x07,
+        0xFF, 0xFF, 0xC9, 0x0F, 0xC5, 0x0F, 0xC5, 0x0F, 0xC6, 0x0F, 0xC5, 0x0F,
+        0xC5, 0x0F, 0xC6, 0x0F, 0xC5, 0x0F, 0xC6, 0x0F, 0xC5, 0x0F, 0xC5, 0x0F,
+        0xC6, 0x0F, 0xC6, 0x0F, 0xC5, 0x0F, 0xC6, 0x0F, 0xC5, 0x0F, 0xC6, 0x0F,
+        0xC6, 0x0F, 0xC5, 0x10, 0xC5, 0x0F, 0xC6, 0x0F, 0xC6, 0x0F, 0xC6, 0x0F,
+        0xC5, 0x0F, 0xC6, 0x0F, 0xC6, 0x0F, 0xC6, 0x0F, 0xC6, 0x0A, 0x07, 0xC6,
+        0x0E, 0xCB, 0x09, 0xCE, 0x07, 0xD0, 0x05, 0xD2, 0x04, 0xD2, 0x03, 0xC7,
+        0x04, 0xC7, 0x02, 0xC6, 0x07, 0xC5, 0x02, 0xC5, 0x08, 0xC5, 0x02, 0xC5,
+        0x09, 0xC4, 0x02, 0xC5, 0x09, 0xC4, 0x02, 0xC5, 0x08, 0xC5, 0x03, 0xC5,
+        0x07, 0xC4, 0x04, 0xC6, 0x04, 0xC6, 0x06, 0xCF, 0x08, 0xCC, 0x09, 0xCF,
+        0x06, 0xD1, 0x04, 0xC7, 0x03, 0xC7, 0x02, 0xC6, 0x07, 0xC6, 0x01, 0xC6,
+        0x07, 0xC6, 0x00, 0xC6, 0x09, 0xCD, 0x09, 0xCD, 0x09, 0xCD, 0x09, 0xCD,
+        0x09, 0xCE, 0x07, 0xCF, 0x07, 0xC6, 0x01, 0xC7, 0x04, 0xC8, 0x01, 0xD5,
+        0x02, 0xD3, 0x04, 0xD1, 0x06, 0xCF, 0x08, 0xCC, 0x0D, 0xC7, 0x07, 0x07,
+        0xC7, 0x0D, 0xCB, 0x09, 0xCE, 0x07, 0xD0, 0x05, 0xD2, 0x04, 0xD3, 0x02,
+        0xC8, 0x03, 0xC7, 0x02, 0xC6, 0x06, 0xC7, 0x00, 0xC7, 0x07, 0xC6, 0x00,
+        0xC6, 0x09, 0xC5, 0x00, 0xC6, 0x09, 0xC5, 0x00, 0xC6, 0x09, 0xCD, 0x09,
+        0xCD, 0x09, 0xCD, 0x09, 0xCE, 0x07, 0xC7, 0x00, 0xC6, 0x06, 0xC8, 0x00,
+        0xC8, 0x03, 0xC9, 0x00, 0xD6, 0x01, 0xD5, 0x02, 0xD4, 0x03, 0xCB, 0x00,
+        0xC6, 0x04, 0xC9, 0x01, 0xC6, 0x06, 0xC6, 0x02, 0xC5, 0x11, 0xC5, 0x10,
+        0xC6, 0x10, 0xC6, 0x01, 0xC6, 0x06, 0xC6, 0x02, 0xC7, 0x04, 0xC7, 0x02,
+        0xD3, 0x04, 0xD2, 0x04, 0xD1, 0x06, 0xCF, 0x09, 0xCB, 0x0D, 0xC7, 0x08,
+        0x0F, 0x80, 0xCD, 0x80, 0x1E, 0x40, 0xCF, 0x40, 0x1A, 0x80, 0xD5, 0x80,
+        0x16, 0x40, 0xD7, 0x40, 0x12, 0x80, 0xDD, 0x80, 0x0E, 0x40, 0xDF, 0x40,
+        0x0C, 0x80, 0xE1, 0x80, 0x0B, 0xE3, 0x0B, 0xE3, 0x0A, 0x40, 0xE3, 0x40,
+        0x08, 0x80, 0xE5, 0x80, 0x07, 0xE7, 0x07, 0xCF, 0x40, 0x05, 0x40, 0xCF,
+        0x06, 0x40, 0xCE, 0x80, 0x07, 0x80, 0xCE, 0x40, 0x04, 0x80, 0xCE, 0x40,
+        0x09, 0x40, 0xCE, 0x80, 0x03, 0xCE, 0x80, 0x0B, 0x80, 0xCE, 0x03, 0xCD,
+        0x40, 0x0D, 0x40, 0xCD, 0x03, 0xCD, 0x0F, 0xCD, 0x03, 0xCD, 0x0F, 0xCD,
+        0x03, 0xCD, 0x0F, 0xCD, 0x03, 0xCD, 0x0F, 0xCD, 0x02, 0x40, 0xCC, 0x80,
+        0x0F, 0x80, 0xCC, 0x40, 0x00, 0x80, 0xCC, 0x40, 0x11, 0x40, 0xCC, 0x80,
+        0xCD, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13,
+        0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13,
+        0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13,
+        0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13,
+        0xCD, 0x80, 0xCC, 0x40, 0x11, 0x40, 0xCC, 0x80, 0x00, 0x40, 0xCC, 0x80,
+        0x0F, 0x80, 0xCC, 0x40, 0x02, 0xCD, 0x0F, 0xCD, 0x03, 0xCD, 0x0F, 0xCD,
+        0x03, 0xCD, 0x0F, 0xCD, 0x03, 0xCD, 0x0F, 0xCD, 0x03, 0xCD, 0x40, 0x0D,
+        0x40, 0xCD, 0x03, 0xCE, 0x80, 0x0B, 0x80, 0xCE, 0x03, 0x80, 0xCE, 0x40,
+        0x09, 0x40, 0xCE, 0x80, 0x04, 0x40, 0xCE, 0x80, 0x07, 0x80, 0xCE, 0x40,
+        0x06, 0xCF, 0x40, 0x05, 0x40, 0xCF, 0x07, 0xE7, 0x07, 0x80, 0xE5, 0x80,
+        0x08, 0x40, 0xE3, 0x40, 0x0A, 0xE3, 0x0B, 0xE3, 0x0B, 0x80, 0xE1, 0x80,
+        0x0C, 0x40, 0xDF, 0x40, 0x0E, 0x80, 0xDD, 0x80, 0x12, 0x40, 0xD7, 0x40,
+        0x16, 0x80, 0xD5, 0x80, 0x1A, 0x40, 0xCF, 0x40, 0x1E, 0x80, 0xCD, 0x80,
+        0x0F, 0x13, 0x80, 0xC5, 0x80, 0x12, 0x40, 0xC7, 0x11, 0x80, 0xC8, 0x11,
+        0xC9, 0x11, 0xC9, 0x10, 0x40, 0xC9, 0x0F, 0x80, 0xCA, 0x0E, 0x40, 0xCB,
+        0x0D, 0x80, 0xCC, 0x0C, 0x40, 0xCD, 0x07, 0x80, 0xD2, 0x06, 0x40, 0xD3,
+        0x80, 0xFF, 0xFF, 0xFF, 0xC2, 0x80, 0xDA, 0x0C, 0x40, 0xCD, 0x0D, 0xCD,
+        0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD,
+        0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD,
+        0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD,
+        0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD,
+        0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD,
+        0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD,
+        0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD, 0x0D, 0xCD,
+        0x0D, 0xCD, 0x0D, 0x80, 0xCB, 0x80, 0x0D, 0x80, 0xCD, 0x80, 0x1C, 0x40,
+        0xCF, 0x40, 0x18, 0x80, 0xD7, 0x80, 0x12, 0x40, 0xD9, 0x40, 0x10, 0x80,
+        0xDB, 0x80, 0x0E, 0x40, 0xDD, 0x40, 0x0C, 0x80, 0xDF, 0x80, 0x0A, 0x40,
+        0xE1, 0x40, 0x08, 0x80, 0xE3, 0x80, 0x06, 0x40, 0xE5, 0x40, 0x04, 0x80,
+        0xE7, 0x80, 0x03, 0xE9, 0x03, 0xCF, 0x40, 0x07, 0x40, 0xCF, 0x02, 0x40,
+        0xCE, 0x80, 0x09, 0x80, 0xCE, 0x40, 0x00, 0x80, 0xCE, 0x40, 0x0B, 0x40,
+        0xCE, 0x80, 0xCE, 0x80, 0x0D, 0xDD, 0x40, 0x0E, 0xDD, 0x0F, 0x80, 0xDC,
+        0x10, 0x40, 0xDB, 0x11, 0xDB, 0x11, 0xDB, 0x11, 0xDB, 0x11, 0xCD, 0x80,
+        0xCB, 0x80, 0x11, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1E, 0x40,
+        0xCD, 0x1D, 0x80, 0xCE, 0x1D, 0xCE, 0x80, 0x1D, 0xCD, 0x40, 0x1D, 0x40,
+        0xCD, 0x1D, 0x80, 0xCE, 0x1C, 0x40, 0xCE, 0x80, 0x1B, 0x80, 0xCE, 0x40,
+        0x1B, 0x40, 0xCE, 0x80, 0x19, 0x80, 0xD0, 0x40, 0x19, 0x40, 0xD0, 0x80,
+        0x19, 0x80, 0xD0, 0x40, 0x19, 0x40, 0xD0, 0x80, 0x19, 0x80, 0xCE, 0x40,
+        0x1B, 0x40, 0xCE, 0x80, 0x19, 0x80, 0xD0, 0x40, 0x19, 0x40, 0xD0, 0x80,
+        0x19, 0x80, 0xCE, 0x40, 0x1B, 0x40, 0xCE, 0x80, 0x1B, 0x80, 0xCE, 0x40,
+        0x1B, 0x40, 0xCE, 0x80, 0x1B, 0x80, 0xCE, 0x40, 0x1B, 0x40, 0xCE, 0x80,
+        0x1B, 0x80, 0xCE, 0x40, 0x1C, 0xCE, 0x80, 0x1D, 0xCD, 0x40, 0x1D, 0x40,
+        0xCC, 0x80, 0x1D, 0x80, 0xCC, 0x40, 0x1E, 0xCD, 0x40, 0x1E, 0xE8, 0x80,
+        0x03, 0xE9, 0x03, 0xE9, 0x02, 0x40, 0xE9, 0x01, 0x80, 0xEA, 0x01, 0xEB,
+        0x01, 0xEB, 0x01, 0xEB, 0x01, 0xEB, 0x01, 0xEB, 0x01, 0xEB, 0x01, 0x80,
+        0xE9, 0x80, 0x0D, 0x80, 0xCD, 0x80, 0x1C, 0x40, 0xCF, 0x40, 0x18, 0x80,
+        0xD7, 0x80, 0x12, 0x40, 0xD9, 0x40, 0x0E, 0x80, 0xDD, 0x80, 0x0C, 0x40,
+        0xDF, 0x40, 0x0A, 0x80, 0xE1, 0x80, 0x08, 0x40, 0xE3, 0x40, 0x06, 0x80,
+        0xE5, 0x80, 0x05, 0xE7, 0x05, 0xE7, 0x05, 0xE7, 0x40, 0x04, 0xCF, 0x40,
+        0x05, 0x40, 0xD0, 0x80, 0x02, 0x40, 0xCE, 0x80, 0x07, 0x80, 0xD0, 0x01,
+        0x80, 0xCE, 0x40, 0x09, 0x40, 0xCF, 0x01, 0xCE, 0x80, 0x0B, 0x80, 0xCE,
+        0x01, 0xCD, 0x40, 0x0D, 0x40, 0xCD, 0x01, 0xCD, 0x0F, 0xCD, 0x01, 0xCD,
+        0x0F, 0xCD, 0x01, 0xCD, 0x0F, 0xCD, 0x01, 0xCD, 0x0F, 0xCD, 0x01, 0x80,
+        0xCB, 0x80, 0x0F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCC, 0x80, 0x1F, 0xCB, 0x40,
+        0x1F, 0x40, 0xCB, 0x1F, 0x80, 0xCC, 0x1E, 0x40, 0xCC, 0x80, 0x1D, 0x80,
+        0xCC, 0x40, 0x1D, 0x40, 0xCC, 0x80, 0x19, 0x80, 0xD0, 0x40, 0x1A, 0xD0,
+        0x80, 0x1B, 0xCF, 0x40, 0x1C, 0xCF, 0x40, 0x1C, 0xD0, 0x80, 0x1B, 0xD1,
+        0x40, 0x1A, 0xD4, 0x80, 0x17, 0x80, 0xD4, 0x40, 0x1B, 0x40, 0xD0, 0x80,
+        0x1B, 0x80, 0xD0, 0x1E, 0x40, 0xCD, 0x1F, 0xCD, 0x40, 0x1E, 0xCE, 0x80,
+        0x1D, 0x80, 0xCE, 0x1E, 0x40, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD,
+        0x1F, 0xCD, 0x1F, 0xCD, 0x80, 0xCB, 0x80, 0x11, 0xDB, 0x10, 0x40, 0xDB,
+        0x0F, 0x80, 0xDC, 0x40, 0x0E, 0xDE, 0x80, 0x0D, 0xCF, 0x80, 0xCE, 0x40,
+        0x0B, 0x40, 0xCE, 0x80, 0x00, 0x40, 0xCE, 0x80, 0x09, 0x80, 0xCE, 0x40,
+        0x02, 0xCF, 0x40, 0x07, 0x40, 0xCF, 0x03, 0xE9, 0x03, 0xE8, 0x80, 0x03,
+        0xE7, 0x40, 0x04, 0x80, 0xE5, 0x80, 0x06, 0x40, 0xE3, 0x40, 0x08, 0x80,
+        0xE1, 0x80, 0x0A, 0x40, 0xDF, 0x40, 0x0C, 0x80, 0xDD, 0x80, 0x10, 0x40,
+        0xD9, 0x40, 0x12, 0x80, 0xD7, 0x80, 0x16, 0x40, 0xCF, 0x40, 0x1C, 0x80,
+        0xCD, 0x80, 0x0F, 0x15, 0x80, 0xCD, 0x80, 0x1B, 0xCF, 0x1B, 0xCF, 0x1A,
+        0x40, 0xCF, 0x19, 0x80, 0xD0, 0x19, 0xD1, 0x19, 0xD1, 0x18, 0x40, 0xD1,
+        0x17, 0x80, 0xD2, 0x16, 0x40, 0xD3, 0x15, 0x80, 0xD4, 0x15, 0xD5, 0x15,
+        0xD5, 0x14, 0x40, 0xD5, 0x13, 0x80, 0xC6, 0x41, 0xCD, 0x13, 0xC7, 0x01,
+        0xCD, 0x13, 0xC7, 0x01, 0xCD, 0x12, 0x40, 0xC6, 0x80, 0x01, 0xCD, 0x11,
+        0x80, 0xC6, 0x40, 0x02, 0xCD, 0x10, 0x40, 0xC6, 0x80, 0x03, 0xCD, 0x0F,
+        0x80, 0xC6, 0x40, 0x04, 0xCD, 0x0F, 0xC7, 0x05, 0xCD, 0x0F, 0xC7, 0x05,
+        0xCD, 0x0E, 0x40, 0xC6, 0x80, 0x05, 0xCD, 0x0D, 0x80, 0xC6, 0x40, 0x06,
+        0xCD, 0x0D, 0xC6, 0x80, 0x07, 0xCD, 0x0D, 0xC5, 0x40, 0x08, 0xCD, 0x0C,
+        0x40, 0xC5, 0x09, 0xCD, 0x0B, 0x80, 0xC6, 0x09, 0xCD, 0x0B, 0xC6, 0x80,
+        0x09, 0xCD, 0x0B, 0xC5, 0x40, 0x0A, 0xCD, 0x0A, 0x40, 0xC5, 0x0B, 0xCD,
+        0x09, 0x80, 0xC6, 0x0B, 0xCD, 0x08, 0x40, 0xC6, 0x80, 0x0B, 0xCD, 0x07,
+        0x80, 0xC6, 0x40, 0x0C, 0xCD, 0x07, 0xC6, 0x80, 0x0D, 0xCD, 0x07, 0xC5,
+        0x40, 0x0E, 0xCD, 0x06, 0x40, 0xC5, 0x0F, 0xCD, 0x05, 0x80, 0xC6, 0x0F,
+        0xCD, 0x05, 0xC7, 0x40, 0x0D, 0x40, 0xCD, 0x40, 0x04, 0xEA, 0x80, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x80, 0xE9, 0x80, 0x16, 0x40, 0xCD,
+        0x40, 0x1C, 0xCD, 0x1D, 0xCD, 0x1D, 0xCD, 0x1D, 0xCD, 0x1D, 0xCD, 0x1D,
+        0xCD, 0x1D, 0xCD, 0x1D, 0xCD, 0x1D, 0xCD, 0x1D, 0xCD, 0x1D, 0xCD, 0x1D,
+        0xCD, 0x1D, 0x80, 0xCB, 0x80, 0x05, 0x05, 0x80, 0xE3, 0x80, 0x07, 0xE5,
+        0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x06, 0x40,
+        0xE5, 0x05, 0x80, 0xE6, 0x05, 0xE7, 0x05, 0xE7, 0x05, 0xE6, 0x80, 0x05,
+        0xC9, 0x40, 0x22, 0xC9, 0x23, 0xC9, 0x23, 0xC9, 0x23, 0xC9, 0x23, 0xC8,
+        0x80, 0x23, 0xC7, 0x40, 0x23, 0x40, 0xC7, 0x23, 0x80, 0xC8, 0x05, 0x80,
+        0xC9, 0x80, 0x11, 0xC9, 0x04, 0x40, 0xCB, 0x40, 0x10, 0xC9, 0x01, 0x80,
+        0xD3, 0x80, 0x0B, 0xC9, 0x41, 0xD5, 0x40, 0x0A, 0xE2, 0x80, 0x09, 0xE3,
+        0x40, 0x08, 0xE4, 0x80, 0x07, 0xE5, 0x40, 0x06, 0xE6, 0x80, 0x04, 0x40,
+        0xE7, 0x03, 0x80, 0xE8, 0x03, 0xE9, 0x40, 0x02, 0xCD, 0x40, 0x09, 0x40,
+        0xD0, 0x80, 0x01, 0x80, 0xCB, 0x80, 0x0B, 0x80, 0xD0, 0x1C, 0x40, 0xCF,
+        0x1D, 0x80, 0xCE, 0x40, 0x1D, 0x40, 0xCE, 0x80, 0x1D, 0x80, 0xCE, 0x1E,
+        0x40, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD,
+        0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1E, 0x40,
+        0xCD, 0x80, 0xC9, 0x80, 0x11, 0x80, 0xDA, 0x40, 0x0F, 0x40, 0xCE, 0x80,
+        0xCC, 0x80, 0x0D, 0x80, 0xCE, 0x40, 0x00, 0xCD, 0x40, 0x0B, 0x40, 0xCF,
+        0x01, 0xCE, 0x80, 0x09, 0x80, 0xD0, 0x01, 0xCF, 0x40, 0x07, 0x40, 0xD0,
+        0x80, 0x01, 0xE9, 0x40, 0x02, 0x80, 0xE8, 0x04, 0x40, 0xE7, 0x05, 0x80,
+        0xE5, 0x80, 0x06, 0x40, 0xE3, 0x40, 0x08, 0x80, 0xE1, 0x80, 0x0A, 0x40,
+        0xDD, 0x40, 0x0E, 0x80, 0xDB, 0x80, 0x10, 0x40, 0xD9, 0x40, 0x12, 0x80,
+        0xD7, 0x80, 0x18, 0x40, 0xCD, 0x40, 0x1E, 0x80, 0xCB, 0x80, 0x11, 0x0F,
+        0x80, 0xCD, 0x80, 0x1C, 0x40, 0xCF, 0x40, 0x18, 0x80, 0xD5, 0x80, 0x14,
+        0x40, 0xD7, 0x40, 0x12, 0x80, 0xDB, 0x80, 0x0E, 0x40, 0xDD, 0x0D, 0x80,
+        0xDE, 0x0C, 0x40, 0xDF, 0x40, 0x0A, 0x80, 0xE1, 0x80, 0x08, 0x40, 0xE3,
+        0x40, 0x06, 0x80, 0xE5, 0x80, 0x05, 0xE7, 0x05, 0xCF, 0x40, 0x05, 0x40,
+        0xCF, 0x04, 0x40, 0xCE, 0x80, 0x07, 0x80, 0xCE, 0x03, 0x80, 0xCE, 0x40,
+        0x09, 0x40, 0xCD, 0x03, 0xCE, 0x80, 0x0B, 0x80, 0xCB, 0x80, 0x03, 0xCD,
+        0x40, 0x1E, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1E, 0x40, 0xCC,
+        0x80, 0x1D, 0x80, 0xCC, 0x40, 0x1E, 0xCD, 0x1F, 0xCD, 0x05, 0x80, 0xC9,
+        0x80, 0x0D, 0xCD, 0x04, 0x40, 0xCB, 0x40, 0x0C, 0xCD, 0x01, 0x80, 0xD1,
+        0x80, 0x09, 0xCD, 0x41, 0xD3, 0x40, 0x08, 0xE6, 0x80, 0x05, 0xE7, 0x40,
+        0x04, 0xE8, 0x80, 0x03, 0xE9, 0x03, 0xE9, 0x03, 0xE9, 0x40, 0x02, 0xD3,
+        0x40, 0x05, 0x40, 0xCE, 0x80, 0x01, 0xD2, 0x80, 0x07, 0x80, 0xCE, 0x01,
+        0xCF, 0x40, 0x0B, 0x40, 0xCD, 0x01, 0xCF, 0x0D, 0xCD, 0x40, 0x00, 0xCF,
+        0x0D, 0xCE, 0x80, 0xCE, 0x80, 0x0D, 0x80, 0xDC, 0x40, 0x0F, 0x40, 0xDB,
+        0x11, 0xDB, 0x11, 0xDB, 0x11, 0xDB, 0x11, 0xDB, 0x11, 0xDB, 0x11, 0xCD,
+        0x80, 0xCC, 0x11, 0xCD, 0x00, 0x40, 0xCB, 0x11, 0xCD, 0x01, 0xCB, 0x11,
+        0xCD, 0x01, 0xCB, 0x11, 0xCD, 0x01, 0xCB, 0x40, 0x0F, 0x40, 0xCD, 0x01,
+        0xCC, 0x80, 0x0D, 0x80, 0xCE, 0x01, 0xCD, 0x0D, 0xCE, 0x80, 0x01, 0xCD,
+        0x0D, 0xCD, 0x40, 0x02, 0x80, 0xCC, 0x40, 0x0B, 0x40, 0xCD, 0x04, 0x40,
+        0xCE, 0x80, 0x05, 0x80, 0xD0, 0x05, 0xCF, 0x40, 0x03, 0x40, 0xD0, 0x80,
+        0x05, 0xE5, 0x40, 0x06, 0x80, 0xE4, 0x08, 0x40, 0xE3, 0x09, 0xE2, 0x80,
+        0x09, 0xE1, 0x40, 0x0A, 0x80, 0xDF, 0x80, 0x0C, 0x40, 0xDD, 0x40, 0x0E,
+        0x80, 0xDB, 0x80, 0x12, 0x40, 0xD7, 0x40, 0x14, 0x80, 0xD5, 0x80, 0x18,
+        0x40, 0xCD, 0x40, 0x1E, 0x80, 0xCB, 0x80, 0x0F, 0x80, 0xEB, 0x80, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x80, 0xEB, 0x80, 0x1E, 0x40,
+        0xCB, 0x40, 0x1F, 0x40, 0xCA, 0x80, 0x1F, 0x80, 0xCA, 0x40, 0x1F, 0x40,
+        0xCB, 0x1F, 0x80, 0xCC, 0x1F, 0xCC, 0x80, 0x1F, 0xCB, 0x40, 0x1F, 0x40,
+        0xCA, 0x80, 0x1F, 0x80, 0xCA, 0x40, 0x1F, 0x40, 0xCB, 0x1F, 0x80, 0xCC,
+        0x1F, 0xCC, 0x80, 0x1F, 0xCB, 0x40, 0x1F, 0x40, 0xCB, 0x1F, 0x80, 0xCC,
+        0x1F, 0xCC, 0x80, 0x1F, 0xCB, 0x40, 0x1F, 0x40, 0xCA, 0x80, 0x1F, 0x80,
+        0xCA, 0x40, 0x1F, 0x40, 0xCB, 0x1F, 0x80, 0xCC, 0x1F, 0xCD, 0x1F, 0xCD,
+        0x1F, 0xCC, 0x80, 0x1F, 0xCB, 0x40, 0x1F, 0x40, 0xCB, 0x1F, 0x80, 0xCC,
+        0x1F, 0xCC, 0x80, 0x1F, 0xCB, 0x40, 0x1F, 0x40, 0xCB, 0x1F, 0x80, 0xCC,
+        0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCC, 0x80, 0x1F, 0xCB, 0x40, 0x20, 0xCB,
+        0x21, 0xCB, 0x20, 0x40, 0xCB, 0x1F, 0x80, 0xCC, 0x1F, 0xCD, 0x1F, 0xCD,
+        0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCC, 0x80, 0x1F, 0xCB, 0x40, 0x1F, 0x40,
+        0xCB, 0x1F, 0x80, 0xCC, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0xCD,
+        0x1F, 0xCD, 0x1F, 0xCD, 0x1F, 0x80, 0xCB, 0x80, 0x15, 0x0F, 0x80, 0xCB,
+        0x80, 0x20, 0x40, 0xCD, 0x40, 0x1C, 0x80, 0xD5, 0x80, 0x16, 0x40, 0xD7,
+        0x40, 0x12, 0x80, 0xDB, 0x80, 0x10, 0x40, 0xDD, 0x40, 0x0E, 0x80, 0xDF,
+        0x80, 0x0C, 0x40, 0xE1, 0x40, 0x0A, 0x80, 0xE3, 0x80, 0x09, 0xE5, 0x09,
+        0xE5, 0x08, 0x40, 0xE5, 0x40, 0x06, 0x80, 0xCE, 0x40, 0x07, 0x40, 0xCE,
+        0x80, 0x05, 0xCE, 0x80, 0x09, 0x80, 0xCE, 0x05, 0xCD, 0x40, 0x0D, 0x40,
+        0xCB, 0x05, 0xCC, 0x80, 0x0F, 0xCB, 0x05, 0xCB, 0x40, 0x10, 0xCB, 0x05,
+        0xCB, 0x11, 0x80, 0xCA, 0x05, 0xCB, 0x12, 0x40, 0xC9, 0x05, 0xCB, 0x13,
+        0xC9, 0x05, 0xCB, 0x13, 0xC9, 0x05, 0xCB, 0x12, 0x40, 0xC9, 0x05, 0xCB,
+        0x11, 0x80, 0xCA, 0x05, 0x80, 0xCA, 0x40, 0x10, 0xCA, 0x80, 0x06, 0x40,
+        0xCA, 0x80, 0x0F, 0xC9, 0x40, 0x08, 0xCB, 0x40, 0x0D, 0x40, 0xC9, 0x09,
+        0xCC, 0x80, 0x09, 0x80, 0xCC, 0x09, 0x80, 0xCC, 0x40, 0x07, 0x40, 0xCC,
+        0x80, 0x0C, 0x40, 0xDF, 0x40, 0x0E, 0x80, 0xDD, 0x80, 0x10, 0x40, 0xD9,
+        0x40, 0x13, 0x40, 0xD9, 0x40, 0x12, 0x80, 0xDD, 0x80, 0x0E, 0x40, 0xDF,
+        0x40, 0x0C, 0x80, 0xE1, 0x80, 0x0A, 0x40, 0xE3, 0x40, 0x08, 0x80, 0xCE,
+        0x40, 0x05, 0x40, 0xCE, 0x80, 0x06, 0x40, 0xCE, 0x80, 0x07, 0x80, 0xCE,
+        0x40, 0x04, 0x80, 0xCC, 0x40, 0x0D, 0x40, 0xCC, 0x80, 0x03, 0xCD, 0x0F,
+        0xCD, 0x03, 0xCD, 0x0F, 0xCD, 0x02, 0x40, 0xCC, 0x80, 0x0F, 0x80, 0xCC,
+        0x40, 0x00, 0x80, 0xCC, 0x40, 0x11, 0x40, 0xCC, 0x80, 0xCD, 0x13, 0xDB,
+        0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB,
+        0x13, 0xDB, 0x40, 0x11, 0x40, 0xDC, 0x80, 0x0F, 0x80, 0xDE, 0x0F, 0xCE,
+        0x80, 0xCF, 0x0F, 0xCD, 0x40, 0x00, 0x80, 0xCE, 0x40, 0x0D, 0x40, 0xCD,
+        0x02, 0x40, 0xCE, 0x80, 0x09, 0x80, 0xD0, 0x03, 0xCF, 0x40, 0x07, 0x40,
+        0xD1, 0x03, 0xEB, 0x03, 0x80, 0xE9, 0x80, 0x04, 0x40, 0xE7, 0x40, 0x06,
+        0x80, 0xE5, 0x80, 0x08, 0x40, 0xE3, 0x40, 0x0A, 0x80, 0xE1, 0x80, 0x0C,
+        0x40, 0xDF, 0x40, 0x0E, 0x80, 0xDD, 0x80, 0x10, 0x40, 0xD9, 0x40, 0x14,
+        0x80, 0xD7, 0x80, 0x1A, 0x40, 0xCF, 0x40, 0x1E, 0x80, 0xCD, 0x80, 0x0F,
+        0x0F, 0x80, 0xCD, 0x80, 0x1E, 0x40, 0xCF, 0x40, 0x1A, 0x80, 0xD5, 0x80,
+        0x16, 0x40, 0xD7, 0x40, 0x12, 0x80, 0xDB, 0x80, 0x10, 0x40, 0xDD, 0x40,
+        0x0E, 0x80, 0xDF, 0x80, 0x0C, 0x40, 0xE1, 0x40, 0x0A, 0x80, 0xE3, 0x80,
+        0x09, 0xE5, 0x40, 0x08, 0xE6, 0x80, 0x06, 0x40, 0xE7, 0x05, 0x80, 0xD0,
+        0x40, 0x05, 0x40, 0xCF, 0x05, 0xD0, 0x80, 0x07, 0x80, 0xCE, 0x40, 0x04,
+        0xCD, 0x40, 0x0B, 0x40, 0xCE, 0x80, 0x02, 0x40, 0xCD, 0x0D, 0x80, 0xCE,
+        0x01, 0x80, 0xCE, 0x0E, 0x40, 0xCD, 0x01, 0xCE, 0x80, 0x0F, 0x80, 0xCC,
+        0x01, 0xCD, 0x40, 0x11, 0x40, 0xCB, 0x01, 0xCD, 0x13, 0xCB, 0x01, 0xCD,
+        0x13, 0xCB, 0x01, 0xCD, 0x13, 0xCB, 0x40, 0x00, 0xCD, 0x13, 0xCC, 0x80,
+        0xCD, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13, 0xDB, 0x13,
+        0xDB, 0x40, 0x11, 0x40, 0xDC, 0x80, 0x0F, 0x80, 0xCE, 0x80, 0xCE, 0x0E,
+        0x40, 0xCF, 0x00, 0x40, 0xCD, 0x0D, 0x80, 0xD0, 0x01, 0xCD, 0x40, 0x0B,
+        0x40, 0xD1, 0x01, 0xD0, 0x80, 0x07, 0x80, 0xD2, 0x01, 0xD1, 0x40, 0x05,
+        0x40, 0xD3, 0x01, 0xED, 0x01, 0x80, 0xEC, 0x02, 0x40, 0xEB, 0x03, 0x80,
+        0xEA, 0x04, 0x40, 0xE9, 0x05, 0x80, 0xE8, 0x06, 0x40, 0xD7, 0x41, 0xCD,
+        0x07, 0x80, 0xD5, 0x80, 0x01, 0xCD, 0x08, 0x40, 0xD3, 0x40, 0x02, 0xCD,
+        0x09, 0x80, 0xD1, 0x80, 0x03, 0xCC, 0x80, 0x0C, 0x40, 0xCD, 0x40, 0x04,
+        0xCB, 0x40, 0x0E, 0x80, 0xCB, 0x80, 0x05, 0xCB, 0x23, 0xCB, 0x22, 0x40,
+        0xCB, 0x21, 0x80, 0xCC, 0x21, 0xCD, 0x21, 0xCD, 0x20, 0x40, 0xCC, 0x80,
+        0x03, 0x80, 0xCB, 0x80, 0x0D, 0x80, 0xCC, 0x40, 0x04, 0xCD, 0x40, 0x0B,
+        0x40, 0xCD, 0x05, 0xCE, 0x80, 0x09, 0x80, 0xCE, 0x05, 0xCF, 0x40, 0x07,
+        0x40, 0xCE, 0x80, 0x05, 0xE7, 0x40, 0x06, 0x80, 0xE6, 0x08, 0x40, 0xE5,
+        0x09, 0xE4, 0x80, 0x09, 0xE3, 0x40, 0x0A, 0x80, 0xE1, 0x80, 0x0C, 0x40,
+        0xDF, 0x40, 0x0E, 0x80, 0xDD, 0x80, 0x12, 0x40, 0xD7, 0x40, 0x16, 0x80,
+        0xD5, 0x80, 0x1A, 0x40, 0xCF, 0x40, 0x1E, 0x80, 0xCD, 0x80, 0x11, 0x17,
+        0x40, 0xD5, 0x40, 0x2F, 0xD7, 0x2E, 0x80, 0xD7, 0x80, 0x28, 0x40, 0xE1,
+        0x40, 0x23, 0xE3, 0x22, 0x80, 0xE3, 0x80, 0x1C, 0x40, 0xED, 0x40, 0x17,
+        0xEF, 0x16, 0x80, 0xEF, 0x80, 0x13, 0x40, 0xF3, 0x40, 0x11, 0xF5, 0x11,
+        0xF5, 0x11, 0xF5, 0x11, 0xF5, 0x10, 0x80, 0xF5, 0x80, 0x0D, 0x40, 0xF9,
+        0x40, 0x0B, 0xFB, 0x0B, 0xFB, 0x0B, 0xD7, 0x80, 0x09, 0x80, 0xD7, 0x0B,
+        0xD7, 0x0B, 0xD7, 0x0A, 0x80, 0xD6, 0x40, 0x0B, 0x40, 0xD6, 0x80, 0x07,
+        0x40, 0xD6, 0x80, 0x0F, 0x80, 0xD6, 0x40, 0x05, 0xD7, 0x11, 0xD7, 0x05,
+        0xD6, 0x40, 0x11, 0x40, 0xD6, 0x05, 0xD4, 0x80, 0x15, 0x80, 0xD4, 0x05,
+        0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17, 0xD4, 0x05,
+        0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17, 0xD4, 0x05,
+        0xD4, 0x17, 0xD4, 0x04, 0x80, 0xD3, 0x40, 0x17, 0x40, 0xD3, 0x80, 0x01,
+        0x40, 0xD3, 0x80, 0x1B, 0x80, 0xD3, 0x40, 0xD4, 0x1D, 0xE9, 0x1D, 0xE9,
+        0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9,
+        0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9,
+        0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9,
+        0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9,
+        0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9,
+        0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xD4, 0x40, 0xD3,
+        0x80, 0x1B, 0x80, 0xD3, 0x40, 0x01, 0x80, 0xD3, 0x40, 0x17, 0x40, 0xD3,
+        0x80, 0x04, 0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17,
+        0xD4, 0x05, 0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17,
+        0xD4, 0x05, 0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x80, 0x15, 0x80, 0xD4, 0x05,
+        0xD6, 0x40, 0x11, 0x40, 0xD6, 0x05, 0xD7, 0x11, 0xD7, 0x05, 0x40, 0xD6,
+        0x80, 0x0F, 0x80, 0xD6, 0x40, 0x07, 0x80, 0xD6, 0x40, 0x0B, 0x40, 0xD6,
+        0x80, 0x0A, 0xD7, 0x0B, 0xD7, 0x0B, 0xD7, 0x80, 0x09, 0x80, 0xD7, 0x0B,
+        0xFB, 0x0B, 0xFB, 0x0B, 0x40, 0xF9, 0x40, 0x0D, 0x80, 0xF5, 0x80, 0x10,
+        0xF5, 0x11, 0xF5, 0x11, 0xF5, 0x11, 0xF5, 0x11, 0x40, 0xF3, 0x40, 0x13,
+        0x80, 0xEF, 0x80, 0x16, 0xEF, 0x17, 0x40, 0xED, 0x40, 0x1C, 0x80, 0xE3,
+        0x80, 0x22, 0xE3, 0x23, 0x40, 0xE1, 0x40, 0x28, 0x80, 0xD7, 0x80, 0x2E,
+        0xD7, 0x2F, 0x40, 0xD5, 0x40, 0x17, 0x1D, 0x40, 0xC9, 0x40, 0x1D, 0xCB,
+        0x1C, 0x80, 0xCB, 0x1A, 0x40, 0xCD, 0x1A, 0xCE, 0x1A, 0xCE, 0x1A, 0xCE,
+        0x1A, 0xCE, 0x19, 0x80, 0xCE, 0x17, 0x40, 0xD0, 0x17, 0xD1, 0x16, 0x80,
+        0xD1, 0x14, 0x40, 0xD3, 0x14, 0xD4, 0x13, 0x80, 0xD4, 0x0B, 0x40, 0xDC,
+        0x0B, 0xDD, 0x0A, 0x80, 0xDD, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xCC, 0x40, 0xE8, 0x13, 0x80, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14,
+        0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0xD4, 0x14, 0x40, 0xD2,
+        0x40, 0x14, 0x40, 0xD5, 0x40, 0x2C, 0xD7, 0x2B, 0x80, 0xD7, 0x80, 0x25,
+        0x40, 0xE4, 0x40, 0x1D, 0xE6, 0x1C, 0x80, 0xE6, 0x80, 0x19, 0x40, 0xEA,
+        0x40, 0x17, 0xEC, 0x16, 0x80, 0xEC, 0x80, 0x13, 0x40, 0xF0, 0x40, 0x11,
+        0xF2, 0x10, 0x80, 0xF2, 0x80, 0x0D, 0x40, 0xF6, 0x40, 0x0B, 0xF8, 0x0A,
+        0x80, 0xF8, 0x80, 0x07, 0x40, 0xFC, 0x40, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+        0xD7, 0x80, 0x0C, 0x80, 0xD7, 0x05, 0xD7, 0x0E, 0xD7, 0x04, 0x80, 0xD6,
+        0x40, 0x0E, 0x40, 0xD6, 0x80, 0x01, 0x40, 0xD6, 0x80, 0x12, 0x80, 0xD6,
+        0x40, 0xD7, 0x14, 0xEE, 0x40, 0x14, 0xEC, 0x80, 0x16, 0xEC, 0x17, 0xEC,
+        0x17, 0x40, 0xEB, 0x19, 0x80, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9,
+        0x1A, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x1A, 0xD4, 0x40, 0xD2, 0x40, 0x1A,
+        0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2E,
+        0x80, 0xD4, 0x2C, 0x40, 0xD6, 0x2C, 0xD7, 0x2C, 0xD6, 0x40, 0x2C, 0xD4,
+        0x80, 0x2E, 0xD4, 0x2E, 0x80, 0xD4, 0x2C, 0x40, 0xD6, 0x2C, 0xD7, 0x2B,
+        0x80, 0xD6, 0x40, 0x29, 0x40, 0xD6, 0x80, 0x2B, 0xD7, 0x2B, 0x80, 0xD6,
+        0x40, 0x26, 0x40, 0xD9, 0x80, 0x28, 0xDA, 0x28, 0x80, 0xD9, 0x40, 0x26,
+        0x40, 0xD9, 0x80, 0x28, 0xDA, 0x28, 0x80, 0xD9, 0x40, 0x26, 0x40, 0xD6,
+        0x80, 0x2B, 0xD7, 0x2B, 0x80, 0xD6, 0x40, 0x26, 0x40, 0xD9, 0x80, 0x28,
+        0xDA, 0x28, 0x80, 0xD9, 0x40, 0x26, 0x40, 0xD6, 0x80, 0x2B, 0xD7, 0x2B,
+        0x80, 0xD6, 0x40, 0x29, 0x40, 0xD6, 0x80, 0x2B, 0xD7, 0x2B, 0x80, 0xD6,
+        0x40, 0x29, 0x40, 0xD6, 0x80, 0x2B, 0xD7, 0x2B, 0x80, 0xD6, 0x40, 0x29,
+        0x40, 0xD6, 0x80, 0x2B, 0xD7, 0x2C, 0xD6, 0x40, 0x2C, 0xD4, 0x80, 0x2E,
+        0xD4, 0x2E, 0x80, 0xD3, 0x40, 0x2C, 0x40, 0xD3, 0x80, 0x2E, 0xD4, 0x2F,
+        0xD4, 0x80, 0x2E, 0xFD, 0x40, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+        0xFE, 0x04, 0x80, 0xFE, 0x02, 0x40, 0xFF, 0xC0, 0x02, 0xFF, 0xC1, 0x02,
+        0xFF, 0xC1, 0x02, 0xFF, 0xC1, 0x02, 0xFF, 0xC1, 0x02, 0xFF, 0xC1, 0x02,
+        0xFF, 0xC1, 0x02, 0xFF, 0xC1, 0x02, 0xFF, 0xC1, 0x02, 0xFF, 0xC1, 0x02,
+        0xFF, 0xC1, 0x02, 0x40, 0xFF, 0x40, 0x14, 0x40, 0xD5, 0x40, 0x2C, 0xD7,
+        0x2B, 0x80, 0xD7, 0x80, 0x25, 0x40, 0xE4, 0x40, 0x1D, 0xE6, 0x1C, 0x80,
+        0xE6, 0x80, 0x16, 0x40, 0xED, 0x40, 0x14, 0xEF, 0x13, 0x80, 0xEF, 0x80,
+        0x10, 0x40, 0xF3, 0x40, 0x0E, 0xF5, 0x0D, 0x80, 0xF5, 0x80, 0x0A, 0x40,
+        0xF9, 0x40, 0x08, 0xFB, 0x08, 0xFB, 0x08, 0xFB, 0x08, 0xFB, 0x08, 0xFB,
+        0x80, 0x07, 0xD7, 0x80, 0x09, 0x80, 0xD9, 0x40, 0x05, 0xD7, 0x0B, 0xDA,
+        0x04, 0x80, 0xD6, 0x40, 0x0B, 0x40, 0xD9, 0x02, 0x40, 0xD6, 0x80, 0x0F,
+        0x80, 0xD7, 0x02, 0xD7, 0x11, 0xD7, 0x02, 0xD6, 0x40, 0x11, 0x40, 0xD6,
+        0x02, 0xD4, 0x80, 0x15, 0x80, 0xD4, 0x02, 0xD4, 0x17, 0xD4, 0x02, 0xD4,
+        0x17, 0xD4, 0x02, 0xD4, 0x17, 0xD4, 0x02, 0xD4, 0x17, 0xD4, 0x02, 0xD4,
+        0x17, 0xD4, 0x02, 0xD4, 0x17, 0xD4, 0x02, 0xD4, 0x17, 0xD4, 0x02, 0x40,
+        0xD2, 0x40, 0x17, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD3, 0x40, 0x2F,
+        0xD1, 0x80, 0x31, 0xD1, 0x31, 0x80, 0xD1, 0x2F, 0x40, 0xD3, 0x2F, 0xD4,
+        0x2E, 0x80, 0xD3, 0x40, 0x2C, 0x40, 0xD3, 0x80, 0x2E, 0xD4, 0x2E, 0x80,
+        0xD3, 0x40, 0x26, 0x40, 0xD9, 0x80, 0x28, 0xDA, 0x29, 0xD9, 0x40, 0x29,
+        0xD7, 0x80, 0x2B, 0xD7, 0x2C, 0xD7, 0x80, 0x2B, 0xD9, 0x40, 0x29, 0xDA,
+        0x29, 0xDA, 0x80, 0x28, 0xDF, 0x40, 0x23, 0xE0, 0x23, 0x40, 0xDF, 0x80,
+        0x2A, 0x80, 0xD9, 0x40, 0x29, 0xDA, 0x29, 0x40, 0xD9, 0x2E, 0x80, 0xD4,
+        0x2F, 0xD4, 0x2F, 0xD4, 0x80, 0x2E, 0xD6, 0x40, 0x2C, 0xD7, 0x2C, 0x40,
+        0xD6, 0x2E, 0x80, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4,
+        0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x40, 0xD2, 0x40, 0x1A,
+        0xE9, 0x1A, 0xE9, 0x19, 0x80, 0xE9, 0x17, 0x40, 0xEB, 0x17, 0xEC, 0x80,
+        0x16, 0xEE, 0x40, 0x14, 0xEF, 0x14, 0xD7, 0x40, 0xD6, 0x80, 0x12, 0x80,
+        0xD6, 0x40, 0x01, 0x80, 0xD6, 0x40, 0x0E, 0x40, 0xD6, 0x80, 0x04, 0xD7,
+        0x0E, 0xD7, 0x05, 0xD7, 0x80, 0x0C, 0x80, 0xD7, 0x05, 0xFE, 0x05, 0xFE,
+        0x05, 0xFD, 0x40, 0x05, 0xFB, 0x80, 0x07, 0xFB, 0x08, 0x40, 0xF9, 0x40,
+        0x0A, 0x80, 0xF5, 0x80, 0x0D, 0xF5, 0x0E, 0x40, 0xF3, 0x40, 0x10, 0x80,
+        0xEF, 0x80, 0x13, 0xEF, 0x14, 0x40, 0xED, 0x40, 0x19, 0x80, 0xE6, 0x80,
+        0x1C, 0xE6, 0x1D, 0x40, 0xE4, 0x40, 0x22, 0x80, 0xD7, 0x80, 0x2B, 0xD7,
+        0x2C, 0x40, 0xD5, 0x40, 0x17, 0x20, 0x40, 0xD5, 0x40, 0x29, 0xD7, 0x29,
+        0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x28, 0x80, 0xD7, 0x26, 0x40, 0xD9, 0x26,
+        0xDA, 0x26, 0xDA, 0x26, 0xDA, 0x26, 0xDA, 0x25, 0x80, 0xDA, 0x23, 0x40,
+        0xDC, 0x23, 0xDD, 0x22, 0x80, 0xDD, 0x20, 0x40, 0xDF, 0x20, 0xE0, 0x20,
+        0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x1F, 0x80, 0xE0, 0x1D, 0x40, 0xCA, 0x80,
+        0x00, 0x80, 0xD4, 0x1D, 0xCB, 0x02, 0xD4, 0x1D, 0xCB, 0x02, 0xD4, 0x1D,
+        0xCB, 0x02, 0xD4, 0x1D, 0xCB, 0x02, 0xD4, 0x1C, 0x80, 0xCA, 0x40, 0x02,
+        0xD4, 0x1A, 0x40, 0xCA, 0x80, 0x04, 0xD4, 0x1A, 0xCB, 0x05, 0xD4, 0x19,
+        0x80, 0xCA, 0x40, 0x05, 0xD4, 0x17, 0x40, 0xCA, 0x80, 0x07, 0xD4, 0x17,
+        0xCB, 0x08, 0xD4, 0x17, 0xCB, 0x08, 0xD4, 0x17, 0xCB, 0x08, 0xD4, 0x17,
+        0xCB, 0x08, 0xD4, 0x16, 0x80, 0xCA, 0x40, 0x08, 0xD4, 0x14, 0x40, 0xCA,
+        0x80, 0x0A, 0xD4, 0x14, 0xCB, 0x0B, 0xD4, 0x14, 0xCA, 0x40, 0x0B, 0xD4,
+        0x14, 0xC8, 0x80, 0x0D, 0xD4, 0x14, 0xC8, 0x0E, 0xD4, 0x13, 0x80, 0xC8,
+        0x0E, 0xD4, 0x11, 0x40, 0xCA, 0x0E, 0xD4, 0x11, 0xCB, 0x0E, 0xD4, 0x11,
+        0xCA, 0x40, 0x0E, 0xD4, 0x11, 0xC8, 0x80, 0x10, 0xD4, 0x11, 0xC8, 0x11,
+        0xD4, 0x10, 0x80, 0xC8, 0x11, 0xD4, 0x0E, 0x40, 0xCA, 0x11, 0xD4, 0x0E,
+        0xCB, 0x11, 0xD4, 0x0D, 0x80, 0xCA, 0x40, 0x11, 0xD4, 0x0B, 0x40, 0xCA,
+        0x80, 0x13, 0xD4, 0x0B, 0xCB, 0x14, 0xD4, 0x0B, 0xCA, 0x40, 0x14, 0xD4,
+        0x0B, 0xC8, 0x80, 0x16, 0xD4, 0x0B, 0xC8, 0x17, 0xD4, 0x0A, 0x80, 0xC8,
+        0x17, 0xD4, 0x08, 0x40, 0xCA, 0x17, 0xD4, 0x08, 0xCB, 0x17, 0xD4, 0x08,
+        0xCB, 0x80, 0x15, 0x80, 0xD4, 0x80, 0x07, 0xFF, 0xC0, 0x40, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xDF, 0x40, 0xFF, 0x40, 0x22, 0x80, 0xD4, 0x80, 0x2B, 0xD4,
+        0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4,
+        0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4,
+        0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4, 0x2C, 0xD4,
+        0x2C, 0x40, 0xD2, 0x40, 0x08, 0x08, 0x40, 0xF6, 0x40, 0x0B, 0xF8, 0x0B,
+        0xF8, 0x0B, 0xF8, 0x0B, 0xF8, 0x0B, 0xF8, 0x0B, 0xF8, 0x0B, 0xF8, 0x0B,
+        0xF8, 0x0B, 0xF8, 0x0B, 0xF8, 0x0A, 0x80, 0xF8, 0x08, 0x40, 0xFA, 0x08,
+        0xFB, 0x08, 0xFB, 0x08, 0xFB, 0x08, 0xFB, 0x08, 0xFA, 0x40, 0x08, 0xCE,
+        0x80, 0x34, 0xCE, 0x35, 0xCE, 0x35, 0xCE, 0x35, 0xCE, 0x35, 0xCE, 0x35,
+        0xCE, 0x35, 0xCE, 0x35, 0xCD, 0x40, 0x35, 0xCB, 0x80, 0x37, 0xCB, 0x37,
+        0x80, 0xCB, 0x35, 0x40, 0xCD, 0x08, 0x40, 0xCF, 0x40, 0x1A, 0xCE, 0x08,
+        0xD1, 0x1A, 0xCE, 0x07, 0x80, 0xD1, 0x80, 0x19, 0xCE, 0x02, 0x40, 0xDE,
+        0x40, 0x11, 0xCE, 0x02, 0xE0, 0x11, 0xCE, 0x80, 0x00, 0x80, 0xE0, 0x80,
+        0x10, 0xF4, 0x40, 0x0E, 0xF5, 0x0E, 0xF5, 0x80, 0x0D, 0xF7, 0x40, 0x0B,
+        0xF8, 0x0B, 0xF8, 0x80, 0x0A, 0xFA, 0x40, 0x08, 0xFB, 0x07, 0x80, 0xFB,
+        0x05, 0x40, 0xFD, 0x05, 0xFE, 0x05, 0xFE, 0x80, 0x04, 0xD4, 0x80, 0x0F,
+        0x80, 0xD9, 0x40, 0x02, 0xD4, 0x11, 0xDA, 0x02, 0x40, 0xD2, 0x40, 0x11,
+        0x40, 0xD9, 0x2B, 0x80, 0xD7, 0x2C, 0xD7, 0x2C, 0x40, 0xD6, 0x80, 0x2D,
+        0x80, 0xD6, 0x40, 0x2C, 0xD7, 0x2C, 0x40, 0xD6, 0x2E, 0x80, 0xD4, 0x2F,
+        0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F,
+        0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F,
+        0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2E, 0x80, 0xD4, 0x40, 0xCF,
+        0x40, 0x1A, 0x40, 0xE8, 0x1A, 0xE9, 0x80, 0x18, 0x80, 0xD6, 0x40, 0xD3,
+        0x40, 0x14, 0x40, 0xD6, 0x80, 0x01, 0xD4, 0x14, 0xD7, 0x02, 0xD4, 0x80,
+        0x12, 0x80, 0xD7, 0x02, 0xD6, 0x40, 0x0E, 0x40, 0xD9, 0x02, 0xD7, 0x0E,
+        0xDA, 0x02, 0xD7, 0x80, 0x0C, 0x80, 0xD9, 0x40, 0x02, 0xFE, 0x80, 0x04,
+        0xFE, 0x05, 0x40, 0xFD, 0x07, 0x80, 0xFB, 0x08, 0xFB, 0x08, 0x40, 0xF9,
+        0x40, 0x0A, 0x80, 0xF5, 0x80, 0x0D, 0xF5, 0x0E, 0x40, 0xF3, 0x40, 0x10,
+        0x80, 0xEC, 0x80, 0x16, 0xEC, 0x17, 0x40, 0xEA, 0x40, 0x19, 0x80, 0xE6,
+        0x80, 0x1C, 0xE6, 0x1D, 0x40, 0xE4, 0x40, 0x25, 0x80, 0xD4, 0x80, 0x2E,
+        0xD4, 0x2F, 0x40, 0xD2, 0x40, 0x1A, 0x17, 0x40, 0xD5, 0x40, 0x2C, 0xD7,
+        0x2B, 0x80, 0xD7, 0x80, 0x25, 0x40, 0xE1, 0x40, 0x20, 0xE3, 0x1F, 0x80,
+        0xE3, 0x80, 0x1C, 0x40, 0xEA, 0x40, 0x17, 0xEC, 0x16, 0x80, 0xEC, 0x14,
+        0x40, 0xEE, 0x14, 0xEF, 0x13, 0x80, 0xEF, 0x80, 0x10, 0x40, 0xF3, 0x40,
+        0x0E, 0xF5, 0x0D, 0x80, 0xF5, 0x80, 0x0A, 0x40, 0xF9, 0x40, 0x08, 0xFB,
+        0x08, 0xFB, 0x08, 0xD7, 0x80, 0x09, 0x80, 0xD7, 0x08, 0xD7, 0x0B, 0xD7,
+        0x07, 0x80, 0xD6, 0x40, 0x0B, 0x40, 0xD6, 0x05, 0x40, 0xD6, 0x80, 0x0F,
+        0x80, 0xD4, 0x05, 0xD7, 0x11, 0xD4, 0x05, 0xD6, 0x40, 0x11, 0x40, 0xD2,
+        0x40, 0x05, 0xD4, 0x80, 0x2E, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4,
+        0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2E, 0x80, 0xD3, 0x40, 0x2C, 0x40,
+        0xD3, 0x80, 0x2E, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x08, 0x40, 0xCF, 0x40,
+        0x14, 0xD4, 0x08, 0xD1, 0x14, 0xD4, 0x07, 0x80, 0xD1, 0x80, 0x13, 0xD4,
+        0x02, 0x40, 0xDB, 0x40, 0x0E, 0xD4, 0x02, 0xDD, 0x0E, 0xD4, 0x80, 0x00,
+        0x80, 0xDD, 0x80, 0x0D, 0xFA, 0x40, 0x08, 0xFB, 0x08, 0xFB, 0x80, 0x07,
+        0xFD, 0x40, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE,
+        0x80, 0x04, 0xDD, 0x80, 0x09, 0x80, 0xD6, 0x40, 0x02, 0xDD, 0x0B, 0xD7,
+        0x02, 0xDC, 0x40, 0x0B, 0x40, 0xD6, 0x02, 0xD7, 0x80, 0x12, 0x80, 0xD4,
+        0x02, 0xD7, 0x14, 0xD4, 0x02, 0xD7, 0x14, 0xD4, 0x80, 0x01, 0xD7, 0x14,
+        0xD6, 0x40, 0xD7, 0x14, 0xEE, 0x40, 0x14, 0x40, 0xEB, 0x80, 0x18, 0x80,
+        0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x1A,
+        0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x1A, 0xD4, 0x40, 0xD3, 0x1A,
+        0xD4, 0x01, 0x80, 0xD1, 0x1A, 0xD4, 0x02, 0xD1, 0x1A, 0xD4, 0x02, 0xD1,
+        0x1A, 0xD4, 0x02, 0xD1, 0x1A, 0xD4, 0x02, 0xD1, 0x1A, 0xD4, 0x02, 0xD1,
+        0x80, 0x18, 0x80, 0xD4, 0x02, 0xD3, 0x40, 0x14, 0x40, 0xD6, 0x02, 0xD4,
+        0x14, 0xD7, 0x02, 0xD4, 0x14, 0xD6, 0x40, 0x02, 0xD4, 0x14, 0xD4, 0x80,
+        0x04, 0xD4, 0x14, 0xD4, 0x05, 0x40, 0xD3, 0x80, 0x12, 0x80, 0xD4, 0x07,
+        0x80, 0xD6, 0x40, 0x08, 0x40, 0xD9, 0x08, 0xD7, 0x08, 0xDA, 0x08, 0xD7,
+        0x80, 0x06, 0x80, 0xD9, 0x40, 0x08, 0xF8, 0x80, 0x0A, 0xF8, 0x0B, 0x40,
+        0xF7, 0x0D, 0x80, 0xF5, 0x0E, 0xF5, 0x0E, 0xF4, 0x40, 0x0E, 0xF2, 0x80,
+        0x10, 0xF2, 0x11, 0x40, 0xF0, 0x40, 0x13, 0x80, 0xEC, 0x80, 0x16, 0xEC,
+        0x17, 0x40, 0xEA, 0x40, 0x1C, 0x80, 0xE3, 0x80, 0x1F, 0xE3, 0x20, 0x40,
+        0xE1, 0x40, 0x25, 0x80, 0xD4, 0x80, 0x2E, 0xD4, 0x2F, 0x40, 0xD2, 0x40,
+        0x17, 0x40, 0xFF, 0xC2, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x40,
+        0xFF, 0xC2, 0x40, 0x2E, 0x80, 0xD1, 0x80, 0x31, 0xD1, 0x31, 0x80, 0xD0,
+        0x40, 0x2F, 0x40, 0xD0, 0x80, 0x31, 0xD1, 0x31, 0x80, 0xD1, 0x2F, 0x40,
+        0xD3, 0x2F, 0xD4, 0x2F, 0xD3, 0x40, 0x2F, 0xD1, 0x80, 0x31, 0xD1, 0x31,
+        0x80, 0xD0, 0x40, 0x2F, 0x40, 0xD0, 0x80, 0x31, 0xD1, 0x31, 0x80, 0xD1,
+        0x2F, 0x40, 0xD3, 0x2F, 0xD4, 0x2F, 0xD3, 0x40, 0x2F, 0xD1, 0x80, 0x31,
+        0xD1, 0x31, 0x80, 0xD1, 0x2F, 0x40, 0xD3, 0x2F, 0xD4, 0x2F, 0xD3, 0x40,
+        0x2F, 0xD1, 0x80, 0x31, 0xD1, 0x31, 0x80, 0xD0, 0x40, 0x2F, 0x40, 0xD0,
+        0x80, 0x31, 0xD1, 0x31, 0x80, 0xD1, 0x2F, 0x40, 0xD3, 0x2F, 0xD4, 0x2F,
+        0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD3, 0x40, 0x2F, 0xD1, 0x80, 0x31,
+        0xD1, 0x31, 0x80, 0xD1, 0x2F, 0x40, 0xD3, 0x2F, 0xD4, 0x2F, 0xD3, 0x40,
+        0x2F, 0xD1, 0x80, 0x31, 0xD1, 0x31, 0x80, 0xD1, 0x2F, 0x40, 0xD3, 0x2F,
+        0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD3, 0x40, 0x2F, 0xD1,
+        0x80, 0x31, 0xD1, 0x32, 0xD1, 0x32, 0xD1, 0x32, 0xD1, 0x31, 0x80, 0xD1,
+        0x2F, 0x40, 0xD3, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F,
+        0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD3, 0x40, 0x2F, 0xD1, 0x80, 0x31,
+        0xD1, 0x31, 0x80, 0xD1, 0x2F, 0x40, 0xD3, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F,
+        0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F, 0xD4, 0x2F,
+        0xD4, 0x2F, 0xD4, 0x2F, 0x40, 0xD2, 0x40, 0x20, 0x17, 0x40, 0xD2, 0x40,
+        0x32, 0xD4, 0x31, 0x80, 0xD4, 0x80, 0x2B, 0x40, 0xE1, 0x40, 0x23, 0xE3,
+        0x22, 0x80, 0xE3, 0x80, 0x1C, 0x40, 0xEA, 0x40, 0x1A, 0xEC, 0x19, 0x80,
+        0xEC, 0x80, 0x16, 0x40, 0xF0, 0x40, 0x14, 0xF2, 0x13, 0x80, 0xF2, 0x80,
+        0x10, 0x40, 0xF6, 0x40, 0x0E, 0xF8, 0x0E, 0xF8, 0x0E, 0xF8, 0x0E, 0xF8,
+        0x0D, 0x80, 0xF8, 0x80, 0x0A, 0x40, 0xD6, 0x80, 0x0C, 0x80, 0xD6, 0x40,
+        0x08, 0xD7, 0x0E, 0xD7, 0x08, 0xD6, 0x40, 0x0E, 0x40, 0xD6, 0x08, 0xD4,
+        0x80, 0x15, 0x80, 0xD1, 0x08, 0xD4, 0x17, 0xD1, 0x08, 0xD3, 0x40, 0x17,
+        0xD1, 0x08, 0xD1, 0x80, 0x19, 0xD1, 0x08, 0xD1, 0x1A, 0xD1, 0x08, 0xD1,
+        0x1A, 0x40, 0xD0, 0x08, 0xD1, 0x1C, 0x80, 0xCE, 0x08, 0xD1, 0x1D, 0xCE,
+        0x08, 0xD1, 0x1D, 0xCE, 0x08, 0xD1, 0x1D, 0xCE, 0x08, 0xD1, 0x1D, 0xCE,
+        0x08, 0xD1, 0x1C, 0x80, 0xCE, 0x08, 0xD1, 0x1A, 0x40, 0xD0, 0x08, 0xD1,
+        0x1A, 0xD1, 0x08, 0x40, 0xD0, 0x80, 0x19, 0xD0, 0x40, 0x0A, 0x80, 0xD0,
+        0x40, 0x17, 0xCE, 0x80, 0x0D, 0xD1, 0x17, 0xCE, 0x0E, 0xD1, 0x80, 0x15,
+        0x80, 0xCE, 0x0E, 0xD3, 0x40, 0x0E, 0x40, 0xD3, 0x0E, 0xD4, 0x0E, 0xD4,
+        0x0E, 0x40, 0xD3, 0x80, 0x0C, 0x80, 0xD3, 0x40, 0x13, 0x80, 0xEF, 0x80,
+        0x16, 0xEF, 0x17, 0x40, 0xED, 0x40, 0x19, 0x80, 0xE6, 0x80, 0x1F, 0xE6,
+        0x1F, 0x80, 0xE6, 0x80, 0x1C, 0x40, 0xED, 0x40, 0x17, 0xEF, 0x16, 0x80,
+        0xEF, 0x80, 0x13, 0x40, 0xF3, 0x40, 0x11, 0xF5, 0x10, 0x80, 0xF5, 0x80,
+        0x0D, 0x40, 0xD6, 0x80, 0x09, 0x80, 0xD6, 0x40, 0x0B, 0xD7, 0x0B, 0xD7,
+        0x0A, 0x80, 0xD6, 0x40, 0x0B, 0x40, 0xD6, 0x80, 0x07, 0x40, 0xD3, 0x80,
+        0x15, 0x80, 0xD3, 0x40, 0x05, 0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17, 0xD4,
+        0x05, 0xD4, 0x17, 0xD4, 0x05, 0xD4, 0x17, 0xD4, 0x04, 0x80, 0xD3, 0x40,
+        0x17, 0x40, 0xD3, 0x80, 0x01, 0x40, 0xD3, 0x80, 0x1B, 0x80, 0xD3, 0x40,
+        0xD4, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D,
+        0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D,
+        0xE9, 0x1D, 0xE9, 0x80, 0x1B, 0x80, 0xEB, 0x40, 0x17, 0x40, 0xEE, 0x17,
+        0xEF, 0x17, 0xD6, 0x40, 0xD7, 0x17, 0xD4, 0x80, 0x01, 0xD7, 0x17, 0xD4,
+        0x02, 0x40, 0xD6, 0x80, 0x15, 0x80, 0xD4, 0x04, 0x80, 0xD6, 0x40, 0x0E,
+        0x40, 0xD9, 0x05, 0xD7, 0x0E, 0xDA, 0x05, 0xD7, 0x80, 0x0C, 0x80, 0xDA,
+        0x05, 0xFF, 0xC1, 0x05, 0xFF, 0xC1, 0x05, 0x40, 0xFF, 0x40, 0x07, 0x80,
+        0xFB, 0x80, 0x0A, 0xFB, 0x0B, 0x40, 0xF9, 0x40, 0x0D, 0x80, 0xF5, 0x80,
+        0x10, 0xF5, 0x11, 0x40, 0xF3, 0x40, 0x13, 0x80, 0xEF, 0x80, 0x16, 0xEF,
+        0x17, 0x40, 0xED, 0x40, 0x19, 0x80, 0xE6, 0x80, 0x1F, 0xE6, 0x20, 0x40,
+        0xE4, 0x40, 0x28, 0x80, 0xD7, 0x80, 0x2E, 0xD7, 0x2F, 0x40, 0xD5, 0x40,
+        0x17, 0x17, 0x40, 0xD5, 0x40, 0x2F, 0xD7, 0x2E, 0x80, 0xD7, 0x80, 0x28,
+        0x40, 0xE1, 0x40, 0x23, 0xE3, 0x22, 0x80, 0xE3, 0x80, 0x1C, 0x40, 0xEA,
+        0x40, 0x1A, 0xEC, 0x19, 0x80, 0xEC, 0x80, 0x16, 0x40, 0xF0, 0x40, 0x14,
+        0xF2, 0x13, 0x80, 0xF2, 0x80, 0x10, 0x40, 0xF6, 0x40, 0x0E, 0xF8, 0x0E,
+        0xF8, 0x80, 0x0D, 0xFA, 0x40, 0x0B, 0xFB, 0x0A, 0x80, 0xFB, 0x08, 0x40,
+        0xD9, 0x80, 0x09, 0x80, 0xD7, 0x08, 0xDA, 0x0B, 0xD7, 0x08, 0xD9, 0x40,
+        0x0B, 0x40, 0xD6, 0x80, 0x07, 0xD4, 0x80, 0x12, 0x80, 0xD6, 0x40, 0x05,
+        0xD4, 0x14, 0xD7, 0x04, 0x80, 0xD4, 0x14, 0x40, 0xD6, 0x02, 0x40, 0xD6,
+        0x16, 0x80, 0xD4, 0x02, 0xD7, 0x17, 0xD4, 0x02, 0xD6, 0x40, 0x17, 0x40,
+        0xD3, 0x02, 0xD4, 0x80, 0x1B, 0x80, 0xD1, 0x02, 0xD4, 0x1D, 0xD1, 0x02,
+        0xD4, 0x1D, 0xD1, 0x02, 0xD4, 0x1D, 0xD1, 0x02, 0xD4, 0x1D, 0xD1, 0x02,
+        0xD4, 0x1D, 0xD1, 0x80, 0x01, 0xD4, 0x1D, 0xD3, 0x40, 0xD4, 0x1D, 0xE9,
+        0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9,
+        0x1D, 0xE9, 0x1D, 0xE9, 0x1D, 0xE9, 0x80, 0x1B, 0x80, 0xEB, 0x40, 0x17,
+        0x40, 0xEE, 0x17, 0xD7, 0x40, 0xD6, 0x16, 0x80, 0xD7, 0x01, 0x80, 0xD4,
+        0x14, 0x40, 0xD9, 0x02, 0xD4, 0x14, 0xDA, 0x02, 0xD4, 0x80, 0x12, 0x80,
+        0xDA, 0x02, 0xD9, 0x40, 0x0B, 0x40, 0xDC, 0x02, 0xDA, 0x0B, 0xDD, 0x02,
+        0xDA, 0x80, 0x09, 0x80, 0xDD, 0x02, 0xFF, 0xC4, 0x02, 0xFF, 0xC4, 0x02,
+        0x40, 0xFF, 0xC3, 0x04, 0x80, 0xFF, 0xC1, 0x05, 0xFF, 0xC1, 0x05, 0x40,
+        0xFF, 0xC0, 0x07, 0x80, 0xFE, 0x08, 0xFE, 0x08, 0x40, 0xFD, 0x0A, 0x80,
+        0xE3, 0x80, 0x00, 0x80, 0xD4, 0x0B, 0xE3, 0x02, 0xD4, 0x0B, 0x40, 0xE1,
+        0x40, 0x02, 0xD4, 0x0D, 0x80, 0xDD, 0x80, 0x04, 0xD4, 0x0E, 0xDD, 0x05,
+        0xD4, 0x0E, 0x40, 0xDB, 0x40, 0x05, 0xD3, 0x40, 0x13, 0x80, 0xD4, 0x80,
+        0x07, 0xD1, 0x80, 0x16, 0xD4, 0x08, 0xD1, 0x17, 0x40, 0xD2, 0x40, 0x08,
+        0xD1, 0x35, 0xD1, 0x35, 0xD1, 0x34, 0x80, 0xD1, 0x32, 0x40, 0xD3, 0x32,
+        0xD4, 0x32, 0xD4, 0x32, 0xD4, 0x32, 0xD4, 0x31, 0x80, 0xD3, 0x40, 0x05,
+        0x40, 0xD2, 0x40, 0x14, 0x40, 0xD3, 0x80, 0x07, 0xD4, 0x14, 0xD4, 0x08,
+        0xD4, 0x80, 0x12, 0x80, 0xD4, 0x08, 0xD6, 0x40, 0x0E, 0x40, 0xD6, 0x08,
+        0xD7, 0x0E, 0xD7, 0x08, 0xD7, 0x80, 0x0C, 0x80, 0xD6, 0x40, 0x08, 0xFB,
+        0x80, 0x0A, 0xFB, 0x0B, 0x40, 0xFA, 0x0D, 0x80, 0xF8, 0x0E, 0xF8, 0x0E,
+        0xF7, 0x40, 0x0E, 0xF5, 0x80, 0x10, 0xF5, 0x11, 0x40, 0xF3, 0x40, 0x13,
+        0x80, 0xEF, 0x80, 0x16, 0xEF, 0x17, 0x40, 0xED, 0x40, 0x1C, 0x80, 0xE3,
+        0x80, 0x22, 0xE3, 0x23, 0x40, 0xE1, 0x40, 0x28, 0x80, 0xD7, 0x80, 0x2E,
+        0xD7, 0x2F, 0x40, 0xD5, 0x40, 0x1A, 0x2B, 0x8C, 0x3F, 0x17, 0xCC, 0x3F,
+        0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F,
+        0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F,
+        0x17, 0xCC, 0x3D, 0x40, 0xC0, 0x80, 0x16, 0xCC, 0x16, 0x80, 0xC0, 0x40,
+        0x22, 0x40, 0xC2, 0x80, 0x15, 0xCC, 0x15, 0x80, 0xC2, 0x40, 0x20, 0x40,
+        0xC4, 0x80, 0x14, 0xCC, 0x14, 0x80, 0xC4, 0x40, 0x1E, 0x40, 0xC6, 0x80,
+        0x13, 0xCC, 0x13, 0x80, 0xC6, 0x40, 0x1C, 0x40, 0xC8, 0x80, 0x12, 0xCC,
+        0x12, 0x80, 0xC8, 0x40, 0x1A, 0x40, 0xCA, 0x80, 0x0E, 0x40, 0x81, 0xCC,
+        0x81, 0x40, 0x0E, 0x80, 0xCA, 0x40, 0x18, 0x40, 0xCC, 0x80, 0x0A, 0x40,
+        0x80, 0xD4, 0x80, 0x40, 0x0A, 0x80, 0xCC, 0x40, 0x16, 0x40, 0xCE, 0x80,
+        0x07, 0x80, 0xDA, 0x80, 0x07, 0x80, 0xCE, 0x40, 0x15, 0xD0, 0x80, 0x04,
+        0x80, 0xDE, 0x80, 0x04, 0x80, 0xD0, 0x15, 0x80, 0xD0, 0x80, 0x01, 0x80,
+        0xE2, 0x80, 0x01, 0x80, 0xD0, 0x80, 0x16, 0x80, 0xD0, 0x80, 0xE6, 0x80,
+        0xD0, 0x80, 0x18, 0x80, 0xFF, 0xC8, 0x80, 0x1A, 0x80, 0xFF, 0xC6, 0x80,
+        0x1C, 0x80, 0xFF, 0xC4, 0x80, 0x1E, 0x80, 0xFF, 0xC2, 0x80, 0x20, 0x80,
+        0xFF, 0xC0, 0x80, 0x22, 0x80, 0xFE, 0x80, 0x24, 0x80, 0xFC, 0x80, 0x26,
+        0x80, 0xFA, 0x80, 0x28, 0x80, 0xF8, 0x80, 0x29, 0xFA, 0x28, 0x80, 0xFA,
+        0x80, 0x27, 0xFC, 0x26, 0x80, 0xFC, 0x80, 0x25, 0xDB, 0x86, 0xDB, 0x24,
+        0x80, 0xD8, 0x80, 0x40, 0x08, 0x40, 0x80, 0xD8, 0x80, 0x23, 0xD7, 0x80,
+        0x40, 0x0C, 0x40, 0x80, 0xD7, 0x22, 0x40, 0xD6, 0x80, 0x10, 0x80, 0xD6,
+        0x40, 0x21, 0x80, 0xD5, 0x40, 0x12, 0x40, 0xD5, 0x80, 0x21, 0xD5, 0x40,
+        0x14, 0x40, 0xD5, 0x20, 0x40, 0xD4, 0x80, 0x16, 0x80, 0xD4, 0x40, 0x1F,
+        0x80, 0xD3, 0x80, 0x18, 0x80, 0xD3, 0x80, 0x1F, 0x80, 0xD3, 0x40, 0x18,
+        0x40, 0xD3, 0x80, 0x0F, 0x80, 0xE2, 0x80, 0x1A, 0x80, 0xE2, 0x81, 0xE2,
+        0x40, 0x1A, 0x40, 0xE2, 0x81, 0xE2, 0x1C, 0xE2, 0x81, 0xE1, 0x80, 0x1C,
+        0x80, 0xE1, 0x81, 0xE1, 0x80, 0x1C, 0x80, 0xE1, 0x81, 0xE1, 0x80, 0x1C,
+        0x80, 0xE1, 0x81, 0xE1, 0x80, 0x1C, 0x80, 0xE1, 0x81, 0xE1, 0x80, 0x1C,
+        0x80, 0xE1, 0x81, 0xE1, 0x80, 0x1C, 0x80, 0xE1, 0x81, 0xE1, 0x80, 0x1C,
+        0x80, 0xE1, 0x81, 0xE2, 0x1C, 0xE2, 0x81, 0xE2, 0x40, 0x1A, 0x40, 0xE2,
+        0x81, 0xE2, 0x80, 0x1A, 0x80, 0xE2, 0x80, 0x0F, 0x80, 0xD3, 0x40, 0x18,
+        0x40, 0xD3, 0x80, 0x1F, 0x80, 0xD3, 0x80, 0x18, 0x80, 0xD3, 0x80, 0x1F,
+        0x40, 0xD4, 0x80, 0x16, 0x80, 0xD4, 0x40, 0x20, 0xD5, 0x40, 0x14, 0x40,
+        0xD5, 0x21, 0x80, 0xD5, 0x40, 0x12, 0x40, 0xD5, 0x80, 0x21, 0x40, 0xD6,
+        0x80, 0x10, 0x80, 0xD6, 0x40, 0x22, 0xD7, 0x80, 0x40, 0x0C, 0x40, 0x80,
+        0xD7, 0x23, 0x80, 0xD8, 0x80, 0x40, 0x08, 0x40, 0x80, 0xD8, 0x80, 0x24,
+        0xDB, 0x86, 0xDB, 0x25, 0x80, 0xFC, 0x80, 0x26, 0xFC, 0x27, 0x80, 0xFA,
+        0x80, 0x28, 0xFA, 0x29, 0x80, 0xF8, 0x80, 0x28, 0x80, 0xFA, 0x80, 0x26,
+        0x80, 0xFC, 0x80, 0x24, 0x80, 0xFE, 0x80, 0x22, 0x80, 0xFF, 0xC0, 0x80,
+        0x20, 0x80, 0xFF, 0xC2, 0x80, 0x1E, 0x80, 0xFF, 0xC4, 0x80, 0x1C, 0x80,
+        0xFF, 0xC6, 0x80, 0x1A, 0x80, 0xFF, 0xC8, 0x80, 0x18, 0x80, 0xD0, 0x80,
+        0xE6, 0x80, 0xD0, 0x80, 0x16, 0x80, 0xD0, 0x80, 0x01, 0x80, 0xE2, 0x80,
+        0x01, 0x80, 0xD0, 0x80, 0x15, 0xD0, 0x80, 0x04, 0x80, 0xDE, 0x80, 0x04,
+        0x80, 0xD0, 0x15, 0x40, 0xCE, 0x80, 0x07, 0x80, 0xDA, 0x80, 0x07, 0x80,
+        0xCE, 0x40, 0x16, 0x40, 0xCC, 0x80, 0x0A, 0x40, 0x80, 0xD4, 0x80, 0x40,
+        0x0A, 0x80, 0xCC, 0x40, 0x18, 0x40, 0xCA, 0x80, 0x0E, 0x40, 0x81, 0xCC,
+        0x81, 0x40, 0x0E, 0x80, 0xCA, 0x40, 0x1A, 0x40, 0xC8, 0x80, 0x12, 0xCC,
+        0x12, 0x80, 0xC8, 0x40, 0x1C, 0x40, 0xC6, 0x80, 0x13, 0xCC, 0x13, 0x80,
+        0xC6, 0x40, 0x1E, 0x40, 0xC4, 0x80, 0x14, 0xCC, 0x14, 0x80, 0xC4, 0x40,
+        0x20, 0x40, 0xC2, 0x80, 0x15, 0xCC, 0x15, 0x80, 0xC2, 0x40, 0x22, 0x40,
+        0xC0, 0x80, 0x16, 0xCC, 0x16, 0x80, 0xC0, 0x40, 0x3D, 0xCC, 0x3F, 0x17,
+        0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17,
+        0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17, 0xCC, 0x3F, 0x17,
+        0xCC, 0x3F, 0x17, 0x8C, 0x2B, 0x30, 0x41, 0x83, 0xC8, 0x83, 0x41, 0x3F,
+        0x1C, 0x40, 0x81, 0xD8, 0x81, 0x40, 0x3F, 0x13, 0x40, 0x81, 0xE0, 0x81,
+        0x40, 0x3F, 0x0C, 0x40, 0x80, 0xE8, 0x80, 0x40, 0x3F, 0x06, 0x40, 0x80,
+        0xEE, 0x80, 0x40, 0x3F, 0x01, 0x40, 0x80, 0xCE, 0x82, 0x42, 0x08, 0x42,
+        0x82, 0xCE, 0x80, 0x40, 0x3D, 0x80, 0xCC, 0x81, 0x41, 0x16, 0x41, 0x81,
+        0xCC, 0x80, 0x39, 0x80, 0xCB, 0x80, 0x40, 0x20, 0x40, 0x80, 0xCB, 0x80,
+        0x35, 0x40, 0xCA, 0x80, 0x40, 0x26, 0x40, 0x80, 0xCA, 0x40, 0x31, 0x40,
+        0x80, 0xC8, 0x80, 0x40, 0x2C, 0x40, 0x80, 0xC8, 0x80, 0x40, 0x2E, 0x80,
+        0xC8, 0x80, 0x40, 0x30, 0x40, 0x80, 0xC8, 0x80, 0x2B, 0x40, 0xC8, 0x80,
+        0x36, 0x80, 0xC8, 0x40, 0x28, 0x80, 0xC7, 0x80, 0x3A, 0x80, 0xC7, 0x80,
+        0x25, 0x40, 0x80, 0xC6, 0x80, 0x40, 0x3C, 0x40, 0x80, 0xC6, 0x80, 0x40,
+        0x22, 0x40, 0xC7, 0x40, 0x3F, 0x00, 0x40, 0xC7, 0x40, 0x20, 0x80, 0xC6,
+        0x80, 0x3F, 0x04, 0x80, 0xC6, 0x80, 0x1E, 0x80, 0xC6, 0x40, 0x3F, 0x06,
+        0x40, 0xC6, 0x80, 0x1C, 0x80, 0xC5, 0x80, 0x40, 0x3F, 0x08, 0x40, 0x80,
+        0xC5, 0x80, 0x1A, 0x80, 0xC5, 0x80, 0x3F, 0x0C, 0x80, 0xC5, 0x80, 0x18,
+        0x80, 0xC5, 0x40, 0x3F, 0x0E, 0x40, 0xC5, 0x80, 0x16, 0x80, 0xC5, 0x40,
+        0x1F, 0x40, 0x83, 0xC6, 0x83, 0x40, 0x1F, 0x40, 0xC5, 0x80, 0x14, 0x80,
+        0xC5, 0x40, 0x1B, 0x41, 0x80, 0xD4, 0x80, 0x41, 0x1B, 0x40, 0xC5, 0x80,
+        0x12, 0x80, 0xC5, 0x40, 0x19, 0x40, 0x80, 0xDC, 0x80, 0x40, 0x19, 0x40,
+        0xC5, 0x80, 0x10, 0x80, 0xC5, 0x40, 0x18, 0x40, 0xE2, 0x40, 0x18, 0x40,
+        0xC5, 0x80, 0x0E, 0x80, 0xC5, 0x40, 0x17, 0x80, 0xE6, 0x80, 0x17, 0x40,
+        0xC5, 0x80, 0x0C, 0x40, 0xC5, 0x40, 0x16, 0x80, 0xCC, 0x81, 0x42, 0x06,
+        0x42, 0x81, 0xCC, 0x80, 0x16, 0x40, 0xC5, 0x40, 0x0A, 0x40, 0xC5, 0x40,
+        0x15, 0x80, 0xCA, 0x80, 0x41, 0x12, 0x41, 0x80, 0xCA, 0x80, 0x15, 0x40,
+        0xC5, 0x40, 0x09, 0x80, 0xC4, 0x40, 0x14, 0x40, 0xC9, 0x80, 0x40, 0x1A,
+        0x40, 0x80, 0xC9, 0x40, 0x14, 0x40, 0xC4, 0x80, 0x08, 0x80, 0xC4, 0x80,
+        0x14, 0x80, 0xC8, 0x80, 0x20, 0x80, 0xC8, 0x80, 0x14, 0x80, 0xC4, 0x80,
+        0x06, 0x40, 0xC4, 0x80, 0x13, 0x40, 0x80, 0xC7, 0x80, 0x24, 0x80, 0xC7,
+        0x80, 0x40, 0x13, 0x80, 0xC4, 0x40, 0x05, 0xC5, 0x40, 0x12, 0x40, 0xC7,
+        0x80, 0x28, 0x80, 0xC7, 0x40, 0x12, 0x40, 0xC5, 0x04, 0x80, 0xC4, 0x40,
+        0x12, 0x80, 0xC6, 0x80, 0x2C, 0x80, 0xC6, 0x80, 0x12, 0x40, 0xC4, 0x80,
+        0x02, 0x40, 0xC4, 0x80, 0x12, 0x80, 0xC6, 0x40, 0x2E, 0x40, 0xC6, 0x80,
+        0x12, 0x80, 0xC4, 0x40, 0x01, 0x80, 0xC4, 0x12, 0x80, 0xC5, 0x80, 0x40,
+        0x30, 0x40, 0x80, 0xC5, 0x80, 0x12, 0xC4, 0x80, 0x00, 0x40, 0xC4, 0x40,
+        0x11, 0x80, 0xC5, 0x80, 0x34, 0x80, 0xC5, 0x80, 0x11, 0x40, 0xC4, 0x41,
+        0xC3, 0x80, 0x11, 0x80, 0xC5, 0x80, 0x36, 0x80, 0xC5, 0x80, 0x11, 0x80,
+        0xC3, 0x40, 0x01, 0x80, 0xC1, 0x40, 0x10, 0x80, 0xC5, 0x40, 0x38, 0x40,
+        0xC5, 0x80, 0x10, 0x40, 0xC1, 0x80, 0x05, 0x40, 0x10, 0x40, 0xC5, 0x40,
+        0x3A, 0x40, 0xC5, 0x40, 0x10, 0x40, 0x18, 0x40, 0xC5, 0x40, 0x3C, 0x40,
+        0xC5, 0x40, 0x29, 0x80, 0xC4, 0x80, 0x3E, 0x80, 0xC4, 0x80, 0x28, 0x80,
+        0xC4, 0x80, 0x19, 0x40, 0x82, 0xC4, 0x82, 0x40, 0x19, 0x80, 0xC4, 0x80,
+        0x26, 0x40, 0xC4, 0x80, 0x17, 0x40, 0x80, 0xCE, 0x80, 0x40, 0x17, 0x80,
+        0xC4, 0x40, 0x25, 0xC5, 0x40, 0x14, 0x40, 0x80, 0xD4, 0x80, 0x40, 0x14,
+        0x40, 0xC5, 0x24, 0x80, 0xC4, 0x40, 0x13, 0x40, 0x80, 0xD8, 0x80, 0x40,
+        0x13, 0x40, 0xC4, 0x80, 0x23, 0xC4, 0x80, 0x13, 0x80, 0xDC, 0x80, 0x13,
+        0x80, 0xC4, 0x23, 0x40, 0x80, 0xC2, 0x12, 0x40, 0x80, 0xC8, 0x81, 0x41,
+        0x04, 0x41, 0x81, 0xC8, 0x80, 0x40, 0x12, 0xC2, 0x80, 0x40, 0x25, 0x40,
+        0xC0, 0x80, 0x11, 0x40, 0xC8, 0x40, 0x0E, 0x40, 0xC8, 0x40, 0x11, 0x80,
+        0xC0, 0x40, 0x3B, 0x40, 0xC7, 0x40, 0x12, 0x40, 0xC7, 0x40, 0x3F, 0x0E,
+        0x40, 0xC6, 0x80, 0x16, 0x80, 0xC6, 0x40, 0x3F, 0x0C, 0x40, 0xC5, 0x80,
+        0x40, 0x18, 0x40, 0x80, 0xC5, 0x40, 0x3F, 0x0A, 0x40, 0xC5, 0x80, 0x1C,
+        0x80, 0xC5, 0x40, 0x3F, 0x09, 0x80, 0xC4, 0x80, 0x1E, 0x80, 0xC4, 0x80,
+        0x3F, 0x08, 0x80, 0xC4, 0x80, 0x20, 0x80, 0xC4, 0x80, 0x3F, 0x06, 0x40,
+        0xC4, 0x80, 0x22, 0x80, 0xC4, 0x40, 0x3F, 0x05, 0x40, 0xC4, 0x40, 0x22,
+        0x40, 0xC4, 0x40, 0x3F, 0x07, 0x80, 0xC1, 0x80, 0x24, 0x80, 0xC1, 0x80,
+        0x3F, 0x0B, 0x80, 0x26, 0x80, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+        0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+        0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x18, 0x40,
+        0x82, 0x40, 0x3F, 0x2F, 0x80, 0xC6, 0x80, 0x3F, 0x2B, 0x80, 0xCA, 0x80,
+        0x3F, 0x28, 0x80, 0xCC, 0x80, 0x3F, 0x26, 0x80, 0xCE, 0x80, 0x3F, 0x25,
+        0xD0, 0x3F, 0x24, 0x80, 0xD0, 0x80, 0x3F, 0x23, 0xD2, 0x3F, 0x22, 0x40,
+        0xD2, 0x40, 0x3F, 0x21, 0x80, 0xD2, 0x80, 0x3F, 0x21, 0x80, 0xD2, 0x80,
+        0x3F, 0x21, 0x80, 0xD2, 0x80, 0x3F, 0x21, 0x40, 0xD2, 0x40, 0x3F, 0x22,
+        0xD2, 0x3F, 0x23, 0x80, 0xD0, 0x80, 0x3F, 0x24, 0xD0, 0x3F, 0x25, 0x80,
+        0xCE, 0x80, 0x3F, 0x26, 0x80, 0xCC, 0x80, 0x3F, 0x28, 0x80, 0xCA, 0x80,
+        0x3F, 0x2B, 0x80, 0xC6, 0x80, 0x3F, 0x2F, 0x40, 0x82, 0x40, 0x38, 0x19,
+        0x40, 0x82, 0xC6, 0x82, 0x40, 0x2F, 0x40, 0x80, 0xD2, 0x80, 0x40, 0x28,
+        0x40, 0x80, 0xD8, 0x80, 0x40, 0x23, 0x40, 0xDE, 0x40, 0x1F, 0x40, 0xE2,
+        0x40, 0x1B, 0x40, 0x80, 0xCA, 0x81, 0x42, 0x04, 0x42, 0x81, 0xCA, 0x80,
+        0x40, 0x18, 0x80, 0xC9, 0x80, 0x40, 0x10, 0x40, 0x80, 0xC9, 0x80, 0x15,
+        0x40, 0x80, 0xC7, 0x80, 0x40, 0x16, 0x40, 0x80, 0xC7, 0x80, 0x40, 0x12,
+        0x40, 0xC7, 0x80, 0x1C, 0x80, 0xC7, 0x40, 0x10, 0x40, 0xC6, 0x80, 0x40,
+        0x1E, 0x40, 0x80, 0xC6, 0x40, 0x0E, 0x80, 0xC6, 0x40, 0x22, 0x40, 0xC6,
+        0x80, 0x0C, 0x80, 0xC5, 0x80, 0x40, 0x0B, 0x40, 0x82, 0xC4, 0x82, 0x40,
+        0x0B, 0x40, 0x80, 0xC5, 0x80, 0x0A, 0x40, 0xC5, 0x80, 0x0A, 0x40, 0x80,
+        0xCE, 0x80, 0x40, 0x0A, 0x80, 0xC5, 0x40, 0x08, 0x40, 0xC5, 0x80, 0x09,
+        0x80, 0xD4, 0x80, 0x09, 0x80, 0xC5, 0x40, 0x06, 0x40, 0xC5, 0x80, 0x08,
+        0x80, 0xD8, 0x80, 0x08, 0x80, 0xC5, 0x40, 0x05, 0x80, 0xC4, 0x80, 0x07,
+        0x40, 0xDC, 0x40, 0x07, 0x80, 0xC4, 0x80, 0x04, 0x80, 0xC4, 0x80, 0x07,
+        0x80, 0xC9, 0x80, 0x41, 0x04, 0x41, 0x80, 0xC9, 0x80, 0x07, 0x80, 0xC4,
+        0x80, 0x02, 0x40, 0xC4, 0x80, 0x07, 0x80, 0xC7, 0x80, 0x40, 0x0C, 0x40,
+        0x80, 0xC7, 0x80, 0x07, 0x80, 0xC4, 0x40, 0x01, 0x80, 0xC4, 0x40, 0x06,
+        0x80, 0xC6, 0x80, 0x12, 0x80, 0xC6, 0x80, 0x06, 0x40, 0xC4, 0x80, 0x00,
+        0x40, 0xC4, 0x40, 0x06, 0x80, 0xC5, 0x80, 0x16, 0x80, 0xC5, 0x80, 0x06,
+        0x40, 0xC4, 0x40, 0x01, 0x80, 0xC1, 0x80, 0x06, 0x80, 0xC5, 0x40, 0x18,
+        0x40, 0xC5, 0x80, 0x06, 0x80, 0xC1, 0x80, 0x04, 0x40, 0x80, 0x40, 0x05,
+        0x80, 0xC5, 0x40, 0x1A, 0x40, 0xC5, 0x80, 0x05, 0x40, 0x80, 0x40, 0x0D,
+        0x40, 0xC5, 0x40, 0x08, 0x41, 0x80, 0xC4, 0x80, 0x41, 0x08, 0x40, 0xC5,
+        0x40, 0x15, 0xC5, 0x40, 0x07, 0x40, 0x80, 0xCA, 0x80, 0x40, 0x07, 0x40,
+        0xC5, 0x14, 0x80, 0xC4, 0x40, 0x06, 0x40, 0x80, 0xCE, 0x80, 0x40, 0x06,
+        0x40, 0xC4, 0x80, 0x14, 0x80, 0xC2, 0x80, 0x06, 0x40, 0xD2, 0x40, 0x06,
+        0x80, 0xC2, 0x80, 0x17, 0x80, 0xC0, 0x06, 0x40, 0xD4, 0x40, 0x06, 0xC0,
+        0x80, 0x21, 0x40, 0xC6, 0x80, 0x41, 0x02, 0x41, 0x80, 0xC6, 0x40, 0x28,
+        0x40, 0xC6, 0x40, 0x08, 0x40, 0xC6, 0x40, 0x27, 0x80, 0xC4, 0x80, 0x0C,
+        0x80, 0xC4, 0x80, 0x27, 0x40, 0xC3, 0x80, 0x0E, 0x80, 0xC3, 0x40, 0x29,
+        0x80, 0xC1, 0x10, 0xC1, 0x80, 0x2D, 0x40, 0x10, 0x40, 0x3F, 0x3F, 0x3F,
+        0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0C, 0x40, 0x80, 0x40, 0x3D, 0x80, 0xC4,
+        0x80, 0x3A, 0x80, 0xC6, 0x80, 0x39, 0xC8, 0x38, 0x40, 0xC8, 0x40, 0x37,
+        0x80, 0xC8, 0x80, 0x37, 0x40, 0xC8, 0x40, 0x38, 0xC8, 0x39, 0x80, 0xC6,
+        0x80, 0x3A, 0x80, 0xC4, 0x80, 0x3D, 0x40, 0x80, 0x40, 0x1F
+    };
+
+    // Digits 0-9 at text sizes 1, 2, 3: AtlasDigits[ size - 1 ][ digit ]
+    constexpr uint8_t ATLAS_DIGIT_SIZES = 3;
+    const AtlasGlyph AtlasDigits[ ATLAS_DIGIT_SIZES ][ 10 ] = {
+        {
+            {     0,  24,  35,    1,  -33,  26 },
+            {    93,  14,  33,    4,  -32,  26 },
+            {   152,  23,  34,    2,  -33,  26 },
+            {   224,  23,  35,    2,  -33,  26 },
+            {   307,  22,  33,    2,  -32,  26 },
+            {   392,  23,  34,    2,  -32,  26 },
+            {   469,  23,  35,    2,  -33,  26 },
+            {   564,  23,  33,    1,  -32,  26 },
+            {   622,  24,  35,    1,  -33,  26 },
+            {   719,  24,  35,    1,  -33,  26 }
+        },
+        {
+            {   816,  48,  70,    2,  -66,  52 },
+            {  1081,  28,  66,    8,  -64,  52 },
+            {  1218,  46,  68,    4,  -66,  52 },
+            {  1454,  46,  70,    4,  -66,  52 },
+            {  1719,  44,  66,    4,  -64,  52 },
+            {  1938,  46,  68,    4,  -64,  52 },
+            {  2171,  46,  70,    4,  -66,  52 },
+            {  2456,  46,  66,    2,  -64,  52 },
+            {  2625,  48,  70,    2,  -66,  52 },
+            {  2940,  48,  70,    2,  -66,  52 }
+        },
+        {
+            {  3239,  72, 105,    3,  -99,  78 },
+            {  3594,  42,  99,   12,  -96,  78 },
+            {  3793,  69, 102,    6,  -99,  78 },
+            {  4110,  69, 105,    6,  -99,  78 },
+            {  4457,  66,  99,    6,  -96,  78 },
+            {  4769,  69, 102,    6,  -96,  78 },
+            {  5082,  69, 105,    6,  -99,  78 },
+            {  5461,  69,  99,    3,  -96,  78 },
+            {  5696,  72, 105,    3,  -99,  78 },
+            {  6109,  72, 105,    3,  -99,  78 }
+        }
+    };
+
+    const AtlasGlyph AtlasIconConfig = {  6510, 101, 101,  -50,  -50,   0 };
+    const AtlasGlyph AtlasIconWiFi = {  7133, 119,  93,  -59,  -42,   0 };
+    const AtlasGlyph AtlasIconWiFiSmall = {  7919,  67,  51,  -33,  -23,   0 };
+
+} // namespace Display
@@ -0,0 +1,89 @@
+/**
+ * @file PaletteCanvas.h
+ * @brief 4-bit palette-indexed off-screen canvas for Arduino_GFX
+ *
+ * Drop-in replacement for Arduino_Canvas that stores 4 bits per pixel
+ * instead of 16. STAC screens use only a few colours at a time (a tally
+ * background plus one foreground), so a 16-entry palette covers them.
+ *
+ * On flush() the canvas is expanded to RGB565 one band of rows at a time
+ * and pushed to the panel, so only a small line buffer is needed:
+ *
+ * | Panel    | Arduino_Canvas | PaletteCanvas (buffer + band) |
+ * |----------|----------------|-------------------------------|
+ * | 135x240  | 64800 bytes    | 16320 + 2160 bytes            |
+ * | 240x135  | 64800 bytes    | 16200 + 3840 bytes            |
+ * | 128x128  | 32768 bytes    | 8192 + 2048 bytes             |
+ *
+ * Palette rules:
+ * - A full-canvas fill resets the palette to that single colour
+ * - New colours take the next free entry
+ * - When all 16 entries are in use, the nearest existing colour is used
+ *
+ * Rotation is not supported; DisplayTFT rotates the panel and recreates
+ * the canvas at the rotated size instead.
+ */
+
+#pragma once
+
+#include <Arduino_GFX_Library.h>
+
+namespace Display {
+
+    class PaletteCanvas : public Arduino_GFX {
+      public:
+        static constexpr uint8_t PALETTE_SIZE = 16;
+        static constexpr uint8_t BAND_ROWS = 8;     ///< Rows expanded per panel transfer
+
+        /**
+         * @brief Construct a palette canvas
+         * @param w Canvas width
+         * @param h Canvas height
+         * @param output Panel to flush to (not owned)
+         * @param output_x X position of the canvas on the panel
+         * @param output_y Y position of the canvas on the panel
+         */
+        PaletteCanvas( int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0 );
+        ~PaletteCanvas();
+
+        bool begin( int32_t speed = GFX_NOT_DEFINED ) override;
+        void writePixelPreclipped( int16_t x, int16_t y, uint16_t color ) override;
+        void writeFillRectPreclipped( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color ) override;
+        void writeFastVLine( int16_t x, int16_t y, int16_t h, uint16_t color ) override;
+        void writeFastHLine( int16_t x, int16_t y, int16_t w, uint16_t color ) override;
+
+        /**
+         * @brief Expand the canvas to RGB565 band by band and push it to the panel
+         * @param force_flush Unused, kept for Arduino_Canvas compatibility
+         */
+        void flush( bool force_flush = false );
+
+        /**
+         * @brief Get the heap used by the index and band buffers
+         * @return Bytes allocated by begin()
+         */
+        size_t getBufferBytes() const;
+
+        /**
+         * @brief Get the number of palette entries in use
+         * @return 1-16 once the canvas has been drawn to, 0 before
+         */
+        uint8_t getPaletteCount() const {
+            return _paletteCount;
+        }
+
+      private:
+        Arduino_G *_output;
+        int16_t _output_x;
+        int16_t _output_y;
+        uint16_t _stride;           // Bytes per row of the index buffer
+        uint8_t *_indexBuffer;      // Two pixels per byte, even x in the low nibble
+        uint16_t *_bandBuffer;      // RGB565 expansion of BAND_ROWS rows
+        uint16_t _palette[ PALETTE_SIZE ];
+        uint8_t _paletteCount;
+
+        uint8_t colorIndex( uint16_t color );
+        void fillRowSpan( uint8_t *row, int16_t x, int16_t w, uint8_t index );
+    };
+
+} // namespace Display
@@ -0,0 +1,159 @@
+#ifndef STAC_POWER_MANAGER_H
+#define STAC_POWER_MANAGER_H
+
+#include <Arduino.h>
+#include <esp_wifi.h>
+#include <cstdint>
+#include "Device_Config.h"
+#include "Config/Types.h"
+
+#if defined(PMU_TYPE_AXP192)
+    #include "Hardware/Power/AXP192.h"
+#endif
+
+
+namespace Hardware {
+
+    /**
+     * @brief Energy use since begin(), as modelled and as measured
+     *
+     * Average current in mA is the same number as mAh used per hour.
+     */
+    struct EnergyReport {
+        uint32_t elapsedMs;             ///< Time covered
+        uint16_t awakePermille;         ///< Share of it with the radio fully awake (poll windows)
+        float modelMilliamps;           ///< Estimated from the duty cycle (see estimateMilliamps())
+        float measuredMilliamps;        ///< Mean battery discharge current, 0 if not measured
+        uint16_t measuredSamples;       ///< PMU samples taken on battery
+    };
+
+    /**
+     * @brief Applies the WiFi power profile and schedules modem sleep around tally polls
+     *
+     * Between polls the radio sleeps as the profile allows; wakeForPoll()
+     * takes it out of modem sleep (and, for BATTERY_SAVER, brings the CPU
+     * back to full clock) just before a poll goes out, and pollDone()
+     * lets it sleep again. A poll reply then arrives straight away instead
+     * of waiting at the access point for the next beacon the station
+     * listens to.
+     *
+     * | Profile       | Between polls                                  |
+     * |---------------|------------------------------------------------|
+     * | LOW_LATENCY   | No modem sleep                                 |
+     * | BALANCED      | Modem sleep, wakes for every DTIM beacon       |
+     * | BATTERY_SAVER | Modem sleep with a long listen interval, 80 MHz |
+     *
+     * Time awake and asleep is accounted for an energy estimate. Boards
+     * with an AXP192 also sample the battery discharge current, so the
+     * estimate can be checked against the real draw.
+     */
+    class PowerManager {
+      public:
+        /**
+         * @brief Constructor
+         * @param profile Profile to apply in begin()
+         */
+        explicit PowerManager( PowerProfile profile );
+
+        /**
+         * @brief Apply the profile's between-poll settings and start accounting (normal mode only)
+         */
+        void begin();
+
+        /**
+         * @brief Wake ahead of a poll and sample the PMU (call every loop tick)
+         * @param untilPollMs Time until the next poll is due
+         */
+        void update( unsigned long untilPollMs );
+
+        /**
+         * @brief Take the radio out of modem sleep and the CPU to full clock
+         */
+        void wakeForPoll();
+
+        /**
+         * @brief Return to the between-poll settings after a poll
+         */
+        void pollDone();
+
+        /**
+         * @brief Whether the poll-window settings are in force
+         */
+        bool isAwake() const {
+            return awake;
+        }
+
+        /**
+         * @brief How long before a poll wakeForPoll() is due (0 = never sleeps)
+         */
+        uint32_t getWakeLeadMs() const;
+
+        PowerProfile getProfile() const {
+            return profile;
+        }
+
+        /**
+         * @brief Energy use since begin()
+         */
+        EnergyReport getReport() const;
+
+        /**
+         * @brief Listen interval to associate with for a profile (0 = driver default)
+         */
+        static uint16_t listenIntervalFor( PowerProfile profile );
+
+        /**
+         * @brief Average current from the energy model
+         * @param profile Profile in force between polls
+         * @param awakeFraction Share of time in poll windows (0..1)
+         * @return Estimated mA (= mAh per hour), board loads such as the display excluded
+         */
+        static float estimateMilliamps( PowerProfile profile, float awakeFraction );
+
+        /**
+         * @brief Short name of a profile for logs
+         */
+        static const char *profileName( PowerProfile profile );
+
+      private:
+        PowerProfile profile;
+        bool started;
+        bool awake;
+        uint32_t fullCpuMhz;            // Clock at begin(), restored for polls
+        unsigned long startedAt;
+        unsigned long stateSince;       // millis() of the last wake/sleep change
+        uint32_t awakeMs;               // Accumulated poll-window time
+        unsigned long lastReportAt;
+
+        #if defined(PMU_TYPE_AXP192)
+        AXP192 pmu;                     // Already set up by the display; only read here
+        unsigned long lastSampleAt;
+        float dischargeSumMa;
+        uint16_t dischargeSamples;
+
+        void samplePMU();
+        #endif
+
+        /**
+         * @brief Modem sleep type between polls
+         */
+        wifi_ps_type_t idleSleepType() const;
+
+        /**
+         * @brief Close the current wake/sleep period in the accounting
+         */
+        void account( unsigned long now );
+
+        /**
+         * @brief Log the energy report
+         */
+        void logReport() const;
+    };
+
+} // namespace Hardware
+
+
+#endif // STAC_POWER_MANAGER_H
+
+
+//  --- EOF --- //
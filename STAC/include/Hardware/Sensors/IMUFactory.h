@@ -20,6 +20,17 @@
 
 namespace Hardware {
 
+    /**
+     * @brief Concrete IMU class for the configured board
+     */
+    #if defined(IMU_TYPE_MPU6886)
+    using BoardIMU = MPU6886_IMU;
+    #elif defined(IMU_TYPE_QMI8658)
+    using BoardIMU = QMI8658_IMU;
+    #else
+    using BoardIMU = NullIMU;
+    #endif
+
     /**
      * @brief Factory for creating IMU instances
      *
@@ -33,6 +44,17 @@ namespace Hardware {
          * @return Unique pointer to IIMU implementation
          */
         static std::unique_ptr<IIMU> create() {
+            return createBoard();
+        }
+
+        /**
+         * @brief Create the board's IMU as its concrete type
+         *
+         * Calls made through the returned pointer bind at compile time
+         * (BoardIMU is final), see STAC_STATIC_DISPATCH.
+         * @return Unique pointer to BoardIMU
+         */
+        static std::unique_ptr<BoardIMU> createBoard() {
             #if defined(IMU_TYPE_MPU6886)
             return std::make_unique<MPU6886_IMU>(
                        Config::Pins::IMU_SCL,
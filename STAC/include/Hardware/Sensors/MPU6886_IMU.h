@@ -15,7 +15,7 @@ namespace Hardware {
      * Implements IIMU interface for the MPU6886 6-axis IMU.
      * Uses I2C communication to detect device orientation.
      */
-    class MPU6886_IMU : public IIMU {
+    class MPU6886_IMU final : public IIMU {
       public:
         /**
          * @brief Construct a new MPU6886_IMU object
@@ -12,7 +12,7 @@ namespace Hardware {
      * Provides a no-op implementation that always returns UP orientation.
      * Used when IMU_HAS_IMU is false in board configuration.
      */
-    class NullIMU : public IIMU {
+    class NullIMU final : public IIMU {
       public:
         NullIMU() = default;
         ~NullIMU() override = default;
@@ -14,7 +14,7 @@ namespace Hardware {
      * Implements IIMU interface for the QMI8658 6-axis IMU.
      * Uses I2C communication to detect device orientation.
      */
-    class QMI8658_IMU : public IIMU {
+    class QMI8658_IMU final : public IIMU {
       public:
         /**
          * @brief Construct a new QMI8658_IMU object
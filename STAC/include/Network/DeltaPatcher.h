@@ -0,0 +1,180 @@
+#ifndef STAC_DELTA_PATCHER_H
+#define STAC_DELTA_PATCHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <esp_partition.h>
+#include <rom/miniz.h>
+#include "Network/OTAPipeline.h"
+
+
+namespace Net {
+
+    /**
+     * @brief Rebuilds a firmware image from a delta patch while it is received
+     *
+     * A patch (made by scripts/make_delta.py) is a header followed by COPY
+     * ops, which read a range of the running app partition, and ADD ops,
+     * which carry new bytes, stored or raw-deflated. Deflated bytes are
+     * inflated with the tinfl decompressor in ROM, through a window of
+     * INFLATE_WINDOW bytes that is only allocated while a patch with
+     * deflated ops is applied. The rebuilt image is fed to an OTAPipeline
+     * as it is produced, with the header's SHA-256 of the new image as the
+     * expected digest, so nothing is installed unless the whole image
+     * matches. The running image is hashed first and a patch made against
+     * a different release is refused before anything is written.
+     *
+     * Patch bytes may arrive split at any point.
+     *
+     * Layout (little-endian):
+     * @code
+     * header  "STDP", version u8, flags u8, reserved u16,
+     *         old size u32, new size u32, old SHA-256[32], new SHA-256[32]
+     * ops     0x01 COPY  offset u32, length u32
+     *         0x02 ADD   length u32, <length bytes>
+     *         0x03 ADD_DEFLATE  length u32, packed u32, <packed bytes of raw deflate>
+     *         0x00 END
+     * @endcode
+     */
+    class DeltaPatcher {
+      public:
+        static constexpr uint8_t FORMAT_VERSION = 2;       // 1 = no ADD_DEFLATE, still accepted
+
+        // Deflate window the patch maker compresses with (power of two, <= TINFL_LZ_DICT_SIZE)
+        static constexpr size_t INFLATE_WINDOW = 8192;
+
+        explicit DeltaPatcher( OTAPipeline &ota );
+
+        ~DeltaPatcher();
+
+        /**
+         * @brief Check whether an upload starts with the patch magic
+         * @param data First bytes of the upload
+         * @param length Number of bytes available
+         */
+        static bool isPatch( const uint8_t *data, size_t length );
+
+        /**
+         * @brief Reset for a new patch
+         */
+        void begin();
+
+        /**
+         * @brief Consume patch bytes
+         * @return false once the patch or the pipeline has failed
+         */
+        bool write( const uint8_t *data, size_t length );
+
+        /**
+         * @brief Check the patch is complete and finish the pipeline
+         * @return true if the rebuilt image is verified and set to boot
+         */
+        bool finish();
+
+        /**
+         * @brief Discard the update
+         */
+        void abort();
+
+        /**
+         * @brief Reason for the last failure
+         */
+        const char *getError() const;
+
+        /**
+         * @brief Patch bytes consumed so far
+         */
+        size_t getPatchBytes() const {
+            return patchBytes;
+        }
+
+      private:
+        struct __attribute__( ( packed ) ) Header {
+            char magic[ 4 ];
+            uint8_t version;
+            uint8_t flags;
+            uint16_t reserved;
+            uint32_t oldSize;
+            uint32_t newSize;
+            uint8_t oldSha256[ OTAPipeline::DIGEST_SIZE ];
+            uint8_t newSha256[ OTAPipeline::DIGEST_SIZE ];
+        };
+
+        enum class Stage : uint8_t {
+            HEADER,     ///< Collecting the header
+            OPCODE,     ///< Waiting for the next op
+            ARGS,       ///< Collecting op arguments
+            ADD_DATA,   ///< Passing ADD bytes through
+            INFLATE,    ///< Inflating ADD_DEFLATE bytes
+            DONE,       ///< END seen
+            FAILED
+        };
+
+        static constexpr size_t COPY_BUFFER_SIZE = 1024;
+
+        // Decompressor state and its output window, allocated on first use
+        struct Inflater {
+            tinfl_decompressor state;
+            uint8_t window[ INFLATE_WINDOW ];
+        };
+
+        OTAPipeline &ota;
+        const esp_partition_t *running;
+        Header header;
+        Stage stage;
+        uint8_t opcode;
+        uint8_t args[ 8 ];
+        size_t collected;           // Bytes of header/args gathered so far
+        size_t addRemaining;
+        size_t packedRemaining;     // ADD_DEFLATE input still to come
+        Inflater *inflater;
+        size_t windowPos;
+        size_t produced;            // Image bytes handed to the pipeline
+        size_t patchBytes;
+        const char *error;
+        uint8_t copyBuffer[ COPY_BUFFER_SIZE ];
+
+        /**
+         * @brief Check the header against the running image and start the pipeline
+         */
+        bool startImage();
+
+        /**
+         * @brief Run a COPY op from the running partition
+         */
+        bool copyFromRunning( uint32_t offset, uint32_t length );
+
+        /**
+         * @brief Start inflating an ADD_DEFLATE op
+         */
+        bool beginInflate();
+
+        /**
+         * @brief Inflate one piece of an ADD_DEFLATE op's packed bytes
+         * @param last This piece ends the op
+         */
+        bool inflate( const uint8_t *data, size_t length, bool last );
+
+        /**
+         * @brief Free the inflate window
+         */
+        void releaseInflater();
+
+        /**
+         * @brief Pass image bytes to the pipeline, enforcing the header's size
+         */
+        bool emit( const uint8_t *data, size_t length );
+
+        /**
+         * @brief Record a failure
+         */
+        bool fail( const char *reason );
+    };
+
+} // namespace Net
+
+
+#endif // STAC_DELTA_PATCHER_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,166 @@
+#ifndef STAC_FLEET_UPDATER_H
+#define STAC_FLEET_UPDATER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+#include <cstdint>
+#include "Config/Constants.h"
+#include "Network/DeltaPatcher.h"
+#include "Network/OTAPipeline.h"
+
+
+namespace Net {
+
+    /**
+     * @brief Progress of a fleet update check
+     */
+    enum class FleetUpdateState : uint8_t {
+        IDLE,           ///< Nothing scheduled
+        WAITING,        ///< Check scheduled (staggered start or re-check)
+        RUNNING,        ///< Manifest check or download in progress
+        INSTALLED,      ///< New image written and set to boot
+        FAILED          ///< Last attempt failed; a re-check is scheduled
+    };
+
+    /**
+     * @brief Pulls firmware updates from a local HTTP server in normal mode
+     *
+     * The server holds a manifest per board/build, STAC_<target>.manifest
+     * (written by `pio run -t ota`), as key=value lines:
+     * @code
+     * version=3.1.0
+     * image=STAC_v3.1.0_ATOM_Matrix_OTA.bin
+     * sha256=<64 hex digits>
+     * delta_from=3.0.0                                    (optional)
+     * delta=STAC_v3.1.0_ATOM_Matrix_DELTA_from_v3.0.0.bin  (optional)
+     * restart=0
+     * @endcode
+     *
+     * When the manifest version is newer than the running one, the image
+     * (or the delta, if it was made from the running version) is streamed
+     * through the OTA pipeline from a background task, at most
+     * RATE_LIMIT_BPS and with a fixed-size buffer. The first check waits a
+     * delay derived from the STAC ID, so a room full of units powered up
+     * together doesn't download at once. The new image boots at the next
+     * restart; with restart=1 the application restarts when the tally is
+     * idle (see isRestartPending()).
+     */
+    class FleetUpdater {
+      public:
+        /**
+         * @brief Constructor
+         * @param serverURL Base URL of the update server, e.g. "http://192.168.1.10:8000"
+         * @param stacID STAC ID, used to stagger the first check
+         */
+        FleetUpdater( const String &serverURL, const String &stacID );
+        ~FleetUpdater();
+
+        /**
+         * @brief Schedule a manifest check
+         * @param staggered true to wait this unit's stagger delay first, false to check
+         *        as soon as WiFi is up (the serial "update" command)
+         */
+        void requestCheck( bool staggered = true );
+
+        /**
+         * @brief Start a scheduled check when due (call from the main loop)
+         * @param wifiConnected Whether the station is connected
+         */
+        void update( bool wifiConnected );
+
+        /**
+         * @brief Current state
+         */
+        FleetUpdateState getState() const {
+            return state;
+        }
+
+        /**
+         * @brief true once an update is installed and the manifest asked for a restart
+         */
+        bool isRestartPending() const {
+            return state == FleetUpdateState::INSTALLED && restartRequested;
+        }
+
+        /**
+         * @brief This unit's delay before its first check (ms)
+         */
+        unsigned long getStaggerMs() const {
+            return staggerMs;
+        }
+
+        /**
+         * @brief Compare two version strings ("3.1.0", "3.0.0-RC.9")
+         * @return <0, 0 or >0 like strcmp; a release sorts after its pre-releases
+         */
+        static int compareVersions( const String &a, const String &b );
+
+      private:
+        struct Manifest {
+            String version;
+            String image;
+            String sha256;
+            String delta;
+            String deltaFrom;
+            bool restart = false;
+        };
+
+        static constexpr size_t CHUNK_SIZE = 1024;
+        static_assert( CHUNK_SIZE >= Config::FleetOTA::MAX_MANIFEST_SIZE, "The manifest is read into chunk" );
+        static constexpr uint32_t TASK_STACK_SIZE = 8192;
+        static constexpr UBaseType_t TASK_PRIORITY = 1;
+
+        String serverURL;
+        unsigned long staggerMs;
+        unsigned long dueAtMs;
+        std::atomic<FleetUpdateState> state;
+        bool restartRequested;
+        TaskHandle_t taskHandle;
+
+        OTAPipeline ota;
+        DeltaPatcher deltaPatcher;
+        uint8_t chunk[ CHUNK_SIZE ];
+
+        /**
+         * @brief Task body: check the manifest and install if newer
+         */
+        static void checkTask( void *param );
+
+        /**
+         * @brief Check the manifest and install if newer (runs in the task)
+         * @return Resulting state
+         */
+        FleetUpdateState runCheck();
+
+        /**
+         * @brief Fetch and parse this board's manifest
+         *
+         * At most MAX_MANIFEST_SIZE bytes are read, also when the reply has
+         * no Content-Length; a longer manifest is refused.
+         */
+        bool fetchManifest( Manifest &manifest );
+
+        /**
+         * @brief Stream an image or delta into the OTA pipeline
+         * @param file File name on the server
+         * @param delta true if the file is a delta patch
+         * @param sha256 Expected image digest (full images only)
+         * @return true if installed
+         */
+        bool download( const String &file, bool delta, const String &sha256 );
+
+        /**
+         * @brief Build a URL for a file on the server
+         */
+        String urlFor( const String &file ) const;
+    };
+
+} // namespace Net
+
+
+#endif // STAC_FLEET_UPDATER_H
+
+
+//  --- EOF --- //
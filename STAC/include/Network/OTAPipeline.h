@@ -0,0 +1,162 @@
+#ifndef STAC_OTA_PIPELINE_H
+#define STAC_OTA_PIPELINE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <mbedtls/sha256.h>
+#include <atomic>
+#include <cstdint>
+
+
+namespace Net {
+
+    /**
+     * @brief Firmware image writer that overlaps receiving with flash writes
+     *
+     * Incoming data is copied into sector-aligned blocks. A writer task
+     * hashes each full block (SHA-256) and hands it to Update while the
+     * caller goes on receiving into the next block. finish() drains the
+     * pipeline and compares the digest with the expected one, if given,
+     * before Update is allowed to switch the boot partition.
+     *
+     * Usage:
+     * @code
+     * OTAPipeline ota;
+     * ota.begin( expectedSha256Hex );     // "" = no digest check
+     * ota.write( data, length );          // per received chunk
+     * if ( !ota.finish() ) {
+     *     log_e( "%s", ota.getError() );
+     * }
+     * @endcode
+     */
+    class OTAPipeline {
+      public:
+        static constexpr size_t BLOCK_SIZE = 8192;         // Two flash sectors
+        static constexpr uint8_t BLOCK_COUNT = 4;
+        static constexpr size_t DIGEST_SIZE = 32;
+
+        OTAPipeline();
+        ~OTAPipeline();
+
+        /**
+         * @brief Prepare the OTA partition and start the writer task
+         * @param expectedSha256 Digest of the whole image as 64 hex digits, or empty
+         * @return true if ready for write(); see getError() otherwise
+         */
+        bool begin( const String &expectedSha256 );
+
+        /**
+         * @brief Queue image data; blocks only while every buffer is waiting for flash
+         * @param data Received bytes
+         * @param length Number of bytes
+         * @return false once the pipeline has failed
+         */
+        bool write( const uint8_t *data, size_t length );
+
+        /**
+         * @brief Write what is left, check the digest and finalise the update
+         * @return true if the new image is written, verified and set to boot
+         */
+        bool finish();
+
+        /**
+         * @brief Stop the writer and discard the update
+         */
+        void abort();
+
+        /**
+         * @brief true between begin() and finish()/abort()
+         */
+        bool isActive() const {
+            return active;
+        }
+
+        /**
+         * @brief Bytes written to flash so far
+         */
+        size_t getBytesWritten() const {
+            return bytesWritten;
+        }
+
+        /**
+         * @brief Time from begin() to the end of finish() (ms), or so far if still active
+         */
+        uint32_t getElapsedMs() const;
+
+        /**
+         * @brief Reason for the last failure
+         */
+        const char *getError() const {
+            return error;
+        }
+
+        /**
+         * @brief SHA-256 of the written image as hex (after a successful finish())
+         */
+        String getDigestHex() const;
+
+      private:
+        struct Block {
+            uint8_t index;
+            uint16_t length;        // 0 = stop the writer
+        };
+
+        uint8_t *buffers;
+        uint8_t current;            // Block being filled, BLOCK_COUNT = none
+        size_t filled;
+
+        StaticQueue_t freeControl;
+        uint8_t freeStorage[ BLOCK_COUNT * sizeof( uint8_t ) ];
+        QueueHandle_t freeQueue;
+        StaticQueue_t fullControl;
+        uint8_t fullStorage[ ( BLOCK_COUNT + 1 ) * sizeof( Block ) ];
+        QueueHandle_t fullQueue;
+
+        std::atomic<TaskHandle_t> writerHandle;
+        std::atomic<bool> failed;
+        std::atomic<size_t> bytesWritten;
+        mbedtls_sha256_context sha;
+        uint8_t expected[ DIGEST_SIZE ];
+        uint8_t digest[ DIGEST_SIZE ];
+        bool checkDigest;
+        bool active;
+        const char *error;
+        uint32_t startMs;
+        uint32_t endMs;
+
+        /**
+         * @brief Writer task body: hash and flash full blocks in order
+         */
+        static void writerTask( void *param );
+
+        /**
+         * @brief Hand the block being filled to the writer
+         * @return false if no free block came back in time
+         */
+        bool queueCurrent();
+
+        /**
+         * @brief Send the stop marker and wait for the writer to exit
+         */
+        void stopWriter();
+
+        /**
+         * @brief Release the buffers and hash state
+         */
+        void release();
+
+        /**
+         * @brief Record a failure
+         */
+        void fail( const char *reason );
+    };
+
+} // namespace Net
+
+
+#endif // STAC_OTA_PIPELINE_H
+
+
+//  --- EOF --- //
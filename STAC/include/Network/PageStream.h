@@ -0,0 +1,107 @@
+#ifndef STAC_PAGE_STREAM_H
+#define STAC_PAGE_STREAM_H
+
+#include <WebServer.h>
+#include <cstdint>
+
+
+namespace Net {
+
+    /**
+     * @brief Chunked HTTP response writer with a small fixed buffer
+     *
+     * Sends a response as it is produced instead of building it in one
+     * String. Short pieces are collected in the buffer; anything larger
+     * than the buffer is sent straight from where it lives.
+     *
+     * Usage:
+     * @code
+     * PageStream out( *server );
+     * out.begin( 200, "application/json" );
+     * out.write( "{\"count\":" );
+     * out.printf( "%d", value );
+     * out.write( "}" );
+     * out.end();
+     * @endcode
+     */
+    class PageStream {
+      public:
+        static constexpr size_t BUFFER_SIZE = 512;
+
+        explicit PageStream( WebServer &server );
+
+        /**
+         * @brief Send the status line and headers; the body follows in chunks
+         * @param code HTTP status code
+         * @param contentType MIME type
+         */
+        void begin( int code, const char *contentType );
+
+        /**
+         * @brief Write a NUL-terminated string
+         */
+        void write( const char *text );
+
+        /**
+         * @brief Write a block of text
+         */
+        void write( const char *data, size_t length );
+
+        /**
+         * @brief Write formatted text (at most BUFFER_SIZE - 1 characters per call)
+         */
+        void printf( const char *format, ... ) __attribute__( ( format( printf, 2, 3 ) ) );
+
+        /**
+         * @brief Send what is buffered and the terminating chunk
+         */
+        void end();
+
+        /**
+         * @brief Body bytes sent so far
+         */
+        size_t getBytesSent() const {
+            return bytesSent;
+        }
+
+        /**
+         * @brief Time from construction to the first body chunk (us), 0 if none sent
+         */
+        uint32_t getFirstChunkUs() const {
+            return firstChunkUs;
+        }
+
+        /**
+         * @brief Lowest free heap seen while streaming (bytes)
+         */
+        uint32_t getMinFreeHeap() const {
+            return minFreeHeap;
+        }
+
+      private:
+        WebServer &server;
+        char buffer[ BUFFER_SIZE ];
+        size_t used;
+        size_t bytesSent;
+        int64_t createdAtUs;
+        uint32_t firstChunkUs;
+        uint32_t minFreeHeap;
+
+        /**
+         * @brief Send the buffer as one chunk
+         */
+        void flush();
+
+        /**
+         * @brief Send a chunk and update the counters
+         */
+        void sendChunk( const char *data, size_t length );
+    };
+
+} // namespace Net
+
+
+#endif // STAC_PAGE_STREAM_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,113 @@
+#ifndef STAC_SERVICE_TASK_H
+#define STAC_SERVICE_TASK_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+
+namespace Net {
+
+    /**
+     * @brief Runs one server's poll function (e.g. WebServer::handleClient) in its own task
+     *
+     * stop() only asks the task to finish: it completes the call in hand,
+     * which for a WebServer is the whole request including its reply and
+     * socket close, and then deletes itself. The task is never deleted from
+     * outside, so a request is never cut off half way with its client
+     * socket and buffers left behind. How long stop() waits is bounded by
+     * the poll function's own timeouts (WebServer gives up on a stalled
+     * client after a few seconds).
+     *
+     * Usage:
+     * @code
+     * ServiceTask web( "portal_web", [ this ]() { server->handleClient(); } );
+     * web.start( 6144, 1, pdMS_TO_TICKS( 2 ) );
+     * ...
+     * web.stop();     // Returns once the task has exited
+     * @endcode
+     */
+    class ServiceTask {
+      public:
+        using PollFunction = std::function<void()>;
+
+        /**
+         * @brief Constructor
+         * @param name Task name (must outlive the task)
+         * @param poll Called repeatedly from the task until stop()
+         */
+        ServiceTask( const char *name, PollFunction poll );
+
+        /**
+         * @brief Destructor - stops the task if it is still running
+         */
+        ~ServiceTask();
+
+        ServiceTask( const ServiceTask & ) = delete;
+        ServiceTask &operator=( const ServiceTask & ) = delete;
+
+        /**
+         * @brief Create the task
+         * @param stackSize Task stack in bytes
+         * @param priority FreeRTOS priority
+         * @param idleTicks Delay between polls, so lower priority tasks get to run
+         * @return true if the task was created
+         */
+        bool start( uint32_t stackSize, UBaseType_t priority, TickType_t idleTicks );
+
+        /**
+         * @brief Ask the task to exit after the call in hand, without waiting
+         */
+        void requestStop() {
+            stopRequested = true;
+        }
+
+        /**
+         * @brief Ask the task to exit and wait until it has
+         *
+         * Safe to call when the task was never started or has already stopped.
+         */
+        void stop();
+
+        /**
+         * @brief Whether the task is running (it clears this as its last step)
+         */
+        bool isRunning() const {
+            return running;
+        }
+
+        /**
+         * @brief Number of completed poll calls
+         */
+        uint32_t getPollCount() const {
+            return polls;
+        }
+
+      private:
+        static constexpr uint32_t STOP_CHECK_MS = 10;
+        static constexpr uint32_t STOP_WARN_MS = 2000;  // Log once if stopping takes longer
+
+        const char *name;
+        PollFunction poll;
+        TickType_t idleTicks;
+        TaskHandle_t handle;
+        std::atomic<bool> stopRequested;
+        std::atomic<bool> running;
+        std::atomic<uint32_t> polls;
+
+        /**
+         * @brief Task body
+         */
+        static void run( void *param );
+    };
+
+} // namespace Net
+
+
+#endif // STAC_SERVICE_TASK_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,605 @@
+/**
+ * @file WebAssets.h
+ * @brief Minified, gzip-compressed static portal pages
+ *
+ * GENERATED by scripts/build_web_assets.py from WebConfigPages.h - DO NOT EDIT
+ * Source hash: ea39980ea322f3bd19db3d2f83a42b0f
+ *
+ * Transfer size (raw / minified / gzip):
+ *   INDEX_PAGE:            39203 /  29459 /  7474 bytes
+ *   CONFIG_RECEIVED_PAGE:    859 /    758 /   495 bytes
+ *   FACTORY_RESET_PAGE:      843 /    742 /   476 bytes
+ *   NOT_FOUND_PAGE:          434 /    399 /   305 bytes
+ */
+
+#ifndef STAC_WEB_ASSETS_H
+#define STAC_WEB_ASSETS_H
+
+#include <Arduino.h>
+
+
+namespace Net {
+    namespace WebAssets {
+
+        /**
+         * @brief One precompressed page
+         */
+        struct WebAsset {
+            const uint8_t *data;    ///< gzip stream
+            size_t size;            ///< Compressed size
+            const char *etag;       ///< Strong ETag, quoted
+        };
+
+        const uint8_t IndexPageData[] PROGMEM = {
+            0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x5D, 0xEB, 0x76, 0xDB, 0x48,
+            0x72, 0xFE, 0xCF, 0xA7, 0x68, 0xD3, 0x99, 0x21, 0x39, 0x43, 0x42, 0x24, 0x25, 0x71, 0x64, 0xCA,
+            0x92, 0x23, 0xEB, 0x32, 0x56, 0xD6, 0x17, 0xC5, 0xB2, 0x67, 0x36, 0xC7, 0x76, 0xCE, 0x01, 0x81,
+            0x26, 0x89, 0x11, 0x08, 0x60, 0x01, 0x50, 0xB2, 0xD6, 0xD6, 0x53, 0xE4, 0x01, 0x72, 0xF2, 0x86,
+            0x79, 0x84, 0x54, 0x55, 0x5F, 0xD0, 0xB8, 0x91, 0x94, 0x2F, 0xBB, 0x67, 0x73, 0x76, 0xB4, 0x6B,
+            0x91, 0x40, 0x77, 0x75, 0x75, 0x55, 0x75, 0xF5, 0x57, 0xD5, 0x05, 0xE8, 0xF1, 0x83, 0x93, 0x57,
+            0xC7, 0x6F, 0xFE, 0xE3, 0xE2, 0x94, 0xCD, 0xD3, 0x85, 0x7F, 0xD8, 0x78, 0xAC, 0x7E, 0x71, 0xDB,
+            0x85, 0x5F, 0x0B, 0x9E, 0xDA, 0xCC, 0x99, 0xDB, 0x71, 0xC2, 0xD3, 0x83, 0xE6, 0x32, 0x9D, 0xF6,
+            0xF6, 0x9A, 0xEA, 0x72, 0x60, 0x2F, 0xF8, 0x41, 0xF3, 0xDA, 0xE3, 0x37, 0x51, 0x18, 0xA7, 0x4D,
+            0xE6, 0x84, 0x41, 0xCA, 0x03, 0x68, 0x76, 0xE3, 0xB9, 0xE9, 0xFC, 0xC0, 0xE5, 0xD7, 0x9E, 0xC3,
+            0x7B, 0xF4, 0xA5, 0xCB, 0xBC, 0xC0, 0x4B, 0x3D, 0xDB, 0xEF, 0x25, 0x8E, 0xED, 0xF3, 0x83, 0x81,
+            0xD5, 0x47, 0x32, 0xBE, 0x17, 0x5C, 0xB1, 0x98, 0xFB, 0x07, 0x4D, 0x0F, 0x3A, 0x37, 0xD9, 0x3C,
+            0xE6, 0xD3, 0x83, 0xA6, 0x6B, 0xA7, 0xF6, 0xB8, 0x8B, 0xF7, 0x53, 0x2F, 0xF5, 0xF9, 0xE1, 0xE5,
+            0x9B, 0xA3, 0x63, 0x76, 0xC9, 0xD3, 0x65, 0xF4, 0x78, 0x4B, 0x5C, 0x69, 0x3C, 0x4E, 0xD2, 0x5B,
+            0x9F, 0xB3, 0xF4, 0x36, 0x02, 0x0E, 0x52, 0xFE, 0x31, 0xDD, 0x72, 0x92, 0x04, 0x7A, 0xFC, 0xC4,
+            0x3E, 0x35, 0x26, 0xE1, 0xC7, 0x5E, 0xE2, 0xFD, 0xD5, 0x0B, 0x66, 0x63, 0x36, 0x09, 0x63, 0x97,
+            0xC7, 0x3D, 0xB8, 0xB4, 0xDF, 0x58, 0xD8, 0xF1, 0xCC, 0x0B, 0xC6, 0xAC, 0xBF, 0xDF, 0x88, 0x6C,
+            0xD7, 0xA5, 0xFB, 0xF0, 0xF9, 0x0E, 0x3A, 0xB8, 0xB7, 0xD0, 0x6F, 0x0A, 0xEC, 0xF7, 0xA6, 0xF6,
+            0xC2, 0xF3, 0x6F, 0xC7, 0xEC, 0x19, 0xF7, 0xAF, 0x79, 0xEA, 0x39, 0x76, 0x97, 0x1D, 0xC5, 0xC0,
+            0x77, 0x97, 0x25, 0x76, 0x90, 0xF4, 0x12, 0x1E, 0x7B, 0xD3, 0xFD, 0x06, 0x8E, 0xD8, 0xB3, 0x7D,
+            0x6F, 0x06, 0xE4, 0x1C, 0x98, 0x32, 0x8F, 0xF7, 0x1B, 0x13, 0xDB, 0xB9, 0x9A, 0xC5, 0xE1, 0x32,
+            0x70, 0xC7, 0x0C, 0xE6, 0xC5, 0xED, 0xB8, 0x37, 0x8B, 0x6D, 0xD7, 0x83, 0xDB, 0xED, 0xC1, 0xF6,
+            0xAE, 0xCB, 0x67, 0x5D, 0xF6, 0xF0, 0xF8, 0xE4, 0x64, 0x74, 0x76, 0xC4, 0xFA, 0x3F, 0xC0, 0xE7,
+            0xD3, 0x47, 0x67, 0xA3, 0x93, 0x63, 0x36, 0xE8, 0xF7, 0x7F, 0xE8, 0x18, 0x2C, 0x0D, 0xFA, 0xD1,
+            0x47, 0xE4, 0x6A, 0x3E, 0x00, 0x9E, 0x14, 0xCF, 0x43, 0xB8, 0x88, 0xCC, 0x3A, 0xA1, 0x1F, 0xC6,
+            0x63, 0xF6, 0x70, 0x7B, 0x7B, 0x9B, 0xDA, 0x0C, 0x8D, 0x36, 0x83, 0xDD, 0x7C, 0x9B, 0xDD, 0xDD,
+            0x5D, 0x6A, 0xB3, 0xDD, 0x65, 0xF3, 0x1D, 0xB3, 0x5D, 0x81, 0xD6, 0x68, 0x34, 0xC2, 0x76, 0x16,
+            0xAA, 0xCF, 0x06, 0xC6, 0x63, 0x6A, 0xFB, 0x51, 0x28, 0x6E, 0xCC, 0x46, 0x7D, 0x62, 0x48, 0x4B,
+            0x8F, 0xD9, 0xCB, 0x34, 0xCC, 0x4F, 0xF7, 0x66, 0xEE, 0xA5, 0x1C, 0x2E, 0x09, 0x61, 0xE3, 0xA4,
+            0x97, 0xC9, 0x98, 0xED, 0x61, 0x37, 0x52, 0xC6, 0xDC, 0x76, 0xC3, 0x1B, 0xEC, 0x3A, 0x84, 0x91,
+            0x69, 0xF8, 0x78, 0x36, 0xB1, 0xDB, 0xFD, 0x2E, 0xFD, 0x58, 0x03, 0x98, 0x7E, 0x78, 0xCD, 0xE3,
+            0xA9, 0x8F, 0xAD, 0xE6, 0x9E, 0xEB, 0xF2, 0x80, 0x38, 0x92, 0x16, 0xE4, 0x05, 0xD3, 0x10, 0xF5,
+            0x6A, 0x8C, 0xF8, 0x70, 0xBA, 0x8B, 0x3F, 0xA6, 0xD8, 0x76, 0xC5, 0x70, 0x52, 0xDF, 0x69, 0x1A,
+            0x2E, 0xC6, 0x34, 0x5E, 0x12, 0xFA, 0x9E, 0xCB, 0x1E, 0xBA, 0xAE, 0x5B, 0xA2, 0x19, 0x19, 0x52,
+            0x91, 0xC2, 0x23, 0x23, 0x00, 0xEB, 0xE1, 0x40, 0x71, 0x07, 0x29, 0x16, 0xA5, 0x94, 0xDA, 0x93,
+            0x04, 0xBA, 0xB9, 0x5E, 0x12, 0xF9, 0x36, 0x18, 0xCA, 0xD4, 0xE7, 0x1F, 0xF3, 0xD2, 0x78, 0xC8,
+            0xFB, 0xF8, 0xB3, 0x8A, 0x19, 0xC7, 0x71, 0x14, 0x31, 0x34, 0x3C, 0x20, 0x01, 0xC3, 0x15, 0x26,
+            0x23, 0x0D, 0x61, 0x05, 0xE5, 0x31, 0x0B, 0xC2, 0x00, 0xE4, 0xEE, 0x2C, 0xE3, 0x04, 0x79, 0x8C,
+            0x42, 0x4F, 0x98, 0xA2, 0x39, 0x89, 0x11, 0x12, 0xA1, 0x0B, 0x37, 0xDC, 0x9B, 0xCD, 0x53, 0x5C,
+            0x13, 0xBE, 0x5B, 0xB0, 0x92, 0x34, 0x06, 0xE3, 0x86, 0xF5, 0x19, 0x82, 0x20, 0x6C, 0xDF, 0x67,
+            0x7D, 0x6B, 0x3B, 0x51, 0x0C, 0x8E, 0xE7, 0xA8, 0x9B, 0xA2, 0xFC, 0xDD, 0x3E, 0xFE, 0xA8, 0x36,
+            0x96, 0xED, 0xA4, 0xDE, 0x35, 0x2F, 0x34, 0x92, 0x66, 0x91, 0xB3, 0xD9, 0x82, 0x4C, 0xB6, 0x33,
+            0x99, 0xEC, 0x1C, 0x1F, 0x9D, 0xED, 0x6A, 0x8A, 0x3D, 0xE9, 0x4C, 0x4C, 0x51, 0x8B, 0xD9, 0x6A,
+            0x21, 0x0D, 0x49, 0x3E, 0x76, 0xE0, 0x2D, 0x6C, 0xC1, 0xF9, 0xD4, 0x76, 0xF9, 0x79, 0x90, 0x63,
+            0x5E, 0x91, 0xC9, 0x18, 0xD4, 0xD4, 0x26, 0x7E, 0xE8, 0x5C, 0x61, 0xBB, 0x7F, 0xBD, 0xE2, 0xB7,
+            0xD3, 0x18, 0x7C, 0x59, 0xA2, 0x28, 0x80, 0x4A, 0xE2, 0x70, 0xC1, 0x3E, 0xB1, 0x30, 0xB2, 0x1D,
+            0x2F, 0xBD, 0x45, 0x3F, 0xC1, 0xEE, 0x1A, 0x69, 0x68, 0x5E, 0x1A, 0xE0, 0xA5, 0x3B, 0x10, 0x6D,
+            0xBC, 0xC8, 0x2F, 0x98, 0x9D, 0xEA, 0x05, 0x73, 0xD7, 0xF0, 0xED, 0x09, 0xF7, 0x2B, 0x58, 0x30,
+            0xBD, 0x89, 0xCF, 0xA7, 0xE9, 0x7E, 0x61, 0x49, 0xE7, 0x6C, 0x73, 0x85, 0x16, 0xEF, 0x1A, 0x5E,
+            0x10, 0x2D, 0xD3, 0x77, 0x99, 0x57, 0x6C, 0x7E, 0xE8, 0xE6, 0xAE, 0x45, 0x76, 0x92, 0xDC, 0x80,
+            0x06, 0x8A, 0xD7, 0x83, 0xE5, 0x62, 0xC2, 0x63, 0xBC, 0x9A, 0x70, 0x9F, 0x3B, 0x28, 0x75, 0x39,
+            0x19, 0xF4, 0x4E, 0x25, 0xE7, 0x54, 0x5A, 0x24, 0xCA, 0x1E, 0x07, 0x05, 0x13, 0x2F, 0x78, 0x84,
+            0x1D, 0xE1, 0xD9, 0xCC, 0x91, 0xA7, 0x9E, 0xCF, 0x9B, 0x1F, 0xBE, 0xE7, 0x78, 0x55, 0x16, 0x59,
+            0x5C, 0x30, 0x45, 0x8D, 0x80, 0x94, 0x27, 0x57, 0x1E, 0x28, 0x25, 0x8A, 0xC0, 0x8F, 0xDB, 0x81,
+            0xC3, 0x95, 0xF5, 0xF5, 0x16, 0xE1, 0x5F, 0x2B, 0x2E, 0x97, 0xAF, 0x54, 0x4D, 0x73, 0x3C, 0x56,
+            0x84, 0xF1, 0x7B, 0x6F, 0x19, 0xF9, 0xA1, 0xED, 0xF6, 0x26, 0x4B, 0x58, 0x0B, 0x68, 0x74, 0x7A,
+            0xD6, 0x7B, 0xB8, 0xFA, 0x47, 0xA5, 0xD5, 0x3F, 0x1C, 0x3C, 0x1A, 0x9D, 0x6D, 0x6B, 0xA5, 0xE7,
+            0xBC, 0xAE, 0x1A, 0xB6, 0x4A, 0x02, 0x2B, 0xFD, 0x83, 0xD4, 0x89, 0x60, 0x02, 0xB7, 0xE9, 0x8C,
+            0xE9, 0x64, 0x39, 0x59, 0x78, 0x68, 0x43, 0xB9, 0xAB, 0x31, 0x07, 0x28, 0x40, 0x2A, 0xCB, 0xB4,
+            0x84, 0xAE, 0x6D, 0xBB, 0xA4, 0xAA, 0x91, 0xB9, 0x0C, 0x68, 0x07, 0x53, 0x6E, 0x8D, 0xED, 0x9A,
+            0x5A, 0xBC, 0x2F, 0xE7, 0xF9, 0x25, 0x50, 0xE7, 0xBB, 0xAA, 0x66, 0x52, 0xF4, 0x62, 0xCA, 0xE7,
+            0xE4, 0x25, 0x5A, 0xDD, 0x57, 0xF8, 0xC1, 0x71, 0x10, 0xA6, 0xED, 0x31, 0xD8, 0x8B, 0x3D, 0xF1,
+            0xB9, 0xDB, 0x29, 0x11, 0xDC, 0xB5, 0xFB, 0x3B, 0x8F, 0x6A, 0x49, 0xA8, 0x7E, 0xC5, 0x6E, 0x64,
+            0xBC, 0x6A, 0xB2, 0x30, 0x02, 0x78, 0x03, 0xD8, 0x0B, 0xB9, 0x5B, 0x24, 0x94, 0xC9, 0x3E, 0xBF,
+            0x19, 0xEE, 0xEC, 0x6C, 0x6F, 0x8F, 0x56, 0x4F, 0x43, 0x76, 0xAD, 0xF1, 0xE6, 0xF6, 0xE0, 0x51,
+            0x7F, 0x42, 0x4E, 0x13, 0x37, 0xC6, 0x1E, 0xFA, 0x8E, 0x0A, 0x64, 0x51, 0x58, 0x96, 0x79, 0x1E,
+            0xFA, 0xF8, 0x53, 0xAD, 0xC6, 0x92, 0xBD, 0x21, 0x3E, 0xEA, 0xCD, 0xA5, 0x1A, 0x07, 0x96, 0xD8,
+            0x59, 0x13, 0x70, 0x3C, 0x1E, 0x2D, 0x84, 0x22, 0xEA, 0x29, 0x6E, 0xF2, 0xB9, 0x71, 0x6D, 0xFC,
+            0xA9, 0x73, 0x35, 0x96, 0x6F, 0x07, 0xD8, 0xB5, 0xBC, 0x63, 0xE3, 0xBF, 0x3D, 0xD7, 0x8B, 0xC5,
+            0xA0, 0x00, 0xE3, 0x42, 0x7F, 0xB9, 0x00, 0xD8, 0x41, 0x7E, 0xB8, 0x07, 0x02, 0x5C, 0x24, 0x19,
+            0xB6, 0xFB, 0x63, 0x99, 0xA4, 0xDE, 0xF4, 0x56, 0xED, 0x26, 0xD9, 0x0D, 0xCD, 0xD9, 0x08, 0x59,
+            0x15, 0x3B, 0xD2, 0xC2, 0x0B, 0xF4, 0xDC, 0xB6, 0xFB, 0xFD, 0x02, 0x23, 0x04, 0xD9, 0x94, 0xDB,
+            0x56, 0xF6, 0x27, 0x26, 0x9C, 0x21, 0x85, 0x62, 0xA7, 0xC8, 0xE8, 0x43, 0x40, 0xA4, 0x88, 0xE5,
+            0x4A, 0xCB, 0xCE, 0xE8, 0x6C, 0x4D, 0xD2, 0x80, 0x38, 0xF7, 0x82, 0x25, 0xD7, 0xD2, 0xED, 0xA5,
+            0x61, 0x34, 0x96, 0x8B, 0x36, 0x8F, 0x3B, 0x76, 0xCA, 0xCA, 0xAD, 0x5E, 0x27, 0xEB, 0xD7, 0xAF,
+            0xC9, 0xD6, 0x5E, 0x1D, 0x10, 0x29, 0xAE, 0xF1, 0xEA, 0x05, 0x4D, 0x9B, 0xA4, 0xCB, 0x9D, 0x30,
+            0x96, 0xBB, 0xBD, 0x18, 0x55, 0x6B, 0xD5, 0x0B, 0xC8, 0xA8, 0xF4, 0xAE, 0x5E, 0x3D, 0xFD, 0x6A,
+            0xF3, 0xCF, 0x56, 0xAD, 0x95, 0x44, 0x5E, 0x20, 0x20, 0xB0, 0x9A, 0xDD, 0x4E, 0xB6, 0xC7, 0x4C,
+            0xB7, 0xF1, 0x47, 0x4F, 0x95, 0x24, 0xB8, 0x53, 0x46, 0x30, 0x05, 0x49, 0xEC, 0xE2, 0x8E, 0xA6,
+            0xB1, 0x01, 0x4A, 0x41, 0x59, 0xC7, 0x4E, 0x11, 0xC1, 0xE0, 0xE8, 0x6C, 0x90, 0xC8, 0xF8, 0x01,
+            0xE6, 0x34, 0xC5, 0xB0, 0x89, 0x17, 0xBC, 0xA8, 0xC2, 0x13, 0x06, 0x70, 0xA1, 0x8E, 0x9F, 0x1A,
+            0xFD, 0x1F, 0x00, 0xA1, 0x90, 0xFC, 0x10, 0x96, 0x8C, 0x59, 0x1C, 0xA6, 0x76, 0xCA, 0xDB, 0x7D,
+            0x08, 0x3E, 0x3A, 0x08, 0x57, 0x70, 0x77, 0xAD, 0x6C, 0xB1, 0x3D, 0xD2, 0x6D, 0x40, 0x08, 0x8B,
+            0xD0, 0xB5, 0xFD, 0x0A, 0xE4, 0x15, 0x2A, 0xB5, 0x4C, 0xBD, 0x8F, 0xE8, 0x9C, 0xFE, 0x0A, 0x30,
+            0xDA, 0x25, 0xEC, 0xDA, 0xEF, 0xC3, 0xBC, 0x11, 0xBB, 0x50, 0x48, 0x45, 0x82, 0xE9, 0xEF, 0xE7,
+            0xF7, 0x74, 0xBD, 0xDC, 0xE9, 0x5B, 0x26, 0xFF, 0x9E, 0x34, 0xAA, 0x5C, 0x48, 0xB0, 0xD3, 0xD9,
+            0xD7, 0x8C, 0x18, 0x50, 0xB0, 0xDC, 0x4B, 0x9A, 0x62, 0xE6, 0xA9, 0x7E, 0x90, 0xE2, 0x29, 0xC0,
+            0xC4, 0xAA, 0xD8, 0x44, 0xB2, 0xB7, 0x87, 0xFC, 0x18, 0xF8, 0x6D, 0xB7, 0xDF, 0x2F, 0x47, 0x2E,
+            0xA8, 0xE6, 0x51, 0x55, 0xE0, 0xA2, 0xB9, 0x2C, 0xF8, 0xCC, 0x8D, 0x7C, 0x97, 0x0C, 0x62, 0x6A,
+            0x97, 0x8E, 0x8A, 0x46, 0x17, 0x61, 0x10, 0x26, 0x00, 0x3C, 0xF9, 0x46, 0xBE, 0x94, 0x64, 0xD2,
+            0xA3, 0xF6, 0xB0, 0xAC, 0x62, 0x08, 0xC1, 0x63, 0x3B, 0xAA, 0x82, 0x99, 0x9A, 0x77, 0xB1, 0xFB,
+            0x57, 0xC4, 0x35, 0x33, 0x3B, 0x52, 0xDE, 0xDE, 0x74, 0x1B, 0xCA, 0x41, 0x3D, 0xDE, 0xA2, 0x38,
+            0x1C, 0xE2, 0xF1, 0x2D, 0x99, 0x2F, 0xC0, 0x58, 0x1A, 0x7E, 0xB9, 0xDE, 0x35, 0x73, 0x7C, 0x40,
+            0x9B, 0x07, 0x4D, 0x1D, 0x56, 0x62, 0x40, 0x3F, 0x1F, 0xE4, 0xA2, 0x79, 0xF8, 0x9A, 0x6B, 0x6B,
+            0x04, 0x67, 0xD8, 0x3A, 0x3A, 0x84, 0x38, 0x3F, 0x0E, 0x83, 0xD9, 0xE1, 0x09, 0xDD, 0x18, 0xE3,
+            0x78, 0xF4, 0x9D, 0x3D, 0x86, 0xE9, 0x05, 0xCC, 0x73, 0x0F, 0x9A, 0xB4, 0x61, 0x4D, 0x42, 0x1B,
+            0x50, 0xED, 0x21, 0xDC, 0x87, 0xCB, 0xF0, 0x2B, 0xCA, 0xF5, 0xBE, 0xBC, 0x3C, 0x3F, 0xA9, 0xEF,
+            0x9B, 0x24, 0x5E, 0x7D, 0xD7, 0x17, 0x47, 0xC7, 0xF5, 0x3D, 0x17, 0xB6, 0x53, 0xDB, 0xF1, 0x37,
+            0x1E, 0x27, 0xB8, 0x56, 0x6A, 0x3B, 0x5F, 0x8B, 0x06, 0x05, 0x02, 0x5B, 0x20, 0x0D, 0x29, 0x13,
+            0x68, 0xD9, 0x9A, 0x71, 0x7E, 0x45, 0xE2, 0x68, 0x31, 0x92, 0xF4, 0x41, 0x4B, 0x29, 0x88, 0x96,
+            0x64, 0xEB, 0xF0, 0x31, 0xE8, 0x37, 0x6B, 0x09, 0x5F, 0x74, 0xC3, 0x1A, 0x03, 0x62, 0xA6, 0x01,
+            0x01, 0x6E, 0xDB, 0x67, 0x05, 0x03, 0xDA, 0x41, 0xAA, 0x5B, 0x40, 0xE9, 0xB0, 0xC0, 0x4C, 0x53,
+            0x7A, 0xD4, 0xA6, 0xD2, 0x96, 0xFA, 0x8E, 0x7A, 0x1D, 0x1E, 0xFE, 0xCE, 0x7D, 0x27, 0x5C, 0x70,
+            0x06, 0x51, 0x52, 0x4E, 0xC5, 0x43, 0x14, 0x8B, 0x64, 0xAA, 0x59, 0x58, 0x1D, 0xAC, 0xB8, 0x6F,
+            0x31, 0x33, 0xA0, 0x01, 0xC2, 0xC7, 0x21, 0xB8, 0xC0, 0xD9, 0x12, 0xE6, 0x78, 0x1B, 0x2E, 0x63,
+            0x41, 0x38, 0x8C, 0xD9, 0x32, 0x72, 0xC1, 0x6B, 0x81, 0x1B, 0x8A, 0x17, 0x37, 0x36, 0xDC, 0x5C,
+            0x26, 0xE8, 0xE9, 0xD3, 0x39, 0x8C, 0x8E, 0xE1, 0x39, 0x84, 0x59, 0xE1, 0x8D, 0xD5, 0x10, 0x12,
+            0x45, 0xEE, 0xE5, 0xE8, 0xF9, 0x58, 0x7A, 0x7B, 0x3A, 0x9C, 0xBA, 0xFB, 0x2C, 0xBF, 0x40, 0x59,
+            0x85, 0xA3, 0x60, 0x45, 0xAE, 0x4B, 0x2B, 0x89, 0x44, 0xB0, 0x9D, 0x9F, 0x64, 0x4F, 0x7A, 0x41,
+            0x3D, 0xA5, 0xC1, 0xA3, 0x5F, 0x46, 0xEE, 0x10, 0xDA, 0xFE, 0xEF, 0x7F, 0xFF, 0xD7, 0xFF, 0xB0,
+            0x23, 0xC7, 0xE1, 0x49, 0xC2, 0xCE, 0x03, 0xF4, 0xC3, 0xE4, 0xFE, 0x41, 0x56, 0xDB, 0x55, 0xB2,
+            0x12, 0xE0, 0xAB, 0x28, 0x19, 0x65, 0x67, 0xCF, 0xC2, 0x24, 0xC5, 0x44, 0x9C, 0x61, 0x68, 0x49,
+            0x6A, 0x3B, 0x16, 0xEC, 0x83, 0xB6, 0xFF, 0x78, 0x12, 0x67, 0x2D, 0xCF, 0x2F, 0xD8, 0x91, 0xEB,
+            0x02, 0x0E, 0x4C, 0x8C, 0xB6, 0x83, 0x47, 0x43, 0x6B, 0x30, 0xDA, 0xB3, 0x46, 0xD6, 0x60, 0xA7,
+            0x91, 0x33, 0x41, 0x43, 0xF9, 0x52, 0xDF, 0x28, 0xDB, 0x26, 0x59, 0x82, 0xF8, 0x24, 0xF9, 0xCC,
+            0x59, 0x24, 0x72, 0x26, 0x03, 0x9A, 0xAC, 0x17, 0x13, 0xD1, 0x77, 0x93, 0x85, 0x81, 0xE3, 0x7B,
+            0xCE, 0x15, 0x20, 0xE2, 0x79, 0x78, 0xF3, 0xC6, 0x9E, 0xB4, 0x5B, 0x09, 0x5A, 0x49, 0xAB, 0xA3,
+            0xC9, 0xF6, 0xE8, 0x42, 0xF3, 0x50, 0x5A, 0x8F, 0x20, 0x55, 0x45, 0xB3, 0x8A, 0xD8, 0xC2, 0x46,
+            0x08, 0x11, 0x60, 0x18, 0x66, 0x92, 0x34, 0x2E, 0x37, 0x0F, 0x5F, 0x64, 0x5F, 0x0C, 0xF2, 0x05,
+            0x4B, 0xC7, 0x7C, 0x26, 0xB8, 0x45, 0x40, 0xE2, 0xE0, 0x75, 0xB4, 0xBD, 0x6B, 0x68, 0x5C, 0x3D,
+            0x75, 0x96, 0x83, 0xCB, 0xE4, 0x22, 0x59, 0xDE, 0xDD, 0x4F, 0xA7, 0xDB, 0x8E, 0xAB, 0x4C, 0x2C,
+            0x17, 0xBD, 0x4E, 0xA7, 0xCE, 0xA0, 0xFF, 0x8B, 0xA9, 0xD7, 0x97, 0x61, 0x6A, 0xEA, 0xF4, 0x0C,
+            0xAC, 0x3E, 0x33, 0x77, 0x32, 0xFF, 0xA4, 0xCB, 0x22, 0x9F, 0xDB, 0x09, 0x34, 0x43, 0x35, 0x0F,
+            0x2C, 0x76, 0x99, 0xDA, 0xB7, 0x98, 0x85, 0x0D, 0x00, 0xD4, 0x42, 0x90, 0xA1, 0x56, 0xE2, 0xEF,
+            0xDE, 0x99, 0x47, 0x4D, 0x86, 0x16, 0x7B, 0x15, 0xF1, 0x80, 0xD9, 0x6C, 0xBA, 0x04, 0x60, 0x35,
+            0x89, 0xC3, 0x9B, 0x04, 0xB0, 0x4E, 0x5B, 0xFB, 0x49, 0x40, 0xD2, 0xB1, 0xA7, 0x07, 0xED, 0x32,
+            0x75, 0xE3, 0x78, 0x1E, 0xC3, 0xD2, 0x36, 0x6E, 0x00, 0x37, 0xEA, 0xDE, 0x19, 0x60, 0xE8, 0x69,
+            0xF8, 0x51, 0xDF, 0xEC, 0xD0, 0x50, 0xDB, 0x16, 0xFB, 0x35, 0x04, 0x0E, 0xC6, 0xBA, 0xDD, 0x3C,
+            0x4D, 0xA3, 0xF1, 0xD6, 0x96, 0x61, 0x9C, 0x7A, 0x72, 0x06, 0x35, 0xD9, 0xCA, 0x34, 0x4B, 0xDD,
+            0xAE, 0xA4, 0x26, 0x09, 0x0C, 0xA4, 0xCD, 0x18, 0xC6, 0xA1, 0x21, 0x83, 0x32, 0xBC, 0x3A, 0x53,
+            0x05, 0xEF, 0x24, 0xB6, 0x96, 0x9C, 0xBB, 0x32, 0x6C, 0x5E, 0x06, 0x25, 0xCD, 0x6A, 0x17, 0xB2,
+            0x37, 0xDD, 0xE5, 0x8F, 0x4A, 0x2E, 0xA4, 0x0A, 0xCD, 0x0B, 0x0F, 0x71, 0xF8, 0xE3, 0xC3, 0x47,
+            0x7B, 0x7B, 0xD0, 0xE3, 0xDF, 0x97, 0x60, 0xB9, 0x7A, 0xCC, 0xCA, 0x65, 0x2F, 0xA1, 0x7D, 0xF3,
+            0xF0, 0x79, 0x68, 0xBB, 0xA8, 0x55, 0x72, 0x84, 0xE4, 0x29, 0x18, 0xA5, 0xA7, 0x40, 0x8B, 0x9E,
+            0xCF, 0x51, 0x78, 0xE0, 0x1B, 0x99, 0x03, 0x7B, 0x4B, 0x64, 0x27, 0xE0, 0x15, 0xD1, 0x0D, 0x82,
+            0x44, 0x00, 0xEF, 0xCE, 0x12, 0xD1, 0x12, 0xAF, 0xC0, 0x5A, 0x89, 0x68, 0x97, 0xB4, 0x32, 0xB7,
+            0x48, 0x7B, 0xD1, 0x02, 0x8D, 0xBD, 0xA7, 0xE6, 0x89, 0x49, 0x79, 0x4A, 0x53, 0x81, 0x5B, 0x22,
+            0x01, 0xC3, 0xA8, 0x94, 0xAD, 0x68, 0x1E, 0xBE, 0x4D, 0x4C, 0xBA, 0x70, 0x09, 0xCC, 0x93, 0xDA,
+            0x42, 0x1F, 0x8A, 0x34, 0x99, 0x91, 0xEB, 0x50, 0xFA, 0xD1, 0xDD, 0x41, 0x15, 0x0E, 0x8F, 0xD2,
+            0x83, 0xA6, 0xF5, 0x47, 0x12, 0x06, 0x5D, 0x2B, 0xC5, 0x65, 0x04, 0x4B, 0x78, 0x6E, 0x07, 0x33,
+            0xE8, 0x84, 0x99, 0x90, 0x33, 0xE0, 0xF5, 0x0C, 0xDA, 0xB6, 0x3B, 0xCD, 0xBC, 0xDF, 0x36, 0x1D,
+            0xEA, 0x40, 0x49, 0x53, 0x7A, 0x04, 0x31, 0xA6, 0xF8, 0x62, 0xF8, 0x04, 0x45, 0xEF, 0x58, 0x4D,
+            0x1B, 0x88, 0x56, 0xEA, 0x70, 0xC7, 0xB1, 0xA7, 0xBB, 0x99, 0x7B, 0x15, 0x78, 0x92, 0x95, 0x53,
+            0x31, 0x2C, 0x17, 0xED, 0xB0, 0x0A, 0xC8, 0xC6, 0x8A, 0x91, 0x0C, 0x70, 0xF9, 0xE3, 0xC3, 0xC1,
+            0x70, 0x6F, 0xD8, 0xDF, 0xDE, 0x67, 0x17, 0xA4, 0x9B, 0x4B, 0x29, 0xBF, 0x46, 0xD9, 0xF7, 0xE4,
+            0x7F, 0x51, 0x5A, 0x11, 0x65, 0x88, 0x1F, 0x7A, 0x80, 0xD2, 0xB8, 0xDF, 0x64, 0x0B, 0x9E, 0xCE,
+            0x43, 0x72, 0x4F, 0x49, 0xDA, 0x24, 0xDB, 0x0E, 0x83, 0x83, 0xE6, 0x96, 0x14, 0x33, 0xD0, 0x8F,
+            0x06, 0x05, 0x05, 0x26, 0xE9, 0x0B, 0xEA, 0x0A, 0xFE, 0x94, 0xF2, 0x7A, 0xAF, 0x43, 0xDC, 0xB4,
+            0xD9, 0xE5, 0x8D, 0x97, 0x3A, 0x73, 0x58, 0xFA, 0x74, 0xD7, 0xD0, 0xA3, 0x4C, 0xFF, 0x89, 0x93,
+            0x1D, 0xD5, 0x99, 0xF8, 0xD0, 0x5F, 0x62, 0xFE, 0x97, 0x25, 0x2C, 0x79, 0x04, 0x7B, 0x61, 0x44,
+            0xD6, 0x78, 0x6D, 0xFB, 0x4B, 0x68, 0xDE, 0x64, 0x3A, 0xBD, 0x21, 0xC8, 0x40, 0x9B, 0xE3, 0x79,
+            0x18, 0x82, 0xD9, 0x10, 0xFF, 0x96, 0x05, 0xA6, 0x27, 0xBA, 0x94, 0xFA, 0xFE, 0xD6, 0x1B, 0xF5,
+            0x9F, 0x9D, 0x34, 0x0F, 0xC5, 0xEF, 0x15, 0xCD, 0x06, 0xAA, 0xDD, 0xA0, 0xD0, 0x70, 0x4B, 0x8C,
+            0x59, 0xB0, 0x45, 0x99, 0x79, 0x51, 0xFD, 0x5F, 0xA2, 0xF3, 0xC6, 0xC6, 0x28, 0xD5, 0x92, 0x94,
+            0xAF, 0x47, 0xFD, 0xB9, 0xBB, 0x46, 0xCA, 0xF5, 0xAE, 0xC4, 0x1C, 0x56, 0x9C, 0x61, 0x34, 0x8B,
+            0x72, 0x2C, 0x4C, 0xB6, 0xD2, 0xD1, 0x08, 0x3F, 0x81, 0x2E, 0x5B, 0x1B, 0x8B, 0xF4, 0x10, 0x86,
+            0x5A, 0x11, 0xD0, 0x36, 0x0F, 0x5F, 0xF2, 0xF4, 0x26, 0x8C, 0xAF, 0xD8, 0x4B, 0x18, 0x85, 0xB5,
+            0xF1, 0x5A, 0xA7, 0x66, 0x49, 0x8A, 0x4D, 0x0B, 0x27, 0x4A, 0x3D, 0x25, 0x5F, 0xE2, 0x33, 0x44,
+            0x3E, 0x3E, 0x0F, 0x66, 0xE9, 0xFC, 0xA0, 0xB9, 0x3D, 0xCC, 0xA9, 0xD7, 0x18, 0x30, 0xBA, 0x01,
+            0x88, 0x7C, 0x21, 0xB3, 0xC7, 0x35, 0x83, 0xE8, 0xE4, 0xB2, 0xD8, 0x42, 0xA1, 0x87, 0x1C, 0x87,
+            0x3E, 0x1A, 0xC3, 0x8C, 0xB6, 0x0B, 0x56, 0x0A, 0xFB, 0xD9, 0xDB, 0xD7, 0xCF, 0xC1, 0xC3, 0x08,
+            0x58, 0x77, 0xC9, 0x63, 0x0C, 0xD2, 0xE1, 0x12, 0x6B, 0x0B, 0xFD, 0xDA, 0x7E, 0xDD, 0xCC, 0x96,
+            0xB1, 0xB4, 0x4F, 0x49, 0x43, 0x0E, 0xA9, 0xBE, 0x19, 0xA3, 0x3E, 0x1A, 0x35, 0x61, 0xBF, 0x04,
+            0x08, 0x3C, 0x0F, 0x7D, 0x58, 0xBA, 0xA0, 0xA4, 0xFC, 0x56, 0x33, 0xB0, 0x06, 0xFD, 0xF1, 0x1E,
+            0x04, 0xB2, 0xCD, 0xE2, 0xD4, 0xE3, 0x8B, 0x38, 0x9C, 0xC2, 0xF4, 0xC3, 0x1B, 0xE0, 0x0A, 0x3F,
+            0xE7, 0x7D, 0x9F, 0x5C, 0x33, 0x62, 0xD2, 0xA2, 0xAD, 0x9E, 0xB8, 0xEC, 0x5A, 0xB4, 0xE3, 0x7E,
+            0x33, 0x5B, 0x22, 0x4F, 0x6D, 0x1F, 0xC1, 0x88, 0x5B, 0x6B, 0xF4, 0x03, 0xDC, 0x02, 0x6E, 0x78,
+            0x92, 0x32, 0x1F, 0xA4, 0x13, 0x38, 0xB7, 0xB5, 0x2D, 0x87, 0x4D, 0xA0, 0x96, 0x82, 0xEB, 0xB9,
+            0x65, 0x89, 0x0D, 0x22, 0xAC, 0x5C, 0x1E, 0x65, 0x5C, 0x97, 0x37, 0x3D, 0x61, 0x9D, 0x2B, 0x8C,
+            0x2F, 0x49, 0xCF, 0x2F, 0xD4, 0x4A, 0x65, 0x39, 0x50, 0xB9, 0xDA, 0xF4, 0xA8, 0x9F, 0x5E, 0x12,
+            0xF8, 0x39, 0xA7, 0x0E, 0x53, 0x0F, 0x20, 0x9F, 0x88, 0x26, 0x02, 0x0B, 0xEF, 0x3F, 0xDB, 0x4F,
+            0xC6, 0xF0, 0xBF, 0xE1, 0xEE, 0xBB, 0x7E, 0x6F, 0xF7, 0xC3, 0xE7, 0x21, 0xFC, 0xDA, 0xF9, 0x00,
+            0xFF, 0x3C, 0xFA, 0xF0, 0xF9, 0x5D, 0x7F, 0xF0, 0xE1, 0x09, 0x7D, 0xA4, 0x7F, 0x9E, 0x74, 0xDE,
+            0x5B, 0x9D, 0x4F, 0xDB, 0x77, 0x9B, 0xB6, 0xFE, 0x97, 0xA6, 0x48, 0x6C, 0xA3, 0x77, 0xC2, 0xD8,
+            0xD3, 0xF1, 0x16, 0xB6, 0x5F, 0xB7, 0x02, 0x92, 0xF4, 0x02, 0x0F, 0xB9, 0x0F, 0xF1, 0xDF, 0x9A,
+            0xA9, 0xCA, 0x53, 0x14, 0x39, 0x59, 0x6A, 0xAE, 0xA7, 0x2B, 0xBE, 0x49, 0x3D, 0xED, 0xC1, 0xFC,
+            0x16, 0x5E, 0x80, 0xAA, 0x45, 0x0B, 0x85, 0x15, 0xB1, 0xBB, 0xBB, 0xBD, 0x9B, 0xE3, 0x06, 0x68,
+            0xF1, 0xD8, 0x73, 0x0C, 0x39, 0x10, 0xD3, 0x3F, 0xD5, 0xB3, 0x77, 0x0C, 0x3B, 0x29, 0xC2, 0xDB,
+            0x8F, 0xEC, 0xD9, 0xC9, 0x8B, 0x73, 0x86, 0x5F, 0x03, 0xB8, 0xDB, 0x1E, 0xF4, 0xF6, 0x3A, 0x1B,
+            0x31, 0x4C, 0x04, 0x34, 0xC3, 0xE2, 0x9B, 0x64, 0x78, 0x54, 0xE0, 0x77, 0xEF, 0xAB, 0x78, 0x8D,
+            0x42, 0xDF, 0x7F, 0xE3, 0x2D, 0x38, 0x0A, 0x13, 0x60, 0xE8, 0x39, 0x6E, 0x96, 0x30, 0x10, 0x6B,
+            0x2F, 0x92, 0x4D, 0x38, 0xD5, 0xDD, 0xD5, 0x2A, 0xD3, 0xDF, 0x25, 0xB7, 0xDB, 0x7D, 0x2D, 0xDF,
+            0x5F, 0x76, 0x25, 0xC7, 0x43, 0x5C, 0xD8, 0xF7, 0x66, 0x5A, 0xAE, 0x95, 0x15, 0x3B, 0x4A, 0x16,
+            0xA0, 0x22, 0xD4, 0x26, 0x5C, 0x12, 0x17, 0x7A, 0x88, 0xCC, 0xBB, 0xEA, 0xF0, 0x9A, 0xBE, 0xAD,
+            0xC5, 0x2F, 0x18, 0xD3, 0xD0, 0xAE, 0x21, 0x36, 0x6E, 0x84, 0x44, 0x4F, 0x01, 0xB6, 0x18, 0xB0,
+            0xA1, 0x0E, 0x1F, 0x11, 0x04, 0x95, 0xF8, 0xC5, 0xBC, 0x64, 0x26, 0x2D, 0x07, 0xF9, 0x73, 0xF1,
+            0xF5, 0xEC, 0x38, 0x61, 0x74, 0x7B, 0xFA, 0x11, 0x91, 0xE2, 0xBF, 0x5D, 0xBE, 0x7A, 0xF9, 0x77,
+            0xC0, 0x52, 0x0A, 0x54, 0xC7, 0x22, 0x4D, 0xB1, 0x27, 0x40, 0x60, 0x06, 0xAF, 0x8E, 0x81, 0xC1,
+            0x4A, 0x74, 0xB5, 0x7A, 0x5E, 0x6E, 0x78, 0x13, 0x20, 0x54, 0x5C, 0x3F, 0x37, 0x3C, 0x7C, 0x9B,
+            0x6E, 0x7F, 0x57, 0x9C, 0x38, 0x78, 0x04, 0xB2, 0xBB, 0x04, 0xC7, 0x5D, 0x39, 0x91, 0x64, 0x81,
+            0xC9, 0xF0, 0x02, 0xFA, 0x10, 0xE9, 0x6E, 0x66, 0x18, 0xC0, 0x5E, 0x96, 0x45, 0xA1, 0xA3, 0x02,
+            0x4A, 0xA2, 0x80, 0x6C, 0x20, 0x18, 0x14, 0xE1, 0x01, 0x8C, 0x19, 0x32, 0x1B, 0x42, 0x5B, 0xC4,
+            0x7F, 0x68, 0xB4, 0x14, 0xCD, 0xD1, 0xB0, 0xB6, 0xC0, 0xF5, 0xB8, 0x4A, 0x29, 0x72, 0x5D, 0x46,
+            0x98, 0x44, 0xA1, 0x81, 0x0D, 0x80, 0x5A, 0x8D, 0x9D, 0x06, 0x7F, 0x33, 0xF0, 0x34, 0xF8, 0x16,
+            0xE8, 0x69, 0xF8, 0xE5, 0xF0, 0x69, 0xF8, 0x65, 0xF8, 0x69, 0x78, 0x7F, 0x00, 0x35, 0xBC, 0x27,
+            0x82, 0x1A, 0x7E, 0x0B, 0x08, 0x35, 0xFC, 0x7E, 0x18, 0x6A, 0x78, 0x1F, 0x10, 0x35, 0xFC, 0x07,
+            0x47, 0x51, 0x83, 0x0D, 0x60, 0xD4, 0x50, 0x47, 0x32, 0xF7, 0x05, 0x52, 0xC3, 0x7F, 0x74, 0x24,
+            0x35, 0xBC, 0x27, 0x94, 0x1A, 0xFE, 0x2D, 0xB1, 0x54, 0xC0, 0xD3, 0xB7, 0x09, 0x9E, 0x58, 0x3C,
+            0x3F, 0x7A, 0xC9, 0xF0, 0x93, 0xCC, 0xB0, 0xAE, 0xD3, 0x8B, 0xEA, 0xA7, 0x59, 0xD5, 0x17, 0x24,
+            0xB7, 0x4B, 0xFA, 0xB2, 0x91, 0xCB, 0xA0, 0xCE, 0x17, 0xBF, 0x0B, 0x1E, 0xEE, 0xE5, 0x39, 0x54,
+            0x4F, 0x93, 0x0B, 0xFC, 0xAA, 0x96, 0x0D, 0x41, 0xA1, 0x0D, 0x79, 0x40, 0x18, 0x88, 0x78, 0xF2,
+            0xAB, 0x91, 0x25, 0x11, 0xC9, 0xA1, 0x4B, 0x71, 0x45, 0xA9, 0xF1, 0x9B, 0x22, 0x4C, 0x31, 0xC0,
+            0xE5, 0x89, 0x64, 0x1B, 0x3E, 0x7C, 0x21, 0xD7, 0x48, 0x22, 0xC7, 0x34, 0x5D, 0xF8, 0x2E, 0x3C,
+            0x2B, 0x18, 0x3B, 0xFC, 0x4A, 0x58, 0x3C, 0xFC, 0x27, 0x2E, 0xFE, 0x27, 0x2E, 0xFE, 0x27, 0x2E,
+            0xFE, 0xBB, 0xE1, 0xE2, 0x9A, 0x33, 0x0A, 0xF3, 0x10, 0xAA, 0xE2, 0xA4, 0x62, 0xE5, 0x11, 0x45,
+            0xEE, 0xCC, 0xAA, 0xEE, 0x84, 0x42, 0xE0, 0x8E, 0x33, 0x75, 0x46, 0x24, 0x80, 0xA0, 0x84, 0x1D,
+            0x46, 0xF3, 0xEC, 0x10, 0xCB, 0x38, 0x19, 0x0C, 0xE0, 0xC3, 0x92, 0xC8, 0x18, 0x67, 0x83, 0xFA,
+            0x54, 0x49, 0x40, 0x33, 0x9B, 0x59, 0x13, 0x2F, 0xC8, 0x0E, 0xA1, 0x48, 0x22, 0x74, 0xD2, 0x9A,
+            0x41, 0x4C, 0xFF, 0x56, 0x09, 0x33, 0x4D, 0xD8, 0xE5, 0xB3, 0xA3, 0xDE, 0x70, 0x77, 0x84, 0x12,
+            0x9E, 0xA3, 0x14, 0xBD, 0x94, 0x39, 0x73, 0xEE, 0x5C, 0x71, 0x17, 0xBA, 0x81, 0xB0, 0x50, 0xE4,
+            0x49, 0x0A, 0x9D, 0x40, 0xA3, 0x1D, 0x75, 0x3E, 0x75, 0x8C, 0xF6, 0xC7, 0x9A, 0x12, 0xC6, 0xAA,
+            0xD9, 0x34, 0xD5, 0x99, 0xD2, 0xEF, 0x36, 0x50, 0x99, 0xD2, 0x09, 0x30, 0x9A, 0x27, 0xC3, 0x64,
+            0xB6, 0xA4, 0x22, 0x4E, 0x46, 0x60, 0x30, 0x27, 0x5C, 0x44, 0x3E, 0x87, 0xB9, 0x63, 0x9F, 0x1D,
+            0x4B, 0x9C, 0x81, 0xDD, 0x78, 0x60, 0x24, 0xE0, 0x71, 0x52, 0x3B, 0x4E, 0xA9, 0x42, 0x04, 0xCF,
+            0x5C, 0x1D, 0xE4, 0x58, 0x38, 0x26, 0xF3, 0xA0, 0xB4, 0x70, 0xF4, 0xF6, 0x26, 0xC4, 0xC3, 0x15,
+            0x87, 0xFB, 0x5D, 0x2C, 0xA6, 0x48, 0x12, 0x3A, 0x4E, 0x21, 0xA2, 0xE4, 0xC1, 0x98, 0xB0, 0x44,
+            0x2B, 0x9F, 0xBA, 0xCF, 0xC7, 0x41, 0x80, 0x37, 0xC5, 0x42, 0x5B, 0x2C, 0xFD, 0xD4, 0x8B, 0x80,
+            0x07, 0xB2, 0x96, 0x1E, 0x3E, 0xE9, 0x60, 0x44, 0x49, 0xE2, 0x5C, 0x4F, 0x81, 0x71, 0x2A, 0x0E,
+            0xC5, 0x66, 0x65, 0xAC, 0x8F, 0xAD, 0x54, 0x4A, 0x5F, 0x6B, 0x1C, 0x8F, 0x4E, 0x58, 0x1B, 0x95,
+            0xD4, 0x59, 0x79, 0x32, 0xA3, 0xD1, 0xBD, 0x31, 0x96, 0xF8, 0xAC, 0x8F, 0x68, 0x80, 0x46, 0xED,
+            0xD6, 0x3A, 0xB7, 0x41, 0xA9, 0x30, 0xBA, 0xD4, 0x6E, 0x38, 0x25, 0x79, 0x90, 0x35, 0xAC, 0x0D,
+            0x35, 0x0C, 0xAC, 0x24, 0xC8, 0xE4, 0x82, 0x9A, 0x9D, 0x02, 0x8E, 0x1D, 0xED, 0xB0, 0x39, 0xFF,
+            0xC8, 0x5C, 0x6F, 0x06, 0xE6, 0x54, 0xD8, 0x90, 0xEC, 0xDE, 0xF4, 0xA8, 0x77, 0xF6, 0xE1, 0xD3,
+            0x68, 0xE7, 0xAE, 0x72, 0x73, 0x29, 0x6C, 0x47, 0x45, 0x7B, 0x32, 0x45, 0x3C, 0x49, 0x83, 0xA6,
+            0xB1, 0x60, 0xE5, 0xD5, 0x28, 0x0E, 0x67, 0xA8, 0xED, 0x95, 0x67, 0xBD, 0xC6, 0x3E, 0xD2, 0x5C,
+            0x51, 0x6A, 0x20, 0x6B, 0x23, 0x8B, 0x4E, 0x8F, 0x8E, 0xB2, 0x98, 0xAA, 0xBC, 0x18, 0x92, 0x0F,
+            0x2C, 0x3D, 0x07, 0x61, 0xB2, 0xA6, 0x78, 0xEA, 0x4D, 0xEC, 0xB8, 0x66, 0xA7, 0x11, 0x25, 0x68,
+            0x2C, 0x57, 0x6C, 0xC5, 0x64, 0x61, 0x13, 0x7E, 0x34, 0x8B, 0xEB, 0xE8, 0xB2, 0x28, 0xAF, 0x6B,
+            0x1E, 0x16, 0xCE, 0x9F, 0xA2, 0xFC, 0x80, 0xB9, 0x53, 0xEF, 0xD2, 0x71, 0x1C, 0x2B, 0x97, 0xF5,
+            0x61, 0x24, 0x8A, 0x72, 0x14, 0x4F, 0xD9, 0xFC, 0x90, 0xAF, 0x2C, 0x28, 0x7B, 0xCA, 0x9A, 0xD3,
+            0xD6, 0x52, 0xA9, 0x62, 0xBE, 0xD0, 0x42, 0x95, 0x44, 0xC8, 0xFA, 0xD7, 0xE6, 0xE1, 0x19, 0x2C,
+            0xA5, 0x10, 0xE2, 0x36, 0x02, 0x13, 0xD2, 0xF7, 0x65, 0x79, 0x0A, 0x71, 0xB3, 0x47, 0xAB, 0x56,
+            0x2C, 0xAC, 0xBA, 0x74, 0x45, 0xAE, 0x29, 0x6E, 0x8B, 0xC2, 0x9C, 0x10, 0xB3, 0xA4, 0xCB, 0x38,
+            0x10, 0xA7, 0xB1, 0xF1, 0x42, 0x0E, 0x47, 0xA3, 0xB5, 0x3B, 0xA5, 0x44, 0x86, 0xB2, 0x41, 0x1C,
+            0x5C, 0x0C, 0x8A, 0xA6, 0xA6, 0x4C, 0xF2, 0x02, 0x14, 0x8D, 0xAC, 0xE5, 0x78, 0xAE, 0xD6, 0xAA,
+            0x9C, 0x1F, 0xAB, 0xC5, 0x33, 0x66, 0x09, 0x76, 0xB9, 0xA6, 0xE6, 0x0B, 0x50, 0x45, 0x59, 0xA1,
+            0xF9, 0x0D, 0xBE, 0x59, 0xAD, 0xC6, 0x3A, 0xB5, 0xB1, 0x8A, 0x07, 0xA6, 0x36, 0xC3, 0x7A, 0xBF,
+            0x72, 0x7E, 0x85, 0x35, 0x32, 0x75, 0xF0, 0x63, 0xD4, 0xFF, 0xC5, 0xDD, 0x9B, 0xAC, 0x84, 0x1F,
+            0xB2, 0x12, 0xE3, 0x0B, 0x85, 0x60, 0x94, 0xDA, 0x01, 0xC7, 0x97, 0xC0, 0x12, 0xD5, 0xEC, 0xD4,
+            0x1F, 0xE0, 0x26, 0x4E, 0xEC, 0x45, 0xE9, 0x61, 0x63, 0xBA, 0x0C, 0x44, 0x3D, 0xB3, 0x2A, 0x4F,
+            0x81, 0xDD, 0x1E, 0x53, 0x4D, 0x58, 0x33, 0xEE, 0x86, 0x0E, 0xC0, 0xEC, 0x20, 0xB5, 0xFE, 0xB2,
+            0xE4, 0xF1, 0xAD, 0x70, 0xE4, 0x61, 0x7C, 0xE4, 0xFB, 0xED, 0x96, 0xF9, 0xD4, 0x4A, 0xAB, 0x63,
+            0x81, 0x8C, 0x4F, 0x6D, 0x67, 0xDE, 0x06, 0xF7, 0x7B, 0x70, 0x08, 0x3D, 0xB9, 0x6F, 0xD1, 0x5A,
+            0x79, 0xEE, 0x25, 0xA9, 0x15, 0xF3, 0x05, 0xF8, 0x8B, 0x76, 0x4B, 0x54, 0x39, 0xB4, 0x3A, 0xFB,
+            0x78, 0x9B, 0xA4, 0x64, 0x49, 0x6F, 0xC5, 0x0E, 0x58, 0x0B, 0x67, 0xDC, 0xDA, 0x6F, 0xDC, 0xC1,
+            0xED, 0x35, 0xE3, 0xDE, 0x7F, 0x3C, 0x24, 0x0A, 0xCC, 0x26, 0xA9, 0xCE, 0xC4, 0x1C, 0xCB, 0xCA,
+            0x8B, 0x03, 0xA6, 0x07, 0x9B, 0xF1, 0xF4, 0xD4, 0xE7, 0xF8, 0xF1, 0xE9, 0xED, 0xB9, 0xDB, 0x6E,
+            0x29, 0x48, 0xD4, 0x62, 0x3F, 0x33, 0x25, 0x94, 0xFD, 0x46, 0x81, 0x40, 0x79, 0x1E, 0x84, 0xE9,
+            0x5A, 0xE5, 0x86, 0x19, 0x7F, 0xA0, 0x75, 0x93, 0xB9, 0x5A, 0x06, 0x50, 0xC4, 0xE6, 0xE0, 0xF5,
+            0x24, 0xEE, 0x32, 0x35, 0xA2, 0x37, 0x13, 0xB5, 0x22, 0xC2, 0x1E, 0xF1, 0x29, 0x21, 0x9E, 0x82,
+            0xA8, 0x5A, 0x5B, 0x54, 0xA0, 0xD7, 0x65, 0x9F, 0x00, 0x27, 0x00, 0xC2, 0x19, 0xA3, 0xC8, 0x7B,
+            0x09, 0x08, 0x96, 0xB7, 0xD8, 0x5D, 0xA7, 0x61, 0xC1, 0xFE, 0x18, 0xB4, 0xC1, 0x01, 0x44, 0x20,
+            0x28, 0x8E, 0x62, 0x55, 0x9F, 0xA9, 0x14, 0xA2, 0xDD, 0x51, 0x4D, 0xE8, 0x99, 0x34, 0x92, 0xFA,
+            0xBB, 0x16, 0xD5, 0x2C, 0x00, 0xCD, 0x16, 0x56, 0x27, 0xE2, 0xEF, 0x85, 0xED, 0xE0, 0x2F, 0x59,
+            0x35, 0xD8, 0xFA, 0xA0, 0x35, 0x75, 0xC5, 0x6F, 0x45, 0xA7, 0xDA, 0xE9, 0x12, 0xE4, 0xC3, 0xF9,
+            0x42, 0xD3, 0x8E, 0x85, 0x4B, 0x31, 0x53, 0x12, 0xDE, 0x7B, 0x07, 0xD7, 0x3F, 0x14, 0x0C, 0xA4,
+            0x48, 0x43, 0x97, 0x17, 0x16, 0x09, 0x4C, 0x96, 0x9E, 0xEF, 0xE2, 0x2A, 0x7D, 0x03, 0x97, 0x69,
+            0x0A, 0x64, 0x16, 0x0D, 0xCB, 0xB1, 0x51, 0x38, 0x3C, 0x8E, 0x01, 0xAD, 0x01, 0x7F, 0x68, 0x25,
+            0x21, 0x28, 0xD4, 0x0F, 0x67, 0xED, 0x96, 0xAC, 0xB9, 0xA1, 0x09, 0x2F, 0x03, 0xFB, 0xDA, 0xF6,
+            0x7C, 0x2C, 0x1C, 0x00, 0xC9, 0x01, 0x97, 0xD4, 0xA5, 0x93, 0x17, 0x7E, 0xC5, 0x28, 0x54, 0x12,
+            0x8F, 0x96, 0x17, 0x2F, 0x01, 0x7A, 0x80, 0x7D, 0x1C, 0x6C, 0xFC, 0x5F, 0x4B, 0x19, 0xAD, 0x6B,
+            0x27, 0x73, 0x9E, 0x60, 0x67, 0xC6, 0x7A, 0x1B, 0xFD, 0x97, 0x75, 0x0D, 0x53, 0xD9, 0xF1, 0xA0,
+            0xB7, 0xC1, 0x8F, 0xEE, 0x87, 0xD5, 0x96, 0xD8, 0xF1, 0x5D, 0x03, 0xF9, 0xEE, 0x36, 0x80, 0x40,
+            0xF1, 0x3F, 0xC4, 0x96, 0x2D, 0xE3, 0xCE, 0x91, 0x2E, 0xDB, 0x58, 0x20, 0x7A, 0x7D, 0x43, 0x38,
+            0x1B, 0x80, 0x32, 0x7A, 0x88, 0x22, 0x81, 0xC9, 0xED, 0x98, 0xBD, 0xE1, 0xF6, 0xA2, 0x40, 0x04,
+            0x10, 0xD4, 0x7C, 0x39, 0xB1, 0x00, 0x1A, 0x6F, 0xFD, 0xF9, 0xD6, 0x87, 0xB8, 0x07, 0x37, 0x76,
+            0x3B, 0x82, 0x50, 0x67, 0x4B, 0x35, 0x54, 0x8D, 0x65, 0xA9, 0x2D, 0xA9, 0x02, 0x05, 0x6D, 0x91,
+            0x29, 0xCA, 0x9B, 0x54, 0x49, 0x9B, 0xDD, 0x42, 0xE3, 0x94, 0x77, 0x44, 0x3D, 0x23, 0xC0, 0x96,
+            0x62, 0x99, 0x97, 0xC9, 0x22, 0xBA, 0x57, 0xD9, 0x40, 0xD3, 0xF0, 0x22, 0xD9, 0x00, 0x4B, 0x6D,
+            0x33, 0xD2, 0x60, 0xEF, 0xF2, 0xBA, 0xAA, 0xA4, 0xCD, 0xEE, 0xC9, 0x45, 0xD0, 0x00, 0xA3, 0xF5,
+            0xA6, 0xAC, 0xFD, 0x80, 0x2E, 0xAA, 0x0A, 0x29, 0xF1, 0x54, 0x0E, 0x89, 0xD9, 0x8A, 0x96, 0xC9,
+            0xBC, 0x2D, 0x94, 0xDC, 0x65, 0x82, 0x8B, 0xC3, 0xC3, 0x43, 0x76, 0x72, 0xFA, 0xDB, 0xF9, 0xF1,
+            0x29, 0x7B, 0xF9, 0xEA, 0x0D, 0x3B, 0x7E, 0xF5, 0xF2, 0xEC, 0xFC, 0xD7, 0xB7, 0xAF, 0x4F, 0x4F,
+            0xD8, 0xE3, 0xC7, 0x8F, 0x71, 0xC9, 0x23, 0x45, 0x22, 0x18, 0x71, 0x70, 0xE4, 0x20, 0x21, 0x80,
+            0xB3, 0x79, 0x82, 0x82, 0xD0, 0x2B, 0xB8, 0x6F, 0x63, 0x34, 0x0A, 0x3C, 0xB1, 0x0B, 0xDD, 0x96,
+            0x4A, 0x6A, 0x5A, 0x72, 0xB4, 0xD7, 0xDC, 0xE1, 0xDE, 0x35, 0xD5, 0xA6, 0x92, 0xD2, 0xAE, 0x3D,
+            0x9B, 0xFD, 0xFA, 0xFA, 0xD5, 0x6F, 0xA7, 0x0C, 0xC3, 0x6A, 0x68, 0x25, 0x79, 0x13, 0x13, 0x15,
+            0x8A, 0xC5, 0xFE, 0xC6, 0x5C, 0xA9, 0x23, 0x5E, 0x93, 0x24, 0x9F, 0x52, 0xA4, 0x1F, 0x60, 0x1C,
+            0xF2, 0x9C, 0x5F, 0x73, 0xDF, 0x54, 0x94, 0xBE, 0x45, 0x8B, 0xE7, 0x8E, 0x71, 0x3F, 0xE1, 0x95,
+            0xB2, 0x10, 0xE3, 0xD1, 0x31, 0x89, 0x3A, 0x05, 0x29, 0x68, 0xF6, 0xC6, 0x9B, 0x7A, 0x97, 0x99,
+            0x76, 0x45, 0xC1, 0x10, 0x3B, 0xBF, 0x30, 0x95, 0x4F, 0xD7, 0xCE, 0xA3, 0x7C, 0x13, 0x4C, 0xCE,
+            0xB2, 0x87, 0xA5, 0x66, 0x78, 0xB9, 0xDB, 0xC0, 0x45, 0x23, 0x9B, 0xEB, 0x04, 0x91, 0x4B, 0xF1,
+            0x9C, 0x28, 0x44, 0x32, 0xD4, 0x8F, 0xDF, 0x4D, 0x6D, 0x38, 0x32, 0x7F, 0xF7, 0xE0, 0xE0, 0x00,
+            0x5C, 0x86, 0xCB, 0xA7, 0x30, 0x29, 0xB7, 0x4A, 0x31, 0x47, 0xE2, 0x49, 0x4F, 0xB9, 0x4A, 0x44,
+            0x2F, 0x83, 0xB0, 0xA4, 0x43, 0x12, 0xD2, 0xC4, 0x21, 0x0A, 0x39, 0xDE, 0x94, 0x3E, 0x26, 0x14,
+            0xEB, 0x88, 0x67, 0x74, 0x4A, 0xF4, 0x9F, 0xB9, 0x0B, 0x6F, 0x33, 0xE2, 0x94, 0x64, 0x5D, 0x31,
+            0x02, 0x52, 0x92, 0xC6, 0xA0, 0x92, 0x9B, 0x2B, 0x5A, 0x5F, 0xBA, 0x1E, 0xF1, 0x52, 0x1C, 0x69,
+            0x8D, 0xB1, 0xC9, 0x45, 0x0D, 0x81, 0x32, 0xA3, 0x98, 0x59, 0x34, 0x12, 0xB3, 0xC1, 0xF0, 0xF9,
+            0x92, 0x02, 0xE9, 0x27, 0xAC, 0x75, 0x1A, 0x50, 0xC9, 0x57, 0x8B, 0x41, 0x8B, 0x13, 0x59, 0xFF,
+            0xD5, 0xEA, 0xC8, 0xFE, 0x1B, 0x19, 0xAB, 0x6C, 0x8B, 0x49, 0x4F, 0x5C, 0x29, 0x2A, 0xEF, 0x69,
+            0xB4, 0xC5, 0x4C, 0xA6, 0x4E, 0x87, 0xFE, 0x0C, 0xD7, 0x17, 0x89, 0xF2, 0x2A, 0xD9, 0x2A, 0x5C,
+            0xE4, 0xA7, 0x82, 0x5F, 0x8B, 0x13, 0x27, 0xF3, 0x13, 0x92, 0xFB, 0xD5, 0x4B, 0x8D, 0xC6, 0xE0,
+            0x1E, 0xE5, 0xF5, 0x63, 0xD8, 0xB5, 0x4D, 0x6B, 0x81, 0xAF, 0xF2, 0xCE, 0xE5, 0xC9, 0x9F, 0x4C,
+            0xAB, 0x76, 0xAF, 0xBA, 0xB4, 0xF3, 0xC0, 0x18, 0x32, 0x28, 0x10, 0x03, 0xFD, 0x01, 0xE8, 0xB1,
+            0xDD, 0x7A, 0x1F, 0x14, 0xD0, 0x83, 0x7C, 0xFD, 0x01, 0x80, 0xC9, 0x0B, 0x7B, 0xC6, 0x09, 0x3D,
+            0x14, 0x01, 0xC5, 0x8A, 0xDD, 0x57, 0x56, 0xDA, 0xC3, 0xE6, 0x5B, 0x87, 0xEE, 0x56, 0x61, 0x9D,
+            0xA4, 0xAA, 0x1F, 0x3E, 0xDF, 0xB1, 0xA6, 0x5F, 0x2F, 0x57, 0x4F, 0x5D, 0x26, 0x61, 0x3E, 0x72,
+            0x85, 0xB8, 0xAC, 0x50, 0xD3, 0xAD, 0x76, 0x3C, 0x11, 0x50, 0x9F, 0x61, 0xAC, 0xB3, 0x02, 0x14,
+            0x1A, 0xF9, 0x0E, 0xE5, 0x85, 0xB3, 0x8E, 0x28, 0xAE, 0xEC, 0x1B, 0x82, 0xB4, 0xD3, 0x6B, 0xE8,
+            0x89, 0x88, 0x8D, 0x07, 0x3C, 0x86, 0x21, 0x29, 0xD4, 0x02, 0x87, 0xAA, 0x04, 0xDE, 0x26, 0x9C,
+            0xCD, 0x2D, 0x80, 0x2C, 0xD8, 0xF2, 0x84, 0x4F, 0xED, 0xA5, 0x8F, 0x41, 0x9A, 0x64, 0x0A, 0xF3,
+            0x15, 0xE7, 0x14, 0xAB, 0xAD, 0xE4, 0x09, 0xB3, 0x06, 0xAD, 0x5C, 0x27, 0x68, 0xAF, 0xFB, 0x5A,
+            0xF8, 0x29, 0x79, 0xD7, 0x57, 0xFB, 0x10, 0x7E, 0xC5, 0x61, 0x6D, 0x9F, 0xC7, 0x69, 0xBB, 0x75,
+            0x41, 0xD5, 0xD9, 0x12, 0x19, 0x53, 0xB9, 0xAE, 0x91, 0x3A, 0x6B, 0x69, 0xC3, 0x41, 0x3B, 0x59,
+            0x27, 0x16, 0x08, 0x1C, 0x41, 0x03, 0xBA, 0xBE, 0xF2, 0x00, 0xE2, 0xF8, 0x25, 0xDF, 0x5F, 0xDB,
+            0x4D, 0xC5, 0xEF, 0x55, 0xDA, 0x53, 0x6A, 0x13, 0x53, 0xFB, 0x38, 0x07, 0x94, 0xC6, 0x02, 0x7E,
+            0xC3, 0xFE, 0xFC, 0xE2, 0xF9, 0x33, 0xD8, 0xA2, 0x5F, 0x73, 0x88, 0x11, 0x12, 0x92, 0x18, 0xDC,
+            0xB3, 0x04, 0xC1, 0x0A, 0xC9, 0xEB, 0x21, 0x8A, 0xB2, 0x47, 0x89, 0x00, 0xDC, 0xA3, 0xE4, 0xCE,
+            0x71, 0xB8, 0x00, 0x71, 0x21, 0xEF, 0x19, 0x6C, 0x83, 0x85, 0xEB, 0x08, 0x08, 0xF9, 0xC2, 0x4E,
+            0xE7, 0x16, 0x05, 0x74, 0x6D, 0xEC, 0x01, 0xE3, 0xC0, 0x14, 0xB7, 0x18, 0xB7, 0xD2, 0x30, 0xC5,
+            0xCD, 0xF7, 0x27, 0x4C, 0x63, 0xAC, 0x5A, 0x1E, 0x66, 0x5E, 0x44, 0x4F, 0x55, 0x64, 0x37, 0x0E,
+            0xF4, 0x38, 0xE0, 0x37, 0x7E, 0x68, 0x6D, 0x42, 0x04, 0xF1, 0x6D, 0x09, 0xE6, 0xB6, 0x8C, 0x74,
+            0x06, 0x3A, 0x81, 0x02, 0xD5, 0x3B, 0x42, 0xCF, 0x28, 0xA8, 0xB2, 0x84, 0xB0, 0x9F, 0x29, 0x1D,
+            0x25, 0x1C, 0x6C, 0x0D, 0xBE, 0x35, 0x5D, 0x02, 0x1C, 0x84, 0x7D, 0x61, 0x08, 0x73, 0x5C, 0x85,
+            0xE2, 0x37, 0xE2, 0x4F, 0x27, 0x3F, 0x1F, 0xE0, 0x19, 0x3B, 0x22, 0x32, 0xE0, 0xD8, 0xB2, 0x2C,
+            0x73, 0xE2, 0x61, 0x04, 0xB1, 0x86, 0x29, 0xCE, 0x9B, 0x18, 0x82, 0x66, 0x62, 0x47, 0x05, 0x26,
+            0x88, 0xB2, 0xCD, 0x16, 0x8E, 0x1F, 0x26, 0x1C, 0xFB, 0x68, 0x4C, 0xF1, 0x95, 0x6C, 0x4E, 0x01,
+            0xF1, 0x73, 0x57, 0x88, 0x32, 0x93, 0xC3, 0xFE, 0xFD, 0xD7, 0xC1, 0xD4, 0x06, 0x7E, 0x56, 0xCB,
+            0x9F, 0xE2, 0x89, 0xA2, 0x02, 0xBE, 0x09, 0xFF, 0xAC, 0xA7, 0x9E, 0xB6, 0x40, 0x17, 0x2F, 0xC6,
+            0xF9, 0x8A, 0x39, 0x64, 0x7E, 0x06, 0x9C, 0xDC, 0x89, 0x9D, 0xDA, 0x72, 0x45, 0x9E, 0xC9, 0xAF,
+            0xA8, 0x00, 0x75, 0xCB, 0xC2, 0x37, 0x0E, 0x04, 0x99, 0x8F, 0xEA, 0x92, 0x53, 0xD1, 0x14, 0x5C,
+            0x6F, 0x86, 0xA5, 0x0E, 0x2B, 0x7C, 0x9B, 0x48, 0xC0, 0x02, 0x23, 0x94, 0x8E, 0xB2, 0xD2, 0xD8,
+            0x5B, 0xA8, 0xB5, 0x4E, 0x06, 0xD2, 0xBA, 0x78, 0x75, 0xF9, 0x06, 0x71, 0xAC, 0x81, 0xD7, 0x11,
+            0xCF, 0xE3, 0x54, 0xAD, 0xB9, 0x7C, 0xE8, 0x08, 0xCD, 0x7F, 0xBC, 0xD7, 0xDF, 0xEB, 0xCB, 0xD4,
+            0x35, 0x34, 0x6A, 0xB4, 0xE5, 0xD8, 0x80, 0x0D, 0x9E, 0x88, 0x41, 0x0E, 0x28, 0xAA, 0x0B, 0x1C,
+            0xD8, 0x91, 0xDF, 0xBE, 0x3E, 0x47, 0x5F, 0x00, 0x7B, 0x56, 0x90, 0xCA, 0x86, 0x1D, 0x44, 0x0E,
+            0xAD, 0x8E, 0x1C, 0x3B, 0xC1, 0x49, 0xA9, 0x49, 0xCA, 0x04, 0xC3, 0x9D, 0x21, 0x16, 0xC2, 0x89,
+            0xAB, 0xE6, 0x95, 0xD5, 0xCB, 0xAB, 0x6D, 0x44, 0x77, 0xA3, 0x90, 0x5D, 0x7D, 0xF9, 0x16, 0x9B,
+            0xC8, 0x62, 0x1D, 0x33, 0xB2, 0x78, 0x49, 0x49, 0x79, 0x85, 0x6D, 0x98, 0x6C, 0xD7, 0x6E, 0xF2,
+            0x38, 0x1B, 0x39, 0x26, 0x38, 0x8C, 0x96, 0x28, 0xC1, 0x6D, 0xAD, 0x34, 0xE7, 0xAC, 0xB0, 0x7D,
+            0xD5, 0x1E, 0x60, 0xA7, 0x10, 0xAE, 0xCD, 0xD1, 0xCE, 0x94, 0x34, 0x92, 0x7C, 0x57, 0xBD, 0xF2,
+            0x4B, 0x2C, 0x0C, 0x36, 0xE5, 0x61, 0xF0, 0x15, 0x4C, 0x0C, 0x34, 0x17, 0x0D, 0x61, 0x68, 0xE6,
+            0xB9, 0xA4, 0x32, 0x12, 0x03, 0x6D, 0x55, 0x91, 0x42, 0x4A, 0xE7, 0x6E, 0xB6, 0xFF, 0x4C, 0x57,
+            0x03, 0x12, 0xD9, 0x5C, 0xED, 0xEC, 0x04, 0x42, 0xD4, 0x7E, 0x2D, 0x08, 0x50, 0xAA, 0x17, 0x43,
+            0x79, 0xBC, 0x59, 0x91, 0x51, 0xAB, 0x78, 0x19, 0x0B, 0xAB, 0x79, 0x19, 0x0B, 0xAB, 0x7A, 0x19,
+            0x0B, 0xD9, 0x2F, 0x8D, 0xA1, 0x73, 0x3D, 0xDA, 0x30, 0xE9, 0x3A, 0x6D, 0x24, 0x84, 0x43, 0xCA,
+            0xB6, 0x4C, 0xD7, 0xC1, 0x94, 0x8B, 0xE2, 0x52, 0x34, 0x2B, 0xBA, 0x88, 0x47, 0x71, 0xAA, 0xFB,
+            0xDC, 0xE5, 0xD1, 0x6C, 0x59, 0x09, 0x5A, 0xAC, 0xF7, 0x5F, 0x13, 0x24, 0x60, 0x11, 0xEF, 0x15,
+            0x24, 0x2C, 0x42, 0x7A, 0x20, 0xF6, 0xA9, 0xB1, 0x10, 0xF1, 0x21, 0xFD, 0xEA, 0x36, 0x30, 0x3A,
+            0x1D, 0xC3, 0x55, 0xCC, 0x3F, 0x8C, 0x6B, 0x87, 0x2A, 0x2F, 0x15, 0x74, 0x4A, 0x18, 0xE8, 0x52,
+            0xB4, 0x42, 0xB5, 0x7C, 0x8A, 0x8D, 0x6E, 0x43, 0xA9, 0xE3, 0xBE, 0xF4, 0xA2, 0x1B, 0x11, 0xFC,
+            0x60, 0xBD, 0x5E, 0x46, 0x4D, 0x48, 0xE8, 0xED, 0xEB, 0xE7, 0xF7, 0x25, 0x27, 0xAA, 0xEE, 0x88,
+            0xA2, 0xAC, 0xC7, 0x33, 0x58, 0xC4, 0xE2, 0x39, 0x55, 0x3B, 0xC7, 0x22, 0x7C, 0x29, 0xDB, 0x39,
+            0xFA, 0xD1, 0x7B, 0xF2, 0x4B, 0x24, 0x24, 0xCF, 0xA2, 0xD4, 0x4E, 0x0D, 0xD1, 0x69, 0xDC, 0x75,
+            0x1B, 0x22, 0x60, 0x47, 0xF1, 0x7A, 0xD1, 0x7D, 0xB9, 0xC7, 0x6A, 0x34, 0xA2, 0x4C, 0x35, 0x6A,
+            0x26, 0xE7, 0x18, 0x42, 0x7E, 0x21, 0xC7, 0xA2, 0xE2, 0x4B, 0x92, 0xA5, 0x5A, 0x30, 0xCD, 0x2F,
+            0x52, 0xCE, 0x62, 0xC3, 0x2F, 0x97, 0x89, 0x2C, 0x95, 0x11, 0x42, 0x51, 0x85, 0x34, 0x86, 0x54,
+            0x1A, 0x77, 0xAB, 0xBC, 0xAF, 0xB0, 0x53, 0x99, 0xE9, 0x30, 0x93, 0x09, 0x07, 0xEB, 0x19, 0x6A,
+            0x89, 0xBA, 0x22, 0x3D, 0x96, 0x81, 0xB1, 0xF2, 0x64, 0x21, 0x06, 0x54, 0x95, 0x68, 0xAB, 0x97,
+            0x97, 0xAC, 0x39, 0xCB, 0x16, 0x58, 0x89, 0x8E, 0xAA, 0x26, 0x5B, 0x4B, 0xE7, 0xE2, 0xF7, 0x3A,
+            0x2A, 0x98, 0x87, 0xC0, 0x3C, 0xC5, 0xE6, 0x33, 0xC4, 0xE6, 0xC6, 0x2C, 0x4B, 0xE4, 0x30, 0x8F,
+            0xB1, 0x39, 0x35, 0x68, 0x6D, 0x8A, 0x0C, 0x3C, 0x42, 0xE0, 0x86, 0x37, 0x96, 0xB3, 0x8C, 0x63,
+            0x68, 0x29, 0x92, 0x4B, 0xE8, 0x99, 0x80, 0x24, 0xFE, 0x82, 0x5D, 0x27, 0x06, 0x24, 0xEC, 0x4D,
+            0x6F, 0xDB, 0x62, 0xE0, 0x2E, 0x0B, 0x96, 0xBE, 0xDF, 0x65, 0xC3, 0xBC, 0x63, 0x2B, 0xD6, 0xF3,
+            0x48, 0xA8, 0xFE, 0xA0, 0x8E, 0x7C, 0x39, 0xDA, 0xD3, 0x69, 0x48, 0xF3, 0x59, 0xC9, 0x38, 0x49,
+            0xF3, 0xF1, 0x9E, 0xF0, 0x6F, 0xB8, 0x2B, 0x40, 0x3C, 0x68, 0x9B, 0x7A, 0x70, 0xE0, 0x3B, 0xB8,
+            0x56, 0x31, 0x63, 0x08, 0xC3, 0x65, 0x13, 0xEC, 0xAE, 0x3E, 0x8B, 0x69, 0x43, 0xA7, 0x3A, 0xAE,
+            0x8C, 0xA6, 0x62, 0xB7, 0x55, 0x6F, 0xEE, 0xA0, 0xC0, 0x1F, 0xDF, 0xDD, 0xD1, 0x2A, 0x35, 0x91,
+            0xEF, 0x35, 0xC3, 0x16, 0x7D, 0x13, 0xC4, 0xE2, 0x0B, 0x1D, 0x24, 0xD8, 0x3C, 0x9E, 0x7B, 0xBE,
+            0xDB, 0x56, 0xFD, 0x4C, 0x86, 0x12, 0x59, 0x8C, 0x85, 0x2F, 0x6F, 0xB9, 0x35, 0xA1, 0x00, 0xFF,
+            0xC8, 0x1D, 0x00, 0x7C, 0x0B, 0x3B, 0xA0, 0x73, 0x9F, 0xE8, 0x36, 0x77, 0x2E, 0x43, 0xB4, 0xC5,
+            0xA1, 0x52, 0x89, 0xB6, 0x94, 0xAA, 0xAA, 0xF8, 0x41, 0xCD, 0x78, 0xE2, 0x99, 0x66, 0xFD, 0x24,
+            0xEB, 0x03, 0x81, 0x4B, 0xE8, 0xA0, 0x81, 0x89, 0x93, 0x86, 0x1C, 0x0E, 0xD9, 0x80, 0x3C, 0x95,
+            0x00, 0x99, 0xC1, 0x08, 0x51, 0xB1, 0x16, 0x10, 0x00, 0xD8, 0x33, 0x5E, 0x84, 0x15, 0x55, 0x55,
+            0x51, 0xDF, 0xD7, 0x42, 0xEE, 0xBF, 0x9B, 0x0A, 0x05, 0x88, 0xDE, 0x80, 0xAC, 0x26, 0x32, 0x86,
+            0x78, 0x0A, 0x1F, 0xDB, 0xEF, 0xEA, 0x98, 0x04, 0x04, 0xF2, 0x09, 0xC1, 0x07, 0xC8, 0x00, 0x54,
+            0xED, 0x7B, 0x02, 0xE6, 0x6F, 0xE1, 0xF1, 0x54, 0x2B, 0x0B, 0x4B, 0x96, 0x31, 0xB2, 0x02, 0x5B,
+            0x92, 0x34, 0xD2, 0x57, 0x93, 0x3F, 0x40, 0xEB, 0xF0, 0xBD, 0x8D, 0x03, 0xE9, 0x66, 0xAB, 0xCC,
+            0x99, 0xEC, 0xD8, 0xB6, 0xF0, 0x3D, 0x9F, 0xD0, 0x0A, 0x08, 0xE2, 0x37, 0x25, 0x56, 0xB4, 0x3D,
+            0x3C, 0x37, 0xA0, 0xB3, 0x2A, 0xF1, 0xC8, 0x68, 0x1A, 0x62, 0xD1, 0x76, 0x7C, 0x6C, 0x63, 0xF8,
+            0x89, 0xD1, 0x46, 0x4F, 0xFA, 0x0D, 0x62, 0x0D, 0x3B, 0xD3, 0x59, 0x31, 0x5A, 0x1E, 0xF2, 0x05,
+            0x38, 0x3D, 0xBC, 0x32, 0xF8, 0x82, 0x01, 0x2A, 0x4D, 0x44, 0x19, 0x17, 0x96, 0x25, 0x09, 0xED,
+            0x5B, 0x4C, 0x6A, 0x67, 0x09, 0xFF, 0xCF, 0x15, 0xCD, 0x51, 0x7D, 0x11, 0xB7, 0x5D, 0xAB, 0x55,
+            0x34, 0x87, 0xFC, 0x33, 0xCB, 0x19, 0xB0, 0xDC, 0x24, 0xB5, 0x64, 0x3C, 0x1A, 0x7D, 0xDF, 0xFC,
+            0x52, 0x1E, 0x23, 0x81, 0x7C, 0x5D, 0xAE, 0x72, 0x37, 0xC8, 0xC9, 0x6B, 0xBA, 0xD0, 0x26, 0x63,
+            0xC2, 0x4F, 0x56, 0xA8, 0x84, 0x9B, 0x0F, 0x6B, 0x4C, 0x43, 0xD1, 0x40, 0x8B, 0x7C, 0x25, 0xF9,
+            0xE0, 0x36, 0xC4, 0x84, 0x76, 0x0C, 0x6C, 0x63, 0x52, 0x00, 0xA2, 0x9E, 0x0E, 0xBD, 0xE4, 0xCE,
+            0xBF, 0x15, 0x46, 0x23, 0xBD, 0x28, 0x06, 0xA4, 0x9A, 0x59, 0xE5, 0x95, 0x5A, 0xAD, 0x7D, 0xB6,
+            0xB5, 0xC5, 0x8E, 0x7D, 0x7C, 0x85, 0x11, 0x4D, 0x89, 0x10, 0x67, 0xBD, 0x1A, 0x4E, 0xE9, 0x8C,
+            0x10, 0xB9, 0xC5, 0x3C, 0xAE, 0x00, 0x37, 0x35, 0x6B, 0x51, 0x4F, 0x0A, 0x7F, 0x1D, 0x25, 0x74,
+            0x1A, 0x28, 0x03, 0xDF, 0x0A, 0xC5, 0x18, 0x0F, 0x7F, 0xCB, 0x65, 0x1A, 0xD8, 0xD7, 0xDE, 0xCC,
+            0x06, 0x84, 0x6E, 0x69, 0x2F, 0xC2, 0x7E, 0xFC, 0x91, 0x55, 0x5C, 0xA6, 0x11, 0x28, 0x0F, 0x02,
+            0x5D, 0x57, 0xDD, 0x6F, 0xAB, 0xE3, 0x5B, 0x2D, 0x5E, 0xB4, 0xCD, 0xCB, 0x94, 0x66, 0x18, 0x89,
+            0x24, 0x8C, 0x66, 0x84, 0xC2, 0x78, 0x75, 0xDF, 0x3C, 0x27, 0xCD, 0x74, 0xA3, 0x84, 0x93, 0x3B,
+            0x30, 0xD5, 0x04, 0xD8, 0xD1, 0xC5, 0xB9, 0x34, 0xD9, 0xAE, 0x7C, 0xED, 0xC9, 0xD4, 0xF6, 0x7D,
+            0xAC, 0x89, 0x18, 0x03, 0x74, 0x2F, 0x8A, 0x0C, 0xAC, 0xF9, 0x34, 0x73, 0xC1, 0x67, 0xB2, 0xA5,
+            0x8E, 0x99, 0x14, 0xD2, 0x58, 0xD1, 0x2C, 0x07, 0xFB, 0x6B, 0x9A, 0x69, 0x3B, 0xF2, 0x92, 0x17,
+            0xE1, 0x44, 0x18, 0xF1, 0xD6, 0x51, 0xE0, 0xC6, 0xA1, 0xE7, 0x7E, 0xBE, 0xE1, 0x93, 0x57, 0x97,
+            0x9F, 0xBD, 0x8B, 0x39, 0xC4, 0xB0, 0xF0, 0xCB, 0x76, 0xE1, 0x9F, 0xD0, 0xFD, 0xFC, 0xD4, 0x87,
+            0xAE, 0x4F, 0x81, 0xDF, 0xDB, 0xCF, 0xE7, 0xA7, 0xA2, 0xD7, 0x67, 0x4A, 0xE6, 0xB3, 0x17, 0x5E,
+            0xE0, 0x6D, 0x79, 0x56, 0x8A, 0xD9, 0xC7, 0x4C, 0xF0, 0x58, 0x39, 0x7F, 0x34, 0x83, 0xF5, 0xA3,
+            0x0E, 0x85, 0xE4, 0x50, 0x46, 0x42, 0x11, 0x2B, 0x0F, 0x8F, 0x36, 0xDF, 0x4E, 0x75, 0xFB, 0x15,
+            0x9B, 0x64, 0xB1, 0xCD, 0xC6, 0xBB, 0xA4, 0xEE, 0x98, 0x1B, 0x68, 0x0A, 0xED, 0x93, 0x36, 0x15,
+            0x3B, 0xA4, 0x08, 0x31, 0xC3, 0x65, 0xDA, 0xAE, 0x4E, 0x4B, 0xE5, 0x36, 0x4E, 0x22, 0xD0, 0x5A,
+            0xD1, 0x4D, 0x08, 0x40, 0xDA, 0x15, 0xA1, 0x28, 0x35, 0x62, 0x31, 0xEF, 0x50, 0xDA, 0x13, 0x4D,
+            0x46, 0xC9, 0xC9, 0x48, 0x2A, 0x32, 0x23, 0x64, 0x2C, 0xD3, 0xCC, 0x06, 0xBD, 0x84, 0xF1, 0x45,
+            0x04, 0x62, 0x80, 0x65, 0x2B, 0xEA, 0x3D, 0xA5, 0x13, 0x7D, 0x1F, 0xBC, 0x0F, 0xDE, 0x60, 0xD4,
+            0x70, 0x34, 0x05, 0x44, 0xCE, 0xC8, 0x37, 0xA3, 0x89, 0xE6, 0x5F, 0x7E, 0xD0, 0x25, 0x27, 0x4B,
+            0x2F, 0xF4, 0x11, 0x2F, 0x7C, 0x7A, 0xDF, 0x4A, 0x14, 0x1D, 0x39, 0x2B, 0x2B, 0xBF, 0x19, 0xAE,
+            0x5B, 0x46, 0x5D, 0x99, 0x21, 0x86, 0x0F, 0xBB, 0xFD, 0x02, 0x84, 0xFE, 0x07, 0xB3, 0x0C, 0x9F,
+            0x83, 0x3B, 0x06, 0xD7, 0x19, 0x70, 0xF7, 0x6D, 0x94, 0x25, 0x07, 0x33, 0x84, 0x8A, 0xF7, 0x96,
+            0x51, 0x06, 0x3C, 0x74, 0x63, 0x32, 0x04, 0xA3, 0xA7, 0x38, 0x22, 0xC0, 0x36, 0xD9, 0x30, 0xE0,
+            0xDA, 0x81, 0xA9, 0x97, 0x78, 0x36, 0xB6, 0x12, 0x29, 0x99, 0x4C, 0xDE, 0xD1, 0x4F, 0x46, 0xA3,
+            0xE2, 0x0C, 0x80, 0xEC, 0xD3, 0xCC, 0x9B, 0xE1, 0x7D, 0xCA, 0x9D, 0xE1, 0x87, 0xDA, 0xFC, 0x59,
+            0x66, 0xB0, 0xA2, 0x9D, 0x63, 0xEA, 0x17, 0xB7, 0x4C, 0xD2, 0x33, 0xA9, 0x66, 0x2B, 0xF2, 0x6D,
+            0x8F, 0x0E, 0xD5, 0xB4, 0x00, 0xEE, 0x6F, 0xAF, 0xF7, 0x33, 0xAA, 0x9C, 0x7E, 0xCA, 0x93, 0xBE,
+            0xE2, 0xB7, 0x08, 0x5C, 0x2A, 0xA7, 0x4D, 0x67, 0x1F, 0x34, 0x25, 0xAA, 0xCE, 0xC1, 0x70, 0xF1,
+            0x34, 0x71, 0xEC, 0x08, 0x02, 0xCC, 0xCF, 0x9F, 0x99, 0xBE, 0x73, 0x0C, 0x7A, 0x10, 0xB9, 0xFF,
+            0x5F, 0xB4, 0xF2, 0xC4, 0xCC, 0x44, 0x3E, 0xBB, 0x76, 0xB9, 0x1B, 0x0D, 0xBB, 0xF8, 0x8E, 0x49,
+            0x32, 0x7E, 0x39, 0x6D, 0xDC, 0xFF, 0xB3, 0xB2, 0x76, 0x5A, 0x92, 0xF8, 0xE6, 0x96, 0xE3, 0x34,
+            0xF6, 0x7F, 0xFE, 0x8D, 0xB5, 0x61, 0xC9, 0x1E, 0x2F, 0x5C, 0xF8, 0x04, 0xB6, 0xF4, 0xC2, 0x76,
+            0x3A, 0x59, 0x01, 0x3C, 0x2D, 0x48, 0x05, 0x49, 0xA9, 0xDF, 0x05, 0x95, 0x3B, 0x0B, 0xCE, 0x09,
+            0x79, 0x53, 0x19, 0x74, 0x19, 0x08, 0xAD, 0x94, 0x24, 0xF0, 0x9B, 0xE9, 0x39, 0xAF, 0xAC, 0xBC,
+            0x06, 0xEF, 0xA1, 0xBA, 0x75, 0xD8, 0x25, 0xD3, 0xA2, 0x58, 0x22, 0x02, 0x33, 0x0A, 0x30, 0x0D,
+            0x0A, 0x50, 0x17, 0x30, 0x8D, 0x64, 0x7E, 0x17, 0xC1, 0x68, 0x25, 0x1F, 0x6E, 0xC8, 0x13, 0x7C,
+            0x33, 0x2B, 0x93, 0xAF, 0xB3, 0xC3, 0x2A, 0x4E, 0xCF, 0x15, 0x65, 0xE0, 0xB9, 0x77, 0xF3, 0xE4,
+            0x19, 0xC5, 0xE1, 0x73, 0xA3, 0x3F, 0x30, 0x33, 0x0F, 0x80, 0x3C, 0xAA, 0x6E, 0x66, 0x29, 0xD5,
+            0x12, 0x1B, 0xF9, 0xD7, 0x00, 0x81, 0x70, 0xA8, 0x16, 0x3E, 0xB8, 0x0A, 0xC0, 0x12, 0xD9, 0x22,
+            0xAB, 0xA1, 0x30, 0xC9, 0xE6, 0x18, 0xAA, 0xC4, 0x70, 0xB5, 0xC8, 0x6C, 0xED, 0xFC, 0x51, 0xE6,
+            0x1B, 0x04, 0x4E, 0x15, 0xA3, 0x6A, 0xF7, 0xF5, 0xA5, 0xBA, 0x39, 0x0F, 0x04, 0x0B, 0x85, 0x37,
+            0x23, 0xD1, 0xDB, 0xD4, 0xBE, 0x87, 0x12, 0xDE, 0xDE, 0x43, 0xCA, 0xC2, 0x32, 0x29, 0x77, 0xFE,
+            0x9B, 0x97, 0x78, 0x13, 0x9F, 0xAF, 0x3D, 0xB2, 0xA8, 0xC9, 0xD1, 0x1F, 0x94, 0x4E, 0x6A, 0x45,
+            0x32, 0x7C, 0x63, 0xB2, 0x83, 0xF5, 0x74, 0x51, 0x3E, 0x39, 0x5E, 0x8B, 0x22, 0x29, 0xA5, 0xFA,
+            0x33, 0xCD, 0xC5, 0x8B, 0x76, 0xEB, 0xCD, 0x1C, 0x0C, 0x11, 0xFE, 0x67, 0x33, 0xF5, 0x30, 0x6B,
+            0x4E, 0x27, 0x5D, 0x7C, 0x42, 0x82, 0xDE, 0x51, 0x45, 0x8F, 0x81, 0xC8, 0x17, 0x87, 0xA8, 0x2A,
+            0x4E, 0x72, 0x34, 0xB2, 0x76, 0x08, 0x5C, 0x8C, 0xA2, 0x80, 0xE5, 0x6E, 0x14, 0xB6, 0xA4, 0x48,
+            0x3C, 0x47, 0xEF, 0x49, 0x8B, 0xBC, 0x7C, 0x26, 0x6D, 0xE3, 0x68, 0x22, 0x2F, 0x9C, 0x9A, 0x79,
+            0x6C, 0x30, 0x8D, 0x0D, 0x66, 0x31, 0x58, 0x3D, 0x8D, 0xFB, 0xCF, 0xA2, 0xB1, 0x69, 0x90, 0x0F,
+            0x4A, 0x37, 0xA7, 0xF5, 0xB5, 0xA7, 0x4A, 0x5F, 0x78, 0x76, 0xB4, 0x59, 0xEF, 0xC1, 0x9A, 0xEE,
+            0xA5, 0xB5, 0xF9, 0x8D, 0x4F, 0xB6, 0x6A, 0xBB, 0xD3, 0x31, 0x40, 0x49, 0xA0, 0xE8, 0x75, 0xA8,
+            0xAA, 0x11, 0x5D, 0x4F, 0x6B, 0x65, 0xB9, 0xC0, 0x8D, 0x5B, 0xD3, 0x5D, 0x1D, 0x24, 0xAC, 0x25,
+            0x21, 0x53, 0xFD, 0xD5, 0x54, 0xF4, 0x01, 0xC2, 0x06, 0x9C, 0x88, 0x84, 0x7E, 0x0D, 0x37, 0xC6,
+            0x99, 0x01, 0x92, 0xEA, 0xEF, 0xAF, 0xB2, 0xB3, 0xF3, 0x8B, 0x32, 0x19, 0x99, 0xA2, 0xF5, 0xA2,
+            0xB5, 0x9C, 0xC8, 0x44, 0x7D, 0x1D, 0x05, 0x4C, 0x9A, 0x21, 0x8D, 0xBD, 0xD5, 0x3C, 0x98, 0xE9,
+            0xF0, 0x12, 0x0D, 0x23, 0xB9, 0x0E, 0x94, 0x46, 0xAB, 0xC4, 0xA2, 0x72, 0xFA, 0xF5, 0xEC, 0x18,
+            0x55, 0x65, 0x40, 0x6C, 0x1B, 0xDF, 0x61, 0xBC, 0xF9, 0x49, 0xE8, 0xD7, 0x1F, 0x78, 0xAE, 0xB4,
+            0xCD, 0xE1, 0x57, 0x1A, 0xE7, 0xF0, 0xDB, 0x58, 0xE7, 0xF0, 0x5B, 0x99, 0xE7, 0xF0, 0x1B, 0xD9,
+            0xE7, 0xF0, 0xEB, 0x0D, 0x74, 0xF8, 0xB5, 0x16, 0x5A, 0x38, 0x61, 0x29, 0x91, 0x31, 0x8F, 0x6A,
+            0x90, 0x25, 0xCC, 0x5D, 0xB4, 0xD6, 0x51, 0xCC, 0xCE, 0x5A, 0xAA, 0xE8, 0x5D, 0x98, 0x6A, 0x43,
+            0xC0, 0xDF, 0x5A, 0xBB, 0x86, 0xCC, 0x03, 0x97, 0xAA, 0x75, 0x44, 0xE7, 0x37, 0x38, 0xD9, 0xB5,
+            0x94, 0x8C, 0xC3, 0x96, 0x2A, 0x42, 0x78, 0x72, 0xB3, 0x86, 0x4E, 0xE9, 0x4C, 0xED, 0xAB, 0x57,
+            0xE3, 0x9A, 0x92, 0x80, 0xE2, 0xF1, 0x81, 0xA8, 0x2A, 0x7B, 0xC0, 0x5E, 0x73, 0xFC, 0x7B, 0x55,
+            0xB4, 0x31, 0x53, 0x76, 0x82, 0xE5, 0x1F, 0x54, 0xB7, 0x0A, 0x65, 0x9B, 0xA5, 0xC7, 0xCD, 0xBF,
+            0x7C, 0x47, 0xFA, 0x36, 0xFB, 0xE5, 0x17, 0x6E, 0xF5, 0xCA, 0xE5, 0xAC, 0x38, 0x26, 0xC3, 0xF3,
+            0xB0, 0xC2, 0x59, 0x58, 0xC5, 0x43, 0x6E, 0x1A, 0xB2, 0x30, 0x8D, 0x9B, 0x8E, 0xC4, 0xDB, 0x99,
+            0x59, 0x22, 0x5F, 0xD3, 0xCC, 0x6E, 0xEC, 0x20, 0xA5, 0xB0, 0x52, 0x3E, 0xE1, 0x66, 0xE7, 0x9F,
+            0x71, 0x7B, 0x42, 0x59, 0x22, 0x04, 0x44, 0xF4, 0x50, 0x2E, 0x8F, 0x31, 0xED, 0x7E, 0xF4, 0xFC,
+            0x79, 0x76, 0x1C, 0xE2, 0x05, 0x8E, 0xBF, 0xA4, 0x64, 0x30, 0x95, 0xA8, 0x3B, 0x31, 0x77, 0x81,
+            0x5B, 0xCF, 0xF6, 0x93, 0x2E, 0x4B, 0xD4, 0xAB, 0x2B, 0x8B, 0xE8, 0x2C, 0xAB, 0x27, 0x16, 0xDA,
+            0x95, 0xBB, 0x04, 0xAC, 0x1B, 0x6F, 0x16, 0xA0, 0x9C, 0x44, 0x4C, 0x4B, 0x03, 0xDB, 0x72, 0x86,
+            0xD0, 0x04, 0x42, 0x9A, 0x09, 0xC7, 0xA2, 0x6C, 0x90, 0xEF, 0x83, 0x0A, 0xED, 0x67, 0x0F, 0xA0,
+            0xE9, 0x88, 0x73, 0x26, 0x9F, 0x43, 0x59, 0x05, 0xBE, 0xB3, 0x17, 0x77, 0x77, 0x2C, 0xFA, 0x8B,
+            0x02, 0xCF, 0xDE, 0xBC, 0x78, 0xBE, 0xEE, 0xF9, 0x1A, 0x59, 0x72, 0xA6, 0xDB, 0xC3, 0x00, 0x6A,
+            0xAC, 0x75, 0x5D, 0xE9, 0x3D, 0xEE, 0xAB, 0x34, 0x6F, 0x2A, 0x16, 0xAB, 0xF9, 0x72, 0xF3, 0xFA,
+            0x42, 0xDA, 0xEA, 0xC9, 0xB2, 0xFC, 0xF9, 0x69, 0x8D, 0xC4, 0xE4, 0x84, 0xEE, 0x27, 0x81, 0xFD,
+            0xB2, 0xC8, 0x15, 0x2D, 0x2B, 0xE6, 0xF4, 0xB4, 0x70, 0x7B, 0xEB, 0xF1, 0x24, 0x7E, 0x9F, 0xFC,
+            0xF4, 0x7E, 0xEB, 0xC9, 0xE1, 0xD6, 0x0C, 0x2B, 0xE3, 0xB1, 0xF8, 0xDA, 0xB8, 0xFB, 0xEE, 0x3F,
+            0x0F, 0x3F, 0xFC, 0x0C, 0xB7, 0xBA, 0x58, 0x66, 0xB6, 0xFF, 0x8D, 0x8E, 0x5E, 0x33, 0xBD, 0xFC,
+            0xBF, 0x39, 0x6A, 0x35, 0x5E, 0x45, 0x6E, 0x9C, 0xB6, 0xE6, 0xDF, 0x1D, 0xFC, 0x37, 0x3A, 0x71,
+            0x95, 0x6E, 0xAA, 0xB6, 0x96, 0x36, 0x5F, 0x4D, 0x0F, 0x9D, 0x1E, 0x6F, 0xA9, 0xC7, 0x2E, 0xF5,
+            0xC3, 0xD2, 0x99, 0xE9, 0xEA, 0xF7, 0x2D, 0x88, 0x6F, 0xF9, 0x47, 0x8E, 0x73, 0x7F, 0x62, 0x62,
+            0xA3, 0xF7, 0xB8, 0xCB, 0x47, 0x4E, 0x9B, 0xE2, 0x2F, 0x19, 0xA0, 0xD4, 0x8C, 0xB7, 0x2C, 0xE8,
+            0x91, 0xC5, 0x13, 0xD3, 0xB9, 0x41, 0xC4, 0x5B, 0x17, 0x2A, 0x1E, 0x7B, 0xCE, 0xFD, 0x11, 0x06,
+            0xE3, 0xB9, 0xD8, 0xDC, 0x6B, 0x46, 0xD6, 0x3D, 0x09, 0xBB, 0xE6, 0x25, 0x23, 0x83, 0xFE, 0x57,
+            0x3D, 0x0A, 0x2B, 0xFF, 0x44, 0x9D, 0x7C, 0x6B, 0x46, 0xC5, 0x8B, 0x44, 0x32, 0x5E, 0xF3, 0xDE,
+            0xA5, 0xE6, 0xB1, 0xDD, 0xD1, 0xE8, 0xFB, 0x73, 0xFA, 0xEA, 0x4F, 0x6B, 0x5F, 0xB3, 0xAC, 0x7E,
+            0xC9, 0x3F, 0x5B, 0xB1, 0x45, 0x7F, 0xFC, 0xF2, 0xFF, 0x00, 0x96, 0xED, 0xEC, 0xC7, 0x13, 0x73,
+            0x00, 0x00
+        };
+        const WebAsset INDEX_PAGE = { IndexPageData, sizeof( IndexPageData ), "\"416c4a2e8cac122a\"" };
+
+        const uint8_t ConfigReceivedPageData[] PROGMEM = {
+            0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6D, 0x52, 0x4D, 0x8B, 0xDB, 0x40,
+            0x0C, 0xBD, 0xFB, 0x57, 0xA8, 0xE9, 0xA5, 0x85, 0xF8, 0x6B, 0xBB, 0x59, 0x8A, 0xE3, 0x04, 0x42,
+            0xD2, 0xD0, 0x5B, 0x17, 0x36, 0x50, 0xF6, 0xA8, 0x78, 0x14, 0x5B, 0xEC, 0x78, 0xC6, 0xCC, 0x8C,
+            0xE3, 0xB8, 0xA5, 0xFF, 0xBD, 0x33, 0xCE, 0x6E, 0xD8, 0x42, 0xF1, 0x41, 0x8C, 0xAC, 0xF7, 0x9E,
+            0x9E, 0xA4, 0xF2, 0xC3, 0xEE, 0xC7, 0xF6, 0xF0, 0xFC, 0xF8, 0x0D, 0x1A, 0xD7, 0xCA, 0x75, 0x54,
+            0xBE, 0x05, 0x42, 0xE1, 0x43, 0x4B, 0x0E, 0x41, 0x61, 0x4B, 0xAB, 0xD9, 0x99, 0x69, 0xE8, 0xB4,
+            0x71, 0x33, 0xA8, 0xB4, 0x72, 0xA4, 0xDC, 0x6A, 0x36, 0xB0, 0x70, 0xCD, 0x4A, 0xD0, 0x99, 0x2B,
+            0x8A, 0xA7, 0xC7, 0x1C, 0x58, 0xB1, 0x63, 0x94, 0xB1, 0xAD, 0x50, 0xD2, 0x2A, 0x4F, 0xB2, 0x99,
+            0xA7, 0x71, 0xEC, 0x24, 0xAD, 0xB7, 0x5A, 0x9D, 0xB8, 0xEE, 0x0D, 0x3A, 0xD6, 0x0A, 0x9E, 0xF0,
+            0x4C, 0xA2, 0x4C, 0xAF, 0xBF, 0xA2, 0xD2, 0xBA, 0x51, 0x12, 0xB8, 0xB1, 0xF3, 0x52, 0x8E, 0x2E,
+            0x2E, 0xAD, 0xAC, 0xF5, 0xD0, 0xA3, 0x16, 0x23, 0xFC, 0x8E, 0x4E, 0x5E, 0x32, 0x3E, 0x61, 0xCB,
+            0x72, 0x2C, 0xE0, 0x3B, 0xC9, 0x33, 0x39, 0xAE, 0x70, 0x0E, 0x1B, 0xE3, 0xB5, 0xE6, 0x60, 0x51,
+            0xD9, 0xD8, 0x92, 0xE1, 0xD3, 0x32, 0x0A, 0xE0, 0x18, 0x25, 0xD7, 0xAA, 0x80, 0xCA, 0xB7, 0x49,
+            0x66, 0x19, 0x1D, 0xB1, 0x7A, 0xA9, 0x8D, 0xEE, 0x95, 0x28, 0xE0, 0xE3, 0x76, 0xB7, 0x7B, 0xD8,
+            0x6F, 0x96, 0x51, 0x87, 0x42, 0xB0, 0xAA, 0x0B, 0xB8, 0xCB, 0xBA, 0xCB, 0x32, 0xFA, 0x13, 0x25,
+            0xC1, 0x18, 0xB2, 0x22, 0xE3, 0x15, 0x5B, 0xBC, 0x5C, 0x2D, 0x15, 0xB0, 0xC8, 0xA6, 0x82, 0x16,
+            0x4D, 0xCD, 0x2A, 0x3C, 0xBB, 0x0B, 0x60, 0xEF, 0xF4, 0xBF, 0xBC, 0x43, 0xC3, 0x8E, 0xDE, 0xB1,
+            0x7E, 0x99, 0x40, 0x47, 0x6D, 0x04, 0x99, 0xD8, 0xA0, 0xE0, 0xDE, 0x16, 0xF0, 0xF5, 0x9A, 0xBB,
+            0xC4, 0xB6, 0x41, 0xA1, 0x87, 0x02, 0x32, 0xB8, 0xF3, 0x6C, 0x79, 0xA0, 0x34, 0xF5, 0x11, 0x3F,
+            0x65, 0xF3, 0xE9, 0x4B, 0xF2, 0xCF, 0xA1, 0xA3, 0x26, 0xF7, 0x9D, 0x54, 0x5A, 0x6A, 0xE3, 0xFB,
+            0xBE, 0xDF, 0x6E, 0xF6, 0x8B, 0x2C, 0xA4, 0xBB, 0xB7, 0x89, 0x58, 0xFE, 0x45, 0x05, 0xE4, 0x0F,
+            0x81, 0x55, 0xFA, 0xC6, 0xE3, 0x86, 0xB8, 0x6E, 0x9C, 0x4F, 0x25, 0x0F, 0xCB, 0x1B, 0x70, 0xB1,
+            0x58, 0x04, 0x54, 0x99, 0x4E, 0x33, 0xF6, 0xB3, 0x4E, 0x5F, 0xB7, 0x1B, 0x86, 0xEB, 0x83, 0xE0,
+            0x33, 0x54, 0x12, 0xAD, 0x5D, 0xCD, 0x6E, 0x13, 0x08, 0x5B, 0x6B, 0xF2, 0xFF, 0xAF, 0xCC, 0xE7,
+            0xA3, 0xB2, 0x5B, 0x3F, 0xEB, 0xDE, 0xC0, 0xD3, 0x61, 0xB3, 0x0D, 0x07, 0xF1, 0xAE, 0xAA, 0x41,
+            0x0B, 0x47, 0x22, 0xE5, 0xB7, 0xE2, 0xCB, 0xC1, 0xF6, 0x55, 0x45, 0xD6, 0x9E, 0x7A, 0x29, 0xC7,
+            0xA4, 0x4C, 0xBB, 0x09, 0x7B, 0x68, 0x08, 0xAE, 0x77, 0x03, 0x03, 0x4B, 0x09, 0x4A, 0x0F, 0x60,
+            0xC8, 0x3A, 0x34, 0x0E, 0x50, 0x89, 0xC0, 0xA8, 0xA8, 0x72, 0xE0, 0x34, 0x8C, 0x41, 0xE6, 0x27,
+            0xEF, 0x19, 0x14, 0xB9, 0x41, 0x9B, 0x97, 0x1B, 0x89, 0xBF, 0x19, 0xA3, 0x55, 0xBD, 0x7E, 0x94,
+            0x84, 0xD6, 0x13, 0x21, 0xBB, 0x24, 0x49, 0x82, 0xCD, 0x29, 0x7D, 0x2D, 0x4B, 0xBD, 0xBB, 0x10,
+            0x5E, 0xBD, 0xA6, 0xD3, 0x7D, 0xFF, 0x05, 0x10, 0x00, 0xDD, 0x66, 0xF6, 0x02, 0x00, 0x00
+        };
+        const WebAsset CONFIG_RECEIVED_PAGE = { ConfigReceivedPageData, sizeof( ConfigReceivedPageData ), "\"7ee951a5eb8d38fa\"" };
+
+        const uint8_t FactoryResetPageData[] PROGMEM = {
+            0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5D, 0x52, 0x4D, 0x6F, 0xDB, 0x30,
+            0x0C, 0xBD, 0xFB, 0x57, 0x70, 0xD9, 0x65, 0x03, 0x62, 0x3B, 0x6E, 0x9A, 0x62, 0x70, 0x9C, 0x00,
+            0x45, 0xB7, 0x61, 0xB7, 0x15, 0x45, 0x2F, 0x3B, 0xD2, 0x16, 0x6D, 0x0B, 0x93, 0x25, 0x43, 0xA2,
+            0xF3, 0xB1, 0x61, 0xFF, 0x7D, 0x94, 0xD3, 0x0C, 0x6B, 0xA1, 0x03, 0x41, 0x8A, 0x7C, 0x8F, 0x7C,
+            0x64, 0xF5, 0xEE, 0xF3, 0xF7, 0x87, 0xE7, 0x1F, 0x8F, 0x5F, 0xA0, 0xE7, 0xC1, 0xEC, 0x93, 0xEA,
+            0x6A, 0x08, 0x95, 0x98, 0x81, 0x18, 0xC1, 0xE2, 0x40, 0xBB, 0xC5, 0x41, 0xD3, 0x71, 0x74, 0x9E,
+            0x17, 0xD0, 0x38, 0xCB, 0x64, 0x79, 0xB7, 0x38, 0x6A, 0xC5, 0xFD, 0x4E, 0xD1, 0x41, 0x37, 0x94,
+            0xCE, 0xCE, 0x12, 0xB4, 0xD5, 0xAC, 0xD1, 0xA4, 0xA1, 0x41, 0x43, 0xBB, 0x22, 0x5B, 0x2D, 0x04,
+            0x86, 0x35, 0x1B, 0xDA, 0x7F, 0xC5, 0x86, 0x9D, 0x3F, 0xC3, 0x13, 0x05, 0xE2, 0x2A, 0xBF, 0x04,
+            0x93, 0x2A, 0xF0, 0xD9, 0x10, 0xF0, 0x79, 0x14, 0x12, 0xA6, 0x13, 0xE7, 0x4D, 0x08, 0x52, 0x54,
+            0x3B, 0x75, 0x86, 0xDF, 0x49, 0x2B, 0x64, 0x69, 0x8B, 0x83, 0x36, 0xE7, 0x12, 0xBE, 0x91, 0x39,
+            0x10, 0xEB, 0x06, 0x97, 0x70, 0xEF, 0x85, 0x65, 0x09, 0x01, 0x6D, 0x48, 0x03, 0x79, 0xDD, 0x6E,
+            0x93, 0x58, 0x9C, 0xA2, 0xD1, 0x9D, 0x2D, 0xA1, 0x91, 0x06, 0xC9, 0x6F, 0x93, 0x1A, 0x9B, 0x9F,
+            0x9D, 0x77, 0x93, 0x55, 0x25, 0xBC, 0x6F, 0x5B, 0xAA, 0x89, 0xB6, 0xC9, 0x88, 0x4A, 0x69, 0xDB,
+            0x95, 0x70, 0xB3, 0x1A, 0x4F, 0xDB, 0xE4, 0x4F, 0x92, 0xC5, 0x91, 0x50, 0x5B, 0xF2, 0xC2, 0x38,
+            0xE0, 0xE9, 0x32, 0x4C, 0x09, 0x9B, 0xD5, 0x9C, 0x30, 0xA0, 0xEF, 0xB4, 0x8D, 0xEE, 0x78, 0x02,
+            0x9C, 0xD8, 0xBD, 0xC6, 0x3D, 0xF6, 0x9A, 0xFF, 0x47, 0x5D, 0xCF, 0x45, 0xB5, 0xF3, 0x8A, 0x7C,
+            0xEA, 0x51, 0xE9, 0x29, 0x94, 0xF0, 0xE9, 0x12, 0x3B, 0xA5, 0xA1, 0x47, 0xE5, 0x8E, 0x25, 0xAC,
+            0xE0, 0x46, 0xD0, 0x8A, 0x08, 0xE9, 0xBB, 0x1A, 0x3F, 0xAC, 0x96, 0xF3, 0xCB, 0x8A, 0x8F, 0xB1,
+            0xA3, 0xBE, 0x90, 0x4E, 0x1A, 0x67, 0x9C, 0x8F, 0x7D, 0xDF, 0xDE, 0xAE, 0xD7, 0x77, 0x31, 0x3C,
+            0x5E, 0x15, 0x09, 0xFA, 0x17, 0x95, 0x50, 0xDC, 0x45, 0x54, 0x23, 0x8D, 0xA7, 0x3D, 0xE9, 0xAE,
+            0x67, 0x09, 0x65, 0x92, 0x78, 0x2D, 0xDC, 0x6C, 0x36, 0xB1, 0xAA, 0xCA, 0x67, 0x8D, 0x45, 0xEB,
+            0xFC, 0x65, 0xAF, 0x51, 0x5C, 0x31, 0x4A, 0x1F, 0xA0, 0x31, 0x18, 0xC2, 0x6E, 0xF1, 0x4F, 0x81,
+            0xB8, 0xAF, 0xBE, 0x78, 0xBD, 0x2C, 0x78, 0x70, 0xC3, 0x68, 0x88, 0x49, 0x00, 0x0A, 0xF9, 0x1F,
+            0xF7, 0xF7, 0xC6, 0xC4, 0x3B, 0x68, 0x75, 0x37, 0x79, 0x64, 0xED, 0x2C, 0x28, 0x94, 0x53, 0xE9,
+            0x31, 0x80, 0x48, 0x6C, 0x81, 0x3C, 0x06, 0x52, 0x59, 0x95, 0x8F, 0x73, 0xBA, 0x2C, 0xD9, 0x3B,
+            0xDB, 0xED, 0x9F, 0x68, 0x70, 0x07, 0x82, 0xD1, 0x1D, 0x45, 0x6A, 0xE7, 0x63, 0x63, 0x73, 0xFC,
+            0x6D, 0xDE, 0xA3, 0xA7, 0x10, 0x80, 0x7B, 0x02, 0x3F, 0xF3, 0xD7, 0x13, 0xB3, 0x70, 0xB0, 0x03,
+            0xF1, 0xA6, 0x71, 0xFE, 0xB9, 0xDC, 0x5D, 0xF6, 0x06, 0x23, 0x97, 0x99, 0xA2, 0x79, 0x99, 0x30,
+            0x9F, 0xEF, 0xF9, 0x2F, 0xD7, 0xFB, 0xC6, 0x2E, 0xE6, 0x02, 0x00, 0x00
+        };
+        const WebAsset FACTORY_RESET_PAGE = { FactoryResetPageData, sizeof( FactoryResetPageData ), "\"c17934622b4d971d\"" };
+
+        const uint8_t NotFoundPageData[] PROGMEM = {
+            0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5D, 0x50, 0xCB, 0x4E, 0xC3, 0x30,
+            0x10, 0xBC, 0xFB, 0x2B, 0x96, 0x70, 0x6D, 0x70, 0x4A, 0x23, 0x0E, 0x89, 0x13, 0xA9, 0x2A, 0x20,
+            0x4E, 0x50, 0xD1, 0x5E, 0x38, 0xBA, 0xCE, 0x26, 0xB1, 0x70, 0xEC, 0xC8, 0xD9, 0x3E, 0xA2, 0xAA,
+            0xFF, 0x8E, 0x53, 0xCA, 0x05, 0xED, 0x61, 0xB5, 0xAF, 0x99, 0xD9, 0x11, 0x77, 0xCF, 0x1F, 0xAB,
+            0xED, 0xD7, 0xFA, 0x05, 0x5A, 0xEA, 0x4C, 0xC9, 0xC4, 0x5F, 0x42, 0x59, 0x85, 0xD4, 0x21, 0x49,
+            0xB0, 0xB2, 0xC3, 0x22, 0x3A, 0x68, 0x3C, 0xF6, 0xCE, 0x53, 0x04, 0xCA, 0x59, 0x42, 0x4B, 0x45,
+            0x74, 0xD4, 0x15, 0xB5, 0x45, 0x85, 0x07, 0xAD, 0x30, 0xBE, 0x16, 0x33, 0xD0, 0x56, 0x93, 0x96,
+            0x26, 0x1E, 0x94, 0x34, 0x58, 0xCC, 0x1F, 0x92, 0x28, 0xC0, 0x90, 0x26, 0x83, 0xE5, 0x5A, 0x36,
+            0x08, 0xEF, 0x8E, 0xE0, 0xD5, 0xED, 0x6D, 0x25, 0xF8, 0x6F, 0x97, 0x89, 0x81, 0x46, 0x83, 0x40,
+            0x63, 0x1F, 0x58, 0x08, 0x4F, 0xC4, 0xD5, 0x30, 0x84, 0xAB, 0x9D, 0xAB, 0x46, 0x38, 0xB3, 0x3A,
+            0xB0, 0xC5, 0xB5, 0xEC, 0xB4, 0x19, 0x33, 0x78, 0x43, 0x73, 0x40, 0xD2, 0x4A, 0xCE, 0x60, 0xE9,
+            0x03, 0xCD, 0x0C, 0x06, 0x69, 0x87, 0x78, 0x40, 0xAF, 0xEB, 0x9C, 0x4D, 0xC7, 0xB1, 0x34, 0xBA,
+            0xB1, 0x19, 0xA8, 0xA0, 0x10, 0x7D, 0xCE, 0x76, 0x52, 0x7D, 0x37, 0x7E, 0x22, 0xCC, 0xE0, 0xBE,
+            0x4E, 0xA6, 0xC8, 0x59, 0x2F, 0xAB, 0x4A, 0xDB, 0x26, 0x83, 0xC7, 0xA4, 0x3F, 0xE5, 0xEC, 0xC2,
+            0xDA, 0x39, 0x9C, 0xC3, 0x5F, 0xC6, 0xF9, 0x69, 0x2B, 0x4D, 0x17, 0x8B, 0xA7, 0x1C, 0x2E, 0x4C,
+            0xF0, 0xAB, 0xB6, 0xA0, 0x91, 0xDF, 0x0C, 0x99, 0x44, 0x4D, 0xF6, 0xCC, 0xCB, 0x34, 0x49, 0x21,
+            0x86, 0xFF, 0x3F, 0x85, 0x01, 0x13, 0x7D, 0x29, 0x24, 0xB4, 0x1E, 0xEB, 0x22, 0xE2, 0x51, 0xF9,
+            0x89, 0xB4, 0xF7, 0x16, 0xC8, 0xC1, 0x66, 0xBB, 0x5C, 0xC1, 0x26, 0x94, 0xBD, 0xE0, 0xB2, 0x14,
+            0xBC, 0x9F, 0x80, 0x6F, 0x88, 0xFC, 0x6A, 0xFC, 0x0F, 0x25, 0xA2, 0x59, 0x3E, 0x8F, 0x01, 0x00,
+            0x00
+        };
+        const WebAsset NOT_FOUND_PAGE = { NotFoundPageData, sizeof( NotFoundPageData ), "\"a3d4fd6662619c4f\"" };
+
+    } // namespace WebAssets
+} // namespace Net
+
+
+#endif // STAC_WEB_ASSETS_H
+
+
+//  --- EOF --- //
@@ -6,6 +6,9 @@
  * configuration interface with tabbed layout for setup and maintenance.
  * Pages are embedded as raw string literals for serving via WebServer.
  *
+ * The static pages are minified and gzip-compressed into WebAssets.h by
+ * scripts/build_web_assets.py at build time; edit them here, not there.
+ *
  * @author Rob Lake (@Xylopyrographer)
  * @date 2026-01-07
  */
@@ -292,6 +295,23 @@ namespace Net {
         const char DEVICE_INFO_CLOSE[] = R"=====(    </div>
 )=====";
 
+        /**
+         * @brief Device info lines, placed between DEVICE_INFO_OPEN and DEVICE_INFO_CLOSE
+         * Values are filled in from GET /info by loadDeviceInfo()
+         */
+        const char DEVICE_INFO[] = R"=====(      <p><strong>Device:</strong> <span id="info-board"></span></p>
+      <p><strong>SSID:</strong> <span id="info-ssid"></span></p>
+      <p><strong>MAC:</strong> <span id="info-mac"></span></p>
+      <p><strong>Version:</strong> <span id="info-version"></span></p>
+)=====";
+
+        /**
+         * @brief Hidden "geek info" block shown in the info modal
+         * Text is built from GET /info by loadDeviceInfo()
+         */
+        const char GEEK_INFO[] = R"=====(<div id='geek-info' style='display:none;'><pre id='geek-pre' style='font-family: monospace; font-size: 12px; line-height: 1.4;'></pre></div>
+)=====";
+
         /**
                                                                              * @brief Landing page with browser escape options
                                                                              */
@@ -372,6 +392,16 @@ namespace Net {
           
           <label for="pwd">Password:</label>
           <input type="password" id="pwd" name="pwd" maxlength="63">
+          
+          <label for="updURL">Update Server URL (optional):</label>
+          <input type="url" id="updURL" name="updURL" maxlength="96" placeholder="http://192.168.1.10:8000">
+          
+          <label for="pwrProf">Power Profile:</label>
+          <select id="pwrProf" name="pwrProf">
+            <option value="0" selected>Balanced</option>
+            <option value="1">Lowest latency</option>
+            <option value="2">Battery saver</option>
+          </select>
         </div>
         
         <div class="section">
@@ -419,6 +449,16 @@ namespace Net {
           
           <label for="pwd2">Password:</label>
           <input type="password" id="pwd2" name="pwd" maxlength="63">
+          
+          <label for="updURL2">Update Server URL (optional):</label>
+          <input type="url" id="updURL2" name="updURL" maxlength="96" placeholder="http://192.168.1.10:8000">
+          
+          <label for="pwrProf2">Power Profile:</label>
+          <select id="pwrProf2" name="pwrProf">
+            <option value="0" selected>Balanced</option>
+            <option value="1">Lowest latency</option>
+            <option value="2">Battery saver</option>
+          </select>
         </div>
         
         <div class="section">
@@ -477,7 +517,7 @@ namespace Net {
         <h3>Firmware Update</h3>
         <div class="info-text">
           <strong>Instructions:</strong><br>
-          1. Select a .bin firmware file below<br>
+          1. Select a .bin firmware file below (optionally paste its SHA-256 to have it checked before installing)<br>
           2. Click "Update Firmware"<br>
           3. Wait for upload and installation to complete<br>
           4. STAC will restart automatically<br>
@@ -488,6 +528,8 @@ namespace Net {
         <form method="post" enctype="multipart/form-data" action="/update" id="upload-form">
           <label for="update">Select Firmware File (.bin):</label>
           <input type="file" name="update" id="update" accept=".bin" required>
+          <label for="sha256">SHA-256 of the file (optional):</label>
+          <input type="text" id="sha256" maxlength="64" placeholder="64 hex digits" pattern="[0-9a-fA-F]{64}">
           <br>
           <input type="submit" value="Update Firmware" id="upload-btn">
           <div id="upload-progress" style="display:none; margin-top: 15px;">
@@ -540,8 +582,74 @@ namespace Net {
       document.getElementById('tab-' + tabName).classList.add('active');
     }
     
+    // Fill in device details and the info text from /info
+    function loadDeviceInfo() {
+      fetch('/info', { cache: 'no-store' })
+        .then(response => response.json())
+        .then(info => {
+          ['board', 'ssid', 'mac', 'version'].forEach(key => {
+            document.getElementById('info-' + key).textContent = info[key];
+          });
+          document.getElementById('geek-pre').textContent = buildGeekText(info);
+        })
+        .catch(error => console.log('Device info unavailable: ' + error));
+    }
+
+    // Info modal text
+    function buildGeekText(info) {
+      const rule = '==========================================';
+      const dashes = '  --------------------------------------';
+      const dots = '  =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=';
+      const lines = [
+        rule,
+        '                  STAC',
+        '        A Roland Smart Tally Client',
+        '             by: Team STAC',
+        '      github.com/Xylopyrographer/STAC',
+        '',
+        '    Device: ' + info.board,
+        '    SSID: ' + info.ssid,
+        '    Access: http://stac.local',
+        '        or: http://' + info.ip,
+        '    MAC: ' + info.mac,
+        '    Version: ' + info.version
+      ];
+      if (!info.configured) {
+        lines.push(dashes, '     >>> DEVICE NOT CONFIGURED <<<');
+        if (info.peripheral) {
+          lines.push('     Operating in Peripheral Mode', '    Receiving tally via GROVE port', dashes,
+                     '    Tally Mode: ' + info.tallyMode, '    Brightness Level: ' + info.brightness);
+        }
+      } else {
+        lines.push(dashes,
+                   '    WiFi Network SSID: ' + info.wifiSsid,
+                   '    Switch IP: ' + info.switchIp,
+                   '    Switch Port #: ' + info.switchPort,
+                   dots,
+                   '    Configured for Model: ' + info.model);
+        if (info.channel !== undefined) {
+          lines.push('    Active Tally Channel: ' + info.channel);
+        }
+        if (info.maxChannel !== undefined) {
+          lines.push('    Max Tally Channel: ' + info.maxChannel);
+        }
+        if (info.maxHdmi !== undefined) {
+          lines.push('    Max HDMI Tally Channel: ' + info.maxHdmi, '    Max SDI Tally Channel: ' + info.maxSdi);
+        }
+        lines.push('    Tally Mode: ' + info.tallyMode,
+                   '    Auto start: ' + (info.autoStart ? 'Enabled' : 'Disabled'),
+                   '    Brightness Level: ' + info.brightness,
+                   '    Polling Interval: ' + info.pollInterval + ' ms',
+                   '    Operating mode: ' + info.mode);
+      }
+      lines.push(dots, '    Git: ' + info.git, '    Core: ' + info.core, '    SDK: ' + info.sdk, rule);
+      return lines.join('\n');
+    }
+
     // Initialize page after DOM is loaded
     function initializePage() {
+      loadDeviceInfo();
+
       // Show tabs immediately (no captive portal)
       document.getElementById('landing').style.display = 'none';
       document.getElementById('tabs').style.display = 'flex';
@@ -600,7 +708,10 @@ namespace Net {
           // Send the file
           const formData = new FormData();
           formData.append('update', file);
-          xhr.open('POST', '/update');
+          // Uploads go to their own server so the portal stays responsive meanwhile
+          const digest = document.getElementById('sha256').value.trim();
+          xhr.open('POST', 'http://' + location.hostname + ':8080/update' +
+                   (digest ? '?sha256=' + encodeURIComponent(digest) : ''));
           xhr.send(formData);
         });
       }
@@ -654,7 +765,9 @@ namespace Net {
         model: model,
         wifi: {
           ssid: document.getElementById(model === 'V-60HD' ? 'SSID' : 'SSID2').value,
-          password: document.getElementById(model === 'V-60HD' ? 'pwd' : 'pwd2').value
+          password: document.getElementById(model === 'V-60HD' ? 'pwd' : 'pwd2').value,
+          updateURL: document.getElementById(model === 'V-60HD' ? 'updURL' : 'updURL2').value,
+          powerProfile: parseInt(document.getElementById(model === 'V-60HD' ? 'pwrProf' : 'pwrProf2').value)
         },
         switch: {
           ip: document.getElementById(model === 'V-60HD' ? 'stIP' : 'stIP2').value,
@@ -906,6 +1019,8 @@ namespace Net {
         document.getElementById('form-v60hd').style.display = 'block';
         document.getElementById('SSID').value = config.wifi.ssid || '';
         document.getElementById('pwd').value = config.wifi.password || '';
+        document.getElementById('updURL').value = config.wifi.updateURL || '';
+        document.getElementById('pwrProf').value = config.wifi.powerProfile || 0;
         document.getElementById('stIP').value = config.switch.ip || '';
         document.getElementById('stPort').value = config.switch.port || 80;
         document.getElementById('stChan').value = config.switch.maxChannel || 6;
@@ -915,6 +1030,8 @@ namespace Net {
         document.getElementById('form-v160hd').style.display = 'block';
         document.getElementById('SSID2').value = config.wifi.ssid || '';
         document.getElementById('pwd2').value = config.wifi.password || '';
+        document.getElementById('updURL2').value = config.wifi.updateURL || '';
+        document.getElementById('pwrProf2').value = config.wifi.powerProfile || 0;
         document.getElementById('stIP2').value = config.switch.ip || '';
         document.getElementById('stPort2').value = config.switch.port || 80;
         document.getElementById('stnetUser').value = config.switch.lanUsername || 'user';
@@ -19,7 +19,13 @@
 #include <WiFi.h>
 #include <Update.h>
 #include <DNSServer.h>
+#include <atomic>
 #include "Config/Types.h"
+#include "Network/DeltaPatcher.h"
+#include "Network/OTAPipeline.h"
+#include "Network/PageStream.h"
+#include "Network/ServiceTask.h"
+#include "Network/WebAssets.h"
 
 
 namespace Net {
@@ -31,12 +37,20 @@ namespace Net {
         bool success;                  ///< Whether update succeeded
         String filename;               ///< Name of uploaded file
         size_t bytesWritten;          ///< Total bytes written to flash
+        size_t bytesReceived;          ///< Upload size (smaller than bytesWritten for a delta)
+        bool delta;                    ///< Upload was a delta patch
+        uint32_t durationMs;           ///< Time from first to last byte written
+        String sha256;                 ///< SHA-256 of the written image (hex)
         String statusMessage;          ///< Human-readable status message
 
         OTAUpdateResult()
             : success( false )
             , filename( "" )
             , bytesWritten( 0 )
+            , bytesReceived( 0 )
+            , delta( false )
+            , durationMs( 0 )
+            , sha256( "" )
             , statusMessage( "" )
         {}
     };
@@ -55,6 +69,12 @@ namespace Net {
      * 6. Handles factory reset requests
      * 7. Provides automatic browser popup on connection (iOS, Android, Windows, macOS)
      *
+     * DNS, the page server and the upload server each run in their own
+     * task, so a slow firmware upload (on UPLOAD_PORT) doesn't hold up DNS
+     * answers or page requests. Only the upload is isolated this way: each
+     * WebServer still serves one request at a time, so page requests queue
+     * behind one another as before.
+     *
      * Usage:
      * @code
      * WebPortalServer portal(stacID);
@@ -138,8 +158,9 @@ namespace Net {
         bool begin();
 
         /**
-         * @brief Set callback for periodic display updates
-         * @param callback Function to call periodically during waitForCompletion
+         * @brief Set callback for display updates
+         * @param callback Function called on every pass of waitForCompletion's loop
+         *                 (about every 10 ms), e.g. to drive an Animator
          */
         void setDisplayUpdateCallback( DisplayUpdateCallback callback ) {
             displayCallback = callback;
@@ -164,7 +185,8 @@ namespace Net {
         /**
          * @brief Wait for user action via web interface
          *
-         * Blocks until user either:
+         * Requests are served by the portal tasks; this runs the display
+         * and reset button callbacks until the user either:
          * - Submits configuration form (Setup tab)
          * - Completes firmware upload (Update tab)
          * - Presses reset button (via callback)
@@ -176,7 +198,7 @@ namespace Net {
         /**
          * @brief Stop the web portal server
          *
-         * - Stops web server
+         * - Stops the portal tasks and web servers
          * - Shuts down mDNS
          * - Turns off WiFi AP
          * - Returns WiFi to OFF mode
@@ -194,8 +216,13 @@ namespace Net {
         // DNS Server configuration for captive portal
         static constexpr uint8_t DNS_PORT = 53;
 
-        // Display update interval (ms)
-        static constexpr unsigned long DISPLAY_UPDATE_INTERVAL = 1000;
+        // Firmware uploads go to their own server so pages stay responsive
+        static constexpr uint16_t UPLOAD_PORT = 8080;
+
+        // Portal task settings
+        static constexpr uint32_t TASK_STACK_SIZE = 6144;
+        static constexpr UBaseType_t TASK_PRIORITY = 1;
+        static constexpr TickType_t TASK_IDLE_TICKS = pdMS_TO_TICKS( 2 );
 
         // IP configuration for AP
         IPAddress apIP;
@@ -204,33 +231,77 @@ namespace Net {
 
         // Server and state
         WebServer *server;
+        WebServer *uploadServer;
         DNSServer *dnsServer;
         String deviceID;
         String macAddress;
         bool serverRunning;
 
-        // Result tracking
+        // Portal tasks; stopped cooperatively, never mid-request
+        ServiceTask dnsTask;
+        ServiceTask webTask;
+        ServiceTask uploadTask;
+
+        // Result tracking; the first handler to claim the result fills it in
         PortalResult result;
-        bool operationComplete;
+        OTAUpdateResult uploadResult;          // Owned by the upload task until claimed
+        OTAPipeline ota;
+        DeltaPatcher deltaPatcher;
+
+        // What the upload turned out to be, decided from its first bytes
+        enum class UploadKind : uint8_t {
+            PENDING,
+            IMAGE,
+            DELTA
+        };
+        UploadKind uploadKind;
+        std::atomic<bool> resultClaimed;
+        std::atomic<bool> operationComplete;
 
         // Callbacks
         DisplayUpdateCallback displayCallback;
         ResetCheckCallback resetCheckCallback;
         PreRestartCallback preRestartCallback;
-        unsigned long lastDisplayUpdate;
 
         /**
          * @brief Register all HTTP endpoint handlers
          *
          * Endpoints:
          * - GET  / : Serve tabbed portal index page
+         * - GET  /info : Device and configuration details (JSON)
+         * - GET  /boot : Boot phase timings (JSON)
          * - POST /config : Process configuration submission
-         * - POST /update : Handle firmware upload
          * - POST /factory-reset : Handle factory reset request
          * - * (not found) : Serve 404 page
          */
         void registerEndpoints();
 
+        /**
+         * @brief Register the upload server's endpoints
+         *
+         * Endpoints (UPLOAD_PORT, cross-origin from the portal page):
+         * - POST /update[?sha256=<hex>] : Handle firmware upload (full image or delta patch)
+         * - OPTIONS /update : CORS preflight
+         */
+        void registerUploadEndpoints();
+
+        /**
+         * @brief Start the DNS, page and upload tasks
+         * @return true if all tasks were created
+         */
+        bool startTasks();
+
+        /**
+         * @brief Ask the portal tasks to stop and wait for each to finish its request
+         */
+        void stopTasks();
+
+        /**
+         * @brief Take the right to set the portal result
+         * @return true if no other handler has claimed it yet
+         */
+        bool claimResult();
+
         /**
          * @brief Handler for GET /
          * Serves the tabbed portal page with device info
@@ -262,10 +333,23 @@ namespace Net {
         void handleFileUpload();
 
         /**
-         * @brief Build the main portal index page with tabs
-         * @return Complete HTML page as String
+         * @brief Handler for GET /info
+         * Serves the device and configuration details the portal page displays
+         */
+        void handleInfo();
+
+        /**
+         * @brief Write the /info JSON object
+         * @param out Chunked response the JSON is written to
+         */
+        void writeInfoJSON( PageStream &out ) const;
+
+        /**
+         * @brief Send a precompressed page, or 304 if the browser's copy is current
+         * @param code HTTP status code
+         * @param asset Page from WebAssets.h
          */
-        String buildIndexPage() const;
+        void sendAsset( int code, const WebAssets::WebAsset &asset );
 
         /**
          * @brief Build OTA result page
@@ -5,7 +5,10 @@
 #include <cstdint>
 #include <functional>
 #include <WString.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include "Config/Constants.h"
+#include "Config/Types.h"
 
 namespace Net {
 
@@ -26,11 +29,67 @@ namespace Net {
      */
     using WiFiStateCallback = std::function<void( WiFiState )>;
 
+    /**
+     * @brief Called from the WiFi event task when a station event was queued
+     *
+     * Runs on another task: it should only wake the loop (e.g. post to an
+     * event bus) so update() gets called soon.
+     */
+    using WiFiEventNotifier = void ( * )( void *context );
+
+    /**
+     * @brief Station events the manager reacts to
+     */
+    enum class WiFiEventKind : uint8_t {
+        ASSOCIATED,         ///< Joined the access point (no address yet)
+        GOT_IP,             ///< Address assigned, link usable
+        LOST_IP,            ///< Address lease lost
+        DISCONNECTED        ///< Left or failed to join the access point
+    };
+
+    /**
+     * @brief Link quality and outage counters
+     */
+    struct WiFiLinkStats {
+        int8_t rssiAverage = 0;             ///< Moving average of RSSI while connected (dBm), 0 = no samples
+        uint8_t lastDisconnectReason = 0;   ///< wifi_err_reason_t of the last disconnect event
+        uint32_t disconnects = 0;           ///< Connections lost since boot
+        uint32_t reconnects = 0;            ///< Background reconnection attempts started
+        uint32_t lastOutageMs = 0;          ///< Length of the last outage, loss to address
+        uint32_t droppedEvents = 0;         ///< Events lost because the queue was full
+        uint8_t pollErrorPercent = 0;       ///< Failed share of the last 8 tally polls
+        uint32_t roamScans = 0;             ///< Background scans started by a poor link
+        uint32_t roams = 0;                 ///< Reassociations to a stronger access point
+    };
+
     /**
      * @brief WiFi connection manager
      *
      * Handles WiFi station and access point modes,
      * connection management, and reconnection logic.
+     *
+     * Station events from the WiFi driver are queued by the event task
+     * and handled in update() on the loop task, so every state change is
+     * reported from there. Nothing blocks: a connect attempt retries with
+     * jittered exponential backoff until it succeeds or its timeout
+     * passes (FAILED), and a lost link is reconnected in the background
+     * the same way. The driver's own auto-reconnect is turned off.
+     *
+     * A full scan joins the strongest access point carrying the SSID.
+     * While connected, a poor link (RSSI average or tally poll failures
+     * past the Config::Net::ROAM_* thresholds) starts a background scan;
+     * a clearly stronger access point is then joined directly. The state
+     * stays CONNECTED throughout, so the display is not disturbed, and
+     * isConnected() is false for the moment the station is between
+     * access points.
+     *
+     * The last successful association (BSSID, channel, DHCP lease) is
+     * kept in RTC memory and can be seeded from NVS with setSavedLink().
+     * A connect to the same SSID then goes straight to that access point
+     * without a channel scan, optionally with the lease as a static
+     * address (Config::Net::REUSE_DHCP_LEASE). If it has not associated
+     * within Config::Net::FAST_CONNECT_TIMEOUT_MS, the link is dropped
+     * and the attempt continues with a full scan.
      */
     class WiFiManager {
       public:
@@ -44,14 +103,19 @@ namespace Net {
         bool begin();
 
         /**
-         * @brief Connect to WiFi network (station mode)
+         * @brief Start connecting without waiting for the result
+         *
+         * The result is reported to the state callback from update(). A
+         * call for the SSID already connecting joins that attempt with a
+         * fresh timeout, and a call for the SSID already connected just
+         * reports CONNECTED again.
          * @param ssid Network SSID
          * @param password Network password
-         * @param timeoutMs Connection timeout in milliseconds
-         * @return true if connected successfully
+         * @param timeoutMs Time before the attempt is reported FAILED (retries continue)
+         * @return true if the attempt was started or joined
          */
-        bool connect( const String &ssid, const String &password,
-                      unsigned long timeoutMs = Config::Timing::WIFI_CONNECT_TIMEOUT_MS );
+        bool connectAsync( const String &ssid, const String &password,
+                           unsigned long timeoutMs = Config::Timing::WIFI_CONNECT_TIMEOUT_MS );
 
         /**
          * @brief Start access point mode
@@ -91,10 +155,55 @@ namespace Net {
 
         /**
          * @brief Set callback for WiFi state changes
-         * @param callback Function to call on state changes
+         * @param callback Function to call on state changes (called from update())
          */
         void setStateCallback( WiFiStateCallback callback );
 
+        /**
+         * @brief Set the function that wakes the loop when an event is queued
+         * @param notifier Called from the WiFi event task
+         * @param context Passed back to the notifier
+         */
+        void setEventNotifier( WiFiEventNotifier notifier, void *context );
+
+        /**
+         * @brief Queue a station event (called by the driver's event task)
+         *
+         * Safe from any task. Can also be used to simulate driver events.
+         * @param kind Event
+         * @param reason Disconnect reason (wifi_err_reason_t), 0 otherwise
+         */
+        void postEvent( WiFiEventKind kind, uint8_t reason = 0 );
+
+        /**
+         * @brief Report the outcome of a tally poll (link quality input for roaming)
+         * @param ok true if the switch replied
+         */
+        void notePollResult( bool ok );
+
+        /**
+         * @brief Roaming trigger
+         * @param rssiAverage RSSI moving average in dBm, 0 = no samples
+         * @param pollErrorPercent Failed share of recent polls
+         * @return true if the link is poor enough to look for another access point
+         */
+        static bool isLinkPoor( int8_t rssiAverage, uint8_t pollErrorPercent );
+
+        /**
+         * @brief Roaming target test
+         * @param candidateRssi RSSI of another access point from a scan (dBm)
+         * @param rssiAverage Current link's RSSI moving average (dBm)
+         * @return true if the candidate is enough stronger to move to
+         */
+        static bool isBetterAccessPoint( int32_t candidateRssi, int8_t rssiAverage );
+
+        /**
+         * @brief Get link quality and outage counters
+         */
+        const WiFiLinkStats &getLinkStats() const {
+            return stats;
+        }
+
         /**
          * @brief Get local IP address
          * @return IP address as string
@@ -127,8 +236,34 @@ namespace Net {
         String getHostname() const;
 
         /**
-         * @brief Handle WiFi events and maintain connection
-         * Call this regularly in loop
+         * @brief Provide the link stored in NVS (call before connecting)
+         *
+         * Ignored if a link survived in RTC memory, as that one is newer.
+         * @param saved Link loaded from NVS
+         */
+        void setSavedLink( const WiFiLink &saved );
+
+        /**
+         * @brief Set the station listen interval used from the next association
+         * @param beacons Beacon intervals between wakes in max modem sleep, 0 = driver default
+         */
+        void setListenInterval( uint16_t beacons );
+
+        /**
+         * @brief Get the link if it changed since the last call, so it can be saved to NVS
+         * @param updated Filled with the current link (zeroed if it was dropped)
+         * @return true if the link changed
+         */
+        bool getNewLink( WiFiLink &updated );
+
+        /**
+         * @brief How the current (or last) connection was made
+         */
+        WiFiConnectPath getConnectPath() const;
+
+        /**
+         * @brief Handle queued WiFi events, time out attempts and start retries
+         * Call this regularly in loop, and when the event notifier fires
          */
         void update();
 
@@ -138,14 +273,115 @@ namespace Net {
         String currentPassword;
         String hostname;
         bool apMode;
-        unsigned long lastConnectionAttempt;
+        unsigned long connectStartedAt;     // millis() when the current attempt started
+        unsigned long connectTimeoutMs;     // Timeout of the current attempt
+        unsigned long attemptStartedAt;     // millis() of the first WiFi.begin() for this attempt
+        WiFiConnectPath connectPath;        // Path of the current attempt
+        WiFiLink link;                      // Last association, used for a directed connect
+        bool linkUpdated;                   // link changed since getNewLink()
         WiFiStateCallback stateCallback;
-        static constexpr unsigned long RECONNECT_INTERVAL_MS = 30000;  // 30 seconds
+
+        // Event queue (filled on the WiFi event task, drained in update())
+        struct QueuedEvent {
+            WiFiEventKind kind;
+            uint8_t reason;
+        };
+        static constexpr uint8_t EVENT_QUEUE_CAPACITY = 8;
+        StaticQueue_t eventQueueControl;
+        uint8_t eventQueueStorage[ EVENT_QUEUE_CAPACITY * sizeof( QueuedEvent ) ];
+        QueueHandle_t eventQueue;
+        WiFiEventNotifier eventNotifier;
+        void *eventNotifierContext;
+
+        // Retry scheduling
+        bool retryPending;                  // WiFi.begin() due at retryAt
+        unsigned long retryAt;
+        uint8_t retryCount;                 // Retries since the last connection, drives the backoff
+        unsigned long linkLostAt;           // millis() the link went down, 0 while up
+
+        // Link quality
+        WiFiLinkStats stats;
+        int32_t rssiAverageX16;             // Moving average in 1/16 dBm
+        unsigned long lastRssiSampleAt;
+        uint8_t pollHistory;                // Last 8 polls, bit set = failed
+
+        // Roaming
+        enum class RoamStage : uint8_t {
+            IDLE,
+            SCANNING,                       // Background scan running
+            REASSOCIATING                   // WiFi.begin() to the new access point issued
+        };
+        RoamStage roamStage;
+        unsigned long roamStartedAt;        // millis() of the reassociation
+        unsigned long lastRoamScanAt;
+        uint16_t listenInterval;            // Beacon intervals, 0 = driver default
+
+        /**
+         * @brief Run the state machine for one driver event
+         */
+        void handleEvent( const QueuedEvent &event );
+
+        /**
+         * @brief Mark the link up and report CONNECTED
+         */
+        void onConnected();
+
+        /**
+         * @brief Schedule the next WiFi.begin() after a jittered exponential backoff
+         */
+        void scheduleRetry();
+
+        /**
+         * @brief Fold an RSSI reading into the moving average
+         */
+        void sampleRSSI();
+
+        /**
+         * @brief Start a background scan when the link is poor, act on its results
+         */
+        void updateRoaming( unsigned long now );
+
+        /**
+         * @brief Reassociation to the new access point completed
+         */
+        void onRoamed();
+
+        /**
+         * @brief Restart link quality tracking from the current RSSI
+         */
+        void resetLinkQuality( unsigned long now );
+
+        /**
+         * @brief Switch to station mode and call WiFi.begin()
+         * @return false if the SSID is empty
+         */
+        bool startConnection( const String &ssid, const String &password, unsigned long timeoutMs );
+
+        /**
+         * @brief Drop the cached link and restart the attempt with a full scan
+         */
+        void fallBackToScan();
+
+        /**
+         * @brief Store the association just made as the cached link
+         * @param persist false to keep it in RTC memory only (not reported by getNewLink())
+         */
+        void recordLink( bool persist = true );
+
+        /**
+         * @brief Use the cached lease as a static address, or go back to DHCP
+         */
+        void useStaticLease( bool enable );
+
+        /**
+         * @brief WiFi.begin() with the listen interval applied
+         */
+        void beginStation( const char *ssid, const char *password, int32_t channel = 0, const uint8_t *bssid = nullptr );
 
         /**
-         * @brief Attempt to reconnect if disconnected
+         * @brief Report the current state to the callback, if set
          */
-        void attemptReconnect();
+        void notifyState();
     };
 
 } // namespace Net
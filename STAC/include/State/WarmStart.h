@@ -0,0 +1,60 @@
+#ifndef STAC_WARM_START_H
+#define STAC_WARM_START_H
+
+#include <cstdint>
+#include "Config/Types.h"
+
+
+namespace State {
+
+    /**
+     * @brief Snapshot of the running tally session kept across unplanned resets
+     *
+     * While in normal mode the application saves the current tally state
+     * to RTC memory. If the next boot follows a brownout, watchdog or
+     * panic reset and the snapshot is valid, the boot is a warm start:
+     * the application skips the interactive startup screens and resumes
+     * polling with the saved tally on screen.
+     *
+     * Operating parameters are reloaded from NVS as usual; only the
+     * session state lives here. Power-on, software and external resets
+     * always take the cold path.
+     */
+    class WarmStart {
+      public:
+        /**
+         * @brief Check the reset reason and the snapshot (call once at boot)
+         * @return true if this boot should take the warm path
+         */
+        static bool begin();
+
+        /**
+         * @brief Result of begin()
+         */
+        static bool isWarm();
+
+        /**
+         * @brief Save the current tally state (normal mode only)
+         * @param tally Tally state now shown
+         */
+        static void save( TallyState tally );
+
+        /**
+         * @brief Invalidate the snapshot (e.g. when leaving normal mode)
+         */
+        static void clear();
+
+        /**
+         * @brief Tally state restored by a warm start
+         * @return Saved tally state, NO_TALLY if there is none
+         */
+        static TallyState getTallyState();
+    };
+
+} // namespace State
+
+
+#endif // STAC_WARM_START_H
+
+
+//  --- EOF --- //
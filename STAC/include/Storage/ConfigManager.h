@@ -10,11 +10,31 @@
 
 namespace Storage {
 
+    /**
+     * @brief NVS access counters (since begin())
+     */
+    struct NvsStats {
+        uint16_t opens = 0;         ///< Namespace opens (prefs.begin), reads and writes
+        uint16_t commits = 0;       ///< Namespaces written back
+    };
+
     /**
      * @brief Non-volatile storage manager for STAC configuration
      *
      * Manages persistent storage of configuration using ESP32 Preferences (NVS).
      * Handles versioning and migration of stored data.
+     *
+     * All namespaces are read once in begin() into an in-RAM cache; the
+     * load and has/is queries are served from the cache. A save updates
+     * the cache and marks the namespace dirty only if a value actually
+     * changed; dirty namespaces are written back together by commit(),
+     * immediately after each save unless commits are deferred.
+     *
+     * Each namespace is stored as a single CRC-protected record blob, so a
+     * namespace costs one NVS read or write. Namespaces still in the older
+     * one-key-per-value layout are read key by key and rewritten as records.
+     * A record that fails its length or CRC check is logged and left in
+     * flash; that namespace runs on defaults until it is saved again.
      */
     class ConfigManager {
       public:
@@ -207,13 +227,188 @@ namespace Storage {
          */
         bool loadPModeEnabled();
 
+        /**
+         * @brief Save the fleet update server URL
+         * @param url Base URL, e.g. "http://192.168.1.10:8000"; empty turns fleet updates off
+         * @return true if saved successfully
+         */
+        bool saveUpdateURL( const String &url );
+
+        /**
+         * @brief Load the fleet update server URL
+         * @return Base URL, or empty if none is configured
+         */
+        String loadUpdateURL();
+
+        /**
+         * @brief Save the last successful WiFi association (written only when it changed)
+         * @param link BSSID, channel and lease of the access point joined
+         * @return true if saved successfully
+         */
+        bool saveWiFiLink( const WiFiLink &link );
+
+        /**
+         * @brief Load the last successful WiFi association
+         * @param link Filled with the stored link (zeroed if there is none)
+         * @return true if a link is stored
+         */
+        bool loadWiFiLink( WiFiLink &link );
+
+        /**
+         * @brief Save the WiFi power profile
+         * @param profile Latency/power trade-off used in normal mode
+         * @return true if saved successfully
+         */
+        bool savePowerProfile( PowerProfile profile );
+
+        /**
+         * @brief Load the WiFi power profile
+         * @return Stored profile, BALANCED if none was saved
+         */
+        PowerProfile loadPowerProfile();
+
         /**
          * @brief Get configuration version
          * @return Version number
          */
         uint8_t getConfigVersion();
 
+        // ========================================================================
+        // Cache Control
+        // ========================================================================
+
+        /**
+         * @brief Hold saves in the cache until commit() (or defer is turned off)
+         * @param defer true to defer, false to commit pending changes and resume write-through
+         * @return false if turning defer off failed to write a pending change (it stays pending)
+         *
+         * Use around sequences that may save the same settings several times,
+         * e.g. the startup configuration menus.
+         */
+        bool setDeferredCommit( bool defer );
+
+        /**
+         * @brief Write all dirty namespaces to NVS, one open per namespace
+         * @return true if everything pending was written
+         */
+        bool commit();
+
+        /**
+         * @brief Check for changes not yet written to NVS
+         */
+        bool hasPendingChanges() const;
+
+        /**
+         * @brief NVS access counters since begin()
+         */
+        const NvsStats &getNvsStats() const;
+
       private:
+        // Dirty bits, one per namespace
+        enum DirtyFlag : uint8_t {
+            DIRTY_WIFI          = 0x01,
+            DIRTY_SWITCH        = 0x02,
+            DIRTY_V60HD         = 0x04,
+            DIRTY_V160HD        = 0x08,
+            DIRTY_IDENTITY      = 0x10,
+            DIRTY_PERIPHERAL    = 0x20
+        };
+
+        // In-RAM copy of every namespace; passwords are held in plain text
+        // and obfuscated only when written back
+        struct CachedConfig {
+            struct {
+                bool stored = false;            // Namespace exists in NVS
+                bool hasSSIDKey = false;
+                uint8_t version = 0;
+                String ssid;
+                String password;
+                bool pmEnabled = false;
+                String updateURL;
+                WiFiLink link = {};
+                PowerProfile powerProfile = PowerProfile::BALANCED;
+            } wifi;
+
+            struct {
+                bool stored = false;
+                bool hasModelKey = false;
+                String model;
+                uint32_t ip = 0;
+                uint16_t port = 80;
+                String username;
+                String password;
+            } sw;
+
+            struct {
+                bool stored = false;
+                bool hasTallyKey = false;
+                uint8_t tallyChannel = 1;
+                uint8_t maxChannel = 8;
+                bool autoStart = false;
+                bool camOpMode = true;
+                uint8_t brightness = 1;
+                uint32_t pollInterval = 300;
+            } v60hd;
+
+            struct {
+                bool stored = false;
+                bool hasTallyKey = false;
+                uint8_t tallyChannel = 1;
+                uint8_t maxHDMI = 8;
+                uint8_t maxSDI = 8;
+                String channelBank = "hdmi_";
+                bool autoStart = false;
+                bool camOpMode = true;
+                uint8_t brightness = 1;
+                uint32_t pollInterval = 300;
+            } v160hd;
+
+            struct {
+                String stacID;
+            } identity;
+
+            struct {
+                bool stored = false;
+                bool cameraMode = false;
+                uint8_t brightness = 1;
+            } peripheral;
+        };
+
+        CachedConfig cache;
+        uint8_t dirty;              // DirtyFlag bits
+        uint8_t legacy;             // DirtyFlag bits of namespaces still in the per-key layout
+        bool deferCommit;
+        NvsStats stats;
+
+        /**
+         * @brief Read every namespace into the cache
+         */
+        void loadCache();
+
+        /**
+         * @brief Open a namespace, counting the access
+         */
+        bool openNamespace( const char *ns, bool readOnly );
+
+        /**
+         * @brief Mark namespaces dirty and write them back unless deferred
+         * @param flags DirtyFlag bits
+         * @return true if written (or deferred)
+         */
+        bool markDirty( uint8_t flags );
+
+        /**
+         * @brief Write one namespace from the cache
+         */
+        bool commitNamespace( uint8_t flag );
+
+        /**
+         * @brief Remove the per-key entries a migrated namespace's record replaces
+         *
+         * Called on the open namespace, only after its record is written.
+         */
+        void removeLegacyKeys( uint8_t flag );
+
         // Single Preferences object used to access multiple NVS namespaces
         // Each prefs.begin(namespace) call opens a different NVS partition
         Preferences prefs;
@@ -226,6 +421,11 @@ namespace Storage {
         static constexpr const char *NS_IDENTITY = "identity";
         static constexpr const char *NS_PERIPHERAL = "peripheral";
 
+        // Record key, one per namespace (NOM v5 / PM v3 onwards)
+        static constexpr const char *KEY_RECORD = "record";
+
+        // Per-key layout (NOM v3/v4, PM v1/v2), read only for migration
+
         // Key names - WiFi
         static constexpr const char *KEY_VERSION = "version";  // Global NOM version (stored in wifi namespace only)
         static constexpr const char *KEY_SSID = "ssid";
@@ -0,0 +1,114 @@
+#ifndef STAC_BOOT_PROFILER_H
+#define STAC_BOOT_PROFILER_H
+
+#include <Arduino.h>
+#include <cstdint>
+#include "Config/Types.h"
+
+namespace Utils {
+
+    /**
+     * @brief Boot milestones
+     *
+     * Some phases overlap (WiFi associates in the background while the
+     * hardware and startup UI come up), so reports list them by time.
+     */
+    enum class BootPhase : uint8_t {
+        SETUP_START,        ///< STACApp::setup() entered (ROM + bootloader + Arduino init before this)
+        HARDWARE_READY,     ///< Display, IMU, buttons initialised
+        STORAGE_READY,      ///< NVS and WiFi manager initialised
+        MODE_SELECTED,      ///< Boot button sequence finished, operating mode known
+        APP_READY,          ///< setup() complete, main loop starting
+        STARTUP_DONE,       ///< Channel display, autostart wait and startup config finished
+        WIFI_CONNECTED,     ///< Station connected
+        FIRST_TALLY,        ///< First valid tally reply from the switch
+        COUNT
+    };
+
+    /**
+     * @brief Timestamps for one boot
+     */
+    struct BootProfile {
+        uint32_t phaseUs[ static_cast<uint8_t>( BootPhase::COUNT ) ];  ///< esp_timer time per phase, 0 = not reached
+        uint32_t bootNumber;        ///< Boots counted since RTC memory was last valid
+        uint8_t resetReason;        ///< esp_reset_reason_t for this boot
+        uint8_t warmStart;          ///< 1 if the boot took the warm-restart path
+        uint8_t wifiPath;           ///< WiFiConnectPath of the first connection
+        uint16_t wifiConnectMs;     ///< Time that connection took, from WiFi.begin()
+    };
+
+    /**
+     * @brief Records when each boot phase completes and keeps the last few boots
+     *
+     * Timestamps come from esp_timer_get_time(), so they count from chip
+     * start. The history lives in RTC memory that is not cleared at boot:
+     * it survives software restarts, watchdog and panic resets, but a
+     * power cycle starts it again from empty.
+     */
+    class BootProfiler {
+      public:
+        static constexpr uint8_t HISTORY_SIZE = 4;
+
+        /**
+         * @brief Start a new profile (call once, first thing in setup())
+         */
+        static void begin();
+
+        /**
+         * @brief Stamp a phase; only the first call per phase counts
+         * @param phase Phase just completed
+         */
+        static void mark( BootPhase phase );
+
+        /**
+         * @brief Flag the current boot as a warm restart
+         */
+        static void noteWarmStart();
+
+        /**
+         * @brief Record how the first WiFi connection of this boot was made
+         * @param path Connect path taken
+         * @param ms Time from starting the attempt to connected
+         */
+        static void noteWiFiConnect( WiFiConnectPath path, uint32_t ms );
+
+        /**
+         * @brief Short name of a connect path for reports
+         */
+        static const char *wifiPathName( WiFiConnectPath path );
+
+        /**
+         * @brief Number of stored profiles, including the current boot
+         */
+        static uint8_t getCount();
+
+        /**
+         * @brief Get a stored profile
+         * @param age 0 = current boot, 1 = previous boot, ...
+         * @return Profile, or nullptr if age >= getCount()
+         */
+        static const BootProfile *getProfile( uint8_t age );
+
+        /**
+         * @brief Short name of a phase for reports
+         */
+        static const char *phaseName( BootPhase phase );
+
+        /**
+         * @brief Print all stored profiles to Serial, newest first, phases in time order
+         */
+        static void printReport();
+
+        /**
+         * @brief Stored profiles as JSON, newest first (phase times in ms)
+         */
+        static String toJSON();
+    };
+
+} // namespace Utils
+
+
+#endif // STAC_BOOT_PROFILER_H
+
+
+//  --- EOF --- //
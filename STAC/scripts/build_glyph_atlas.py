@@ -0,0 +1,341 @@
+#!/usr/bin/env python3
+"""
+Generate the anti-aliased TFT glyph atlas (GlyphAtlasTFT.h).
+
+Rasterises, ahead of time, the glyphs that DisplayTFT used to build from
+GFX primitives on every draw:
+- Digits 0-9 from STACSansBold24pt7b at text sizes 1, 2 and 3 (the sizes
+  used by drawLargeDigit, drawChannelNumber and the brightness overlay)
+- The configuration gear icon
+- The WiFi icon (portrait and landscape sizes)
+
+Each glyph is supersampled 4x4, quantised to 2-bit alpha and run-length
+encoded: one byte per run, alpha in the top 2 bits, run length - 1 in the
+low 6 bits. Runs continue across rows.
+
+Digits are upscaled from the 1-bit GFX font (bilinear reconstruction,
+thresholded at 50%), so glyph boxes and advances match what
+setTextSize()/print() produced and the existing layout code still applies.
+
+Runs as a PlatformIO extra script (regenerates only when the font or this
+script changes) or standalone:  python3 scripts/build_glyph_atlas.py
+"""
+
+import hashlib
+import math
+import re
+from pathlib import Path
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = Path(env.get("PROJECT_DIR"))  # noqa: F821
+    SCRIPT_PATH = PROJECT_DIR / "scripts" / "build_glyph_atlas.py"
+except NameError:
+    SCRIPT_PATH = Path(__file__).resolve()
+    PROJECT_DIR = SCRIPT_PATH.parent.parent
+
+TFT_DIR = PROJECT_DIR / "include" / "Hardware" / "Display" / "TFT"
+FONT_PATH = TFT_DIR / "STACSansBold24pt7b.h"
+ATLAS_PATH = TFT_DIR / "GlyphAtlasTFT.h"
+
+SUPERSAMPLE = 4
+DIGIT_SCALES = (1, 2, 3)
+FIRST_DIGIT_POS = 4     # Font position of '0' (after space, *, +, -)
+
+
+# ============================================================================
+# Sources
+# ============================================================================
+
+def load_gfx_font(path):
+    """Parse bitmap bytes and glyph table out of an Adafruit GFX font header."""
+    text = path.read_text()
+
+    bitmap_src = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    bitmap = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap_src)]
+
+    glyph_src = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    glyphs = []
+    for m in re.finditer(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyph_src):
+        offset, width, height, advance, x_off, y_off = (int(v) for v in m.groups())
+        glyphs.append({"offset": offset, "width": width, "height": height,
+                       "advance": advance, "x_off": x_off, "y_off": y_off})
+    return bitmap, glyphs
+
+
+def unpack_glyph(bitmap, glyph):
+    """Unpack a GFX glyph (bits packed MSB first, rows not byte aligned)."""
+    rows = []
+    bit = 0
+    for _ in range(glyph["height"]):
+        row = []
+        for _ in range(glyph["width"]):
+            byte = bitmap[glyph["offset"] + (bit >> 3)]
+            row.append(1 if byte & (0x80 >> (bit & 7)) else 0)
+            bit += 1
+        rows.append(row)
+    return rows
+
+
+# ============================================================================
+# Rasterisation
+# ============================================================================
+
+def quantise(coverage):
+    """Map coverage 0.0-1.0 to a 2-bit alpha level."""
+    return min(3, int(coverage * 3 + 0.5))
+
+
+def rasterise_digit(pixels, scale):
+    """Upscale a 1-bit glyph by 'scale' with smoothed, anti-aliased edges."""
+    src_h = len(pixels)
+    src_w = len(pixels[0]) if src_h else 0
+
+    def sample(x, y):
+        if 0 <= x < src_w and 0 <= y < src_h:
+            return pixels[y][x]
+        return 0
+
+    def bilinear(u, v):
+        # Source pixel centres sit at integer + 0.5
+        u -= 0.5
+        v -= 0.5
+        x0 = math.floor(u)
+        y0 = math.floor(v)
+        fx = u - x0
+        fy = v - y0
+        top = sample(x0, y0) * (1 - fx) + sample(x0 + 1, y0) * fx
+        bottom = sample(x0, y0 + 1) * (1 - fx) + sample(x0 + 1, y0 + 1) * fx
+        return top * (1 - fy) + bottom * fy
+
+    out_w = src_w * scale
+    out_h = src_h * scale
+    total = SUPERSAMPLE * SUPERSAMPLE
+    alpha = []
+    for y in range(out_h):
+        row = []
+        for x in range(out_w):
+            hits = 0
+            for sy in range(SUPERSAMPLE):
+                v = (y + (sy + 0.5) / SUPERSAMPLE) / scale
+                for sx in range(SUPERSAMPLE):
+                    u = (x + (sx + 0.5) / SUPERSAMPLE) / scale
+                    if bilinear(u, v) >= 0.5:
+                        hits += 1
+            row.append(quantise(hits / total))
+        alpha.append(row)
+    return alpha
+
+
+def rasterise_shape(inside, radius):
+    """
+    Rasterise an analytic shape centred on pixel (0, 0).
+
+    inside(x, y) takes coordinates relative to the centre pixel's centre.
+    Returns (alpha rows, x offset, y offset) trimmed to the covered area.
+    """
+    total = SUPERSAMPLE * SUPERSAMPLE
+    grid = {}
+    for py in range(-radius, radius + 1):
+        for px in range(-radius, radius + 1):
+            hits = 0
+            for sy in range(SUPERSAMPLE):
+                y = py - 0.5 + (sy + 0.5) / SUPERSAMPLE
+                for sx in range(SUPERSAMPLE):
+                    x = px - 0.5 + (sx + 0.5) / SUPERSAMPLE
+                    if inside(x, y):
+                        hits += 1
+            level = quantise(hits / total)
+            if level:
+                grid[(px, py)] = level
+
+    xs = [p[0] for p in grid]
+    ys = [p[1] for p in grid]
+    left, right, top, bottom = min(xs), max(xs), min(ys), max(ys)
+    alpha = [[grid.get((x, y), 0) for x in range(left, right + 1)] for y in range(top, bottom + 1)]
+    return alpha, left, top
+
+
+def gear_inside(x, y):
+    """Gear from DisplayTFT::drawConfigIcon: body r35, 8 teeth to r50, hole r15."""
+    r = math.hypot(x, y)
+    if r <= 15:
+        return False
+    if r <= 35:
+        return True
+    for i in range(8):
+        angle = math.radians(i * 45)
+        along = x * math.cos(angle) + y * math.sin(angle)
+        across = -x * math.sin(angle) + y * math.cos(angle)
+        if 30 <= along <= 50 and abs(across) <= 6.5:
+            return True
+    return False
+
+
+def make_wifi_inside(scale):
+    """WiFi icon from DisplayTFT::drawWiFiIcon (connected) at the given scale."""
+    dot_y = int(40 * scale)
+    dot_r = int(10 * scale)
+    base_r = int(25 * scale)
+    step = int(20 * scale)
+    arc_y = dot_y - int(15 * scale)
+    half_width = 2.5    # drawLine at offsets -2..+2
+
+    def inside(x, y):
+        if math.hypot(x, y - dot_y) <= dot_r:
+            return True
+        dy = arc_y - y
+        if dy <= 0:
+            return False
+        r = math.hypot(x, dy)
+        if abs(math.degrees(math.atan2(x, dy))) > 61.5:
+            return False
+        return any(abs(r - (base_r + i * step)) <= half_width for i in range(3))
+
+    return inside
+
+
+# ============================================================================
+# Encoding
+# ============================================================================
+
+def encode_rle(alpha):
+    """Encode alpha rows as (level << 6) | (run - 1) bytes, runs crossing rows."""
+    flat = [level for row in alpha for level in row]
+    out = []
+    i = 0
+    while i < len(flat):
+        level = flat[i]
+        run = 1
+        while i + run < len(flat) and flat[i + run] == level and run < 64:
+            run += 1
+        out.append((level << 6) | (run - 1))
+        i += run
+    return out
+
+
+def source_hash():
+    hasher = hashlib.md5()
+    hasher.update(FONT_PATH.read_bytes())
+    hasher.update(SCRIPT_PATH.read_bytes())
+    return hasher.hexdigest()
+
+
+def generate_atlas(digest):
+    bitmap, glyphs = load_gfx_font(FONT_PATH)
+
+    data = []
+    entries = {}     # name -> (offset, width, height, x_off, y_off, advance)
+
+    def add(name, alpha, x_off, y_off, advance):
+        offset = len(data)
+        data.extend(encode_rle(alpha))
+        height = len(alpha)
+        width = len(alpha[0]) if height else 0
+        entries[name] = (offset, width, height, x_off, y_off, advance, len(data) - offset)
+
+    for scale in DIGIT_SCALES:
+        for digit in range(10):
+            glyph = glyphs[FIRST_DIGIT_POS + digit]
+            alpha = rasterise_digit(unpack_glyph(bitmap, glyph), scale)
+            add(f"digit{scale}_{digit}", alpha, glyph["x_off"] * scale, glyph["y_off"] * scale,
+                glyph["advance"] * scale)
+
+    alpha, left, top = rasterise_shape(gear_inside, 52)
+    add("config", alpha, left, top, 0)
+    alpha, left, top = rasterise_shape(make_wifi_inside(1.0), 75)
+    add("wifi", alpha, left, top, 0)
+    alpha, left, top = rasterise_shape(make_wifi_inside(0.55), 45)
+    add("wifiSmall", alpha, left, top, 0)
+
+    def entry(name):
+        offset, width, height, x_off, y_off, advance, _ = entries[name]
+        return f"{{ {offset:5d}, {width:3d}, {height:3d}, {x_off:4d}, {y_off:4d}, {advance:3d} }}"
+
+    lines = []
+    lines.append("/**")
+    lines.append(" * @file GlyphAtlasTFT.h")
+    lines.append(" * @brief Pre-rasterised, anti-aliased TFT digits and icons")
+    lines.append(" *")
+    lines.append(" * GENERATED by scripts/build_glyph_atlas.py - DO NOT EDIT")
+    lines.append(f" * Source hash: {digest}")
+    lines.append(" *")
+    lines.append(" * Glyph data is 2-bit alpha, run-length encoded: each byte is")
+    lines.append(" * (alpha << 6) | (run - 1); runs continue across rows.")
+    lines.append(" *")
+    lines.append(" * Flash footprint:")
+    for scale in DIGIT_SCALES:
+        size = sum(entries[f"digit{scale}_{d}"][6] for d in range(10))
+        lines.append(f" *   Digits, text size {scale}: {size:6d} bytes")
+    for name in ("config", "wifi", "wifiSmall"):
+        lines.append(f" *   Icon {name + ':':<19}{entries[name][6]:6d} bytes")
+    lines.append(f" *   Total RLE data:      {len(data):6d} bytes (+ {len(entries) * 8} bytes glyph table)")
+    lines.append(" */")
+    lines.append("")
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("namespace Display {")
+    lines.append("")
+    lines.append("    /**")
+    lines.append("     * @brief One atlas glyph")
+    lines.append("     *")
+    lines.append("     * The top-left pixel is drawn at (originX + xOffset, originY + yOffset).")
+    lines.append("     * For digits the origin is the text cursor (baseline), as for GFX fonts;")
+    lines.append("     * for icons it is the icon centre.")
+    lines.append("     */")
+    lines.append("    struct AtlasGlyph {")
+    lines.append("        uint16_t offset;    ///< Start of this glyph's runs in GlyphAtlasData")
+    lines.append("        uint8_t width;")
+    lines.append("        uint8_t height;")
+    lines.append("        int16_t xOffset;")
+    lines.append("        int16_t yOffset;")
+    lines.append("        uint8_t xAdvance;   ///< Cursor advance (digits only)")
+    lines.append("    };")
+    lines.append("")
+    lines.append(f"    const uint8_t GlyphAtlasData[] PROGMEM = {{")
+    for i in range(0, len(data), 12):
+        chunk = ", ".join(f"0x{b:02X}" for b in data[i:i + 12])
+        lines.append(f"        {chunk},")
+    lines[-1] = lines[-1].rstrip(",")
+    lines.append("    };")
+    lines.append("")
+    lines.append(f"    // Digits 0-9 at text sizes {', '.join(str(s) for s in DIGIT_SCALES)}: AtlasDigits[ size - 1 ][ digit ]")
+    lines.append(f"    constexpr uint8_t ATLAS_DIGIT_SIZES = {len(DIGIT_SCALES)};")
+    lines.append("    const AtlasGlyph AtlasDigits[ ATLAS_DIGIT_SIZES ][ 10 ] = {")
+    for scale in DIGIT_SCALES:
+        lines.append("        {")
+        for digit in range(10):
+            sep = "," if digit < 9 else ""
+            lines.append(f"            {entry(f'digit{scale}_{digit}')}{sep}")
+        lines.append("        }" + ("," if scale != DIGIT_SCALES[-1] else ""))
+    lines.append("    };")
+    lines.append("")
+    lines.append(f"    const AtlasGlyph AtlasIconConfig = {entry('config')};")
+    lines.append(f"    const AtlasGlyph AtlasIconWiFi = {entry('wifi')};")
+    lines.append(f"    const AtlasGlyph AtlasIconWiFiSmall = {entry('wifiSmall')};")
+    lines.append("")
+    lines.append("} // namespace Display")
+    lines.append("")
+
+    ATLAS_PATH.write_text("\n".join(lines))
+    return len(data), len(entries)
+
+
+def main():
+    digest = source_hash()
+    if ATLAS_PATH.exists() and f"Source hash: {digest}" in ATLAS_PATH.read_text():
+        return
+
+    size, count = generate_atlas(digest)
+    print("=" * 60)
+    print("TFT Glyph Atlas Generated:")
+    print(f"  Glyphs:     {count}")
+    print(f"  RLE data:   {size} bytes")
+    print(f"  Output:     {ATLAS_PATH.relative_to(PROJECT_DIR)}")
+    print("=" * 60)
+
+
+# Generate when the script loads (before any build actions), like build_version.py
+main()
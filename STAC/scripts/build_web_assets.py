@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""
+Generate the precompressed web portal assets (WebAssets.h).
+
+Takes the static pages from include/Network/WebConfigPages.h, minifies
+them and gzips them into byte arrays that the portal sends as-is with
+"Content-Encoding: gzip". Each asset carries a strong ETag (hash of the
+compressed bytes) so a browser revisiting the portal gets a 304.
+
+The index page is assembled from its fragments in the order the portal
+used to send them. Dynamic values are no longer spliced into it; the page
+fetches them from GET /info.
+
+Minification is deliberately conservative: leading indentation, blank
+lines, HTML comments, CSS block comments and whole-line // comments are
+removed. Line breaks stay, so script statements that rely on automatic
+semicolon insertion are unaffected.
+
+Runs as a PlatformIO extra script (regenerates only when the pages or
+this script change) or standalone:  python3 scripts/build_web_assets.py
+"""
+
+import gzip
+import hashlib
+import re
+from pathlib import Path
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = Path(env.get("PROJECT_DIR"))  # noqa: F821
+    SCRIPT_PATH = PROJECT_DIR / "scripts" / "build_web_assets.py"
+except NameError:
+    SCRIPT_PATH = Path(__file__).resolve()
+    PROJECT_DIR = SCRIPT_PATH.parent.parent
+
+NETWORK_DIR = PROJECT_DIR / "include" / "Network"
+PAGES_PATH = NETWORK_DIR / "WebConfigPages.h"
+ASSETS_PATH = NETWORK_DIR / "WebAssets.h"
+
+# Asset name -> fragments of WebConfigPages.h it is built from
+ASSETS = {
+    "INDEX_PAGE": ["PAGE_HEAD", "DEVICE_INFO_OPEN", "DEVICE_INFO", "DEVICE_INFO_CLOSE", "GEEK_INFO",
+                   "LANDING_PAGE", "TAB_BUTTONS", "TAB_SETUP", "TAB_MAINTENANCE", "PAGE_SCRIPT",
+                   "PAGE_FOOTER"],
+    "CONFIG_RECEIVED_PAGE": ["CONFIG_RECEIVED"],
+    "FACTORY_RESET_PAGE": ["FACTORY_RESET_RECEIVED"],
+    "NOT_FOUND_PAGE": ["NOT_FOUND"],
+}
+
+
+# ============================================================================
+# Sources
+# ============================================================================
+
+def load_fragments(path):
+    """Raw string literals of WebConfigPages.h by name."""
+    text = path.read_text()
+    return dict(re.findall(r'const char (\w+)\[\] = R"=====\((.*?)\)=====";', text, re.S))
+
+
+def source_hash():
+    digest = hashlib.md5()
+    digest.update(PAGES_PATH.read_bytes())
+    digest.update(SCRIPT_PATH.read_bytes())
+    return digest.hexdigest()
+
+
+# ============================================================================
+# Minify and compress
+# ============================================================================
+
+def minify(html):
+    """Strip comments, indentation and blank lines; keep line breaks."""
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    html = re.sub(r"/\*.*?\*/", "", html, flags=re.S)
+    lines = []
+    for line in html.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def compress(data):
+    # mtime=0 keeps the output (and so the ETag) stable between builds
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+# ============================================================================
+# Output
+# ============================================================================
+
+def generate_assets(digest):
+    fragments = load_fragments(PAGES_PATH)
+
+    assets = []
+    for name, parts in ASSETS.items():
+        missing = [part for part in parts if part not in fragments]
+        if missing:
+            raise RuntimeError(f"build_web_assets: {', '.join(missing)} not found in {PAGES_PATH.name}")
+        raw = "".join(fragments[part] for part in parts)
+        small = minify(raw)
+        packed = compress(small.encode("utf-8"))
+        etag = '"' + hashlib.sha256(packed).hexdigest()[:16] + '"'
+        assets.append((name, len(raw.encode("utf-8")), len(small.encode("utf-8")), packed, etag))
+
+    lines = []
+    lines.append("/**")
+    lines.append(" * @file WebAssets.h")
+    lines.append(" * @brief Minified, gzip-compressed static portal pages")
+    lines.append(" *")
+    lines.append(" * GENERATED by scripts/build_web_assets.py from WebConfigPages.h - DO NOT EDIT")
+    lines.append(f" * Source hash: {digest}")
+    lines.append(" *")
+    lines.append(" * Transfer size (raw / minified / gzip):")
+    for name, raw_size, min_size, packed, _ in assets:
+        lines.append(f" *   {name + ':':<22}{raw_size:6d} / {min_size:6d} / {len(packed):5d} bytes")
+    lines.append(" */")
+    lines.append("")
+    lines.append("#ifndef STAC_WEB_ASSETS_H")
+    lines.append("#define STAC_WEB_ASSETS_H")
+    lines.append("")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("")
+    lines.append("namespace Net {")
+    lines.append("    namespace WebAssets {")
+    lines.append("")
+    lines.append("        /**")
+    lines.append("         * @brief One precompressed page")
+    lines.append("         */")
+    lines.append("        struct WebAsset {")
+    lines.append("            const uint8_t *data;    ///< gzip stream")
+    lines.append("            size_t size;            ///< Compressed size")
+    lines.append("            const char *etag;       ///< Strong ETag, quoted")
+    lines.append("        };")
+    for name, _, _, packed, etag in assets:
+        array = name.title().replace("_", "") + "Data"
+        lines.append("")
+        lines.append(f"        const uint8_t {array}[] PROGMEM = {{")
+        for i in range(0, len(packed), 16):
+            chunk = ", ".join(f"0x{b:02X}" for b in packed[i:i + 16])
+            lines.append(f"            {chunk},")
+        lines[-1] = lines[-1].rstrip(",")
+        lines.append("        };")
+        etag_literal = etag.replace('"', '\\"')
+        lines.append(f"        const WebAsset {name} = {{ {array}, sizeof( {array} ), \"{etag_literal}\" }};")
+    lines.append("")
+    lines.append("    } // namespace WebAssets")
+    lines.append("} // namespace Net")
+    lines.append("")
+    lines.append("")
+    lines.append("#endif // STAC_WEB_ASSETS_H")
+    lines.append("")
+    lines.append("")
+    lines.append("//  --- EOF --- //")
+    lines.append("")
+
+    ASSETS_PATH.write_text("\n".join(lines))
+    return assets
+
+
+def main():
+    digest = source_hash()
+    if ASSETS_PATH.exists() and f"Source hash: {digest}" in ASSETS_PATH.read_text():
+        return
+
+    assets = generate_assets(digest)
+    print("=" * 60)
+    print("Web Portal Assets Generated:")
+    for name, raw_size, _, packed, _ in assets:
+        print(f"  {name:<22}{raw_size:6d} -> {len(packed):5d} bytes")
+    print(f"  Output:     {ASSETS_PATH.relative_to(PROJECT_DIR)}")
+    print("=" * 60)
+
+
+# Generate when the script loads (before any build actions), like build_version.py
+main()
@@ -1,6 +1,10 @@
 # Register custom PlatformIO/SCons targets
 # - `-t merged`: Creates STAC_v<version>_<board>_<build>_FULL.bin for Web Serial flashing (includes bootloader + partitions + app)
 # - `-t ota`: Creates STAC_v<version>_<board>_<build>.bin for OTA updates (app only)
+#   With STAC_DELTA_BASE=<previous OTA .bin> set, also creates
+#   STAC_v<version>_<board>_<build>_DELTA_from_<base>.bin, a patch against that release
+#   Also writes STAC_<board>_<build>.manifest, which devices with an update server
+#   configured poll to find the newest image (serve STAC/bin/ over HTTP)
 #
 # Binaries are collected in STAC/bin/ (flat structure for GitHub Releases):
 #   STAC/bin/STAC_v3.0.0_ATOM_Matrix_FULL.bin
@@ -13,12 +17,17 @@
 import os
 import re
 import glob
+import hashlib
 import shutil
 import subprocess
+import sys
 from SCons.Script import Import  # type: ignore
 
 Import("env")
 
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "scripts"))
+import make_delta  # noqa: E402
+
 
 def _ensure_dir(path: str):
     os.makedirs(path, exist_ok=True)
@@ -255,9 +264,73 @@ def _do_ota_copy_action(target, source, env):
     
     size = os.path.getsize(ota_dst)
     print(f"[ota target] Created: {ota_dst} ({size} bytes)")
+
+    delta = None
+    delta_base = os.environ.get("STAC_DELTA_BASE", "")
+    if delta_base:
+        delta = _make_delta_patch(delta_base, ota_dst, out_dir, version, suffix)
+        if delta is None:
+            return 1
+
+    _write_manifest(out_dir, suffix, version, ota_dst, delta)
     return 0
 
 
+def _make_delta_patch(base_path, ota_path, out_dir, version, suffix):
+    """Create a delta patch from the base release to the new OTA image.
+
+    Returns (patch file name, base version or None), or None on error.
+    """
+    if not os.path.exists(base_path):
+        print(f"[ota target] ERROR: delta base not found: {base_path}")
+        return None
+
+    match = re.search(r"STAC_v(.+?)_" + re.escape(suffix), os.path.basename(base_path))
+    base_version = f"v{match.group(1)}" if match else "base"
+    delta_filename = f"STAC_v{version}_{suffix}_DELTA_from_{base_version}.bin"
+    delta_dst = os.path.join(out_dir, delta_filename)
+
+    for old_bin in glob.glob(os.path.join(out_dir, f"STAC_*_{suffix}_DELTA_from_*.bin")):
+        os.remove(old_bin)
+        print(f"[ota target] Removed old binary: {os.path.basename(old_bin)}")
+
+    patch_size, image_size = make_delta.write_delta(base_path, ota_path, delta_dst)
+    print(f"[ota target] Created: {delta_dst} ({patch_size} bytes, "
+          f"{100.0 * patch_size / image_size:.1f}% of the {image_size} byte image)")
+    return delta_filename, match.group(1) if match else None
+
+
+def _write_manifest(out_dir, suffix, version, ota_path, delta):
+    """Write the manifest fleet devices poll (key=value lines).
+
+    The delta is listed only when the base version is known: a device uses it
+    only if it runs exactly that version. Set restart=1 by hand to have devices
+    restart into the new image as soon as their tally is idle.
+    """
+    lines = [
+        f"version={version}",
+        f"image={os.path.basename(ota_path)}",
+        f"size={os.path.getsize(ota_path)}",
+        f"sha256={hashlib.sha256(_read(ota_path)).hexdigest()}",
+    ]
+    if delta and delta[1]:
+        lines.append(f"delta={delta[0]}")
+        lines.append(f"delta_from={delta[1]}")
+    lines.append("restart=0")
+
+    manifest_path = os.path.join(out_dir, f"STAC_{suffix}.manifest")
+    with open(manifest_path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    print(f"[ota target] Created: {manifest_path}")
+
+
+# Devices fetch STAC_<board>_<build>.manifest, so the firmware needs its own suffix.
+# Post script: projenv is the environment the project sources compile with.
+Import("projenv")
+projenv.Append(CPPDEFINES=[("STAC_OTA_TARGET", '\\"%s\\"' % _get_build_suffix(
+    env.subst("$PIOENV"), env.GetProjectOption("build_type", "debug")))])
+
+
 # Create a human-friendly custom target visible to `pio run -t merged`
 env.AddCustomTarget(
     name="merged",
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+Build a delta OTA patch that turns one STAC app image into another.
+
+The device rebuilds the new image by streaming the patch: COPY ops read
+ranges of the running (old) app partition, ADD ops carry new bytes. New
+bytes are raw-deflated (ADD_DEFLATE) whenever that is smaller, with a
+window small enough for the device to inflate them through the ROM tinfl
+in a few KB of RAM. The header holds the SHA-256 of both images, so the device refuses a patch
+made for a different base and verifies the rebuilt image before it
+switches partitions. Layout (little-endian) must match
+include/Network/DeltaPatcher.h:
+
+    header  "STDP", version u8, flags u8, reserved u16,
+            old size u32, new size u32, old SHA-256[32], new SHA-256[32]
+    ops     0x01 COPY  offset u32, length u32
+            0x02 ADD   length u32, <length bytes>
+            0x03 ADD_DEFLATE  length u32, packed u32, <packed bytes of raw deflate>
+            0x00 END
+
+Matching indexes the old image every INDEX_STEP bytes and scans the new
+image byte by byte, so code that moved by any offset is still found.
+
+Used by the `-t ota` target in custom_targets.py, or standalone:
+    python3 scripts/make_delta.py <old.bin> <new.bin> <patch.bin>
+"""
+
+import hashlib
+import struct
+import sys
+import zlib
+
+MAGIC = b"STDP"
+VERSION = 2          # 1 had no ADD_DEFLATE; the device still accepts it
+HEADER = struct.Struct("<4sBBHII32s32s")
+
+OP_END = 0x00
+OP_COPY = 0x01
+OP_ADD = 0x02
+OP_ADD_DEFLATE = 0x03
+
+KEY_SIZE = 16        # Bytes hashed per index entry
+INDEX_STEP = 4       # Old image offsets indexed (code is 4-byte aligned)
+MIN_COPY = 16        # Shorter matches cost more as COPY than as ADD bytes
+WINDOW_BITS = 13     # Deflate window; must match DeltaPatcher::INFLATE_WINDOW (8 KB)
+
+
+def _deflate(data):
+    """Raw deflate with the window the device inflates with."""
+    packer = zlib.compressobj(9, zlib.DEFLATED, -WINDOW_BITS)
+    return packer.compress(data) + packer.flush()
+
+
+def _match_length(old, old_pos, new, new_pos):
+    """Length of the common run starting at old_pos / new_pos."""
+    limit = min(len(old) - old_pos, len(new) - new_pos)
+    length = 0
+    step = 256
+    while step:
+        while length + step <= limit and old[old_pos + length:old_pos + length + step] == \
+                new[new_pos + length:new_pos + length + step]:
+            length += step
+        step //= 4
+    return length
+
+
+def make_delta(old, new):
+    """Return the patch bytes that rebuild `new` from `old`."""
+    index = {}
+    for pos in range(0, len(old) - KEY_SIZE + 1, INDEX_STEP):
+        index.setdefault(old[pos:pos + KEY_SIZE], pos)
+
+    ops = bytearray()
+    literal_start = 0
+    pos = 0
+    last_old = 0
+
+    def flush_literal(end):
+        if end <= literal_start:
+            return
+        literal = new[literal_start:end]
+        packed = _deflate(literal)
+        if len(packed) + 4 < len(literal):
+            ops.extend(struct.pack("<BII", OP_ADD_DEFLATE, len(literal), len(packed)))
+            ops.extend(packed)
+        else:
+            ops.extend(struct.pack("<BI", OP_ADD, len(literal)))
+            ops.extend(literal)
+
+    while pos <= len(new) - KEY_SIZE:
+        # Sequential continuation first: most of a rebuilt image lines up with the old one
+        old_pos = last_old if new[pos:pos + KEY_SIZE] == old[last_old:last_old + KEY_SIZE] else \
+            index.get(new[pos:pos + KEY_SIZE])
+        if old_pos is None:
+            pos += 1
+            continue
+
+        length = _match_length(old, old_pos, new, pos)
+        # Grow backwards into the pending literal
+        while pos > literal_start and old_pos > 0 and old[old_pos - 1] == new[pos - 1]:
+            pos -= 1
+            old_pos -= 1
+            length += 1
+
+        if length < MIN_COPY:
+            pos += 1
+            continue
+
+        flush_literal(pos)
+        ops.extend(struct.pack("<BII", OP_COPY, old_pos, length))
+        pos += length
+        last_old = old_pos + length
+        literal_start = pos
+
+    flush_literal(len(new))
+    ops.append(OP_END)
+
+    header = HEADER.pack(MAGIC, VERSION, 0, 0, len(old), len(new),
+                         hashlib.sha256(old).digest(), hashlib.sha256(new).digest())
+    return header + bytes(ops)
+
+
+def apply_delta(old, patch):
+    """Rebuild the new image (reference for DeltaPatcher; used to self-check)."""
+    magic, version, _, _, old_size, new_size, old_sha, new_sha = HEADER.unpack_from(patch)
+    if magic != MAGIC or not 1 <= version <= VERSION:
+        raise ValueError("not a STAC delta patch")
+    if len(old) < old_size or hashlib.sha256(old[:old_size]).digest() != old_sha:
+        raise ValueError("patch was made for a different base image")
+
+    out = bytearray()
+    pos = HEADER.size
+    while True:
+        op = patch[pos]
+        pos += 1
+        if op == OP_END:
+            break
+        if op == OP_COPY:
+            offset, length = struct.unpack_from("<II", patch, pos)
+            pos += 8
+            out.extend(old[offset:offset + length])
+        elif op == OP_ADD:
+            (length,) = struct.unpack_from("<I", patch, pos)
+            pos += 4
+            out.extend(patch[pos:pos + length])
+            pos += length
+        elif op == OP_ADD_DEFLATE:
+            length, packed = struct.unpack_from("<II", patch, pos)
+            pos += 8
+            literal = zlib.decompressobj(-WINDOW_BITS).decompress(patch[pos:pos + packed])
+            if len(literal) != length:
+                raise ValueError(f"ADD_DEFLATE at {pos - 9} inflates to {len(literal)} bytes, not {length}")
+            out.extend(literal)
+            pos += packed
+        else:
+            raise ValueError(f"bad op 0x{op:02X} at {pos - 1}")
+
+    if len(out) != new_size or hashlib.sha256(out).digest() != new_sha:
+        raise ValueError("rebuilt image does not match")
+    return bytes(out)
+
+
+def write_delta(old_path, new_path, patch_path):
+    """Create the patch file; returns (patch size, new image size)."""
+    with open(old_path, "rb") as f:
+        old = f.read()
+    with open(new_path, "rb") as f:
+        new = f.read()
+
+    patch = make_delta(old, new)
+    apply_delta(old, patch)
+    with open(patch_path, "wb") as f:
+        f.write(patch)
+    return len(patch), len(new)
+
+
+def main():
+    if len(sys.argv) != 4:
+        print(__doc__)
+        return 2
+
+    patch_size, new_size = write_delta(sys.argv[1], sys.argv[2], sys.argv[3])
+    print(f"Delta: {patch_size} bytes for a {new_size} byte image "
+          f"({100.0 * patch_size / new_size:.1f}%)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,103 @@
+#include "Application/EventBus.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+
+
+namespace Application {
+
+    EventBus::EventBus()
+        : queue( nullptr )
+        , subscriptionCount( 0 )
+        , posted( 0 )
+        , dropped( 0 )
+        , dispatched( 0 )
+        , maxLatencyUs( 0 ) {
+    }
+
+    bool EventBus::begin() {
+        if ( queue ) {
+            return true;
+        }
+
+        queue = xQueueCreateStatic( QUEUE_CAPACITY, sizeof( AppEvent ), queueStorage, &queueControl );
+        if ( !queue ) {
+            log_e( "Failed to create event queue" );
+            return false;
+        }
+        return true;
+    }
+
+    bool EventBus::subscribe( OperatingMode mode, AppEventType type, AppEventHandler handler, void *context ) {
+        if ( !handler ) {
+            return false;
+        }
+        if ( subscriptionCount >= MAX_HANDLERS ) {
+            log_e( "Event handler table full (%d entries)", MAX_HANDLERS );
+            return false;
+        }
+
+        subscriptions[ subscriptionCount++ ] = { mode, type, handler, context };
+        return true;
+    }
+
+    bool EventBus::post( AppEventType type, uint32_t value ) {
+        if ( !queue ) {
+            return false;
+        }
+
+        AppEvent event = makeEvent( type, value );
+        if ( xQueueSend( queue, &event, 0 ) != pdTRUE ) {
+            dropped.fetch_add( 1, std::memory_order_relaxed );
+            return false;
+        }
+        posted.fetch_add( 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    bool EventBus::receive( AppEvent &event, uint32_t timeoutMs ) {
+        if ( !queue ) {
+            delay( timeoutMs );
+            return false;
+        }
+        return xQueueReceive( queue, &event, pdMS_TO_TICKS( timeoutMs ) ) == pdTRUE;
+    }
+
+    uint8_t EventBus::dispatch( const AppEvent &event, OperatingMode mode ) {
+        // Only the loop task dispatches, so a plain load/store is enough for the maximum
+        int64_t latencyUs = esp_timer_get_time() - event.postedAtUs;
+        if ( latencyUs > static_cast<int64_t>( maxLatencyUs.load( std::memory_order_relaxed ) ) ) {
+            maxLatencyUs.store( static_cast<uint32_t>( latencyUs ), std::memory_order_relaxed );
+        }
+
+        uint8_t called = 0;
+        for ( uint8_t i = 0; i < subscriptionCount; i++ ) {
+            const Subscription &sub = subscriptions[ i ];
+            if ( sub.mode == mode && sub.type == event.type ) {
+                sub.handler( event, sub.context );
+                called++;
+            }
+        }
+
+        if ( called > 0 ) {
+            dispatched.fetch_add( 1, std::memory_order_relaxed );
+        }
+        return called;
+    }
+
+    EventBusStats EventBus::getStats() const {
+        EventBusStats stats;
+        stats.posted = posted.load( std::memory_order_relaxed );
+        stats.dropped = dropped.load( std::memory_order_relaxed );
+        stats.dispatched = dispatched.load( std::memory_order_relaxed );
+        stats.maxLatencyUs = maxLatencyUs.load( std::memory_order_relaxed );
+        return stats;
+    }
+
+    AppEvent EventBus::makeEvent( AppEventType type, uint32_t value ) {
+        return AppEvent{ type, value, esp_timer_get_time() };
+    }
+
+} // namespace Application
+
+
+//  --- EOF --- //
@@ -1,4 +1,5 @@
 #include <Arduino.h>
+#include <climits>
 #include "Application/STACApp.h"
 #include "Hardware/Display/DisplayFactory.h"
 #include "Hardware/Display/GlyphManager.h"
@@ -10,6 +11,8 @@
 #include "Network/Protocol/RolandClientFactory.h"
 #include "Network/WebConfigServer.h"
 #include "Utils/InfoPrinter.h"
+#include "Utils/BootProfiler.h"
+#include "State/WarmStart.h"
 
 // Add these 'using' declarations
 using Display::DisplayFactory;
@@ -26,28 +29,45 @@ namespace Application {
         , lastRolandPoll( 0 )
         , rolandPollInterval( 300 )
         , rolandClientInitialized( false )
+        , warmResume( false )
+        , nextTickAtMs( 0 )
         , buttonPollTimer( nullptr ) {
         // unique_ptr members default to nullptr
     }
 
     bool STACApp::setup() {
-        // Initialize hardware
-        if ( !initializeHardware() ) {
-            log_e( "Hardware initialization failed" );
+        Utils::BootProfiler::begin();
+        warmResume = State::WarmStart::begin();
+
+        // Event queue first: button polling starts posting during hardware init
+        if ( !eventBus.begin() ) {
             return false;
         }
 
-        // Initialize network and storage
+        // Initialize network and storage first so WiFi association can
+        // run while the display, IMU and boot UI are being brought up
         if ( !initializeNetworkAndStorage() ) {
             log_e( "Network/Storage initialization failed" );
             return false;
         }
+        Utils::BootProfiler::mark( Utils::BootPhase::STORAGE_READY );
+        startEarlyWiFi();
+
+        // Initialize hardware
+        if ( !initializeHardware() ) {
+            log_e( "Hardware initialization failed" );
+            return false;
+        }
+        Utils::BootProfiler::mark( Utils::BootPhase::HARDWARE_READY );
 
         // Show green power glyph to indicate successful initialization
         // (orange was shown during hardware init, green = all systems ready)
-        const uint8_t *powerGlyph = Display::BASE_GLYPHS[ Display::GLF_PO ];
-        display->drawGlyph( powerGlyph, Display::StandardColors::GREEN, Display::StandardColors::BLACK, Config::Display::SHOW );
-        delay( 750 );  // Hold green power glyph for 750ms
+        // A warm start goes straight back to the tally display instead
+        if ( !warmResume ) {
+            const uint8_t *powerGlyph = Display::BASE_GLYPHS[ Display::GLF_PO ];
+            display->drawGlyph( powerGlyph, Display::StandardColors::GREEN, Display::StandardColors::BLACK, Config::Display::SHOW );
+            delay( 750 );  // Hold green power glyph for 750ms
+        }
 
         // Initialize system state
         systemState = std::make_unique<State::SystemState>();
@@ -59,6 +79,19 @@ namespace Application {
         // Determine operating mode (after showing green = successful init)
         OperatingMode mode = determineOperatingMode();
         systemState->getOperatingMode().setMode( mode );
+        Utils::BootProfiler::mark( Utils::BootPhase::MODE_SELECTED );
+
+        // The early connection and the warm-start snapshot only apply to normal mode
+        if ( mode != OperatingMode::NORMAL ) {
+            if ( wifiManager->getState() == Net::WiFiState::CONNECTING ) {
+                wifiManager->disconnect();
+            }
+            State::WarmStart::clear();
+            warmResume = false;
+        }
+        if ( warmResume ) {
+            Utils::BootProfiler::noteWarmStart();
+        }
 
         log_i( "Operating Mode: %s", systemState->getOperatingMode().getModeString() );
         log_i( "STAC ID: %s", stacID.c_str() );
@@ -76,17 +109,13 @@ namespace Application {
             log_i( "Tally: %s -> %s",
                    State::TallyStateManager::stateToString( oldState ),
                    State::TallyStateManager::stateToString( newState ) );
-            updateDisplay();
-
-            #if HAS_PERIPHERAL_MODE_CAPABILITY
-            // Update GROVE output if in normal mode
-            if ( systemState->getOperatingMode().isNormalMode() ) {
-                grovePort->setTallyState( newState );
-            }
-            #endif
+            // Already on the loop task, so deliver immediately
+            eventBus.dispatch( EventBus::makeEvent( AppEventType::TALLY_RESULT, static_cast<uint32_t>( newState ) ),
+                               systemState->getOperatingMode().getCurrentMode() );
         }
         );
 
+        registerEventHandlers();
         initialized = true;
 
         // Handle provisioning mode if needed (blocking call)
@@ -123,6 +152,10 @@ namespace Application {
                         );
         #endif
 
+        const Storage::NvsStats &nvs = configManager->getNvsStats();
+        log_i( "NVS during setup: %d namespace opens, %d commits", nvs.opens, nvs.commits );
+
+        Utils::BootProfiler::mark( Utils::BootPhase::APP_READY );
         return true;
     }
 
@@ -131,34 +164,143 @@ namespace Application {
             return;
         }
 
-        // Button polling is now handled by esp_timer (2ms interval)
-        // Just handle button events here
+        OperatingMode mode = systemState->getOperatingMode().getCurrentMode();
+
+        // Sleep until an event arrives (button edges from the esp_timer poll)
+        // or the next periodic tick is due
+        long untilTick = static_cast<long>( nextTickAtMs - millis() );
+        AppEvent event;
+        if ( eventBus.receive( event, untilTick > 0 ? static_cast<uint32_t>( untilTick ) : 0 ) ) {
+            eventBus.dispatch( event, mode );
+        }
+
+        if ( static_cast<long>( millis() - nextTickAtMs ) >= 0 ) {
+            eventBus.dispatch( EventBus::makeEvent( AppEventType::TIMER_TICK, millis() ), mode );
+            nextTickAtMs = millis() + tickIntervalMs();
+        }
+    }
+
+    void STACApp::registerEventHandlers() {
+        // Provisioning runs to completion in setup(), so only NORMAL and PERIPHERAL subscribe
+        eventBus.subscribe( OperatingMode::NORMAL, AppEventType::TIMER_TICK,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->handleNormalTick();
+        }, this );
+
+        eventBus.subscribe( OperatingMode::NORMAL, AppEventType::BUTTON_PRESSED,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->handleButton();
+        }, this );
+
+        eventBus.subscribe( OperatingMode::NORMAL, AppEventType::BUTTON_RELEASED,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->handleButton();
+        }, this );
+
+        eventBus.subscribe( OperatingMode::NORMAL, AppEventType::WIFI_STATE,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->handleWiFiState( static_cast<Net::WiFiState>( event.value ) );
+        }, this );
+
+        eventBus.subscribe( OperatingMode::NORMAL, AppEventType::WIFI_EVENT,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->wifiManager->update();
+        }, this );
+
+        eventBus.subscribe( OperatingMode::NORMAL, AppEventType::TALLY_RESULT,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->handleTallyResult( static_cast<TallyState>( event.value ) );
+        }, this );
+
+        #if defined(BUTTON_B_PIN)
+        eventBus.subscribe( OperatingMode::NORMAL, AppEventType::BUTTON_B_PRESSED,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->handleButtonB();
+        }, this );
+        #endif
+
+        #if HAS_PERIPHERAL_MODE_CAPABILITY
+        eventBus.subscribe( OperatingMode::PERIPHERAL, AppEventType::TIMER_TICK,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->handlePeripheralMode();
+        }, this );
+
+        // A release ends the settings screen without waiting for the next tick
+        eventBus.subscribe( OperatingMode::PERIPHERAL, AppEventType::BUTTON_RELEASED,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->handlePeripheralMode();
+        }, this );
+
         #if defined(BUTTON_B_PIN)
-        handleButtonB();
+        eventBus.subscribe( OperatingMode::PERIPHERAL, AppEventType::BUTTON_B_PRESSED,
+        []( const AppEvent & event, void *context ) {
+            static_cast<STACApp *>( context )->handleButtonB();
+        }, this );
+        #endif
         #endif
+    }
 
-        // Handle button input
+    void STACApp::handleNormalTick() {
+        // Long presses are timed here; press/release edges arrive as events
         handleButton();
 
+        // Advance any running display animation
+        animator->update( millis() );
+
         // Update managers
         wifiManager->update();
         systemState->update();
 
-        // Mode-specific handling
+        // Keep NVS in step with the access point last joined (written only on change)
+        WiFiLink link;
+        if ( wifiManager->getNewLink( link ) ) {
+            configManager->saveWiFiLink( link );
+        }
+
+        handleNormalMode();
+    }
+
+    void STACApp::handleTallyResult( TallyState newState ) {
+        updateDisplay();
+        State::WarmStart::save( newState );
+
+        #if HAS_PERIPHERAL_MODE_CAPABILITY
+        // Update GROVE output (handler is only registered for normal mode)
+        grovePort->setTallyState( newState );
+        #endif
+    }
+
+    uint32_t STACApp::tickIntervalMs() {
+        using namespace Config::Timing;
+
         switch ( systemState->getOperatingMode().getCurrentMode() ) {
-            case OperatingMode::NORMAL:
-                handleNormalMode();
-                break;
+            case OperatingMode::NORMAL: {
+                // Animations and long-press timing need a fast tick
+                if ( animator->isRunning() || button->isPressed() ) {
+                    return EVENT_TICK_ACTIVE_MS;
+                }
+                // Otherwise wake for the next Roland poll, or the idle tick if sooner
+                if ( rolandClientInitialized ) {
+                    unsigned long sincePoll = millis() - lastRolandPoll;
+                    if ( sincePoll >= rolandPollInterval ) {
+                        return 0;
+                    }
+                    unsigned long untilPoll = rolandPollInterval - sincePoll;
+                    // Wake early when the radio has to come out of modem sleep first
+                    uint32_t lead = powerManager && !powerManager->isAwake() ? powerManager->getWakeLeadMs() : 0;
+                    untilPoll = untilPoll > lead ? untilPoll - lead : 0;
+                    return untilPoll < EVENT_TICK_IDLE_MS ? untilPoll : EVENT_TICK_IDLE_MS;
+                }
+                return EVENT_TICK_IDLE_MS;
+            }
 
-                #if HAS_PERIPHERAL_MODE_CAPABILITY
+            #if HAS_PERIPHERAL_MODE_CAPABILITY
             case OperatingMode::PERIPHERAL:
-                handlePeripheralMode();
-                break;
-                #endif
+                return PM_POLL_INTERVAL_MS;
+            #endif
 
-            case OperatingMode::PROVISIONING:
-                // Provisioning is handled once in setup(), not in loop
-                break;
+            default:
+                return EVENT_TICK_IDLE_MS;
         }
     }
 
@@ -180,7 +322,7 @@ namespace Application {
 
         // IMU - Initialize FIRST to detect orientation before display init
         // This allows display to be created with correct rotation from the start
-        imu = IMUFactory::create();
+        imu = IMUFactory::createBoard();
         Orientation displayOrientation = Orientation::ROTATE_0;  // Default if IMU unavailable
 
         if ( imu->begin() ) {
@@ -242,7 +384,7 @@ namespace Application {
         #endif
 
         // Display - Initialize with correct configuration from board config
-        display = DisplayFactory::create();
+        display = DisplayFactory::createBoard();
 
         // Set initial rotation: use IMU-detected orientation for boards with IMU,
         // or board-specific physical rotation for boards without IMU
@@ -256,6 +398,7 @@ namespace Application {
             log_e( "Display initialization failed" );
             return false;
         }
+        animator = std::make_unique<Display::Animator>( display.get() );
 
         // Immediately show orange power glyph (display is already on from begin())
         const uint8_t *earlyPowerGlyph = Display::BASE_GLYPHS[ Display::GLF_PO ];
@@ -319,21 +462,35 @@ namespace Application {
 #if defined(BUTTON_B_PIN)
     static Button *s_buttonB = nullptr;
 #endif
+    static EventBus *s_eventBus = nullptr;
 
     static void buttonPollCallback( void* arg ) {
         if ( s_button ) {
             s_button->read();
+            // Wake the main loop on debounced edges
+            if ( s_eventBus ) {
+                if ( s_button->wasPressed() ) {
+                    s_eventBus->post( AppEventType::BUTTON_PRESSED );
+                }
+                else if ( s_button->wasReleased() ) {
+                    s_eventBus->post( AppEventType::BUTTON_RELEASED );
+                }
+            }
         }
         #if defined(BUTTON_B_PIN)
         if ( s_buttonB ) {
             s_buttonB->read();
+            if ( s_eventBus && s_buttonB->wasPressed() ) {
+                s_eventBus->post( AppEventType::BUTTON_B_PRESSED );
+            }
         }
         #endif
     }
 
     void STACApp::startButtonPolling() {
-        // Store button pointers for static callback
+        // Store button and event bus pointers for static callback
         s_button = button;
+        s_eventBus = &eventBus;
         #if defined(BUTTON_B_PIN)
         s_buttonB = buttonB;
         #endif
@@ -397,11 +554,42 @@ namespace Application {
             return false;
         }
         wifiManager->setHostname( stacID );
+        wifiManager->setEventNotifier( []( void *context ) {
+            // WiFi event task: wake the loop so the event is handled straight away
+            static_cast<STACApp *>( context )->eventBus.post( AppEventType::WIFI_EVENT );
+        }, this );
         log_i( "✓ WiFi Manager" );
 
         return true;
     }
 
+    void STACApp::startEarlyWiFi() {
+        // Only start if this boot is expected to end up in normal mode;
+        // the boot button can still pick another mode, see setup()
+        if ( !configManager->isProvisioned() || !configManager->hasWiFiCredentials() ) {
+            return;
+        }
+        #if HAS_PERIPHERAL_MODE_CAPABILITY
+        if ( configManager->loadPModeEnabled() ) {
+            return;
+        }
+        #endif
+
+        // Last access point and lease from NVS, for a directed connect without a scan
+        WiFiLink savedLink;
+        if ( configManager->loadWiFiLink( savedLink ) ) {
+            wifiManager->setSavedLink( savedLink );
+        }
+
+        // Sent when associating, so it has to be in place before the first connect
+        wifiManager->setListenInterval( Hardware::PowerManager::listenIntervalFor( configManager->loadPowerProfile() ) );
+
+        String ssid, password;
+        if ( configManager->loadWiFiCredentials( ssid, password ) && wifiManager->connectAsync( ssid, password ) ) {
+            log_i( "WiFi association started early" );
+        }
+    }
+
     OperatingMode STACApp::determineOperatingMode() {
         // Check for button hold at boot FIRST (PMode toggle/provisioning/factory reset/OTA)
         // This allows peripheral mode entry even when device is not configured
@@ -458,6 +646,7 @@ namespace Application {
                 // Run brightness change (will show checkerboard and allow selection)
                 if ( startupConfig ) {
                     // Use a temporary flag to indicate we're in runtime brightness adjust
+                    configManager->setDeferredCommit( true );
                     startupConfig->changeBrightness( ops );
 
                     // Save if changed
@@ -475,6 +664,9 @@ namespace Application {
                             log_e( "Failed to save brightness level" );
                         }
                     }
+                    if ( !configManager->setDeferredCommit( false ) ) {
+                        log_e( "Failed to write brightness level to NVS" );
+                    }
 
                     // Restore the display
                     updateDisplay();
@@ -508,87 +700,185 @@ namespace Application {
         #endif
     }
 
+    void STACApp::handleSerialCommand() {
+        static char line[ 16 ];
+        static uint8_t length = 0;
+
+        while ( Serial.available() > 0 ) {
+            char c = static_cast<char>( Serial.read() );
+            if ( c != '\r' && c != '\n' ) {
+                if ( length < sizeof( line ) - 1 ) {
+                    line[ length++ ] = c;
+                }
+                continue;
+            }
+            if ( length == 0 ) {
+                continue;
+            }
+            line[ length ] = '\0';
+            length = 0;
+
+            if ( strcasecmp( line, "update" ) == 0 ) {
+                if ( fleetUpdater ) {
+                    Serial.println( "Checking the update server" );
+                    fleetUpdater->requestCheck( false );
+                }
+                else {
+                    Serial.println( "No update server configured" );
+                }
+            }
+            else {
+                Serial.printf( "Unknown command: %s\n", line );
+            }
+        }
+    }
+
     /**
      * @brief Update display based on current tally state
      */
     void STACApp::updateDisplay() {
+        // A tally update always takes over the display
+        animator->stop();
+
+        uint32_t renderStartUs = micros();
         TallyState currentState = systemState->getTallyState().getCurrentState();
         StacOperations ops = systemState->getOperations();
 
-        // Draw the tally state (without showing yet)
+        // Describe the tally screen first so an unchanged one can be skipped
+        Display::DisplayScene scene;
+        scene.id = static_cast<uint8_t>( currentState );
+        scene.brightness = display->getBrightness();
         if ( currentState == TallyState::UNSELECTED ) {
             if ( ops.cameraOperatorMode ) {
                 // Camera Operator mode: Show dotted frame glyph
-                using namespace Display;
-                const uint8_t *glyphData = glyphManager->getGlyph( Display::GLF_DF );
-                display->drawGlyph( glyphData,
-                                    Display::StandardColors::PURPLE,
-                                    Display::StandardColors::BLACK,
-                                    false );  // Don't show yet
+                scene.glyph = glyphManager->getGlyph( Display::GLF_DF );
+                scene.foreground = Display::StandardColors::PURPLE;
+                scene.background = Display::StandardColors::BLACK;
             }
             else {
                 // Talent mode: Show solid green
-                display->fill( Display::StandardColors::GREEN, Config::Display::NO_SHOW );  // Don't show yet
+                scene.background = Display::StandardColors::GREEN;
             }
         }
         else {
             // All other states: Fill with state color
-            Display::color_t color = systemState->getTallyState().getStateColor();
-            display->fill( color, Config::Display::NO_SHOW );  // Don't show yet
+            scene.background = systemState->getTallyState().getStateColor();
         }
 
-        // Overlay power-on indicator glyph
+        // Power-on indicator overlay
         // After orientation is determined, use rotated glyphs from GlyphManager
-        const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
-        display->drawGlyphOverlay( powerGlyph, Display::StandardColors::ORANGE, Config::Display::NO_SHOW );
+        scene.overlay = glyphManager->getGlyph( Display::GLF_PO );
+        scene.overlayColor = Display::StandardColors::ORANGE;
+
+        if ( tallyScene.isShown( *display, scene ) ) {
+            log_v( "Tally display unchanged, redraw skipped" );
+            return;
+        }
+
+        // Draw the tally state (without showing yet)
+        if ( scene.glyph ) {
+            display->drawGlyph( scene.glyph, scene.foreground, scene.background, Config::Display::NO_SHOW );
+        }
+        else {
+            display->fill( scene.background, Config::Display::NO_SHOW );
+        }
+        display->drawGlyphOverlay( scene.overlay, scene.overlayColor, Config::Display::NO_SHOW );
 
         // Now show the complete display
         display->show();
+        tallyScene.markShown( *display, scene );
+
+        Display::SceneCounters counters = tallyScene.getCounters();
+        log_d( "Tally display updated in %lu us (%lu redraws, %lu suppressed)",
+               static_cast<unsigned long>( micros() - renderStartUs ),
+               static_cast<unsigned long>( counters.redrawsPerformed ),
+               static_cast<unsigned long>( counters.redrawsSuppressed ) );
+    }
+
+    void STACApp::handleWiFiState( Net::WiFiState state ) {
+        // Before the switch has been reached, the WiFi status screens tell the story
+        if ( !rolandClientInitialized ) {
+            displayWiFiStatus( state );
+            return;
+        }
+
+        switch ( state ) {
+            case Net::WiFiState::CONNECTED:
+                // Poll at the next tick; the reply redraws the tally over the WiFi glyph
+                log_i( "WiFi back - resuming tally polling" );
+                animator->stop();
+                lastRolandPoll = millis() - rolandPollInterval;
+                break;
+
+            case Net::WiFiState::DISCONNECTED:
+                log_w( "WiFi lost - tally polling paused" );
+                #if HAS_PERIPHERAL_MODE_CAPABILITY
+                if ( grovePort ) {
+                    grovePort->setTallyState( TallyState::ERROR );
+                }
+                #endif
+                displayWiFiStatus( state );
+                break;
+
+            default:
+                displayWiFiStatus( state );
+                break;
+        }
     }
 
     void STACApp::displayWiFiStatus( Net::WiFiState state ) {
         using namespace Config::Timing;
         using namespace Display;
 
+        // Warm start: keep the restored tally on screen until the first poll;
+        // only a failure is worth interrupting it for
+        if ( warmResume && state != Net::WiFiState::FAILED ) {
+            return;
+        }
+
         const uint8_t *wifiGlyph = glyphManager->getGlyph( Display::GLF_WIFI );
 
+        // Any new WiFi status replaces a failure animation still playing
+        animator->stop();
+
         switch ( state ) {
+            case Net::WiFiState::DISCONNECTED:
             case Net::WiFiState::CONNECTING: {
-                // Show orange WiFi glyph while attempting connection
+                // Show orange WiFi glyph while the link is down or being attempted
                 display->drawGlyph( wifiGlyph, StandardColors::ORANGE, StandardColors::BLACK, Config::Display::SHOW );
-                log_i( "WiFi: Attempting connection (orange glyph displayed)" );
+                log_i( "WiFi: %s (orange glyph displayed)",
+                       state == Net::WiFiState::CONNECTING ? "Attempting connection" : "Link down" );
                 break;
             }
 
             case Net::WiFiState::CONNECTED: {
-                // Show green WiFi glyph on successful connection
-                display->drawGlyph( wifiGlyph, StandardColors::GREEN, StandardColors::BLACK, Config::Display::SHOW );
+                // Show green WiFi glyph on successful connection, then clear to the power pixel
+                // Played by the animator; the Roland client starts once it has finished
                 log_i( "WiFi: Connected (green glyph displayed)" );
 
                 // Print WiFi connected status to serial
                 Utils::InfoPrinter::printWiFiConnected();
 
-                delay( GUI_PAUSE_MS );  // Pause to show success
-
-                // Clear display and show power pixel
                 // After orientation is determined, use rotated glyphs from GlyphManager
-                display->fill( StandardColors::BLACK, Config::Display::NO_SHOW );
-
                 const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
-                display->drawGlyphOverlay( powerGlyph, StandardColors::ORANGE, Config::Display::NO_SHOW );
-                display->show();
+                Animation connected;
+                connected.glyph( wifiGlyph, StandardColors::GREEN, StandardColors::BLACK, GUI_PAUSE_MS )
+                .fill( StandardColors::BLACK, 0 )
+                .overlay( powerGlyph, StandardColors::ORANGE, 0 );
+                animator->play( connected, millis() );
                 break;
             }
 
             case Net::WiFiState::FAILED: {
-                // Flash red WiFi glyph on timeout
-                display->drawGlyph( wifiGlyph, StandardColors::RED, StandardColors::BLACK, Config::Display::SHOW );
+                // Flash red WiFi glyph on timeout, then show orange glyph again for retry attempt
+                // Played by the animator so the main loop keeps running
                 log_e( "WiFi: Connection timeout (flashing red glyph)" );
-                display->flash( 8, 300, display->getBrightness() );  // Flash 8 times at 300ms intervals
-                delay( GUI_PAUSE_MS );
-
-                // Show orange glyph again for retry attempt
-                display->drawGlyph( wifiGlyph, StandardColors::ORANGE, StandardColors::BLACK, Config::Display::SHOW );
+                Animation failed;
+                failed.glyph( wifiGlyph, StandardColors::RED, StandardColors::BLACK, 0 )
+                .flash( 8, 300, display->getBrightness() )    // Flash 8 times at 300ms intervals
+                .hold( GUI_PAUSE_MS )
+                .glyph( wifiGlyph, StandardColors::ORANGE, StandardColors::BLACK, 0 );
+                animator->play( failed, millis() );
                 break;
             }
 
@@ -666,109 +956,132 @@ namespace Application {
                 Utils::InfoPrinter::printFooter( ops, switchIP, switchPort, ssid );
             }
 
-            // Display the active tally channel (always, regardless of autostart setting)
-            // For V-160HD SDI channels (9-20), display the channel within bank (1-8)
-            uint8_t displayChannel = ops.tallyChannel;
-            if ( ops.switchModel != "V-60HD" && ops.tallyChannel > 8 ) {
-                displayChannel = ops.tallyChannel - 8;  // SDI 9→1, 10→2, etc.
+            if ( warmResume ) {
+                // Warm start after an unplanned reset: skip the startup screens and
+                // put the saved tally back up; the first poll confirms or corrects it
+                log_i( "Warm start - skipping startup sequence" );
+                systemState->getTallyState().setState( State::WarmStart::getTallyState() );
+                updateDisplay();
             }
-            const uint8_t *channelGlyph = glyphManager->getDigitGlyph( displayChannel );
+            else {
+                // Display the active tally channel (always, regardless of autostart setting)
+                // For V-160HD SDI channels (9-20), display the channel within bank (1-8)
+                uint8_t displayChannel = ops.tallyChannel;
+                if ( ops.switchModel != "V-60HD" && ops.tallyChannel > 8 ) {
+                    displayChannel = ops.tallyChannel - 8;  // SDI 9→1, 10→2, etc.
+                }
+                const uint8_t *channelGlyph = glyphManager->getDigitGlyph( displayChannel );
 
-            // Channel and autostart colors depend on switch model and channel bank
-            Display::color_t channelColor;
-            Display::color_t autostartColor;
+                // Channel and autostart colors depend on switch model and channel bank
+                Display::color_t channelColor;
+                Display::color_t autostartColor;
 
-            if ( ops.switchModel != "V-60HD" && ops.tallyChannel > 8 ) {
-                // V-160HD second bank (SDI channels 9-20)
-                channelColor = Display::StandardColors::LIGHT_GREEN;
-                autostartColor = Display::StandardColors::BLUE;
-            }
-            else {
-                // V-60HD or V-160HD first bank (HDMI channels 1-8)
-                channelColor = Display::StandardColors::BLUE;
-                autostartColor = Display::StandardColors::BRIGHT_GREEN;
-            }
+                if ( ops.switchModel != "V-60HD" && ops.tallyChannel > 8 ) {
+                    // V-160HD second bank (SDI channels 9-20)
+                    channelColor = Display::StandardColors::LIGHT_GREEN;
+                    autostartColor = Display::StandardColors::BLUE;
+                }
+                else {
+                    // V-60HD or V-160HD first bank (HDMI channels 1-8)
+                    channelColor = Display::StandardColors::BLUE;
+                    autostartColor = Display::StandardColors::BRIGHT_GREEN;
+                }
 
-            // Clear any previous display state before showing channel glyph
-            display->clear( Config::Display::NO_SHOW );
-            display->drawGlyph( channelGlyph, channelColor, Display::StandardColors::BLACK, Config::Display::SHOW );
+                // Clear any previous display state before showing channel glyph
+                display->clear( Config::Display::NO_SHOW );
+                display->drawGlyph( channelGlyph, channelColor, Display::StandardColors::BLACK, Config::Display::SHOW );
 
-            // Wait for button release before proceeding
-            while ( button->isPressed() ) {
-                // Button state updated by esp_timer, just wait
-                delay( 1 );
-            }
+                // Wait for button release before proceeding
+                while ( button->isPressed() ) {
+                    // Button state updated by esp_timer, just wait
+                    delay( 1 );
+                }
 
-            // Check if autostart is enabled
-            bool autoStartBypass = false;
+                // Check if autostart is enabled
+                bool autoStartBypass = false;
 
-            if ( ops.autoStartEnabled ) {
-                // Autostart mode: Add blinking corners and wait for timeout or button press
-                log_i( "Autostart mode active - waiting for timeout or button press" );
+                if ( ops.autoStartEnabled ) {
+                    // Autostart mode: Add blinking corners and wait for timeout or button press
+                    log_i( "Autostart mode active - waiting for timeout or button press" );
 
-                using namespace Config::Timing;
-                using namespace Display;
+                    using namespace Config::Timing;
+                    using namespace Display;
 
-                // Get corners glyph for pulsing
-                const uint8_t *cornersGlyph = glyphManager->getGlyph( Display::GLF_CORNERS );
-                display->pulseCorners( cornersGlyph, true, autostartColor );
+                    // Pulse corner pixels - channel glyph already drawn
+                    const uint8_t *cornersGlyph = glyphManager->getGlyph( Display::GLF_CORNERS );
+                    Animation cornersPulse;
+                    cornersPulse.corners( cornersGlyph, true, autostartColor, AUTOSTART_PULSE_MS )
+                    .corners( cornersGlyph, false, autostartColor, AUTOSTART_PULSE_MS );
+                    animator->play( cornersPulse, millis(), Animator::REPEAT_FOREVER );
 
-                unsigned long autostartTimeout = millis() + AUTOSTART_TIMEOUT_MS;
-                unsigned long nextFlash = millis() + AUTOSTART_PULSE_MS;
-                bool cornersOn = true;
+                    unsigned long autostartStart = millis();
 
-                while ( millis() < autostartTimeout ) {
-                    // Button state updated by esp_timer
+                    while ( millis() - autostartStart < AUTOSTART_TIMEOUT_MS ) {
+                        // Button state updated by esp_timer
 
-                    // Check Button B for reset
-                    #if defined(BUTTON_B_PIN)
-                    handleButtonB();  // Triggers ESP.restart() if pressed
-                    #endif
+                        // Check Button B for reset
+                        #if defined(BUTTON_B_PIN)
+                        handleButtonB();  // Triggers ESP.restart() if pressed
+                        #endif
 
-                    // Button pressed: Cancel autostart
-                    if ( button->isPressed() ) {
-                        log_i( "Button pressed - cancelling autostart" );
-                        autoStartBypass = false;
-                        break;
-                    }
+                        // Button pressed: Cancel autostart
+                        if ( button->isPressed() ) {
+                            log_i( "Button pressed - cancelling autostart" );
+                            autoStartBypass = false;
+                            break;
+                        }
 
-                    // Flash corner pixels
-                    if ( millis() >= nextFlash ) {
-                        nextFlash = millis() + AUTOSTART_PULSE_MS;
-                        cornersOn = !cornersOn;
+                        animator->update( millis() );
+                        delay( 1 );
+                    }
+                    animator->stop();
 
-                        // Only pulse corners - channel glyph already drawn
-                        display->pulseCorners( cornersGlyph, cornersOn, autostartColor );
+                    // If we timed out (no button press), bypass startup config
+                    if ( millis() - autostartStart >= AUTOSTART_TIMEOUT_MS ) {
+                        autoStartBypass = true;
+                        log_i( "Autostart timeout - bypassing startup config" );
                     }
                 }
 
-                // If we timed out (no button press), bypass startup config
-                if ( millis() >= autostartTimeout ) {
-                    autoStartBypass = true;
-                    log_i( "Autostart timeout - bypassing startup config" );
+                // Run startup configuration (unless autostart bypassed)
+                // Menu saves land in the config cache and are written once at the end
+                configManager->setDeferredCommit( true );
+                if ( startupConfig->runStartupSequence( ops, autoStartBypass ) ) {
+                    // Update operations in system state
+                    systemState->setOperations( ops );
+
+                    // Save to protocol-specific namespace
+                    bool saved = false;
+                    if ( ops.isV60HD() ) {
+                        saved = configManager->saveV60HDConfig( ops );
+                    }
+                    else if ( ops.isV160HD() ) {
+                        saved = configManager->saveV160HDConfig( ops );
+                    }
+                    if ( !saved ) {
+                        log_e( "Failed to save protocol configuration after startup" );
+                    }
+                }
+                if ( !configManager->setDeferredCommit( false ) ) {
+                    log_e( "Failed to write startup configuration to NVS" );
                 }
             }
+            Utils::BootProfiler::mark( Utils::BootPhase::STARTUP_DONE );
 
-            // Run startup configuration (unless autostart bypassed)
-            if ( startupConfig->runStartupSequence( ops, autoStartBypass ) ) {
-                // Update operations in system state
-                systemState->setOperations( ops );
-
-                // Save to protocol-specific namespace
-                bool saved = false;
-                if ( ops.isV60HD() ) {
-                    saved = configManager->saveV60HDConfig( ops );
-                }
-                else if ( ops.isV160HD() ) {
-                    saved = configManager->saveV160HDConfig( ops );
-                }
-                if ( !saved ) {
-                    log_e( "Failed to save protocol configuration after startup" );
-                }
+            // Fleet updates are off unless an update server was provisioned
+            String updateURL = configManager->loadUpdateURL();
+            if ( !updateURL.isEmpty() ) {
+                fleetUpdater = std::make_unique<Net::FleetUpdater>( updateURL, stacID );
+                fleetUpdater->requestCheck();
             }
+
+            // WiFi power profile; the startup menus above ran at full speed
+            powerManager = std::make_unique<Hardware::PowerManager>( configManager->loadPowerProfile() );
+            wifiManager->setListenInterval( Hardware::PowerManager::listenIntervalFor( powerManager->getProfile() ) );
+            powerManager->begin();
         }
 
-        if ( !wifiAttempted && !wifiManager->isConnected() && configManager->hasWiFiCredentials() ) {
+        if ( !wifiAttempted && configManager->hasWiFiCredentials() ) {
             wifiAttempted = true;
 
             String ssid, password;
@@ -778,16 +1091,20 @@ namespace Application {
                 // Set callback for visual feedback
                 wifiManager->setStateCallback(
                 [ this ]( Net::WiFiState state ) {
-                    displayWiFiStatus( state );
+                    // Reported from WiFiManager::update() on the loop task, so deliver immediately
+                    eventBus.dispatch( EventBus::makeEvent( AppEventType::WIFI_STATE, static_cast<uint32_t>( state ) ),
+                                       OperatingMode::NORMAL );
                 }
                 );
 
-                wifiManager->connect( ssid, password );
+                // Joins the attempt started at boot; the outcome arrives as WIFI_STATE
+                wifiManager->connectAsync( ssid, password );
             }
         }
 
         // Initialize Roland client if WiFi connected and not yet initialized
-        if ( wifiManager->isConnected() && !rolandClientInitialized && switchConfigLoaded ) {
+        // (after the connected screen, so the first tally doesn't cut it short)
+        if ( wifiManager->isConnected() && !rolandClientInitialized && switchConfigLoaded && !animator->isRunning() ) {
             if ( initializeRolandClient( switchIP, switchPort, username, passwordSwitch ) ) {
                 rolandClientInitialized = true;
                 log_i( "Roland client initialized" );
@@ -795,9 +1112,36 @@ namespace Application {
             }
         }
 
+        // Bring the radio out of modem sleep just ahead of the next poll
+        unsigned long untilPoll = ULONG_MAX;
+        if ( rolandClientInitialized ) {
+            unsigned long sincePoll = millis() - lastRolandPoll;
+            untilPoll = sincePoll >= rolandPollInterval ? 0 : rolandPollInterval - sincePoll;
+        }
+        powerManager->update( untilPoll );
+
         // Poll Roland switch if initialized
         if ( rolandClientInitialized ) {
+            unsigned long previousPoll = lastRolandPoll;
             pollRolandSwitch();
+            if ( lastRolandPoll != previousPoll ) {
+                powerManager->pollDone();
+            }
+        }
+
+        handleSerialCommand();
+
+        if ( fleetUpdater ) {
+            fleetUpdater->update( wifiManager->isConnected() );
+
+            // An installed update waits until this camera is off air
+            if ( fleetUpdater->isRestartPending() ) {
+                TallyState tally = systemState->getTallyState().getCurrentState();
+                if ( tally != TallyState::PROGRAM && tally != TallyState::PREVIEW ) {
+                    log_i( "Fleet update installed - restarting" );
+                    restartDevice( 1000 );
+                }
+            }
         }
     }
 
@@ -809,196 +1153,198 @@ namespace Application {
         // Get glyph indices based on display size
         using namespace Display;
 
-        log_i( "Entering Peripheral Mode" );
-
-        // Configure GROVE GPIO pins as inputs for reading tally state
-        grovePort->configurePinsAsInputs();
-        log_i( "GROVE port configured as inputs for peripheral mode" );
-
-        // ===== Load or initialize peripheral mode settings =====
-        bool cameraMode = false;  // Default: talent mode
-        uint8_t brightnessLevel = 1;  // Default: lowest brightness
-
-        if ( !configManager->loadPeripheralSettings( cameraMode, brightnessLevel ) ) {
-            // First time in peripheral mode - save defaults
-            log_i( "First time in peripheral mode - using defaults" );
-            configManager->savePeripheralSettings( cameraMode, brightnessLevel );
-        }
+        // Settings and tally tracking persist across ticks
+        static bool peripheralInitialized = false;
+        static bool cameraMode = false;         // Default: talent mode
+        static uint8_t brightnessLevel = 1;     // Default: lowest brightness
+        static uint8_t lastTallyState = Config::Peripheral::INVALID_STATE;
+        static unsigned long nextCheck = 0;
+        static bool settingsOpen = false;       // Brightness screen up, waiting for release or hold
+        static unsigned long modeChangeTimeout = 0;
+
+        // One-time entry: load settings and play the startup animation
+        if ( !peripheralInitialized ) {
+            peripheralInitialized = true;
+
+            log_i( "Entering Peripheral Mode" );
+
+            // Configure GROVE GPIO pins as inputs for reading tally state
+            grovePort->configurePinsAsInputs();
+            log_i( "GROVE port configured as inputs for peripheral mode" );
+
+            // ===== Load or initialize peripheral mode settings =====
+            if ( !configManager->loadPeripheralSettings( cameraMode, brightnessLevel ) ) {
+                // First time in peripheral mode - save defaults
+                log_i( "First time in peripheral mode - using defaults" );
+                configManager->savePeripheralSettings( cameraMode, brightnessLevel );
+            }
 
-        // Apply brightness
-        uint8_t absoluteBrightness = Config::Display::BRIGHTNESS_MAP[ brightnessLevel ];
-        display->setBrightness( absoluteBrightness, Config::Display::NO_SHOW );
+            // Apply brightness
+            uint8_t absoluteBrightness = Config::Display::BRIGHTNESS_MAP[ brightnessLevel ];
+            display->setBrightness( absoluteBrightness, Config::Display::NO_SHOW );
+
+            // Print peripheral mode status to serial (include configuration state)
+            bool isProvisioned = configManager->isProvisioned();
+            Utils::InfoPrinter::printPeripheral( cameraMode, brightnessLevel, isProvisioned );
+
+            // ===== Startup animation =====
+            // Show "P" glyph in green (perifmodecolor), flash it 4 times, hold,
+            // then show power-on glyph as orange pixel on green background
+            const uint8_t *pGlyph = glyphManager->getGlyph( Display::GLF_P );
+            const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
+
+            Animation startup;
+            startup.glyph( pGlyph, StandardColors::GREEN, StandardColors::BLACK, 250 );
+            for ( int i = 0; i < 4; i++ ) {
+                startup.fill( StandardColors::BLACK, 250 )
+                .glyph( pGlyph, StandardColors::GREEN, StandardColors::BLACK, ( i < 3 ) ? 250 : GUI_PAUSE_MS );
+            }
+            startup.fill( StandardColors::GREEN, 0 )
+            .overlay( powerGlyph, StandardColors::ORANGE, 0 );
 
-        // Print peripheral mode status to serial (include configuration state)
-        bool isProvisioned = configManager->isProvisioned();
-        Utils::InfoPrinter::printPeripheral( cameraMode, brightnessLevel, isProvisioned );
+            animator->play( startup, millis() );
+            while ( animator->update( millis() ) ) {
+                handleButtonB();  // Check for Button B reset
+                delay( 1 );
+            }
 
-        // ===== Startup animation =====
-        // Show "P" glyph in green (perifmodecolor)
-        const uint8_t *pGlyph = glyphManager->getGlyph( Display::GLF_P );
-        display->drawGlyph( pGlyph, StandardColors::GREEN, StandardColors::BLACK, Config::Display::SHOW );
+            // Wait for button release
+            while ( button->isPressed() ) {
+                delay( 1 );
+            }
 
-        // Flash display 4 times
-        for ( int i = 0; i < 4; i++ ) {
-            delay( 250 );
-            display->clear( Config::Display::SHOW );
-            delay( 250 );
-            display->drawGlyph( pGlyph, StandardColors::GREEN, StandardColors::BLACK, Config::Display::SHOW );
+            log_i( "Peripheral mode initialized: camera=%s, brightness=%d",
+                   cameraMode ? "true" : "false", brightnessLevel );
         }
 
-        delay( GUI_PAUSE_MS );
+        // ===== One pass of the peripheral mode loop (called every tick and button release) =====
+        handleButtonB();  // Check for Button B reset
 
-        // Show power-on glyph as orange pixel on green background
-        const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
-        display->clear( Config::Display::NO_SHOW );
-        display->fill( StandardColors::GREEN, Config::Display::NO_SHOW );
-        display->drawGlyphOverlay( powerGlyph, StandardColors::ORANGE, Config::Display::NO_SHOW );
-        display->show();
+        // Settings screen is up: released before timeout adjusts brightness,
+        // still held after it changes camera/talent mode
+        if ( settingsOpen ) {
+            if ( button->isReleased() && ( modeChangeTimeout >= millis() ) ) {
+                // Use shared changeBrightness with peripheral save callback
+                brightnessLevel = startupConfig->changeBrightness( brightnessLevel,
+                [ this ]( uint8_t newBrightness ) {
+                    configManager->savePeripheralSettings( cameraMode, newBrightness );
+                } );
+                settingsOpen = false;
+            }
+            else if ( button->isPressed() && ( modeChangeTimeout < millis() ) ) {
+                // Use shared changeCameraTalentMode with peripheral save callback
+                cameraMode = startupConfig->changeCameraTalentMode( cameraMode,
+                [ this ]( bool newMode ) {
+                    configManager->savePeripheralSettings( newMode, brightnessLevel );
+                } );
+                settingsOpen = false;
+            }
 
-        // Wait for button release
-        while ( button->isPressed() ) {
-            delay( 1 );
+            if ( !settingsOpen ) {
+                // Force immediate tally state refresh by setting impossible value
+                lastTallyState = Config::Peripheral::INVALID_STATE;
+                nextCheck = 0;
+            }
+            return;     // Tally display stays paused while the settings screen is up
         }
 
-        log_i( "Peripheral mode initialized: camera=%s, brightness=%d",
-               cameraMode ? "true" : "false", brightnessLevel );
+        // Read tally state from Grove port
+        if ( millis() >= nextCheck ) {
+            nextCheck = millis() + PM_POLL_INTERVAL_MS;
 
-        // ===== Main peripheral mode loop =====
-        uint8_t lastTallyState = Config::Peripheral::INVALID_STATE;
-        unsigned long nextCheck = 0;
+            TallyState receivedState = grovePort->readTallyState();
 
-        while ( true ) {
-            // Read tally state from Grove port
-            if ( millis() >= nextCheck ) {
-                nextCheck = millis() + PM_POLL_INTERVAL_MS;
+            // Convert to numeric state for comparison
+            uint8_t currentState;
+            switch ( receivedState ) {
+                case TallyState::PROGRAM:
+                    currentState = 3;
+                    break;
+                case TallyState::PREVIEW:
+                    currentState = 2;
+                    break;
+                case TallyState::UNSELECTED:
+                    currentState = 1;
+                    break;
+                default:
+                    currentState = 0;
+                    break;
+            }
 
-                TallyState receivedState = grovePort->readTallyState();
+            // Update display if state changed
+            if ( currentState != lastTallyState ) {
+                lastTallyState = currentState;
 
-                // Convert to numeric state for comparison
-                uint8_t currentState;
                 switch ( receivedState ) {
-                    case TallyState::PROGRAM:
-                        currentState = 3;
-                        break;
-                    case TallyState::PREVIEW:
-                        currentState = 2;
+                    case TallyState::PROGRAM: {
+                        // Red (program) with orange square overlay
+                        display->fill( StandardColors::RED, Config::Display::NO_SHOW );
+                        const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
+                        display->drawGlyphOverlay( powerGlyph, StandardColors::ORANGE, Config::Display::SHOW );
                         break;
-                    case TallyState::UNSELECTED:
-                        currentState = 1;
-                        break;
-                    default:
-                        currentState = 0;
-                        break;
-                }
+                    }
 
-                // Update display if state changed
-                if ( currentState != lastTallyState ) {
-                    lastTallyState = currentState;
+                    case TallyState::PREVIEW: {
+                        // Green (preview) with orange square overlay
+                        display->fill( StandardColors::GREEN, Config::Display::NO_SHOW );
+                        const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
+                        display->drawGlyphOverlay( powerGlyph, StandardColors::ORANGE, Config::Display::SHOW );
+                        break;
+                    }
 
-                    switch ( receivedState ) {
-                        case TallyState::PROGRAM: {
-                            // Red (program) with orange square overlay
-                            display->fill( StandardColors::RED, Config::Display::NO_SHOW );
-                            const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
-                            display->drawGlyphOverlay( powerGlyph, StandardColors::ORANGE, Config::Display::SHOW );
-                            break;
+                    case TallyState::UNSELECTED: {
+                        if ( cameraMode ) {
+                            // Camera mode: Show dark frame glyph in purple with orange square
+                            const uint8_t *dfGlyph = glyphManager->getGlyph( Display::GLF_DF );
+                            display->drawGlyph( dfGlyph, StandardColors::PURPLE, StandardColors::BLACK, Config::Display::NO_SHOW );
                         }
-
-                        case TallyState::PREVIEW: {
-                            // Green (preview) with orange square overlay
+                        else {
+                            // Talent mode: Show green with orange square
                             display->fill( StandardColors::GREEN, Config::Display::NO_SHOW );
-                            const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
-                            display->drawGlyphOverlay( powerGlyph, StandardColors::ORANGE, Config::Display::SHOW );
-                            break;
                         }
+                        const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
+                        display->drawGlyphOverlay( powerGlyph, StandardColors::ORANGE, Config::Display::SHOW );
+                        break;
+                    }
 
-                        case TallyState::UNSELECTED: {
-                            if ( cameraMode ) {
-                                // Camera mode: Show dark frame glyph in purple with orange square
-                                const uint8_t *dfGlyph = glyphManager->getGlyph( Display::GLF_DF );
-                                display->drawGlyph( dfGlyph, StandardColors::PURPLE, StandardColors::BLACK, Config::Display::NO_SHOW );
-                            }
-                            else {
-                                // Talent mode: Show green with orange square
-                                display->fill( StandardColors::GREEN, Config::Display::NO_SHOW );
-                            }
+                    default: {
+                        // Error/unknown state - no orange square (ATOM behavior)
+                        if ( cameraMode ) {
+                            // Camera mode: Show orange X
+                            const uint8_t *xGlyph = glyphManager->getGlyph( Display::GLF_BX );
+                            display->drawGlyph( xGlyph, StandardColors::ORANGE, StandardColors::BLACK, Config::Display::SHOW );
+                        }
+                        else {
+                            // Talent mode: Show green with orange power pixel
+                            display->fill( StandardColors::GREEN, Config::Display::NO_SHOW );
                             const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
                             display->drawGlyphOverlay( powerGlyph, StandardColors::ORANGE, Config::Display::SHOW );
-                            break;
-                        }
-
-                        default: {
-                            // Error/unknown state - no orange square (ATOM behavior)
-                            if ( cameraMode ) {
-                                // Camera mode: Show orange X
-                                const uint8_t *xGlyph = glyphManager->getGlyph( Display::GLF_BX );
-                                display->drawGlyph( xGlyph, StandardColors::ORANGE, StandardColors::BLACK, Config::Display::SHOW );
-                            }
-                            else {
-                                // Talent mode: Show green with orange power pixel
-                                display->fill( StandardColors::GREEN, Config::Display::NO_SHOW );
-                                const uint8_t *powerGlyph = glyphManager->getGlyph( Display::GLF_PO );
-                                display->drawGlyphOverlay( powerGlyph, StandardColors::ORANGE, Config::Display::SHOW );
-                            }
-                            break;
                         }
+                        break;
                     }
                 }
             }
+        }
 
-            // Handle button for settings adjustment
-            // Button state updated by esp_timer
-            handleButtonB();  // Check for Button B reset
-
-            if ( button->pressedFor( BUTTON_SELECT_MS ) ) {
-                // User wants to change peripheral mode settings
-
-                // Show brightness selection screen
-                display->fill( StandardColors::WHITE, Config::Display::NO_SHOW );
-
-                // Blank center columns
-                const uint8_t *centerBlank = glyphManager->getGlyph( Display::GLF_EN );
-                display->drawGlyphOverlay( centerBlank, StandardColors::BLACK, Config::Display::NO_SHOW );
-
-                // Show current brightness level
-                const uint8_t *levelGlyph = glyphManager->getDigitGlyph( brightnessLevel );
-                display->drawGlyphOverlay( levelGlyph, StandardColors::ORANGE, Config::Display::SHOW );
-
-                // State machine: brightness adjustment or mode change
-                // Wait for release (brightness) or keep holding (mode change)
-                bool exitSettings = false;
-                unsigned long modeChangeTimeout = millis() + BUTTON_SELECT_MS;
-
-                do {
-                    // Button state updated by esp_timer
-                    handleButtonB();  // Check for Button B reset
+        // Handle button for settings adjustment
+        // Button state updated by esp_timer
+        if ( button->pressedFor( BUTTON_SELECT_MS ) ) {
+            // User wants to change peripheral mode settings
 
-                    // Released before timeout: Enter brightness adjustment
-                    if ( button->isReleased() && ( modeChangeTimeout >= millis() ) ) {
-                        // Use shared changeBrightness with peripheral save callback
+            // Show brightness selection screen
+            display->fill( StandardColors::WHITE, Config::Display::NO_SHOW );
 
-                        brightnessLevel = startupConfig->changeBrightness( brightnessLevel,
-                        [ this, &cameraMode ]( uint8_t newBrightness ) {
-                            configManager->savePeripheralSettings( cameraMode, newBrightness );
-                        } );
-                        exitSettings = true;
-                    }
-                    // Still pressed after timeout: Enter mode change
-                    else if ( button->isPressed() && ( modeChangeTimeout < millis() ) ) {
-                        // Use shared changeCameraTalentMode with peripheral save callback
-                        cameraMode = startupConfig->changeCameraTalentMode( cameraMode,
-                        [ this, &brightnessLevel ]( bool newMode ) {
-                            configManager->savePeripheralSettings( newMode, brightnessLevel );
-                        } );
-                        exitSettings = true;
-                    }
+            // Blank center columns
+            const uint8_t *centerBlank = glyphManager->getGlyph( Display::GLF_EN );
+            display->drawGlyphOverlay( centerBlank, StandardColors::BLACK, Config::Display::NO_SHOW );
 
-                } while ( !exitSettings );
+            // Show current brightness level
+            const uint8_t *levelGlyph = glyphManager->getDigitGlyph( brightnessLevel );
+            display->drawGlyphOverlay( levelGlyph, StandardColors::ORANGE, Config::Display::SHOW );
 
-                // Force immediate tally state refresh by setting impossible value
-                lastTallyState = Config::Peripheral::INVALID_STATE;
-                nextCheck = 0;          // Force immediate check on next loop iteration
-            }
+            // Next passes wait for release (brightness) or a longer hold (mode change)
+            settingsOpen = true;
+            modeChangeTimeout = millis() + BUTTON_SELECT_MS;
         }
     }
     #endif // HAS_PERIPHERAL_MODE_CAPABILITY
@@ -1028,6 +1374,7 @@ namespace Application {
 
         // Show GLF_CFG in appropriate color based on provisioned state
         const uint8_t *cfgGlyph = glyphManager->getGlyph( Display::GLF_CFG );
+        animator->stop();   // Restores the brightness a boot sequence animation started from
         const uint8_t normalBrightness = display->getBrightness();
 
         // Calculate dim brightness using adjacent brightness levels from the map
@@ -1050,19 +1397,30 @@ namespace Application {
         display->clear( Config::Display::SHOW );
         display->drawGlyph( cfgGlyph, provisionColor, Display::StandardColors::BLACK, Config::Display::SHOW );
 
+        // The config glyph pulses between adjacent brightness levels while the portal waits
+        Animation pulse;
+        pulse.glyph( cfgGlyph, provisionColor, StandardColors::BLACK, 0 )
+        .brightness( normalBrightness, Config::Timing::PORTAL_PULSE_MS )
+        .brightness( dimBrightness, Config::Timing::PORTAL_PULSE_MS );
+
         // For unprogrammed devices NOT from boot button, flash the config glyph before pulsing
         // (if from boot button, the boot sequence already did the flashing)
         if ( !wasProvisioned && !fromBootButton ) {
-            delay( 500 );  // Hold static glyph for 500ms
-            display->flash( 4, 250, normalBrightness );  // Flash 4 times at 250ms intervals
-            display->setBrightness( normalBrightness );  // Restore brightness after flash
+            Animation intro;
+            intro.hold( 500 )                   // Hold static glyph for 500ms
+            .flash( 4, 250, normalBrightness ); // Flash 4 times at 250ms intervals
+            animator->play( intro, millis() );
+        }
+        else {
+            animator->play( pulse, millis(), Animator::REPEAT_FOREVER );
         }
 
-        // Set up pulsing config glyph display callback using brightness modulation
-        bool pulseState = false;
-        configServer.setDisplayUpdateCallback( [ this, cfgGlyph, provisionColor, normalBrightness, dimBrightness, &pulseState ]() {
-            display->pulseDisplay( cfgGlyph, provisionColor, Display::StandardColors::BLACK,
-                                   pulseState, normalBrightness, dimBrightness );
+        // The portal's wait loop drives the animator; the pulse follows the intro flash
+        configServer.setDisplayUpdateCallback( [ this, pulse ]() {
+            unsigned long now = millis();
+            if ( !animator->update( now ) ) {
+                animator->play( pulse, now, Animator::REPEAT_FOREVER );
+            }
         } );
 
         // Set up Button B reset check callback (for M5StickC Plus)
@@ -1078,11 +1436,9 @@ namespace Application {
         } );
         #endif
 
-        // Ensure brightness is set to normal before pulsing starts
-        display->setBrightness( normalBrightness, Config::Display::NO_SHOW );
-
         // Wait for either configuration or OTA to complete
         Net::WebConfigServer::PortalResult result = configServer.waitForCompletion();
+        animator->stop();
 
         // Handle result based on type
         if ( result.type == Net::WebConfigServer::PortalResultType::OTA_SUCCESS ) {
@@ -1123,27 +1479,8 @@ namespace Application {
                 log_i( "Factory reset complete" );
             }
 
-            // Brief pause
-            delay( Config::Timing::GUI_PAUSE_MS );
-
-            // Flash display once to confirm (baseline behavior)
-            // Use brightness level 1 for the flash
-            uint8_t brightness = Config::Display::BRIGHTNESS_MAP[ 1 ];
-            display->flash( 1, 500, brightness );
-
             // Park here forever showing the factory reset glyph (matching button behavior)
-            // User must power cycle or press reset button to restart
-            while ( true ) {
-                #if defined(BUTTON_B_PIN)
-                // Button state updated by esp_timer
-                if ( buttonB->isPressed() ) {
-                    log_i( "Button B pressed after factory reset - restarting" );
-                    display->setBrightness( 0 );  // Turn off backlight before restart
-                    ESP.restart();
-                }
-                #endif
-                yield();
-            }
+            parkAfterFactoryReset();
             // Never returns
         }
         // else CONFIG_RECEIVED - continue with provisioning flow
@@ -1167,6 +1504,9 @@ namespace Application {
             return;
         }
 
+        // Fleet update server is optional; a bad URL is logged and left off
+        configManager->saveUpdateURL( provData.updateURL );
+
         // Convert IP string to IPAddress
         IPAddress switchIP;
         if ( !switchIP.fromString( provData.switchIPString ) ) {
@@ -1304,6 +1644,9 @@ namespace Application {
         // This ensures we don't count the blocking HTTP request time as part of the interval
         lastRolandPoll = millis();
 
+        // Poll failures count towards the link quality used for roaming
+        wifiManager->notePollResult( result.connected && result.gotReply );
+
         // Update switch state from query result
         switchState.connected = result.connected;
         switchState.timeout = result.timedOut;
@@ -1337,6 +1680,14 @@ namespace Application {
 
             if ( validResponse ) {
                 // ===== Valid response - update tally state =====
+                static bool bootProfileReported = false;
+                if ( !bootProfileReported ) {
+                    bootProfileReported = true;
+                    warmResume = false;     // Back to normal WiFi status feedback
+                    Utils::BootProfiler::mark( Utils::BootPhase::FIRST_TALLY );
+                    Utils::BootProfiler::printReport();
+                }
+
                 rolandPollInterval = ops.statusPollInterval;  // Use normal poll interval
                 switchState.junkReply = false;
                 switchState.junkReplyCount = 0;  // Clear error counters
@@ -1500,26 +1851,32 @@ namespace Application {
 
         log_i( "Factory reset complete" );
 
-        // Brief pause
-        delay( Config::Timing::GUI_PAUSE_MS );
+        parkAfterFactoryReset();
+    }
 
-        // Flash display once to confirm (baseline behavior)
+    void STACApp::parkAfterFactoryReset() {
+        // Brief pause, then flash display once to confirm (baseline behavior)
         // Use brightness level 1 for the flash
-        uint8_t brightness = Config::Display::BRIGHTNESS_MAP[ 1 ];
-        display->flash( 1, 500, brightness );
+        Display::Animation confirm;
+        confirm.hold( Config::Timing::GUI_PAUSE_MS )
+        .flash( 1, 500, Config::Display::BRIGHTNESS_MAP[ 1 ] );
+        animator->play( confirm, millis() );
 
         // Park here forever showing the factory reset glyph (baseline behavior)
         // User must power cycle or press reset button to restart
         while ( true ) {
+            animator->update( millis() );
+
             #if defined(BUTTON_B_PIN)
             // Button state updated by esp_timer
             if ( buttonB->isPressed() ) {
                 log_i( "Button B pressed after factory reset - restarting" );
+                animator->stop();
                 display->setBrightness( 0 );  // Turn off backlight before restart
                 ESP.restart();
             }
             #endif
-            yield();
+            delay( 1 );
         }
     }
 
@@ -1532,12 +1889,11 @@ namespace Application {
 
     void STACApp::showConfirmationCheckmark() {
         // Clear display, show green checkmark, pause, then clear
-        display->clear( Config::Display::SHOW );
-        // delay( Config::Timing::GUI_PAUSE_MS );
         const uint8_t *checkGlyph = glyphManager->getGlyph( Display::GLF_CK );
-        display->drawGlyph( checkGlyph, Display::StandardColors::GREEN, Display::StandardColors::BLACK, Config::Display::SHOW );
-        delay( Config::Timing::GUI_PAUSE_MS );
-        display->clear( Config::Display::SHOW );
+        Display::Animation checkmark;
+        checkmark.glyph( checkGlyph, Display::StandardColors::GREEN, Display::StandardColors::BLACK, Config::Timing::GUI_PAUSE_MS )
+        .fill( Display::StandardColors::BLACK, 0 );
+        animator->play( checkmark, millis() );
     }
 
     OperatingMode STACApp::checkBootButtonSequence() {
@@ -1589,7 +1945,6 @@ namespace Application {
         BootButtonState state = BootButtonState::PROVISIONING_PENDING;
         #endif
 
-        unsigned long stateArmTime = millis() + STATE_HOLD_TIME;
         bool sequenceExit = false;
         OperatingMode resultMode = OperatingMode::NORMAL;
 
@@ -1604,8 +1959,20 @@ namespace Application {
         const uint8_t *nGlyph = glyphManager->getGlyph( Display::GLF_N );
         #endif
 
+        // Each state is announced by its static glyph for 500ms (0.5 * rate), then
+        // 4 flashes OFF/ON at 250ms intervals. The animator plays it while the
+        // state machine keeps watching the button.
+        // Returns the animation length so the next state arms after it finishes.
+        auto playArmedAnimation = [ this, nvsBrightness ]( const uint8_t *glyph, Display::color_t color ) -> unsigned long {
+            Animation armed;
+            armed.glyph( glyph, color, Display::StandardColors::BLACK, 500 )
+            .flash( 4, 250, nvsBrightness );
+            animator->play( armed, millis() );
+            return armed.durationMs();
+        };
+
         // Show initial glyph based on starting state
-        // Display static glyph for 500ms, then flash 4 times (rate=500ms, interval=250ms)
+        unsigned long initialAnimationMs;
         #if HAS_PERIPHERAL_MODE_CAPABILITY
         // PMode capable: Show P or N glyph
         // - If PMode disabled: Show [P] in GREEN (entering P mode - always works)
@@ -1616,30 +1983,25 @@ namespace Application {
             Display::color_t nColor = isProvisioned
                                       ? Display::StandardColors::GREEN  // Configured: ready for Normal
                                       : Display::StandardColors::RED;   // Not configured: warning
-            display->drawGlyph( nGlyph, nColor, Display::StandardColors::BLACK, Config::Display::SHOW );
-            delay( 500 );  // Static glyph visible for 500ms (0.5 * rate)
-            display->flash( 4, 250, nvsBrightness );  // Flash 4 times: OFF/ON at 250ms intervals
-            display->setBrightness( nvsBrightness );  // Restore brightness after flash
+            initialAnimationMs = playArmedAnimation( nGlyph, nColor );
         }
         else {
             // Entering P mode - always GREEN (P mode works without configuration)
-            display->drawGlyph( pGlyph, Display::StandardColors::GREEN, Display::StandardColors::BLACK, Config::Display::SHOW );
-            delay( 500 );  // Static glyph visible for 500ms (0.5 * rate)
-            display->flash( 4, 250, nvsBrightness );  // Flash 4 times: OFF/ON at 250ms intervals
-            display->setBrightness( nvsBrightness );  // Restore brightness after flash
+            initialAnimationMs = playArmedAnimation( pGlyph, Display::StandardColors::GREEN );
         }
         #else
         // No PMode capability: Show provisioning glyph based on provisioned state
         auto color = isProvisioned ? Display::StandardColors::ORANGE : Display::StandardColors::RED;
-        display->drawGlyph( cfgGlyph, color, Display::StandardColors::BLACK, Config::Display::SHOW );
-        delay( 500 );  // Static glyph visible for 500ms (0.5 * rate)
-        display->flash( 4, 250, nvsBrightness );  // Flash 4 times: OFF/ON at 250ms intervals
-        display->setBrightness( nvsBrightness );  // Restore brightness after flash
+        initialAnimationMs = playArmedAnimation( cfgGlyph, color );
         #endif
 
+        // The first state arms once both the hold time and the announcement have elapsed
+        unsigned long stateArmTime = millis() + max( STATE_HOLD_TIME, initialAnimationMs );
+
         // Button state machine loop
         while ( !sequenceExit ) {
             // Button state updated by esp_timer
+            animator->update( millis() );
 
             switch ( state ) {
                     #if HAS_PERIPHERAL_MODE_CAPABILITY
@@ -1651,6 +2013,7 @@ namespace Application {
                         log_i( "Boot button sequence: PMODE toggled to %s", newPModeState ? "ENABLED" : "DISABLED" );
 
                         // Show confirmation checkmark (stays visible until restart)
+                        animator->stop();
                         display->clear( Config::Display::NO_SHOW );
                         const uint8_t *checkGlyph = glyphManager->getGlyph( Display::GLF_CK );
                         display->drawGlyph( checkGlyph, Display::StandardColors::GREEN, Display::StandardColors::BLACK, Config::Display::NO_SHOW );
@@ -1667,13 +2030,10 @@ namespace Application {
                         // Show provisioning glyph (gear icon)
                         // Use ORANGE if provisioned, RED if not
                         auto color = isProvisioned ? Display::StandardColors::ORANGE : Display::StandardColors::RED;
-                        display->drawGlyph( cfgGlyph, color, Display::StandardColors::BLACK, Config::Display::SHOW );
-                        delay( 500 );  // Static glyph visible for 500ms
-                        display->flash( 4, 250, nvsBrightness );  // Flash to indicate state armed
-                        display->setBrightness( nvsBrightness );  // Restore brightness
+                        unsigned long animationMs = playArmedAnimation( cfgGlyph, color );  // Flash to indicate state armed
 
                         state = BootButtonState::PROVISIONING_PENDING;
-                        stateArmTime = millis() + STATE_HOLD_TIME;
+                        stateArmTime = millis() + animationMs + STATE_HOLD_TIME;
                     }
                     break;
                     #endif
@@ -1682,6 +2042,7 @@ namespace Application {
                     if ( !button->isPressed() ) {
                         // Released - enter unified portal mode
                         log_i( "Boot button sequence: UNIFIED PORTAL selected (provisioning/OTA)" );
+                        animator->stop();
                         resultMode = OperatingMode::PROVISIONING;
                         sequenceExit = true;
                     }
@@ -1694,13 +2055,10 @@ namespace Application {
 
                             // GLF_FR (factory reset icon) in red
                             const uint8_t *frGlyph = glyphManager->getGlyph( Display::GLF_FR );
-                            display->drawGlyph( frGlyph, Display::StandardColors::RED, Display::StandardColors::BLACK, Config::Display::SHOW );
-                            delay( 500 );  // Static glyph visible for 500ms
-                            display->flash( 4, 250, nvsBrightness );  // Flash to indicate state armed
-                            display->setBrightness( nvsBrightness );  // Restore brightness
+                            unsigned long animationMs = playArmedAnimation( frGlyph, Display::StandardColors::RED );  // Flash to indicate state armed
 
                             state = BootButtonState::FACTORY_RESET_PENDING;
-                            stateArmTime = millis() + STATE_HOLD_TIME;
+                            stateArmTime = millis() + animationMs + STATE_HOLD_TIME;
                         }
                         else {
                             // Device not provisioned - stay in provisioning state showing red glyph
@@ -1714,6 +2072,7 @@ namespace Application {
                     if ( !button->isPressed() ) {
                         // Released - perform factory reset
                         log_i( "Boot button sequence: FACTORY RESET selected" );
+                        animator->stop();
                         handleFactoryReset();
                         // Never returns - ESP32 restarts
                     }
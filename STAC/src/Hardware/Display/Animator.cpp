@@ -0,0 +1,191 @@
+#include "Hardware/Display/Animator.h"
+#include "Config/Constants.h"
+#include <Arduino.h>
+
+
+namespace Display {
+
+    // ========================================================================
+    // ANIMATION (KEYFRAME SEQUENCE)
+    // ========================================================================
+
+    Animation::Animation()
+        : count( 0 ) {
+    }
+
+    bool Animation::add( const Keyframe &frame ) {
+        if ( count >= MAX_KEYFRAMES ) {
+            log_e( "Animation full - keyframe dropped (max %d)", MAX_KEYFRAMES );
+            return false;
+        }
+        frames[ count++ ] = frame;
+        return true;
+    }
+
+    Animation &Animation::glyph( const uint8_t* glyph, color_t foreground, color_t background, uint16_t durationMs ) {
+        add( { KeyframeAction::GLYPH, glyph, foreground, background, Keyframe::KEEP_BRIGHTNESS, durationMs } );
+        return *this;
+    }
+
+    Animation &Animation::overlay( const uint8_t* glyph, color_t color, uint16_t durationMs ) {
+        add( { KeyframeAction::OVERLAY, glyph, color, StandardColors::BLACK, Keyframe::KEEP_BRIGHTNESS, durationMs } );
+        return *this;
+    }
+
+    Animation &Animation::fill( color_t color, uint16_t durationMs ) {
+        add( { KeyframeAction::FILL, nullptr, color, color, Keyframe::KEEP_BRIGHTNESS, durationMs } );
+        return *this;
+    }
+
+    Animation &Animation::corners( const uint8_t* cornersGlyph, bool state, color_t color, uint16_t durationMs ) {
+        KeyframeAction action = state ? KeyframeAction::CORNERS_ON : KeyframeAction::CORNERS_OFF;
+        add( { action, cornersGlyph, color, StandardColors::BLACK, Keyframe::KEEP_BRIGHTNESS, durationMs } );
+        return *this;
+    }
+
+    Animation &Animation::brightness( uint8_t brightness, uint16_t durationMs ) {
+        add( { KeyframeAction::HOLD, nullptr, StandardColors::BLACK, StandardColors::BLACK, brightness, durationMs } );
+        return *this;
+    }
+
+    Animation &Animation::hold( uint16_t durationMs ) {
+        add( { KeyframeAction::HOLD, nullptr, StandardColors::BLACK, StandardColors::BLACK, Keyframe::KEEP_BRIGHTNESS, durationMs } );
+        return *this;
+    }
+
+    Animation &Animation::flash( uint8_t times, uint16_t interval, uint8_t brightness ) {
+        for ( uint8_t i = 0; i < times; i++ ) {
+            this->brightness( 0, interval );            // OFF: Remove content
+            this->brightness( brightness, interval );   // ON: Return content
+        }
+        return *this;
+    }
+
+    uint32_t Animation::durationMs() const {
+        uint32_t total = 0;
+        for ( uint8_t i = 0; i < count; i++ ) {
+            total += frames[ i ].durationMs;
+        }
+        return total;
+    }
+
+    // ========================================================================
+    // ANIMATOR (PLAYER)
+    // ========================================================================
+
+    Animator::Animator( IDisplay* display )
+        : display( display )
+        , repeats( 1 )
+        , pass( 0 )
+        , index( 0 )
+        , nextFrameMs( 0 )
+        , startBrightness( 0 )
+        , running( false ) {
+    }
+
+    void Animator::play( const Animation &animation, unsigned long nowMs, uint8_t repeats ) {
+        if ( display == nullptr || animation.size() == 0 ) {
+            running = false;
+            return;
+        }
+
+        // A zero-length sequence repeated forever would never yield
+        if ( repeats == REPEAT_FOREVER && animation.durationMs() == 0 ) {
+            log_w( "Zero-length animation cannot repeat forever - playing once" );
+            repeats = 1;
+        }
+
+        this->animation = animation;
+        this->repeats = repeats;
+        pass = 0;
+        index = 0;
+        nextFrameMs = nowMs;
+        startBrightness = display->getBrightness();
+        running = true;
+
+        update( nowMs );
+    }
+
+    void Animator::stop() {
+        if ( !running ) {
+            return;
+        }
+        running = false;
+
+        if ( display->getBrightness() != startBrightness ) {
+            display->setBrightness( startBrightness, Config::Display::NO_SHOW );
+        }
+    }
+
+    bool Animator::update( unsigned long nowMs ) {
+        if ( !running ) {
+            return false;
+        }
+
+        bool needsShow = false;
+
+        // Apply every keyframe whose start time has been reached
+        while ( static_cast<long>( nowMs - nextFrameMs ) >= 0 ) {
+            if ( index >= animation.size() ) {
+                // End of a pass - the last keyframe's hold time has elapsed
+                index = 0;
+                if ( repeats != REPEAT_FOREVER && ++pass >= repeats ) {
+                    running = false;
+                    break;
+                }
+            }
+
+            const Keyframe &frame = animation[ index++ ];
+            needsShow |= applyFrame( frame );
+            nextFrameMs += frame.durationMs;
+        }
+
+        if ( needsShow ) {
+            display->show();
+        }
+
+        return running;
+    }
+
+    bool Animator::applyFrame( const Keyframe &frame ) {
+        bool needsShow = false;
+
+        switch ( frame.action ) {
+            case KeyframeAction::GLYPH:
+                display->drawGlyph( frame.glyph, frame.foreground, frame.background, Config::Display::NO_SHOW );
+                needsShow = true;
+                break;
+
+            case KeyframeAction::OVERLAY:
+                display->drawGlyphOverlay( frame.glyph, frame.foreground, Config::Display::NO_SHOW );
+                needsShow = true;
+                break;
+
+            case KeyframeAction::FILL:
+                display->fill( frame.foreground, Config::Display::NO_SHOW );
+                needsShow = true;
+                break;
+
+            case KeyframeAction::CORNERS_ON:
+            case KeyframeAction::CORNERS_OFF:
+                // pulseCorners updates the panel itself (TFT landscape draws
+                // straight to the panel, so a canvas flush would erase it)
+                display->pulseCorners( frame.glyph, frame.action == KeyframeAction::CORNERS_ON, frame.foreground );
+                break;
+
+            case KeyframeAction::HOLD:
+                break;
+        }
+
+        if ( frame.brightness != Keyframe::KEEP_BRIGHTNESS ) {
+            display->setBrightness( static_cast<uint8_t>( frame.brightness ), Config::Display::NO_SHOW );
+            needsShow = true;
+        }
+
+        return needsShow;
+    }
+
+} // namespace Display
+
+
+//  --- EOF --- //
@@ -1,13 +1,29 @@
 #include "Hardware/Display/DisplayBase.h"
+#include <esp_timer.h>
+#include <cstring>
 
 
 namespace Display {
 
     DisplayBase::DisplayBase( uint8_t pin, uint8_t numLeds, uint8_t ledType )
-        : display( static_cast<led_strip_type_t>( ledType ), 0 )
+        // A WS2812 (GRB) strip is driven as its RGB-order variant, so LiteLED
+        // clocks out the GRB bytes from ColorTable as they are. Other strip
+        // types get RGB rows and LiteLED keeps ordering them itself.
+        : display( ledType == LED_STRIP_WS2812 ? LED_STRIP_WS2812_RGB : static_cast<led_strip_type_t>( ledType ), 0 )
         , pin( pin )
         , numLeds( numLeds )
-        , currentBrightness( 20 ) {
+        , currentBrightness( 20 )
+        , order( ledType == LED_STRIP_WS2812 ? WireOrder::GRB : WireOrder::RGB )
+        , levelRow( nullptr )
+        , sentBrightness( 0 )
+        , sentValid( false )
+        , transferDoneAtUs( 0 ) {
+        if ( this->numLeds > MAX_LEDS ) {
+            log_e( "LED count %d exceeds maximum of %d", numLeds, MAX_LEDS );
+            this->numLeds = MAX_LEDS;
+        }
+        memset( frame, 0, sizeof( frame ) );
+        memset( sentFrame, 0, sizeof( sentFrame ) );
     }
 
     bool DisplayBase::begin() {
@@ -16,6 +32,9 @@ namespace Display {
             return false;
         }
 
+        // Brightness is applied from ColorTable, so the driver runs at full brightness
+        display.brightness( 255, false );
+
         clear( false );
         setBrightness( currentBrightness, false );
         show();
@@ -25,7 +44,11 @@ namespace Display {
     }
 
     void DisplayBase::clear( bool show ) {
-        display.clear( show );
+        memset( frame, 0, sizeof( frame ) );
+
+        if ( show ) {
+            this->show();
+        }
     }
 
     void DisplayBase::setPixel( uint8_t position, color_t color, bool show ) {
@@ -34,7 +57,11 @@ namespace Display {
             return;
         }
 
-        display.setPixel( position, color, show );
+        writePixel( position, color );
+
+        if ( show ) {
+            this->show();
+        }
     }
 
     void DisplayBase::setPixelXY( uint8_t x, uint8_t y, color_t color, bool show ) {
@@ -44,7 +71,7 @@ namespace Display {
 
     void DisplayBase::fill( color_t color, bool show ) {
         for ( uint8_t i = 0; i < numLeds; i++ ) {
-            display.setPixel( i, color, false );
+            writePixel( i, color );
         }
 
         if ( show ) {
@@ -61,7 +88,7 @@ namespace Display {
         // Draw glyph (unpacked format: 1 byte per pixel)
         for ( uint8_t i = 0; i < numLeds; i++ ) {
             color_t color = ( glyph[ i ] != 0 ) ? foreground : background;
-            display.setPixel( i, color, false );
+            writePixel( i, color );
         }
 
         if ( show ) {
@@ -71,7 +98,11 @@ namespace Display {
 
     void DisplayBase::setBrightness( uint8_t brightness, bool show ) {
         currentBrightness = brightness;
-        display.brightness( brightness, show );
+        levelRow = ColorTable::wireRow( brightness, order );
+
+        if ( show ) {
+            this->show();
+        }
     }
 
     uint8_t DisplayBase::getBrightness() const {
@@ -79,10 +110,65 @@ namespace Display {
     }
 
     void DisplayBase::show() {
+        stats.showRequests++;
+
+        // Nothing to do if the strip already shows exactly this frame
+        if ( sentValid && sentBrightness == currentBrightness &&
+                memcmp( frame, sentFrame, numLeds * sizeof( color_t ) ) == 0 ) {
+            stats.framesSkipped++;
+            return;
+        }
+
+        // Only block if the previous frame is still clocking out
+        if ( waitForTransfer() ) {
+            stats.framesCoalesced++;
+        }
+
+        loadWireFrame();
         display.show();
-        // Flush time depends on number of LEDs
-        // ~0.3ms per LED @ 800kHz, plus some overhead
-        delayMicroseconds( numLeds * 320 );
+
+        memcpy( sentFrame, frame, numLeds * sizeof( color_t ) );
+        sentBrightness = currentBrightness;
+        sentValid = true;
+        transferDoneAtUs = esp_timer_get_time() + ( numLeds * LED_WIRE_US_PER_LED ) + LED_LATCH_US;
+        stats.framesSent++;
+    }
+
+    bool DisplayBase::isTransferComplete() const {
+        return esp_timer_get_time() >= transferDoneAtUs;
+    }
+
+    bool DisplayBase::waitForTransfer() {
+        int64_t remaining = transferDoneAtUs - esp_timer_get_time();
+        if ( remaining <= 0 ) {
+            return false;
+        }
+        delayMicroseconds( static_cast<uint32_t>( remaining ) );
+        return true;
+    }
+
+    void DisplayBase::writePixel( uint8_t position, color_t color ) {
+        frame[ position ] = color;
+    }
+
+    void DisplayBase::loadWireFrame() {
+        // Frames are mostly runs of one or two colours, so remember the last lookup
+        color_t lastColor = frame[ 0 ] ^ 1;
+        uint32_t lastWire = 0;
+
+        for ( uint8_t i = 0; i < numLeds; i++ ) {
+            color_t color = frame[ i ];
+            if ( color != lastColor ) {
+                int8_t index = levelRow ? ColorTable::paletteIndex( color ) : -1;
+                lastWire = ( index >= 0 ) ? levelRow[ index ] : toWire( color, currentBrightness, order );
+                lastColor = color;
+            }
+            display.setPixel( i, lastWire, false );
+        }
+    }
+
+    DisplayStats DisplayBase::getStats() const {
+        return stats;
     }
 
     void DisplayBase::flash( uint8_t times, uint16_t interval, uint8_t brightness ) {
@@ -109,7 +195,7 @@ namespace Display {
         // Overlay glyph: only draw pixels where glyph[i] == 1
         for ( uint8_t i = 0; i < numLeds; i++ ) {
             if ( glyph[ i ] == 1 ) {
-                display.setPixel( i, color, false );
+                writePixel( i, color );
             }
         }
 
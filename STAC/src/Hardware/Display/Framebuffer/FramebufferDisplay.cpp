@@ -0,0 +1,266 @@
+#include "Hardware/Display/Framebuffer/FramebufferDisplay.h"
+
+
+namespace Display {
+
+    FramebufferDisplay::FramebufferDisplay( uint16_t width, uint16_t height )
+        : width( width )
+        , height( height )
+        , matrixGeometry( static_cast<uint32_t>( width ) * height <= MAX_MATRIX_PIXELS )
+        , backBuffer( static_cast<size_t>( width ) * height, StandardColors::BLACK )
+        , frontBuffer( static_cast<size_t>( width ) * height, StandardColors::BLACK )
+        , brightness( 20 )
+        , shownBrightness( 20 )
+        , lastGlyphIndex( 0xFF ) {
+    }
+
+    std::unique_ptr<FramebufferDisplay> FramebufferDisplay::createForBoard() {
+        #if defined(DISPLAY_TYPE_TFT)
+        return std::unique_ptr<FramebufferDisplay>( new FramebufferDisplay( DISPLAY_WIDTH, DISPLAY_HEIGHT ) );
+        #else
+        return std::unique_ptr<FramebufferDisplay>( new FramebufferDisplay( DISPLAY_MATRIX_WIDTH, DISPLAY_MATRIX_HEIGHT ) );
+        #endif
+    }
+
+    bool FramebufferDisplay::begin() {
+        clear( false );
+        show();
+        return true;
+    }
+
+    void FramebufferDisplay::clear( bool show ) {
+        fill( StandardColors::BLACK, show );
+    }
+
+    void FramebufferDisplay::setPixel( uint8_t position, color_t color, bool show ) {
+        counters.drawCalls++;
+        if ( position < backBuffer.size() ) {
+            writePixel( position, color );
+        }
+        if ( show ) {
+            this->show();
+        }
+    }
+
+    void FramebufferDisplay::setPixelXY( uint8_t x, uint8_t y, color_t color, bool show ) {
+        counters.drawCalls++;
+        if ( x < width && y < height ) {
+            writePixel( static_cast<uint32_t>( y ) * width + x, color );
+        }
+        if ( show ) {
+            this->show();
+        }
+    }
+
+    void FramebufferDisplay::fill( color_t color, bool show ) {
+        counters.drawCalls++;
+        fillRect( 0, 0, width, height, color );
+        if ( show ) {
+            this->show();
+        }
+    }
+
+    void FramebufferDisplay::drawGlyph( const uint8_t* glyph, color_t foreground, color_t background, bool show ) {
+        counters.drawCalls++;
+        if ( glyph == nullptr ) {
+            return;
+        }
+
+        if ( matrixGeometry ) {
+            // Unpacked format: 1 byte per pixel
+            for ( uint32_t i = 0; i < backBuffer.size(); i++ ) {
+                writePixel( i, ( glyph[ i ] != 0 ) ? foreground : background );
+            }
+        }
+        else {
+            // Index stub: background plus a block standing in for the glyph artwork
+            lastGlyphIndex = glyph[ 0 ];
+            fillRect( 0, 0, width, height, background );
+            fillCentredSquare( ( width < height ? width : height ) / 2, foreground );
+        }
+
+        if ( show ) {
+            this->show();
+        }
+    }
+
+    void FramebufferDisplay::setBrightness( uint8_t brightness, bool show ) {
+        this->brightness = brightness;
+        if ( show ) {
+            this->show();
+        }
+    }
+
+    uint8_t FramebufferDisplay::getBrightness() const {
+        return brightness;
+    }
+
+    void FramebufferDisplay::show() {
+        counters.showCalls++;
+        stats.showRequests++;
+        frontBuffer = backBuffer;
+        shownBrightness = brightness;
+        stats.framesSent++;
+    }
+
+    void FramebufferDisplay::flash( uint8_t times, uint16_t interval, uint8_t brightness ) {
+        // No clock here: run the OFF/ON cycles back to back so frame counts
+        // match the hardware implementations
+        ( void )interval;
+        for ( uint8_t i = 0; i < times; i++ ) {
+            setBrightness( 0, true );
+            setBrightness( brightness, true );
+        }
+    }
+
+    void FramebufferDisplay::drawGlyphOverlay( const uint8_t* glyph, color_t color, bool show ) {
+        counters.drawCalls++;
+        if ( glyph == nullptr ) {
+            return;
+        }
+
+        if ( matrixGeometry ) {
+            // Only pixels where glyph[i] == 1 are modified
+            for ( uint32_t i = 0; i < backBuffer.size(); i++ ) {
+                if ( glyph[ i ] == 1 ) {
+                    writePixel( i, color );
+                }
+            }
+        }
+        else {
+            // Same footprint as the TFT power/dot overlay: 12% of the short side, odd, >= 12 px
+            uint16_t size = ( width < height ? width : height ) * 12 / 100;
+            if ( size < 12 ) {
+                size = 12;
+            }
+            size |= 1;
+            fillCentredSquare( size, color );
+        }
+
+        if ( show ) {
+            this->show();
+        }
+    }
+
+    void FramebufferDisplay::pulseCorners( const uint8_t* cornersGlyph, bool state, color_t color ) {
+        color_t cornerColor = state ? color : StandardColors::BLACK;
+
+        if ( matrixGeometry ) {
+            drawGlyphOverlay( cornersGlyph, cornerColor, true );
+            return;
+        }
+
+        // TFT corner indicators are 15 px squares
+        counters.drawCalls++;
+        const uint16_t cornerSize = 15;
+        fillRect( 0, 0, cornerSize, cornerSize, cornerColor );
+        fillRect( width - cornerSize, 0, cornerSize, cornerSize, cornerColor );
+        fillRect( 0, height - cornerSize, cornerSize, cornerSize, cornerColor );
+        fillRect( width - cornerSize, height - cornerSize, cornerSize, cornerSize, cornerColor );
+        show();
+    }
+
+    void FramebufferDisplay::pulseDisplay( const uint8_t* glyph, color_t foreground, color_t background,
+                                           bool& pulseState, uint8_t normalBrightness, uint8_t dimBrightness ) {
+        pulseState = !pulseState;
+        setBrightness( pulseState ? normalBrightness : dimBrightness, false );
+        drawGlyph( glyph, foreground, background, true );
+    }
+
+    uint8_t FramebufferDisplay::getWidth() const {
+        return static_cast<uint8_t>( width );
+    }
+
+    uint8_t FramebufferDisplay::getHeight() const {
+        return static_cast<uint8_t>( height );
+    }
+
+    uint8_t FramebufferDisplay::getPixelCount() const {
+        // Same convention as DisplayTFT: TFT pixel counts don't fit in uint8_t
+        return matrixGeometry ? static_cast<uint8_t>( width * height ) : 255;
+    }
+
+    DisplayStats FramebufferDisplay::getStats() const {
+        return stats;
+    }
+
+    color_t FramebufferDisplay::getShownPixel( uint16_t x, uint16_t y ) const {
+        if ( x >= width || y >= height ) {
+            return StandardColors::BLACK;
+        }
+        return frontBuffer[ static_cast<uint32_t>( y ) * width + x ];
+    }
+
+    void FramebufferDisplay::resetCounters() {
+        counters = RenderCounters();
+        stats = DisplayStats();
+    }
+
+    bool FramebufferDisplay::dumpPPM( FILE* file, uint8_t scale ) const {
+        if ( file == nullptr || scale == 0 ) {
+            return false;
+        }
+
+        uint32_t outWidth = static_cast<uint32_t>( width ) * scale;
+        uint32_t outHeight = static_cast<uint32_t>( height ) * scale;
+        if ( fprintf( file, "P6\n%lu %lu\n255\n",
+                      static_cast<unsigned long>( outWidth ), static_cast<unsigned long>( outHeight ) ) < 0 ) {
+            return false;
+        }
+
+        std::vector<uint8_t> row( outWidth * 3 );
+        for ( uint16_t y = 0; y < height; y++ ) {
+            for ( uint16_t x = 0; x < width; x++ ) {
+                color_t color = frontBuffer[ static_cast<uint32_t>( y ) * width + x ];
+                for ( uint8_t s = 0; s < scale; s++ ) {
+                    uint32_t offset = ( static_cast<uint32_t>( x ) * scale + s ) * 3;
+                    row[ offset ] = ( color >> 16 ) & 0xFF;
+                    row[ offset + 1 ] = ( color >> 8 ) & 0xFF;
+                    row[ offset + 2 ] = color & 0xFF;
+                }
+            }
+            for ( uint8_t s = 0; s < scale; s++ ) {
+                if ( fwrite( row.data(), 1, row.size(), file ) != row.size() ) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool FramebufferDisplay::dumpPPM( const char* path, uint8_t scale ) const {
+        FILE* file = fopen( path, "wb" );
+        if ( file == nullptr ) {
+            return false;
+        }
+        bool ok = dumpPPM( file, scale );
+        return ( fclose( file ) == 0 ) && ok;
+    }
+
+    void FramebufferDisplay::writePixel( uint32_t index, color_t color ) {
+        backBuffer[ index ] = color;
+        counters.pixelsWritten++;
+    }
+
+    void FramebufferDisplay::fillRect( uint16_t x, uint16_t y, uint16_t w, uint16_t h, color_t color ) {
+        for ( uint16_t row = y; row < y + h && row < height; row++ ) {
+            for ( uint16_t col = x; col < x + w && col < width; col++ ) {
+                writePixel( static_cast<uint32_t>( row ) * width + col, color );
+            }
+        }
+    }
+
+    void FramebufferDisplay::fillCentredSquare( uint16_t size, color_t color ) {
+        if ( size > width ) {
+            size = width;
+        }
+        if ( size > height ) {
+            size = height;
+        }
+        fillRect( ( width - size ) / 2, ( height - size ) / 2, size, size, color );
+    }
+
+} // namespace Display
+
+
+//  --- EOF --- //
@@ -13,6 +13,17 @@
 // Includes digits for brightness display - no separate font needed
 #include "Hardware/Display/TFT/STACSansBold24pt7b.h"
 
+// Digits and the gear/WiFi icons come from a pre-rasterised, anti-aliased atlas
+// generated by scripts/build_glyph_atlas.py. Set TFT_GLYPH_ATLAS=0 to draw them
+// with the GFX font and primitives instead.
+#ifndef TFT_GLYPH_ATLAS
+    #define TFT_GLYPH_ATLAS 1
+#endif
+
+#if TFT_GLYPH_ATLAS
+    #include "Hardware/Display/TFT/GlyphAtlasTFT.h"
+#endif
+
 // Backlight control method selection based on board config
 #if defined(DISPLAY_BACKLIGHT_PMU)
     #define USE_AXP192_PMU
@@ -42,7 +53,8 @@ namespace Display {
         , _width( width )
         , _height( height )
         , _brightness( 128 )
-        , _rotation( TFT_DEFAULT_ROTATION ) {
+        , _rotation( TFT_DEFAULT_ROTATION )
+        , _rgb565Row( ColorTable::rgb565Row( 128 ) ) {
     }
 
     DisplayTFT::~DisplayTFT() {
@@ -114,14 +126,10 @@ namespace Display {
         log_i( "Creating canvas: %dx%d to match display rotation %d",
                canvas_w, canvas_h, _rotation );
 
-        _canvas = new Arduino_Canvas( canvas_w, canvas_h, _gfx, 0, 0, 0 );
-        if ( !_canvas ) {
+        if ( !createCanvas() ) {
             return false;
         }
 
-        // Begin canvas
-        _canvas->begin();
-
         // Clear canvas and push to display (backlight is still OFF at this point)
         clear( true );
 
@@ -136,12 +144,7 @@ namespace Display {
     }
 
     void DisplayTFT::clear( bool doShow ) {
-        if ( _canvas ) {
-            _canvas->fillScreen( 0x0000 ); // 0x0000
-            if ( doShow ) {
-                show();
-            }
-        }
+        fill( StandardColors::BLACK, doShow );
     }
 
     void DisplayTFT::setPixel( uint8_t position, color_t color, bool doShow ) {
@@ -155,6 +158,7 @@ namespace Display {
 
     void DisplayTFT::setPixelXY( uint8_t x, uint8_t y, color_t color, bool doShow ) {
         if ( _canvas && x < _canvas->width() && y < _canvas->height() ) {
+            materializeSolidFrame();
             _canvas->drawPixel( x, y, colorToRGB565( color ) );
             if ( doShow ) {
                 show();
@@ -164,7 +168,11 @@ namespace Display {
 
     void DisplayTFT::fill( color_t color, bool doShow ) {
         if ( _canvas ) {
-            _canvas->fillScreen( colorToRGB565( color ) );
+            // Recorded only - show() fills the panel directly, bypassing the canvas
+            _solid.active = true;
+            _solid.dirty = true;
+            _solid.hasOverlay = false;
+            _solid.fill = colorToRGB565( color );
             if ( doShow ) {
                 show();
             }
@@ -184,8 +192,9 @@ namespace Display {
                glyphIndex, foreground, background,
                _canvas->width(), _canvas->height(), _gfx->width(), _gfx->height() );
 
-        // Fill background first
-        fill( background, false );
+        // Fill background first (glyphs are drawn on the canvas, replacing any solid frame)
+        _solid.active = false;
+        _canvas->fillScreen( colorToRGB565( background ) );
 
         // Center coordinates for icon drawing (use sprite dimensions)
         int16_t cx = _canvas->width() / 2;
@@ -208,11 +217,11 @@ namespace Display {
                 return;  // drawLargeDigit calls show()
 
             case Display::GLF_WIFI:
-                drawWiFiIcon( cx, cy, foreground, true );
+                drawWiFiIcon( cx, cy, foreground, true, background );
                 break;
 
             case Display::GLF_CFG:
-                drawConfigIcon( cx, cy, foreground );
+                drawConfigIcon( cx, cy, foreground, background );
                 break;
 
             case Display::GLF_UD:
@@ -445,6 +454,7 @@ namespace Display {
         log_i( "setBrightness: %d", brightness );
         if ( brightness != _brightness ) {
             _brightness = brightness;
+            _rgb565Row = ColorTable::rgb565Row( brightness );
             updateBacklight();
         }
         if ( doShow ) {
@@ -457,15 +467,32 @@ namespace Display {
     }
 
     void DisplayTFT::show() {
-        if ( _canvas ) {
-            static int flushCount = 0;
-            flushCount++;
+        _stats.showRequests++;
 
-            uint16_t w = _canvas->width();
-            uint16_t h = _canvas->height();
+        if ( _solid.active ) {
+            if ( !_solid.dirty ) {
+                // Panel already shows this frame (e.g. brightness-only change)
+                _stats.framesSkipped++;
+                return;
+            }
+
+            uint32_t startUs = micros();
+            pushSolidFrame();
+            _solid.dirty = false;
+            _stats.framesSent++;
+
+            log_v( "Solid frame: %lu us", static_cast<unsigned long>( micros() - startUs ) );
+            return;
+        }
+
+        if ( _canvas ) {
+            uint32_t startUs = micros();
 
             // Flush canvas to display
             _canvas->flush();
+            _stats.framesSent++;
+
+            log_v( "Canvas flush: %lu us", static_cast<unsigned long>( micros() - startUs ) );
         }
     }
 
@@ -520,7 +547,9 @@ namespace Display {
                 int16_t boxW = blockSize * 2;
                 int16_t boxH = blockSize * 3;
 
-                _canvas->fillRect( cx - boxW / 2, cy - boxH / 2, boxW, boxH, colorToRGB565( color ) );
+                if ( !overlaySolidFrame( cx - boxW / 2, cy - boxH / 2, boxW, boxH, colorToRGB565( color ) ) ) {
+                    _canvas->fillRect( cx - boxW / 2, cy - boxH / 2, boxW, boxH, colorToRGB565( color ) );
+                }
             }
             break;
 
@@ -542,6 +571,13 @@ namespace Display {
                 // Use STACSansBold24pt for digit overlay - scale=1 to fit properly in black rectangle
                 uint8_t scale = 1;
 
+                materializeSolidFrame();
+
+                #if TFT_GLYPH_ATLAS
+                // Drawn inside the black centre window (GLF_EN), so blend against black
+                char digitStr[ 2 ] = {static_cast<char>( '0' + digit ), '\0'};
+                drawAtlasDigits( digitStr, scale, colorToRGB565( color ), 0x0000 );
+                #else
                 _canvas->setFont( &STACSansBold24pt7b );
                 _canvas->setTextColor( colorToRGB565( color ) );
                 _canvas->setTextSize( scale );
@@ -561,6 +597,7 @@ namespace Display {
                 _canvas->setCursor( x, y );
                 char remappedDigit = remapCharToSTACSansFont( digitStr[ 0 ] );
                 _canvas->print( remappedDigit );
+                #endif
             }
             break;
 
@@ -585,7 +622,9 @@ namespace Display {
                     squareSize++;
                 }
 
-                _canvas->fillRect( cx - squareSize / 2, cy - squareSize / 2, squareSize, squareSize, colorToRGB565( color ) );
+                if ( !overlaySolidFrame( cx - squareSize / 2, cy - squareSize / 2, squareSize, squareSize, colorToRGB565( color ) ) ) {
+                    _canvas->fillRect( cx - squareSize / 2, cy - squareSize / 2, squareSize, squareSize, colorToRGB565( color ) );
+                }
             }
             break;
 
@@ -617,11 +656,19 @@ namespace Display {
             // Bottom-right corner
             _gfx->fillRect( w - cornerSize, h - cornerSize, cornerSize, cornerSize, rgb565 );
 
+            // Panel no longer matches a pending solid frame; the next show() repaints it
+            _solid.dirty = true;
+
+            // Count the direct draw as a shown frame so SceneTracker sees the panel changed
+            _stats.showRequests++;
+            _stats.framesSent++;
+
             return;  // Skip canvas path
         }
 
         // Portrait mode: use canvas as normal
         if ( _canvas ) {
+            materializeSolidFrame();
             uint16_t w = _canvas->width();
             uint16_t h = _canvas->height();
             // Top-left corner
@@ -669,6 +716,10 @@ namespace Display {
         return 255;
     }
 
+    DisplayStats DisplayTFT::getStats() const {
+        return _stats;
+    }
+
     // ========================================================================
     // TFT-Specific Methods
     // ========================================================================
@@ -681,11 +732,17 @@ namespace Display {
         uint16_t fg = colorToRGB565( color );
         uint16_t bg = colorToRGB565( bgColor );
 
+        _solid.active = false;
         _canvas->fillScreen( bg );
 
         // Use STACSansBold24pt scaled down for smooth digit rendering
         uint8_t scale = ( _rotation == 1 || _rotation == 3 ) ? 2 : 3;
+        uint32_t startUs = micros();
 
+        #if TFT_GLYPH_ATLAS
+        char digitStr[ 2 ] = {static_cast<char>( '0' + digit ), '\0'};
+        drawAtlasDigits( digitStr, scale, fg, bg );
+        #else
         _canvas->setFont( &STACSansBold24pt7b );
         _canvas->setTextColor( fg, bg );
         _canvas->setTextSize( scale );
@@ -707,6 +764,9 @@ namespace Display {
 
         _canvas->setCursor( x, y );
         _canvas->print( remappedDigit );
+        #endif
+
+        log_v( "Digit %d drawn in %lu us", digit, static_cast<unsigned long>( micros() - startUs ) );
 
         show();
     }
@@ -719,6 +779,7 @@ namespace Display {
         uint16_t fg = colorToRGB565( color );
         uint16_t bg = colorToRGB565( bgColor );
 
+        _solid.active = false;
         _canvas->fillScreen( bg );
 
         // Format channel number
@@ -731,7 +792,11 @@ namespace Display {
         if ( _rotation == 1 || _rotation == 3 ) {
             scale = ( numDigits == 1 ) ? 2 : 1; // Landscape is narrower
         }
+        uint32_t startUs = micros();
 
+        #if TFT_GLYPH_ATLAS
+        drawAtlasDigits( numStr, scale, fg, bg );
+        #else
         _canvas->setFont( &STACSansBold24pt7b );
         _canvas->setTextColor( fg, bg );
         _canvas->setTextSize( scale );
@@ -756,20 +821,31 @@ namespace Display {
 
         _canvas->setCursor( x, y );
         _canvas->print( remappedStr );
+        #endif
+
+        log_v( "Channel %d drawn in %lu us", channel, static_cast<unsigned long>( micros() - startUs ) );
 
         show();
     }
 
-    void DisplayTFT::drawWiFiIcon( int16_t cx, int16_t cy, color_t color, bool connected ) {
+    void DisplayTFT::drawWiFiIcon( int16_t cx, int16_t cy, color_t color, bool connected, color_t bgColor ) {
         if ( !_canvas ) {
             return;
         }
+        materializeSolidFrame();
 
         uint16_t rgb565 = colorToRGB565( color );
 
         // Draw WiFi arcs (signal strength indicator)
         // Scale based on rotation: portrait (0,2) = large, landscape (1,3) = smaller to fit 135px
         bool isLandscape = ( _rotation == 1 || _rotation == 3 );
+
+        #if TFT_GLYPH_ATLAS
+        if ( connected ) {
+            drawAtlasGlyph( isLandscape ? AtlasIconWiFiSmall : AtlasIconWiFi, cx, cy, rgb565, colorToRGB565( bgColor ) );
+            return;
+        }
+        #endif
         float scale = isLandscape ? 0.55f : 1.0f;
 
         int16_t dotY = cy + static_cast<int16_t>( 40 * scale ); // Base dot position
@@ -811,13 +887,17 @@ namespace Display {
         }
     }
 
-    void DisplayTFT::drawConfigIcon( int16_t cx, int16_t cy, color_t color ) {
+    void DisplayTFT::drawConfigIcon( int16_t cx, int16_t cy, color_t color, color_t bgColor ) {
         if ( !_canvas ) {
             return;
         }
+        materializeSolidFrame();
 
         uint16_t rgb565 = colorToRGB565( color );
 
+        #if TFT_GLYPH_ATLAS
+        drawAtlasGlyph( AtlasIconConfig, cx, cy, rgb565, colorToRGB565( bgColor ) );
+        #else
         // Draw a larger gear icon for provisioning mode
         int16_t outerR = 50;   // Larger outer radius
         int16_t innerR = 35;   // Larger inner radius
@@ -849,12 +929,14 @@ namespace Display {
 
         // Draw the center hole (black)
         _canvas->fillCircle( cx, cy, holeR, 0x0000 ); // 0x0000
+        #endif
     }
 
     void DisplayTFT::drawUpdateIcon( int16_t cx, int16_t cy, color_t color ) {
         if ( !_canvas ) {
             return;
         }
+        materializeSolidFrame();
 
         uint16_t rgb565 = colorToRGB565( color );
 
@@ -883,6 +965,7 @@ namespace Display {
         if ( !_canvas ) {
             return;
         }
+        materializeSolidFrame();
 
         // Vector graphics checkmark using filled rectangles for bold appearance
         // Scales better than lines and matches font weight
@@ -909,6 +992,7 @@ namespace Display {
         if ( !_canvas ) {
             return;
         }
+        materializeSolidFrame();
 
         uint16_t rgb565 = colorToRGB565( color );
 
@@ -931,6 +1015,7 @@ namespace Display {
         if ( !_canvas ) {
             return;
         }
+        materializeSolidFrame();
 
         uint16_t rgb565 = colorToRGB565( color );
 
@@ -962,6 +1047,7 @@ namespace Display {
         if ( !_canvas ) {
             return;
         }
+        materializeSolidFrame();
 
         uint16_t rgb565 = colorToRGB565( color );
 
@@ -1013,6 +1099,7 @@ namespace Display {
         if ( !_canvas ) {
             return;
         }
+        materializeSolidFrame();
 
         uint16_t rgb565 = colorToRGB565( color );
         uint16_t w = _canvas->width();
@@ -1038,12 +1125,12 @@ namespace Display {
 
             // Recreate canvas with new dimensions
             if ( _canvas ) {
-                delete _canvas;
                 // Canvas must match rotated display dimensions
-                _canvas = new Arduino_Canvas( _gfx->width(), _gfx->height(), _gfx, 0, 0, 0 );
-                _canvas->begin();
-                _canvas->fillScreen( 0x0000 );
-                log_i( "Canvas recreated for rotation %d: %dx%d", _rotation, _gfx->width(), _gfx->height() );
+                _solid.active = false;
+                if ( createCanvas() ) {
+                    _canvas->fillScreen( 0x0000 );
+                    log_i( "Canvas recreated for rotation %d: %dx%d", _rotation, _gfx->width(), _gfx->height() );
+                }
             }
         }
     }
@@ -1085,14 +1172,169 @@ namespace Display {
     // Private Helper Methods
     // ========================================================================
 
-    uint16_t DisplayTFT::colorToRGB565( color_t color ) const {
-        // Convert 24-bit RGB to 16-bit RGB565
-        uint8_t r = ( color >> 16 ) & 0xFF;
-        uint8_t g = ( color >> 8 ) & 0xFF;
-        uint8_t b = color & 0xFF;
+    bool DisplayTFT::createCanvas() {
+        if ( _canvas ) {
+            delete _canvas;
+            _canvas = nullptr;
+        }
+
+        int16_t w = _gfx->width();
+        int16_t h = _gfx->height();
+        uint32_t heapBefore = ESP.getFreeHeap();
+
+        _canvas = new TFTCanvas( w, h, _gfx, 0, 0 );
+        if ( !_canvas->begin() ) {
+            log_e( "Failed to allocate %dx%d canvas", w, h );
+            delete _canvas;
+            _canvas = nullptr;
+            return false;
+        }
+
+        // An RGB565 canvas needs 2 bytes per pixel
+        log_i( "Canvas %dx%d uses %lu bytes of heap (RGB565 canvas: %lu bytes)", w, h,
+               static_cast<unsigned long>( heapBefore - ESP.getFreeHeap() ),
+               static_cast<unsigned long>( w ) * h * 2 );
+        return true;
+    }
+
+    bool DisplayTFT::overlaySolidFrame( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color ) {
+        if ( !_solid.active ) {
+            return false;
+        }
+
+        if ( _solid.hasOverlay && ( x != _solid.x || y != _solid.y || w != _solid.w || h != _solid.h ) ) {
+            // Only one overlay rectangle fits the fast path
+            materializeSolidFrame();
+            return false;
+        }
+
+        _solid.hasOverlay = true;
+        _solid.dirty = true;
+        _solid.overlay = color;
+        _solid.x = x;
+        _solid.y = y;
+        _solid.w = w;
+        _solid.h = h;
+        return true;
+    }
+
+    void DisplayTFT::materializeSolidFrame() {
+        if ( !_solid.active ) {
+            return;
+        }
+
+        _canvas->fillScreen( _solid.fill );
+        if ( _solid.hasOverlay ) {
+            _canvas->fillRect( _solid.x, _solid.y, _solid.w, _solid.h, _solid.overlay );
+        }
+        _solid.active = false;
+    }
+
+    void DisplayTFT::pushSolidFrame() {
+        int16_t w = _gfx->width();
+        int16_t h = _gfx->height();
+
+        if ( !_solid.hasOverlay ) {
+            _gfx->fillRect( 0, 0, w, h, _solid.fill );
+            return;
+        }
+
+        // Fill around the overlay rather than under it so it doesn't flicker
+        int16_t right = _solid.x + _solid.w;
+        int16_t bottom = _solid.y + _solid.h;
+        if ( _solid.y > 0 ) {
+            _gfx->fillRect( 0, 0, w, _solid.y, _solid.fill );
+        }
+        if ( bottom < h ) {
+            _gfx->fillRect( 0, bottom, w, h - bottom, _solid.fill );
+        }
+        if ( _solid.x > 0 ) {
+            _gfx->fillRect( 0, _solid.y, _solid.x, _solid.h, _solid.fill );
+        }
+        if ( right < w ) {
+            _gfx->fillRect( right, _solid.y, w - right, _solid.h, _solid.fill );
+        }
+        _gfx->fillRect( _solid.x, _solid.y, _solid.w, _solid.h, _solid.overlay );
+    }
+
+    #if TFT_GLYPH_ATLAS
+    void DisplayTFT::drawAtlasGlyph( const AtlasGlyph &glyph, int16_t x, int16_t y, uint16_t fg, uint16_t bg ) {
+        // Alpha levels 0-3: transparent, two blends, solid
+        uint16_t shades[ 4 ] = { 0, blendRGB565( fg, bg, 1 ), blendRGB565( fg, bg, 2 ), fg };
+
+        const uint8_t *runs = &GlyphAtlasData[ glyph.offset ];
+        int16_t left = x + glyph.xOffset;
+        int16_t top = y + glyph.yOffset;
+        uint8_t col = 0;
+        uint8_t row = 0;
+
+        _canvas->startWrite();
+        while ( row < glyph.height ) {
+            uint8_t code = pgm_read_byte( runs++ );
+            uint8_t alpha = code >> 6;
+            uint16_t run = ( code & 0x3F ) + 1;
+
+            // Split the run at row ends
+            while ( run > 0 && row < glyph.height ) {
+                uint8_t span = min( run, static_cast<uint16_t>( glyph.width - col ) );
+                if ( alpha ) {
+                    _canvas->writeFastHLine( left + col, top + row, span, shades[ alpha ] );
+                }
+                col += span;
+                run -= span;
+                if ( col >= glyph.width ) {
+                    col = 0;
+                    row++;
+                }
+            }
+        }
+        _canvas->endWrite();
+    }
+
+    void DisplayTFT::drawAtlasDigits( const char *digits, uint8_t size, uint16_t fg, uint16_t bg ) {
+        if ( size < 1 || size > ATLAS_DIGIT_SIZES ) {
+            return;
+        }
+        const AtlasGlyph *font = AtlasDigits[ size - 1 ];
+
+        // Text bounds, computed the way getTextBounds() does for GFX fonts
+        int16_t cursor = 0;
+        int16_t minX = INT16_MAX, minY = INT16_MAX;
+        int16_t maxX = INT16_MIN, maxY = INT16_MIN;
+        for ( const char *c = digits; *c; c++ ) {
+            const AtlasGlyph &glyph = font[ ( *c - '0' ) % 10 ];
+            minX = min( minX, static_cast<int16_t>( cursor + glyph.xOffset ) );
+            maxX = max( maxX, static_cast<int16_t>( cursor + glyph.xOffset + glyph.width - 1 ) );
+            minY = min( minY, glyph.yOffset );
+            maxY = max( maxY, static_cast<int16_t>( glyph.yOffset + glyph.height - 1 ) );
+            cursor += glyph.xAdvance;
+        }
+        if ( cursor == 0 ) {
+            return;
+        }
+
+        // Same centering as the GFX font path
+        int16_t w = maxX - minX + 1;
+        int16_t h = maxY - minY + 1;
+        int16_t x = ( _canvas->width() - w ) / 2 - minX;
+        int16_t y = ( _canvas->height() - h ) / 2 + h;    // Baseline adjustment
+
+        for ( const char *c = digits; *c; c++ ) {
+            const AtlasGlyph &glyph = font[ ( *c - '0' ) % 10 ];
+            drawAtlasGlyph( glyph, x, y, fg, bg );
+            x += glyph.xAdvance;
+        }
+    }
 
-        return ( ( r & 0xF8 ) << 8 ) | ( ( g & 0xFC ) << 3 ) | ( b >> 3 );
+    uint16_t DisplayTFT::blendRGB565( uint16_t fg, uint16_t bg, uint8_t alpha ) {
+        // alpha is in thirds (0 = bg, 3 = fg)
+        uint8_t inverse = 3 - alpha;
+        uint16_t r = ( ( fg >> 11 ) * alpha + ( bg >> 11 ) * inverse ) / 3;
+        uint16_t g = ( ( ( fg >> 5 ) & 0x3F ) * alpha + ( ( bg >> 5 ) & 0x3F ) * inverse ) / 3;
+        uint16_t b = ( ( fg & 0x1F ) * alpha + ( bg & 0x1F ) * inverse ) / 3;
+        return ( r << 11 ) | ( g << 5 ) | b;
     }
+    #endif
 
     // Helper to get current width accounting for rotation
     inline uint16_t DisplayTFT::currentWidth() const {
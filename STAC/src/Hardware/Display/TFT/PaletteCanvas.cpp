@@ -0,0 +1,200 @@
+/**
+ * @file PaletteCanvas.cpp
+ * @brief 4-bit palette-indexed off-screen canvas for Arduino_GFX
+ */
+
+#include "Hardware/Display/TFT/PaletteCanvas.h"
+#include <cstdint>
+#include <cstring>
+
+namespace Display {
+
+    PaletteCanvas::PaletteCanvas( int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y )
+        : Arduino_GFX( w, h )
+        , _output( output )
+        , _output_x( output_x )
+        , _output_y( output_y )
+        , _stride( ( w + 1 ) / 2 )
+        , _indexBuffer( nullptr )
+        , _bandBuffer( nullptr )
+        , _paletteCount( 0 ) {
+        memset( _palette, 0, sizeof( _palette ) );
+    }
+
+    PaletteCanvas::~PaletteCanvas() {
+        free( _indexBuffer );
+        free( _bandBuffer );
+    }
+
+    bool PaletteCanvas::begin( int32_t speed ) {
+        // Same contract as Arduino_Canvas: begin the panel unless told not to
+        if ( speed != GFX_SKIP_OUTPUT_BEGIN && _output ) {
+            if ( !_output->begin( speed ) ) {
+                return false;
+            }
+        }
+
+        if ( !_indexBuffer ) {
+            _indexBuffer = static_cast<uint8_t *>( malloc( static_cast<size_t>( _stride ) * _height ) );
+        }
+        if ( !_bandBuffer ) {
+            _bandBuffer = static_cast<uint16_t *>( malloc( static_cast<size_t>( _width ) * BAND_ROWS * sizeof( uint16_t ) ) );
+        }
+        if ( !_indexBuffer || !_bandBuffer ) {
+            log_e( "PaletteCanvas: failed to allocate %u bytes", static_cast<unsigned>( getBufferBytes() ) );
+            return false;
+        }
+
+        // Start as a single black entry
+        memset( _indexBuffer, 0, static_cast<size_t>( _stride ) * _height );
+        _palette[ 0 ] = 0x0000;
+        _paletteCount = 1;
+        return true;
+    }
+
+    void PaletteCanvas::writePixelPreclipped( int16_t x, int16_t y, uint16_t color ) {
+        uint8_t index = colorIndex( color );
+        uint8_t *cell = &_indexBuffer[ y * _stride + ( x >> 1 ) ];
+        if ( x & 1 ) {
+            *cell = ( *cell & 0x0F ) | ( index << 4 );
+        }
+        else {
+            *cell = ( *cell & 0xF0 ) | index;
+        }
+    }
+
+    void PaletteCanvas::writeFillRectPreclipped( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color ) {
+        if ( x == 0 && y == 0 && w == _width && h == _height ) {
+            // Nothing from the previous frame survives a full fill
+            _paletteCount = 0;
+        }
+
+        uint8_t index = colorIndex( color );
+        for ( int16_t row = y; row < y + h; row++ ) {
+            fillRowSpan( &_indexBuffer[ row * _stride ], x, w, index );
+        }
+    }
+
+    void PaletteCanvas::writeFastVLine( int16_t x, int16_t y, int16_t h, uint16_t color ) {
+        if ( h < 0 ) {
+            y += h + 1;
+            h = -h;
+        }
+        if ( x < 0 || x >= _width || h == 0 ) {
+            return;
+        }
+        if ( y < 0 ) {
+            h += y;
+            y = 0;
+        }
+        if ( y + h > _height ) {
+            h = _height - y;
+        }
+        if ( h > 0 ) {
+            writeFillRectPreclipped( x, y, 1, h, color );
+        }
+    }
+
+    void PaletteCanvas::writeFastHLine( int16_t x, int16_t y, int16_t w, uint16_t color ) {
+        if ( w < 0 ) {
+            x += w + 1;
+            w = -w;
+        }
+        if ( y < 0 || y >= _height || w == 0 ) {
+            return;
+        }
+        if ( x < 0 ) {
+            w += x;
+            x = 0;
+        }
+        if ( x + w > _width ) {
+            w = _width - x;
+        }
+        if ( w > 0 ) {
+            writeFillRectPreclipped( x, y, w, 1, color );
+        }
+    }
+
+    void PaletteCanvas::flush( bool force_flush ) {
+        ( void )force_flush;
+        if ( !_indexBuffer || !_bandBuffer || !_output ) {
+            return;
+        }
+
+        for ( int16_t bandY = 0; bandY < _height; bandY += BAND_ROWS ) {
+            int16_t rows = ( _height - bandY < BAND_ROWS ) ? ( _height - bandY ) : BAND_ROWS;
+            uint16_t *out = _bandBuffer;
+
+            for ( int16_t row = bandY; row < bandY + rows; row++ ) {
+                const uint8_t *in = &_indexBuffer[ row * _stride ];
+                for ( int16_t x = 0; x < _width; x += 2 ) {
+                    uint8_t cell = *in++;
+                    *out++ = _palette[ cell & 0x0F ];
+                    if ( x + 1 < _width ) {
+                        *out++ = _palette[ cell >> 4 ];
+                    }
+                }
+            }
+
+            _output->draw16bitRGBBitmap( _output_x, _output_y + bandY, _bandBuffer, _width, rows );
+        }
+    }
+
+    size_t PaletteCanvas::getBufferBytes() const {
+        return static_cast<size_t>( _stride ) * _height + static_cast<size_t>( _width ) * BAND_ROWS * sizeof( uint16_t );
+    }
+
+    uint8_t PaletteCanvas::colorIndex( uint16_t color ) {
+        for ( uint8_t i = 0; i < _paletteCount; i++ ) {
+            if ( _palette[ i ] == color ) {
+                return i;
+            }
+        }
+
+        if ( _paletteCount < PALETTE_SIZE ) {
+            _palette[ _paletteCount ] = color;
+            return _paletteCount++;
+        }
+
+        // Palette full: use the closest colour (squared distance in RGB565 components)
+        int16_t r = color >> 11;
+        int16_t g = ( color >> 5 ) & 0x3F;
+        int16_t b = color & 0x1F;
+        uint8_t best = 0;
+        int32_t bestDistance = INT32_MAX;
+        for ( uint8_t i = 0; i < PALETTE_SIZE; i++ ) {
+            int16_t dr = r - ( _palette[ i ] >> 11 );
+            int16_t dg = ( g - ( ( _palette[ i ] >> 5 ) & 0x3F ) ) / 2;     // Green has one extra bit
+            int16_t db = b - ( _palette[ i ] & 0x1F );
+            int32_t distance = dr * dr + dg * dg + db * db;
+            if ( distance < bestDistance ) {
+                bestDistance = distance;
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    void PaletteCanvas::fillRowSpan( uint8_t *row, int16_t x, int16_t w, uint8_t index ) {
+        int16_t end = x + w;
+
+        // Leading odd pixel (high nibble)
+        if ( ( x & 1 ) && x < end ) {
+            row[ x >> 1 ] = ( row[ x >> 1 ] & 0x0F ) | ( index << 4 );
+            x++;
+        }
+
+        // Whole bytes
+        int16_t pairs = ( end - x ) >> 1;
+        if ( pairs > 0 ) {
+            memset( &row[ x >> 1 ], ( index << 4 ) | index, pairs );
+            x += pairs * 2;
+        }
+
+        // Trailing even pixel (low nibble)
+        if ( x < end ) {
+            row[ x >> 1 ] = ( row[ x >> 1 ] & 0xF0 ) | index;
+        }
+    }
+
+} // namespace Display
@@ -0,0 +1,204 @@
+#include "Hardware/Power/PowerManager.h"
+#include <WiFi.h>
+#include "Config/Constants.h"
+
+
+namespace Hardware {
+
+    PowerManager::PowerManager( PowerProfile profile )
+        : profile( profile )
+        , started( false )
+        , awake( false )
+        , fullCpuMhz( 0 )
+        , startedAt( 0 )
+        , stateSince( 0 )
+        , awakeMs( 0 )
+        , lastReportAt( 0 )
+          #if defined(PMU_TYPE_AXP192)
+        , pmu()
+        , lastSampleAt( 0 )
+        , dischargeSumMa( 0.0f )
+        , dischargeSamples( 0 )
+          #endif
+    {
+    }
+
+    void PowerManager::begin() {
+        if ( started ) {
+            return;
+        }
+        started = true;
+        fullCpuMhz = getCpuFrequencyMhz();
+        startedAt = millis();
+        stateSince = startedAt;
+        lastReportAt = startedAt;
+
+        WiFi.setSleep( idleSleepType() );
+        if ( profile == PowerProfile::BATTERY_SAVER ) {
+            setCpuFrequencyMhz( Config::Power::SAVER_CPU_MHZ );
+        }
+        log_i( "Power profile: %s (CPU %lu MHz between polls)", profileName( profile ),
+               static_cast<unsigned long>( getCpuFrequencyMhz() ) );
+    }
+
+    void PowerManager::update( unsigned long untilPollMs ) {
+        if ( !started ) {
+            return;
+        }
+
+        uint32_t lead = getWakeLeadMs();
+        if ( !awake && lead > 0 && untilPollMs <= lead ) {
+            wakeForPoll();
+        }
+
+        unsigned long now = millis();
+        #if defined(PMU_TYPE_AXP192)
+        if ( now - lastSampleAt >= Config::Power::PMU_SAMPLE_MS ) {
+            lastSampleAt = now;
+            samplePMU();
+        }
+        #endif
+
+        if ( now - lastReportAt >= Config::Power::REPORT_INTERVAL_MS ) {
+            lastReportAt = now;
+            logReport();
+        }
+    }
+
+    void PowerManager::wakeForPoll() {
+        if ( !started || awake || profile == PowerProfile::LOW_LATENCY ) {
+            return;
+        }
+
+        account( millis() );
+        awake = true;
+        if ( profile == PowerProfile::BATTERY_SAVER ) {
+            setCpuFrequencyMhz( fullCpuMhz );
+        }
+        WiFi.setSleep( WIFI_PS_NONE );
+    }
+
+    void PowerManager::pollDone() {
+        if ( !awake ) {
+            return;
+        }
+
+        account( millis() );
+        awake = false;
+        WiFi.setSleep( idleSleepType() );
+        if ( profile == PowerProfile::BATTERY_SAVER ) {
+            setCpuFrequencyMhz( Config::Power::SAVER_CPU_MHZ );
+        }
+    }
+
+    uint32_t PowerManager::getWakeLeadMs() const {
+        return profile == PowerProfile::LOW_LATENCY ? 0 : Config::Power::WAKE_LEAD_MS;
+    }
+
+    EnergyReport PowerManager::getReport() const {
+        EnergyReport report = {};
+        if ( !started ) {
+            return report;
+        }
+
+        unsigned long now = millis();
+        uint32_t awakeTotal = awakeMs + ( awake ? now - stateSince : 0 );
+        report.elapsedMs = now - startedAt;
+        if ( report.elapsedMs > 0 ) {
+            report.awakePermille = static_cast<uint16_t>( static_cast<uint64_t>( awakeTotal ) * 1000 / report.elapsedMs );
+        }
+        report.modelMilliamps = estimateMilliamps( profile, report.awakePermille / 1000.0f );
+
+        #if defined(PMU_TYPE_AXP192)
+        if ( dischargeSamples > 0 ) {
+            report.measuredMilliamps = dischargeSumMa / dischargeSamples;
+            report.measuredSamples = dischargeSamples;
+        }
+        #endif
+        return report;
+    }
+
+    uint16_t PowerManager::listenIntervalFor( PowerProfile profile ) {
+        return profile == PowerProfile::BATTERY_SAVER ? Config::Power::SAVER_LISTEN_INTERVAL : 0;
+    }
+
+    float PowerManager::estimateMilliamps( PowerProfile profile, float awakeFraction ) {
+        using namespace Config::Power;
+
+        if ( awakeFraction < 0.0f ) {
+            awakeFraction = 0.0f;
+        }
+        else if ( awakeFraction > 1.0f ) {
+            awakeFraction = 1.0f;
+        }
+
+        float awakeMa = CPU_FULL_MA + RADIO_AWAKE_MA;
+        float idleMa;
+        switch ( profile ) {
+            case PowerProfile::LOW_LATENCY:
+                idleMa = awakeMa;
+                break;
+            case PowerProfile::BATTERY_SAVER:
+                idleMa = CPU_SLOW_MA + RADIO_MAX_MODEM_MA;
+                break;
+            default:
+                idleMa = CPU_FULL_MA + RADIO_MIN_MODEM_MA;
+                break;
+        }
+        return awakeMa * awakeFraction + idleMa * ( 1.0f - awakeFraction );
+    }
+
+    const char *PowerManager::profileName( PowerProfile profile ) {
+        switch ( profile ) {
+            case PowerProfile::LOW_LATENCY:
+                return "lowest latency";
+            case PowerProfile::BATTERY_SAVER:
+                return "battery saver";
+            default:
+                return "balanced";
+        }
+    }
+
+    wifi_ps_type_t PowerManager::idleSleepType() const {
+        switch ( profile ) {
+            case PowerProfile::LOW_LATENCY:
+                return WIFI_PS_NONE;
+            case PowerProfile::BATTERY_SAVER:
+                return WIFI_PS_MAX_MODEM;
+            default:
+                return WIFI_PS_MIN_MODEM;
+        }
+    }
+
+    void PowerManager::account( unsigned long now ) {
+        if ( awake ) {
+            awakeMs += now - stateSince;
+        }
+        stateSince = now;
+    }
+
+    #if defined(PMU_TYPE_AXP192)
+    void PowerManager::samplePMU() {
+        // Discharge current only means something on battery
+        if ( pmu.getVbusVoltage() >= 4000.0f || dischargeSamples == UINT16_MAX ) {
+            return;
+        }
+        dischargeSumMa += pmu.getBatteryDischargeCurrent();
+        dischargeSamples++;
+    }
+    #endif
+
+    void PowerManager::logReport() const {
+        EnergyReport report = getReport();
+        log_i( "Power (%s): radio awake %u.%u%% of %lu s, model %.1f mAh/h", profileName( profile ),
+               report.awakePermille / 10, report.awakePermille % 10,
+               static_cast<unsigned long>( report.elapsedMs / 1000 ), report.modelMilliamps );
+        if ( report.measuredSamples > 0 ) {
+            log_i( "  Battery: %.1f mAh/h measured over %u samples", report.measuredMilliamps, report.measuredSamples );
+        }
+    }
+
+} // namespace Hardware
+
+
+//  --- EOF --- //
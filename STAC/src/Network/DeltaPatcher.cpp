@@ -0,0 +1,349 @@
+#include "Network/DeltaPatcher.h"
+#include <Arduino.h>
+#include <esp_ota_ops.h>
+#include <mbedtls/sha256.h>
+#include <cstring>
+
+
+namespace Net {
+
+    namespace {
+
+        constexpr char PATCH_MAGIC[ 4 ] = { 'S', 'T', 'D', 'P' };
+
+        constexpr uint8_t OP_END = 0x00;
+        constexpr uint8_t OP_COPY = 0x01;
+        constexpr uint8_t OP_ADD = 0x02;
+        constexpr uint8_t OP_ADD_DEFLATE = 0x03;
+
+        static_assert( ( DeltaPatcher::INFLATE_WINDOW & ( DeltaPatcher::INFLATE_WINDOW - 1 ) ) == 0,
+                       "tinfl needs a power-of-two window" );
+
+        uint32_t readU32( const uint8_t *bytes ) {
+            return static_cast<uint32_t>( bytes[ 0 ] ) |
+                   ( static_cast<uint32_t>( bytes[ 1 ] ) << 8 ) |
+                   ( static_cast<uint32_t>( bytes[ 2 ] ) << 16 ) |
+                   ( static_cast<uint32_t>( bytes[ 3 ] ) << 24 );
+        }
+
+    } // namespace
+
+    DeltaPatcher::DeltaPatcher( OTAPipeline &ota )
+        : ota( ota )
+        , running( nullptr )
+        , stage( Stage::HEADER )
+        , opcode( OP_END )
+        , collected( 0 )
+        , addRemaining( 0 )
+        , packedRemaining( 0 )
+        , inflater( nullptr )
+        , windowPos( 0 )
+        , produced( 0 )
+        , patchBytes( 0 )
+        , error( "" ) {
+    }
+
+    DeltaPatcher::~DeltaPatcher() {
+        releaseInflater();
+    }
+
+    bool DeltaPatcher::isPatch( const uint8_t *data, size_t length ) {
+        return length >= sizeof( PATCH_MAGIC ) && memcmp( data, PATCH_MAGIC, sizeof( PATCH_MAGIC ) ) == 0;
+    }
+
+    void DeltaPatcher::begin() {
+        stage = Stage::HEADER;
+        collected = 0;
+        addRemaining = 0;
+        packedRemaining = 0;
+        produced = 0;
+        patchBytes = 0;
+        error = "";
+        releaseInflater();
+    }
+
+    bool DeltaPatcher::write( const uint8_t *data, size_t length ) {
+        patchBytes += length;
+
+        while ( length > 0 ) {
+            switch ( stage ) {
+                case Stage::HEADER: {
+                    size_t take = min( length, sizeof( Header ) - collected );
+                    memcpy( reinterpret_cast<uint8_t *>( &header ) + collected, data, take );
+                    collected += take;
+                    data += take;
+                    length -= take;
+                    if ( collected == sizeof( Header ) ) {
+                        if ( !startImage() ) {
+                            return false;
+                        }
+                        stage = Stage::OPCODE;
+                    }
+                    break;
+                }
+
+                case Stage::OPCODE:
+                    opcode = *data++;
+                    length--;
+                    collected = 0;
+                    if ( opcode == OP_END ) {
+                        stage = Stage::DONE;
+                    }
+                    else if ( opcode == OP_COPY || opcode == OP_ADD || opcode == OP_ADD_DEFLATE ) {
+                        stage = Stage::ARGS;
+                    }
+                    else {
+                        return fail( "Corrupt delta patch (unknown op)" );
+                    }
+                    break;
+
+                case Stage::ARGS: {
+                    size_t needed = opcode == OP_ADD ? 4 : 8;
+                    size_t take = min( length, needed - collected );
+                    memcpy( args + collected, data, take );
+                    collected += take;
+                    data += take;
+                    length -= take;
+                    if ( collected < needed ) {
+                        break;
+                    }
+
+                    if ( opcode == OP_COPY ) {
+                        if ( !copyFromRunning( readU32( args ), readU32( args + 4 ) ) ) {
+                            return false;
+                        }
+                        stage = Stage::OPCODE;
+                    }
+                    else if ( opcode == OP_ADD ) {
+                        addRemaining = readU32( args );
+                        stage = addRemaining ? Stage::ADD_DATA : Stage::OPCODE;
+                    }
+                    else {
+                        addRemaining = readU32( args );
+                        packedRemaining = readU32( args + 4 );
+                        if ( !beginInflate() ) {
+                            return false;
+                        }
+                    }
+                    break;
+                }
+
+                case Stage::ADD_DATA: {
+                    size_t take = min( length, addRemaining );
+                    if ( !emit( data, take ) ) {
+                        return false;
+                    }
+                    data += take;
+                    length -= take;
+                    addRemaining -= take;
+                    if ( addRemaining == 0 ) {
+                        stage = Stage::OPCODE;
+                    }
+                    break;
+                }
+
+                case Stage::INFLATE: {
+                    size_t take = min( length, packedRemaining );
+                    if ( !inflate( data, take, take == packedRemaining ) ) {
+                        return false;
+                    }
+                    data += take;
+                    length -= take;
+                    packedRemaining -= take;
+                    if ( packedRemaining == 0 ) {
+                        stage = Stage::OPCODE;
+                    }
+                    break;
+                }
+
+                case Stage::DONE:
+                    return fail( "Data after the end of the delta patch" );
+
+                case Stage::FAILED:
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    bool DeltaPatcher::finish() {
+        releaseInflater();
+        if ( stage != Stage::DONE || produced != header.newSize ) {
+            if ( stage != Stage::FAILED ) {
+                fail( stage == Stage::DONE ? "Delta patch produced the wrong image size" : "Delta patch is incomplete" );
+            }
+            ota.abort();
+            return false;
+        }
+
+        bool ok = ota.finish();
+        log_i( "Delta OTA: %u patch bytes rebuilt a %u byte image (%u%%)",
+               static_cast<unsigned>( patchBytes ), static_cast<unsigned>( produced ),
+               produced ? static_cast<unsigned>( patchBytes * 100 / produced ) : 0 );
+        return ok;
+    }
+
+    void DeltaPatcher::abort() {
+        releaseInflater();
+        ota.abort();
+        stage = Stage::FAILED;
+    }
+
+    const char *DeltaPatcher::getError() const {
+        return error[ 0 ] ? error : ota.getError();
+    }
+
+    bool DeltaPatcher::startImage() {
+        if ( !isPatch( reinterpret_cast<const uint8_t *>( header.magic ), sizeof( header.magic ) ) ) {
+            return fail( "Not a delta patch" );
+        }
+        if ( header.version < 1 || header.version > FORMAT_VERSION ) {
+            return fail( "Unsupported delta patch version" );
+        }
+
+        running = esp_ota_get_running_partition();
+        if ( !running || header.oldSize > running->size ) {
+            return fail( "Delta patch was made for a different release" );
+        }
+
+        // Hash the running image so a patch for another base is refused before anything is written
+        mbedtls_sha256_context sha;
+        mbedtls_sha256_init( &sha );
+        mbedtls_sha256_starts( &sha, 0 );
+        bool readOk = true;
+        for ( uint32_t offset = 0; offset < header.oldSize && readOk; offset += COPY_BUFFER_SIZE ) {
+            size_t chunk = min( static_cast<size_t>( header.oldSize - offset ), COPY_BUFFER_SIZE );
+            readOk = esp_partition_read( running, offset, copyBuffer, chunk ) == ESP_OK;
+            mbedtls_sha256_update( &sha, copyBuffer, chunk );
+        }
+        uint8_t digest[ OTAPipeline::DIGEST_SIZE ];
+        mbedtls_sha256_finish( &sha, digest );
+        mbedtls_sha256_free( &sha );
+
+        if ( !readOk ) {
+            return fail( "Failed to read the running firmware" );
+        }
+        if ( memcmp( digest, header.oldSha256, sizeof( digest ) ) != 0 ) {
+            return fail( "Delta patch was made for a different release" );
+        }
+
+        char expected[ OTAPipeline::DIGEST_SIZE * 2 + 1 ];
+        for ( size_t i = 0; i < OTAPipeline::DIGEST_SIZE; i++ ) {
+            snprintf( expected + i * 2, 3, "%02x", header.newSha256[ i ] );
+        }
+
+        log_i( "Delta patch: %u byte base verified, rebuilding %u byte image",
+               static_cast<unsigned>( header.oldSize ), static_cast<unsigned>( header.newSize ) );
+
+        if ( !ota.begin( String( expected ) ) ) {
+            stage = Stage::FAILED;
+            return false;
+        }
+        return true;
+    }
+
+    bool DeltaPatcher::copyFromRunning( uint32_t offset, uint32_t length ) {
+        if ( offset > header.oldSize || length > header.oldSize - offset ) {
+            return fail( "Corrupt delta patch (copy outside the base image)" );
+        }
+
+        while ( length > 0 ) {
+            size_t chunk = min( static_cast<size_t>( length ), COPY_BUFFER_SIZE );
+            if ( esp_partition_read( running, offset, copyBuffer, chunk ) != ESP_OK ) {
+                return fail( "Failed to read the running firmware" );
+            }
+            if ( !emit( copyBuffer, chunk ) ) {
+                return false;
+            }
+            offset += chunk;
+            length -= chunk;
+        }
+        return true;
+    }
+
+    bool DeltaPatcher::beginInflate() {
+        if ( packedRemaining == 0 ) {
+            if ( addRemaining != 0 ) {
+                return fail( "Corrupt delta patch (empty deflate data)" );
+            }
+            stage = Stage::OPCODE;
+            return true;
+        }
+
+        if ( !inflater ) {
+            inflater = static_cast<Inflater *>( malloc( sizeof( Inflater ) ) );
+            if ( !inflater ) {
+                return fail( "Not enough memory to inflate the delta patch" );
+            }
+        }
+        tinfl_init( &inflater->state );
+        windowPos = 0;
+        stage = Stage::INFLATE;
+        return true;
+    }
+
+    bool DeltaPatcher::inflate( const uint8_t *data, size_t length, bool last ) {
+        // The window wraps: back-references reach at most INFLATE_WINDOW bytes behind
+        const mz_uint32 flags = last ? 0 : TINFL_FLAG_HAS_MORE_INPUT;
+
+        while ( true ) {
+            size_t inBytes = length;
+            size_t outBytes = INFLATE_WINDOW - windowPos;
+            tinfl_status status = tinfl_decompress( &inflater->state, data, &inBytes, inflater->window,
+                                                    inflater->window + windowPos, &outBytes, flags );
+            data += inBytes;
+            length -= inBytes;
+
+            if ( outBytes > addRemaining ) {
+                return fail( "Corrupt delta patch (deflate data too long)" );
+            }
+            if ( outBytes > 0 && !emit( inflater->window + windowPos, outBytes ) ) {
+                return false;
+            }
+            addRemaining -= outBytes;
+            windowPos = ( windowPos + outBytes ) & ( INFLATE_WINDOW - 1 );
+
+            if ( status == TINFL_STATUS_HAS_MORE_OUTPUT ) {
+                continue;
+            }
+            if ( status == TINFL_STATUS_NEEDS_MORE_INPUT && !last ) {
+                return true;
+            }
+            if ( status != TINFL_STATUS_DONE ) {
+                return fail( "Corrupt delta patch (bad deflate data)" );
+            }
+            if ( !last || length > 0 || addRemaining > 0 ) {
+                return fail( "Corrupt delta patch (deflate length mismatch)" );
+            }
+            return true;
+        }
+    }
+
+    void DeltaPatcher::releaseInflater() {
+        free( inflater );
+        inflater = nullptr;
+    }
+
+    bool DeltaPatcher::emit( const uint8_t *data, size_t length ) {
+        if ( length > header.newSize - produced ) {
+            return fail( "Corrupt delta patch (image too large)" );
+        }
+        produced += length;
+        if ( !ota.write( data, length ) ) {
+            stage = Stage::FAILED;
+            return false;
+        }
+        return true;
+    }
+
+    bool DeltaPatcher::fail( const char *reason ) {
+        error = reason;
+        stage = Stage::FAILED;
+        log_e( "Delta OTA: %s", reason );
+        return false;
+    }
+
+} // namespace Net
+
+
+//  --- EOF --- //
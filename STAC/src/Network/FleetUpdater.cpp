@@ -0,0 +1,354 @@
+#include "Network/FleetUpdater.h"
+#include <HTTPClient.h>
+#include <WiFiClient.h>
+#include "Config/Constants.h"
+
+
+namespace Net {
+
+    namespace {
+
+        uint32_t hashID( const String &text ) {
+            uint32_t hash = 2166136261UL;     // FNV-1a
+            for ( size_t i = 0; i < text.length(); i++ ) {
+                hash ^= static_cast<uint8_t>( text[ i ] );
+                hash *= 16777619UL;
+            }
+            return hash;
+        }
+
+        // Next dot-separated part of a version; numeric if it is all digits
+        bool nextPart( const char *&cursor, long &number, String &text ) {
+            if ( *cursor == '\0' ) {
+                return false;
+            }
+            const char *start = cursor;
+            while ( *cursor && *cursor != '.' ) {
+                cursor++;
+            }
+            text = String( start ).substring( 0, cursor - start );
+            char *end = nullptr;
+            number = strtol( text.c_str(), &end, 10 );
+            if ( text.length() == 0 || *end != '\0' ) {
+                number = -1;
+            }
+            if ( *cursor == '.' ) {
+                cursor++;
+            }
+            return true;
+        }
+
+        int compareParts( const String &a, const String &b ) {
+            const char *ca = a.c_str();
+            const char *cb = b.c_str();
+            long na, nb;
+            String ta, tb;
+            while ( true ) {
+                bool hasA = nextPart( ca, na, ta );
+                bool hasB = nextPart( cb, nb, tb );
+                if ( !hasA || !hasB ) {
+                    return hasA ? 1 : ( hasB ? -1 : 0 );
+                }
+                int diff = ( na >= 0 && nb >= 0 ) ? ( na > nb ) - ( na < nb ) : strcmp( ta.c_str(), tb.c_str() );
+                if ( diff != 0 ) {
+                    return diff;
+                }
+            }
+        }
+
+    } // namespace
+
+    FleetUpdater::FleetUpdater( const String &serverURL, const String &stacID )
+        : serverURL( serverURL )
+        , staggerMs( hashID( stacID ) % Config::FleetOTA::STAGGER_WINDOW_MS )
+        , dueAtMs( 0 )
+        , state( FleetUpdateState::IDLE )
+        , restartRequested( false )
+        , taskHandle( nullptr )
+        , deltaPatcher( ota ) {
+        while ( this->serverURL.endsWith( "/" ) ) {
+            this->serverURL.remove( this->serverURL.length() - 1 );
+        }
+    }
+
+    FleetUpdater::~FleetUpdater() {
+        if ( taskHandle ) {
+            vTaskDelete( taskHandle );
+            ota.abort();
+        }
+    }
+
+    void FleetUpdater::requestCheck( bool staggered ) {
+        if ( state == FleetUpdateState::RUNNING || state == FleetUpdateState::INSTALLED ) {
+            log_i( "Fleet update %s - check not scheduled",
+                   state == FleetUpdateState::RUNNING ? "already running" : "already installed" );
+            return;
+        }
+        dueAtMs = millis() + ( staggered ? staggerMs : 0 );
+        state = FleetUpdateState::WAITING;
+        log_i( "Fleet update check in %lu s (%s)", ( dueAtMs - millis() ) / 1000, serverURL.c_str() );
+    }
+
+    void FleetUpdater::update( bool wifiConnected ) {
+        FleetUpdateState current = state;
+        if ( current == FleetUpdateState::IDLE || current == FleetUpdateState::FAILED ) {
+            // Last check found nothing new or failed; look again later
+            dueAtMs = millis() + Config::FleetOTA::RECHECK_INTERVAL_MS;
+            state = FleetUpdateState::WAITING;
+            return;
+        }
+
+        if ( current != FleetUpdateState::WAITING || !wifiConnected ||
+                static_cast<long>( millis() - dueAtMs ) < 0 ) {
+            return;
+        }
+
+        state = FleetUpdateState::RUNNING;
+        if ( xTaskCreate( checkTask, "fleet_ota", TASK_STACK_SIZE, this, TASK_PRIORITY, &taskHandle ) != pdPASS ) {
+            log_e( "Failed to start fleet update task" );
+            taskHandle = nullptr;
+            state = FleetUpdateState::FAILED;
+        }
+    }
+
+    void FleetUpdater::checkTask( void *param ) {
+        FleetUpdater *self = static_cast<FleetUpdater *>( param );
+        FleetUpdateState result = self->runCheck();
+        self->taskHandle = nullptr;
+        self->state = result;
+        vTaskDelete( nullptr );
+    }
+
+    FleetUpdateState FleetUpdater::runCheck() {
+        Manifest manifest;
+        if ( !fetchManifest( manifest ) ) {
+            return FleetUpdateState::FAILED;
+        }
+
+        const char *running = Config::Strings::SOFTWARE_VERSION;
+        if ( compareVersions( manifest.version, running ) <= 0 ) {
+            log_i( "Fleet update: running %s, server has %s - up to date", running, manifest.version.c_str() );
+            return FleetUpdateState::IDLE;
+        }
+
+        log_i( "Fleet update: %s -> %s", running, manifest.version.c_str() );
+        restartRequested = manifest.restart;
+
+        // A delta made from the running version is much smaller; fall back to the full image
+        if ( manifest.delta.length() > 0 && manifest.deltaFrom == running ) {
+            if ( download( manifest.delta, true, "" ) ) {
+                return FleetUpdateState::INSTALLED;
+            }
+            log_w( "Fleet update: delta failed, trying the full image" );
+        }
+        if ( manifest.image.length() > 0 && download( manifest.image, false, manifest.sha256 ) ) {
+            return FleetUpdateState::INSTALLED;
+        }
+        return FleetUpdateState::FAILED;
+    }
+
+    bool FleetUpdater::fetchManifest( Manifest &manifest ) {
+        String url = urlFor( String( "STAC_" ) + Config::Strings::OTA_TARGET + ".manifest" );
+
+        HTTPClient http;
+        http.setTimeout( Config::FleetOTA::HTTP_TIMEOUT_MS );
+        http.useHTTP10( true );     // No chunked replies: the body comes straight off the socket
+        if ( !http.begin( url ) ) {
+            log_e( "Fleet update: bad URL %s", url.c_str() );
+            return false;
+        }
+
+        int code = http.GET();
+        int size = http.getSize();      // -1 if the server didn't say
+        if ( code != HTTP_CODE_OK || size > static_cast<int>( Config::FleetOTA::MAX_MANIFEST_SIZE ) ) {
+            log_w( "Fleet update: manifest %s - HTTP %d, %d bytes", url.c_str(), code, size );
+            http.end();
+            return false;
+        }
+
+        // Read at most MAX_MANIFEST_SIZE bytes, whatever the server claims or doesn't
+        WiFiClient *stream = http.getStreamPtr();
+        size_t length = 0;
+        bool tooLarge = false;
+        unsigned long lastDataMs = millis();
+        while ( size < 0 || length < static_cast<size_t>( size ) ) {
+            int available = stream->available();
+            if ( available <= 0 ) {
+                if ( !http.connected() || millis() - lastDataMs >= Config::FleetOTA::HTTP_TIMEOUT_MS ) {
+                    break;
+                }
+                vTaskDelay( pdMS_TO_TICKS( 5 ) );
+                continue;
+            }
+            if ( length == Config::FleetOTA::MAX_MANIFEST_SIZE ) {
+                tooLarge = true;
+                break;
+            }
+            length += stream->readBytes( chunk + length,
+                                         min( static_cast<size_t>( available ), Config::FleetOTA::MAX_MANIFEST_SIZE - length ) );
+            lastDataMs = millis();
+        }
+        http.end();
+
+        if ( tooLarge ) {
+            log_w( "Fleet update: manifest %s is over %u bytes", url.c_str(),
+                   static_cast<unsigned>( Config::FleetOTA::MAX_MANIFEST_SIZE ) );
+            return false;
+        }
+        String text;
+        text.concat( reinterpret_cast<const char *>( chunk ), length );
+
+        int start = 0;
+        while ( start < static_cast<int>( text.length() ) ) {
+            int end = text.indexOf( '\n', start );
+            if ( end < 0 ) {
+                end = text.length();
+            }
+            String line = text.substring( start, end );
+            start = end + 1;
+
+            line.trim();
+            int equals = line.indexOf( '=' );
+            if ( line.startsWith( "#" ) || equals <= 0 ) {
+                continue;
+            }
+            String key = line.substring( 0, equals );
+            String value = line.substring( equals + 1 );
+            key.trim();
+            value.trim();
+
+            if ( key == "version" ) {
+                manifest.version = value;
+            }
+            else if ( key == "image" ) {
+                manifest.image = value;
+            }
+            else if ( key == "sha256" ) {
+                manifest.sha256 = value;
+            }
+            else if ( key == "delta" ) {
+                manifest.delta = value;
+            }
+            else if ( key == "delta_from" ) {
+                manifest.deltaFrom = value;
+            }
+            else if ( key == "restart" ) {
+                manifest.restart = value == "1";
+            }
+        }
+
+        if ( manifest.version.length() == 0 ) {
+            log_w( "Fleet update: manifest has no version" );
+            return false;
+        }
+        return true;
+    }
+
+    bool FleetUpdater::download( const String &file, bool delta, const String &sha256 ) {
+        String url = urlFor( file );
+
+        HTTPClient http;
+        http.setTimeout( Config::FleetOTA::HTTP_TIMEOUT_MS );
+        http.useHTTP10( true );     // Image bytes only, never chunk headers
+        if ( !http.begin( url ) ) {
+            return false;
+        }
+        int code = http.GET();
+        if ( code != HTTP_CODE_OK ) {
+            log_w( "Fleet update: %s - HTTP %d", url.c_str(), code );
+            http.end();
+            return false;
+        }
+
+        int total = http.getSize();     // -1 if the server didn't say
+        WiFiClient *stream = http.getStreamPtr();
+        log_i( "Fleet update: downloading %s (%d bytes, %s)", file.c_str(), total, delta ? "delta" : "full image" );
+
+        bool ok = true;
+        if ( delta ) {
+            deltaPatcher.begin();
+        }
+        else {
+            ok = ota.begin( sha256 );
+        }
+        size_t received = 0;
+        unsigned long startMs = millis();
+        unsigned long lastDataMs = startMs;
+
+        while ( ok && ( total < 0 || received < static_cast<size_t>( total ) ) ) {
+            int available = stream->available();
+            if ( available <= 0 ) {
+                if ( !http.connected() || millis() - lastDataMs >= Config::FleetOTA::HTTP_TIMEOUT_MS ) {
+                    break;
+                }
+                vTaskDelay( pdMS_TO_TICKS( 5 ) );
+                continue;
+            }
+
+            size_t length = stream->readBytes( chunk, min( static_cast<size_t>( available ), CHUNK_SIZE ) );
+            lastDataMs = millis();
+            received += length;
+            ok = delta ? deltaPatcher.write( chunk, length ) : ota.write( chunk, length );
+
+            // Rate limit: stay behind RATE_LIMIT_BPS so tally polling keeps its share of the air
+            unsigned long dueMs = static_cast<unsigned long>(
+                                      static_cast<uint64_t>( received ) * 1000 / Config::FleetOTA::RATE_LIMIT_BPS );
+            unsigned long elapsedMs = millis() - startMs;
+            if ( elapsedMs < dueMs ) {
+                vTaskDelay( pdMS_TO_TICKS( dueMs - elapsedMs ) );
+            }
+        }
+        http.end();
+
+        if ( ok && total >= 0 && received != static_cast<size_t>( total ) ) {
+            log_w( "Fleet update: download ended after %u of %d bytes", static_cast<unsigned>( received ), total );
+            ok = false;
+        }
+
+        if ( !ok ) {
+            if ( delta ) {
+                deltaPatcher.abort();
+            }
+            else {
+                ota.abort();
+            }
+            return false;
+        }
+
+        bool installed = delta ? deltaPatcher.finish() : ota.finish();
+        if ( installed ) {
+            log_i( "Fleet update: installed %s (%u bytes in %lu ms) - active after restart",
+                   file.c_str(), static_cast<unsigned>( received ), millis() - startMs );
+        }
+        else {
+            log_e( "Fleet update: %s", delta ? deltaPatcher.getError() : ota.getError() );
+        }
+        return installed;
+    }
+
+    String FleetUpdater::urlFor( const String &file ) const {
+        return serverURL + "/" + file;
+    }
+
+    int FleetUpdater::compareVersions( const String &a, const String &b ) {
+        int dashA = a.indexOf( '-' );
+        int dashB = b.indexOf( '-' );
+        String coreA = dashA < 0 ? a : a.substring( 0, dashA );
+        String coreB = dashB < 0 ? b : b.substring( 0, dashB );
+
+        int diff = compareParts( coreA, coreB );
+        if ( diff != 0 ) {
+            return diff;
+        }
+
+        // Same release number: a pre-release sorts before the release
+        if ( dashA < 0 || dashB < 0 ) {
+            return ( dashA < 0 ) - ( dashB < 0 );
+        }
+        return compareParts( a.substring( dashA + 1 ), b.substring( dashB + 1 ) );
+    }
+
+} // namespace Net
+
+
+//  --- EOF --- //
@@ -0,0 +1,287 @@
+#include "Network/OTAPipeline.h"
+#include <Update.h>
+#include <cstring>
+
+
+namespace Net {
+
+    namespace {
+
+        constexpr uint32_t FREE_BLOCK_TIMEOUT = 10000;     // ms a write may wait for flash
+        constexpr uint32_t WRITER_STOP_TIMEOUT = 10000;    // ms to drain the queued blocks
+        constexpr uint32_t WRITER_STACK_SIZE = 4096;
+        constexpr UBaseType_t WRITER_PRIORITY = 2;         // Above the portal tasks
+
+        int hexValue( char c ) {
+            if ( c >= '0' && c <= '9' ) {
+                return c - '0';
+            }
+            if ( c >= 'a' && c <= 'f' ) {
+                return c - 'a' + 10;
+            }
+            if ( c >= 'A' && c <= 'F' ) {
+                return c - 'A' + 10;
+            }
+            return -1;
+        }
+
+    } // namespace
+
+    OTAPipeline::OTAPipeline()
+        : buffers( nullptr )
+        , current( BLOCK_COUNT )
+        , filled( 0 )
+        , freeQueue( nullptr )
+        , fullQueue( nullptr )
+        , writerHandle( nullptr )
+        , failed( false )
+        , bytesWritten( 0 )
+        , checkDigest( false )
+        , active( false )
+        , error( "" )
+        , startMs( 0 )
+        , endMs( 0 ) {
+        memset( digest, 0, sizeof( digest ) );
+    }
+
+    OTAPipeline::~OTAPipeline() {
+        abort();
+    }
+
+    bool OTAPipeline::begin( const String &expectedSha256 ) {
+        abort();
+
+        error = "";
+        failed = false;
+        bytesWritten = 0;
+        filled = 0;
+        current = BLOCK_COUNT;
+        startMs = millis();
+        endMs = 0;
+
+        checkDigest = expectedSha256.length() > 0;
+        if ( checkDigest ) {
+            if ( expectedSha256.length() != DIGEST_SIZE * 2 ) {
+                fail( "SHA-256 digest must be 64 hex digits" );
+                return false;
+            }
+            for ( size_t i = 0; i < DIGEST_SIZE; i++ ) {
+                int high = hexValue( expectedSha256[ i * 2 ] );
+                int low = hexValue( expectedSha256[ i * 2 + 1 ] );
+                if ( high < 0 || low < 0 ) {
+                    fail( "SHA-256 digest must be 64 hex digits" );
+                    return false;
+                }
+                expected[ i ] = static_cast<uint8_t>( ( high << 4 ) | low );
+            }
+        }
+
+        buffers = static_cast<uint8_t *>( malloc( BLOCK_SIZE * BLOCK_COUNT ) );
+        if ( !buffers ) {
+            fail( "Not enough memory for OTA buffers" );
+            return false;
+        }
+
+        freeQueue = xQueueCreateStatic( BLOCK_COUNT, sizeof( uint8_t ), freeStorage, &freeControl );
+        fullQueue = xQueueCreateStatic( BLOCK_COUNT + 1, sizeof( Block ), fullStorage, &fullControl );
+        for ( uint8_t i = 0; i < BLOCK_COUNT; i++ ) {
+            xQueueSend( freeQueue, &i, 0 );
+        }
+
+        if ( !Update.begin( UPDATE_SIZE_UNKNOWN ) ) {
+            Update.printError( Serial );
+            fail( Update.errorString() );
+            release();
+            return false;
+        }
+
+        // The writer only runs once blocks arrive, after begin() returns
+        TaskHandle_t handle = nullptr;
+        if ( xTaskCreate( writerTask, "ota_writer", WRITER_STACK_SIZE, this, WRITER_PRIORITY, &handle ) != pdPASS ) {
+            Update.abort();
+            fail( "Failed to start OTA writer task" );
+            release();
+            return false;
+        }
+        writerHandle = handle;
+
+        mbedtls_sha256_init( &sha );
+        mbedtls_sha256_starts( &sha, 0 );
+        active = true;
+        log_i( "OTA pipeline ready: %u x %u byte blocks, partition %u bytes%s",
+               BLOCK_COUNT, static_cast<unsigned>( BLOCK_SIZE ), static_cast<unsigned>( Update.size() ),
+               checkDigest ? ", SHA-256 check on" : "" );
+        return true;
+    }
+
+    bool OTAPipeline::write( const uint8_t *data, size_t length ) {
+        if ( !active || failed ) {
+            return false;
+        }
+
+        while ( length > 0 ) {
+            if ( current == BLOCK_COUNT ) {
+                if ( xQueueReceive( freeQueue, &current, pdMS_TO_TICKS( FREE_BLOCK_TIMEOUT ) ) != pdTRUE ) {
+                    current = BLOCK_COUNT;
+                    fail( "Timed out waiting for flash" );
+                    return false;
+                }
+                filled = 0;
+            }
+
+            size_t chunk = min( length, BLOCK_SIZE - filled );
+            memcpy( buffers + current * BLOCK_SIZE + filled, data, chunk );
+            filled += chunk;
+            data += chunk;
+            length -= chunk;
+
+            if ( filled == BLOCK_SIZE && !queueCurrent() ) {
+                return false;
+            }
+        }
+        return !failed;
+    }
+
+    bool OTAPipeline::queueCurrent() {
+        Block block = { current, static_cast<uint16_t>( filled ) };
+        current = BLOCK_COUNT;
+        filled = 0;
+        if ( xQueueSend( fullQueue, &block, pdMS_TO_TICKS( FREE_BLOCK_TIMEOUT ) ) != pdTRUE ) {
+            fail( "Timed out waiting for flash" );
+            return false;
+        }
+        return true;
+    }
+
+    bool OTAPipeline::finish() {
+        if ( !active ) {
+            return false;
+        }
+
+        if ( current != BLOCK_COUNT && filled > 0 ) {
+            queueCurrent();
+        }
+        stopWriter();
+        mbedtls_sha256_finish( &sha, digest );
+
+        if ( !failed && checkDigest && memcmp( digest, expected, DIGEST_SIZE ) != 0 ) {
+            fail( "SHA-256 mismatch - image not installed" );
+        }
+
+        bool ok = false;
+        if ( failed ) {
+            Update.abort();
+        }
+        else if ( !Update.end( true ) ) {
+            Update.printError( Serial );
+            fail( Update.errorString() );
+        }
+        else {
+            ok = true;
+        }
+
+        endMs = millis();
+        release();
+
+        uint32_t elapsed = getElapsedMs();
+        log_i( "OTA %s: %u bytes in %lu ms (%.2f MB/s)", ok ? "complete" : "failed",
+               static_cast<unsigned>( bytesWritten ), static_cast<unsigned long>( elapsed ),
+               elapsed ? bytesWritten / 1048.576f / elapsed : 0.0f );
+        return ok;
+    }
+
+    void OTAPipeline::abort() {
+        if ( !active ) {
+            return;
+        }
+
+        failed = true;
+        stopWriter();
+        Update.abort();
+        endMs = millis();
+        release();
+        log_w( "OTA aborted after %u bytes", static_cast<unsigned>( bytesWritten ) );
+    }
+
+    uint32_t OTAPipeline::getElapsedMs() const {
+        return ( endMs ? endMs : millis() ) - startMs;
+    }
+
+    String OTAPipeline::getDigestHex() const {
+        char hex[ DIGEST_SIZE * 2 + 1 ];
+        for ( size_t i = 0; i < DIGEST_SIZE; i++ ) {
+            snprintf( hex + i * 2, 3, "%02x", digest[ i ] );
+        }
+        return String( hex );
+    }
+
+    void OTAPipeline::writerTask( void *param ) {
+        OTAPipeline *self = static_cast<OTAPipeline *>( param );
+        Block block;
+
+        while ( xQueueReceive( self->fullQueue, &block, portMAX_DELAY ) == pdTRUE && block.length > 0 ) {
+            uint8_t *data = self->buffers + block.index * BLOCK_SIZE;
+            if ( !self->failed ) {
+                mbedtls_sha256_update( &self->sha, data, block.length );
+                size_t written = Update.write( data, block.length );
+                self->bytesWritten += written;
+                if ( written != block.length ) {
+                    log_e( "Flash write error: expected %u bytes, wrote %u bytes",
+                           block.length, static_cast<unsigned>( written ) );
+                    self->fail( Update.errorString() );
+                }
+            }
+            xQueueSend( self->freeQueue, &block.index, 0 );
+        }
+
+        self->writerHandle = nullptr;
+        vTaskDelete( nullptr );
+    }
+
+    void OTAPipeline::stopWriter() {
+        if ( !writerHandle ) {
+            return;
+        }
+
+        // Queued blocks are written first; the stop marker is always last
+        Block stop = { 0, 0 };
+        xQueueSend( fullQueue, &stop, pdMS_TO_TICKS( WRITER_STOP_TIMEOUT ) );
+
+        uint32_t start = millis();
+        while ( writerHandle ) {
+            if ( millis() - start >= WRITER_STOP_TIMEOUT ) {
+                log_e( "OTA writer did not stop - deleting" );
+                vTaskDelete( writerHandle.load() );
+                writerHandle = nullptr;
+                fail( "OTA writer stalled" );
+                break;
+            }
+            delay( 1 );
+        }
+    }
+
+    void OTAPipeline::release() {
+        if ( active ) {
+            mbedtls_sha256_free( &sha );
+        }
+        active = false;
+        free( buffers );
+        buffers = nullptr;
+        freeQueue = nullptr;
+        fullQueue = nullptr;
+        current = BLOCK_COUNT;
+        filled = 0;
+    }
+
+    void OTAPipeline::fail( const char *reason ) {
+        if ( !failed || error[ 0 ] == '\0' ) {
+            error = reason;
+            log_e( "OTA: %s", reason );
+        }
+        failed = true;
+    }
+
+} // namespace Net
+
+
+//  --- EOF --- //
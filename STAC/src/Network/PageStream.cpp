@@ -0,0 +1,95 @@
+#include "Network/PageStream.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <cstdarg>
+#include <cstring>
+
+
+namespace Net {
+
+    PageStream::PageStream( WebServer &server )
+        : server( server )
+        , used( 0 )
+        , bytesSent( 0 )
+        , createdAtUs( esp_timer_get_time() )
+        , firstChunkUs( 0 )
+        , minFreeHeap( ESP.getFreeHeap() ) {
+    }
+
+    void PageStream::begin( int code, const char *contentType ) {
+        server.setContentLength( CONTENT_LENGTH_UNKNOWN );
+        server.send( code, contentType, "" );
+    }
+
+    void PageStream::write( const char *text ) {
+        write( text, strlen( text ) );
+    }
+
+    void PageStream::write( const char *data, size_t length ) {
+        if ( length > BUFFER_SIZE - used ) {
+            flush();
+        }
+
+        // Anything that doesn't fit in the buffer goes out as its own chunk, uncopied
+        if ( length >= BUFFER_SIZE ) {
+            sendChunk( data, length );
+            return;
+        }
+
+        memcpy( buffer + used, data, length );
+        used += length;
+    }
+
+    void PageStream::printf( const char *format, ... ) {
+        va_list args;
+        va_start( args, format );
+        va_list retry;
+        va_copy( retry, args );
+
+        int length = vsnprintf( buffer + used, BUFFER_SIZE - used, format, args );
+        if ( length >= 0 && static_cast<size_t>( length ) >= BUFFER_SIZE - used ) {
+            flush();
+            length = vsnprintf( buffer, BUFFER_SIZE, format, retry );
+            if ( length >= static_cast<int>( BUFFER_SIZE ) ) {
+                log_w( "Formatted text truncated to %d characters", static_cast<int>( BUFFER_SIZE - 1 ) );
+                length = BUFFER_SIZE - 1;
+            }
+        }
+        if ( length > 0 ) {
+            used += length;
+        }
+
+        va_end( retry );
+        va_end( args );
+    }
+
+    void PageStream::end() {
+        flush();
+        server.sendContent( "", 0 );    // Terminating chunk
+    }
+
+    void PageStream::flush() {
+        if ( used > 0 ) {
+            sendChunk( buffer, used );
+            used = 0;
+        }
+    }
+
+    void PageStream::sendChunk( const char *data, size_t length ) {
+        if ( bytesSent == 0 ) {
+            firstChunkUs = static_cast<uint32_t>( esp_timer_get_time() - createdAtUs );
+        }
+
+        server.sendContent( data, length );
+        bytesSent += length;
+
+        uint32_t freeHeap = ESP.getFreeHeap();
+        if ( freeHeap < minFreeHeap ) {
+            minFreeHeap = freeHeap;
+        }
+    }
+
+} // namespace Net
+
+
+//  --- EOF --- //
@@ -0,0 +1,74 @@
+#include "Network/ServiceTask.h"
+
+
+namespace Net {
+
+    ServiceTask::ServiceTask( const char *name, PollFunction poll )
+        : name( name )
+        , poll( poll )
+        , idleTicks( 1 )
+        , handle( nullptr )
+        , stopRequested( false )
+        , running( false )
+        , polls( 0 ) {
+    }
+
+    ServiceTask::~ServiceTask() {
+        stop();
+    }
+
+    bool ServiceTask::start( uint32_t stackSize, UBaseType_t priority, TickType_t idleTicks ) {
+        if ( handle ) {
+            return true;
+        }
+
+        this->idleTicks = idleTicks;
+        stopRequested = false;
+        running = true;
+
+        if ( xTaskCreate( run, name, stackSize, this, priority, &handle ) != pdPASS ) {
+            log_e( "Failed to create task %s", name );
+            running = false;
+            handle = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    void ServiceTask::stop() {
+        if ( !handle ) {
+            return;
+        }
+
+        requestStop();
+
+        uint32_t waitedMs = 0;
+        while ( running ) {
+            vTaskDelay( pdMS_TO_TICKS( STOP_CHECK_MS ) );
+            waitedMs += STOP_CHECK_MS;
+            if ( waitedMs == STOP_WARN_MS ) {
+                log_w( "Task %s is still finishing a request", name );
+            }
+        }
+
+        handle = nullptr;
+    }
+
+    void ServiceTask::run( void *param ) {
+        ServiceTask *self = static_cast<ServiceTask *>( param );
+
+        while ( !self->stopRequested ) {
+            self->poll();
+            self->polls++;
+            vTaskDelay( self->idleTicks );
+        }
+
+        // Last use of self: once this is clear, stop() returns and the owner may go away
+        self->running = false;
+        vTaskDelete( nullptr );
+    }
+
+} // namespace Net
+
+
+//  --- EOF --- //
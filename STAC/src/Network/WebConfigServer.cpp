@@ -8,28 +8,99 @@
 
 #include "Network/WebConfigServer.h"
 #include "Network/WebConfigPages.h"
+#include "Network/WebAssets.h"
 #include "Storage/ConfigManager.h"
 #include "Device_Config.h"
 #include "build_info.h"
+#include "Utils/BootProfiler.h"
 #include <esp_wifi.h>
 #include <esp_mac.h>
 
 
 namespace Net {
 
+    namespace {
+
+        /**
+         * @brief Minimal JSON object writer on top of PageStream
+         */
+        class JsonObject {
+          public:
+            explicit JsonObject( PageStream &out )
+                : out( out )
+                , first( true ) {
+                out.write( "{" );
+            }
+
+            void addString( const char *key, const char *value ) {
+                addKey( key );
+                out.write( "\"" );
+                for ( const char *c = value; *c; c++ ) {
+                    if ( *c == '"' || *c == '\\' ) {
+                        char escaped[ 2 ] = { '\\', *c };
+                        out.write( escaped, 2 );
+                    }
+                    else if ( static_cast<uint8_t>( *c ) < 0x20 ) {
+                        out.printf( "\\u%04x", static_cast<uint8_t>( *c ) );
+                    }
+                    else {
+                        out.write( c, 1 );
+                    }
+                }
+                out.write( "\"" );
+            }
+
+            void addNumber( const char *key, long value ) {
+                addKey( key );
+                out.printf( "%ld", value );
+            }
+
+            void addBool( const char *key, bool value ) {
+                addKey( key );
+                out.write( value ? "true" : "false" );
+            }
+
+            void close() {
+                out.write( "}" );
+            }
+
+          private:
+            PageStream &out;
+            bool first;
+
+            void addKey( const char *key ) {
+                out.printf( "%s\"%s\":", first ? "" : ",", key );
+                first = false;
+            }
+        };
+
+    } // namespace
+
     WebConfigServer::WebConfigServer( const String &deviceID )
         : apIP( 192, 168, 6, 14 )
         , apGateway( 0, 0, 0, 0 )
         , apNetmask( 255, 255, 255, 0 )
         , server( nullptr )
+        , uploadServer( nullptr )
         , dnsServer( nullptr )
         , deviceID( deviceID )
         , serverRunning( false )
+        , dnsTask( "portal_dns", [ this ]() {
+            dnsServer->processNextRequest();
+        } )
+        , webTask( "portal_web", [ this ]() {
+            server->handleClient();
+        } )
+        , uploadTask( "portal_upload", [ this ]() {
+            uploadServer->handleClient();
+        } )
+        , deltaPatcher( ota )
+        , uploadKind( UploadKind::PENDING )
+        , resultClaimed( false )
         , operationComplete( false )
         , displayCallback( nullptr )
         , resetCheckCallback( nullptr )
-        , preRestartCallback( nullptr )
-        , lastDisplayUpdate( 0 ) {
+        , preRestartCallback( nullptr ) {
         // Get MAC address and format it for display
         uint8_t mac[ 6 ];
         esp_efuse_mac_get_default( mac );
@@ -92,13 +163,56 @@ namespace Net {
 
         // Create and configure web server
         server = new WebServer( 80 );
+        static const char *cacheHeaders[] = { "If-None-Match" };
+        server->collectHeaders( cacheHeaders, 1 );
         registerEndpoints();
         server->begin();
         server->enableDelay( false ); // Disable 1ms delay in handleClient()
 
+        // Upload server: the page posts firmware here, cross-origin, so it needs CORS
+        uploadServer = new WebServer( UPLOAD_PORT );
+        uploadServer->enableCORS( true );
+        registerUploadEndpoints();
+        uploadServer->begin();
+        uploadServer->enableDelay( false );
+
         serverRunning = true;
-        log_i( "Web portal server started on port 80" );
 
+        if ( !startTasks() ) {
+            log_e( "Failed to start portal tasks" );
+            end();
+            return false;
+        }
+
+        log_i( "Web portal server started on ports 80 and %u", UPLOAD_PORT );
+
+        return true;
+    }
+
+    bool WebConfigServer::startTasks() {
+        bool created = dnsTask.start( TASK_STACK_SIZE, TASK_PRIORITY, TASK_IDLE_TICKS );
+        created = created && webTask.start( TASK_STACK_SIZE, TASK_PRIORITY, TASK_IDLE_TICKS );
+        created = created && uploadTask.start( TASK_STACK_SIZE, TASK_PRIORITY, TASK_IDLE_TICKS );
+
+        return created;
+    }
+
+    void WebConfigServer::stopTasks() {
+        // Ask all three at once; a firmware upload in progress is finished (or times out) first
+        dnsTask.requestStop();
+        webTask.requestStop();
+        uploadTask.requestStop();
+
+        uploadTask.stop();
+        webTask.stop();
+        dnsTask.stop();
+    }
+
+    bool WebConfigServer::claimResult() {
+        if ( resultClaimed.exchange( true ) ) {
+            log_w( "Portal result already set - ignoring request" );
+            return false;
+        }
         return true;
     }
 
@@ -110,16 +224,8 @@ namespace Net {
 
         log_i( "Waiting for user action via web portal" );
 
-        // Reset state
-        operationComplete = false;
-        result.type = PortalResultType::NONE;
-        lastDisplayUpdate = millis();
-
-        // Handle client requests until operation completes
+        // The portal tasks serve requests; the result is set by whichever handler finishes first
         while ( !operationComplete ) {
-            dnsServer->processNextRequest();  // Process DNS requests for captive portal
-            server->handleClient();
-
             // Check for reset button via callback
             if ( resetCheckCallback && resetCheckCallback() ) {
                 log_i( "Reset requested during portal session - restarting" );
@@ -129,14 +235,12 @@ namespace Net {
                 ESP.restart();
             }
 
-            // Update pulsing display via callback
-            unsigned long now = millis();
-            if ( displayCallback && ( now - lastDisplayUpdate >= DISPLAY_UPDATE_INTERVAL ) ) {
-                lastDisplayUpdate = now;
+            // Let the display animate (the callback paces itself)
+            if ( displayCallback ) {
                 displayCallback();
             }
 
-            yield();
+            delay( 10 );
         }
 
         log_i( "Portal operation complete: type=%d", static_cast<int>( result.type ) );
@@ -150,6 +254,10 @@ namespace Net {
 
         log_i( "Stopping web portal server" );
 
+        // Stop the tasks before the servers they use
+        stopTasks();
+        ota.abort();
+
         // Stop DNS server
         if ( dnsServer ) {
             dnsServer->stop();
@@ -165,6 +273,13 @@ namespace Net {
             server = nullptr;
         }
 
+        if ( uploadServer ) {
+            uploadServer->stop();
+            uploadServer->close();
+            delete uploadServer;
+            uploadServer = nullptr;
+        }
+
         // Stop mDNS
         MDNS.end();
 
@@ -197,10 +312,20 @@ namespace Net {
             }
             else {
                 // Regular 404
-                server->send( 404, "text/html", WebConfig::NOT_FOUND );
+                sendAsset( 404, WebAssets::NOT_FOUND_PAGE );
             }
         } );
 
+        // GET /info - Device and configuration details shown on the portal page (JSON)
+        server->on( "/info", HTTP_GET, [ this ]() {
+            handleInfo();
+        } );
+
+        // GET /boot - Boot phase timings of the last few boots (JSON)
+        server->on( "/boot", HTTP_GET, [ this ]() {
+            server->send( 200, "application/json", Utils::BootProfiler::toJSON() );
+        } );
+
         // POST /config - Process configuration submission
         server->on( "/config", HTTP_POST, [ this ]() {
             handleConfigSubmit();
@@ -210,9 +335,11 @@ namespace Net {
         server->on( "/factory-reset", HTTP_POST, [ this ]() {
             handleFactoryReset();
         } );
+    }
 
+    void WebConfigServer::registerUploadEndpoints() {
         // POST /update - Handle firmware upload and flashing
-        server->on( "/update", HTTP_POST,
+        uploadServer->on( "/update", HTTP_POST,
         [ this ]() {
             // This lambda runs after upload completes
             handleUpdateComplete();
@@ -221,24 +348,46 @@ namespace Net {
             // This lambda handles the actual file upload chunks
             handleFileUpload();
         }
-                  );
+                        );
+
+        // OPTIONS /update - CORS preflight (the page watches upload progress)
+        uploadServer->on( "/update", HTTP_OPTIONS, [ this ]() {
+            uploadServer->send( 204 );
+        } );
     }
 
     void WebConfigServer::handleRoot() {
-        String page = buildIndexPage();
-        server->send( 200, "text/html", page );
+        sendAsset( 200, WebAssets::INDEX_PAGE );
         log_v( "Served portal index page" );
     }
 
+    void WebConfigServer::sendAsset( int code, const WebAssets::WebAsset &asset ) {
+        // The page only changes with the firmware, so a matching ETag means the browser copy is current
+        if ( code == 200 && server->header( "If-None-Match" ) == asset.etag ) {
+            server->sendHeader( "ETag", asset.etag );
+            server->send( 304 );
+            return;
+        }
+
+        server->sendHeader( "Content-Encoding", "gzip" );
+        server->sendHeader( "ETag", asset.etag );
+        server->sendHeader( "Cache-Control", "no-cache" );     // Revalidate each visit
+        server->send_P( code, "text/html", reinterpret_cast<const char *>( asset.data ), asset.size );
+    }
+
     void WebConfigServer::handleConfigSubmit() {
         log_i( "Processing configuration submission" );
 
         // Send confirmation page immediately
-        server->send( 200, "text/html", WebConfig::CONFIG_RECEIVED );
+        sendAsset( 200, WebAssets::CONFIG_RECEIVED_PAGE );
 
         // Ensure response is sent before continuing
         delay( 100 );
 
+        if ( !claimResult() ) {
+            return;
+        }
+
         // Extract form data
         String model = server->arg( "stModel" );
         result.configData.switchModel = model;
@@ -247,6 +396,12 @@ namespace Net {
         result.configData.switchIPString = server->arg( "stIP" );
         result.configData.switchPort = static_cast<uint16_t>( server->arg( "stPort" ).toInt() );
         result.configData.pollInterval = static_cast<unsigned long>( server->arg( "pollTime" ).toInt() );
+        result.configData.updateURL = server->arg( "updURL" );
+        result.configData.updateURL.trim();
+        long profile = server->arg( "pwrProf" ).toInt();
+        if ( profile >= static_cast<long>( PowerProfile::BALANCED ) && profile <= static_cast<long>( PowerProfile::BATTERY_SAVER ) ) {
+            result.configData.powerProfile = static_cast<PowerProfile>( profile );
+        }
 
         if ( model == "V-60HD" ) {
             result.configData.maxChannel = static_cast<uint8_t>( server->arg( "stChan" ).toInt() );
@@ -261,6 +416,7 @@ namespace Net {
             log_i( "    Switch IP: %s:%d", result.configData.switchIPString.c_str(), result.configData.switchPort );
             log_i( "    Max Channel: %d", result.configData.maxChannel );
             log_i( "    Poll Interval: %lu ms", result.configData.pollInterval );
+            log_i( "    Power Profile: %d", static_cast<int>( result.configData.powerProfile ) );
         }
         else if ( model == "V-160HD" ) {
             result.configData.lanUserID = server->arg( "stnetUser" );
@@ -276,6 +432,7 @@ namespace Net {
             log_i( "    LAN User: %s", result.configData.lanUserID.c_str() );
             log_i( "    Max HDMI: %d, Max SDI: %d", result.configData.maxHDMIChannel, result.configData.maxSDIChannel );
             log_i( "    Poll Interval: %lu ms", result.configData.pollInterval );
+            log_i( "    Power Profile: %d", static_cast<int>( result.configData.powerProfile ) );
         }
 
         result.type = PortalResultType::CONFIG_RECEIVED;
@@ -286,11 +443,15 @@ namespace Net {
         log_i( "Processing factory reset request from web portal" );
 
         // Send confirmation page immediately
-        server->send( 200, "text/html", WebConfig::FACTORY_RESET_RECEIVED );
+        sendAsset( 200, WebAssets::FACTORY_RESET_PAGE );
 
         // Ensure response is sent before continuing
         delay( 100 );
 
+        if ( !claimResult() ) {
+            return;
+        }
+
         log_i( "Factory reset confirmed via web portal" );
 
         result.type = PortalResultType::FACTORY_RESET;
@@ -300,231 +461,211 @@ namespace Net {
     void WebConfigServer::handleUpdateComplete() {
         // Build and send result page
         String resultPage = buildOTAResultPage();
-        server->send( 200, "text/html", resultPage );
+        uploadServer->send( 200, "text/html", resultPage );
 
         log_i( "Update result page sent to client" );
-        log_i( "  Filename: %s", result.otaResult.filename.c_str() );
-        log_i( "  Bytes: %d", result.otaResult.bytesWritten );
-        log_i( "  Status: %s", result.otaResult.statusMessage.c_str() );
+        log_i( "  Filename: %s", uploadResult.filename.c_str() );
+        log_i( "  Bytes: %d", uploadResult.bytesWritten );
+        log_i( "  Status: %s", uploadResult.statusMessage.c_str() );
+
+        if ( !claimResult() ) {
+            return;
+        }
 
         // Set result type based on success
+        result.otaResult = uploadResult;
         result.type = result.otaResult.success ? PortalResultType::OTA_SUCCESS : PortalResultType::OTA_FAILED;
         operationComplete = true;
     }
 
     void WebConfigServer::handleFileUpload() {
-        HTTPUpload& upload = server->upload();
+        HTTPUpload& upload = uploadServer->upload();
 
         if ( upload.status == UPLOAD_FILE_START ) {
             // Start of upload
-            result.otaResult.filename = upload.filename;
-            result.otaResult.success = false;
-            result.otaResult.bytesWritten = 0;
-            result.otaResult.statusMessage = "Starting upload...";
+            uploadResult = OTAUpdateResult();
+            uploadResult.filename = upload.filename;
+            uploadResult.statusMessage = "No firmware data received";
+            uploadKind = UploadKind::PENDING;
 
             log_i( "Firmware upload started: %s", upload.filename.c_str() );
-            log_i( "Expected file size: %d bytes", upload.totalSize );
-
-            // Begin OTA update with UPDATE_SIZE_UNKNOWN to auto-detect
-            if ( !Update.begin( UPDATE_SIZE_UNKNOWN ) ) {
-                result.otaResult.statusMessage = "Failed to begin OTA update";
-                result.otaResult.success = false;
-                log_e( "Update.begin() failed" );
-                Update.printError( Serial );
-            }
-            else {
-                log_i( "OTA partition ready for writing (size: %d bytes)", Update.size() );
-            }
         }
         else if ( upload.status == UPLOAD_FILE_WRITE ) {
-            // Write chunk to flash
-            size_t written = Update.write( upload.buf, upload.currentSize );
-            if ( written != upload.currentSize ) {
-                log_e( "Write error: expected %d bytes, wrote %d bytes",
-                       upload.currentSize, written );
+            uploadResult.bytesReceived += upload.currentSize;
+
+            // The first chunk tells a full image from a delta patch
+            if ( uploadKind == UploadKind::PENDING ) {
+                if ( DeltaPatcher::isPatch( upload.buf, upload.currentSize ) ) {
+                    uploadKind = UploadKind::DELTA;
+                    uploadResult.delta = true;
+                    deltaPatcher.begin();
+                }
+                else {
+                    // Data is flashed by the pipeline's writer task while the next chunk arrives
+                    uploadKind = UploadKind::IMAGE;
+                    if ( !ota.begin( uploadServer->arg( "sha256" ) ) ) {
+                        uploadResult.statusMessage = "Failed to begin OTA update: " + String( ota.getError() );
+                    }
+                }
             }
-            result.otaResult.bytesWritten += written;
 
-            // Log progress periodically
-            if ( result.otaResult.bytesWritten % 32768 == 0 ) {
-                log_v( "Written: %d bytes", result.otaResult.bytesWritten );
+            // Hand chunk on; the first error is kept for the result page
+            if ( uploadKind == UploadKind::DELTA ) {
+                deltaPatcher.write( upload.buf, upload.currentSize );
+            }
+            else if ( ota.isActive() ) {
+                ota.write( upload.buf, upload.currentSize );
             }
         }
         else if ( upload.status == UPLOAD_FILE_END ) {
             // Upload complete
-            if ( Update.end( true ) ) {
-                // Success!
-                result.otaResult.success = true;
-                result.otaResult.statusMessage = "Firmware updated successfully";
-                log_i( "OTA update successful! Total bytes: %d", result.otaResult.bytesWritten );
+            if ( uploadKind == UploadKind::DELTA ) {
+                uploadResult.success = deltaPatcher.finish();
+            }
+            else if ( ota.isActive() ) {
+                uploadResult.success = ota.finish();
             }
             else {
-                // Failed
-                result.otaResult.success = false;
-                result.otaResult.statusMessage = "Update failed: " + String( Update.errorString() );
-                log_e( "OTA update failed: %s", Update.errorString() );
-                Update.printError( Serial );
+                return;     // Nothing received or begin failed, message already set
+            }
+
+            uploadResult.bytesWritten = ota.getBytesWritten();
+            uploadResult.durationMs = ota.getElapsedMs();
+            if ( uploadResult.success ) {
+                uploadResult.sha256 = ota.getDigestHex();
+                uploadResult.statusMessage = "Firmware updated successfully";
+                log_i( "OTA update successful! SHA-256: %s", uploadResult.sha256.c_str() );
+            }
+            else {
+                const char *reason = uploadKind == UploadKind::DELTA ? deltaPatcher.getError() : ota.getError();
+                uploadResult.statusMessage = "Update failed: " + String( reason );
             }
         }
         else if ( upload.status == UPLOAD_FILE_ABORTED ) {
             // Upload was cancelled
-            Update.abort();
-            result.otaResult.success = false;
-            result.otaResult.statusMessage = "Upload cancelled by user";
+            ota.abort();
+            uploadResult.success = false;
+            uploadResult.bytesWritten = ota.getBytesWritten();
+            uploadResult.statusMessage = "Upload cancelled by user";
             log_w( "OTA upload aborted" );
         }
     }
 
 
-    String WebConfigServer::buildIndexPage() const {
-        // Get firmware version info
-        String fwVersion = BUILD_FULL_VERSION;  // "3.0.0-RC.11 (b826c4)"
-        String gitInfo = String( BUILD_GIT_COMMIT ) + " @ " + String( BUILD_DATE );
-        String coreVersion = String( ESP_ARDUINO_VERSION_MAJOR ) + "." +
-                             String( ESP_ARDUINO_VERSION_MINOR ) + "." +
-                             String( ESP_ARDUINO_VERSION_PATCH );
-        String sdkVersion = esp_get_idf_version();
+    void WebConfigServer::handleInfo() {
+        uint32_t heapBefore = ESP.getFreeHeap();
+
+        PageStream out( *server );
+        server->sendHeader( "Cache-Control", "no-store" );
+        out.begin( 200, "application/json" );
+        writeInfoJSON( out );
+        out.end();
+
+        log_d( "Served device info: %u bytes, first chunk after %lu us, peak heap use %lu bytes",
+               static_cast<unsigned>( out.getBytesSent() ),
+               static_cast<unsigned long>( out.getFirstChunkUs() ),
+               static_cast<unsigned long>( heapBefore - out.getMinFreeHeap() ) );
+    }
 
+    void WebConfigServer::writeInfoJSON( PageStream &out ) const {
         // Load configuration from NVS
         Storage::ConfigManager configMgr;
         configMgr.begin();
 
         bool isConfigured = configMgr.isProvisioned();
-
-        // Build complete page
-        String page;
-        page.reserve( 8192 ); // Pre-allocate to reduce fragmentation
-
-        page += WebConfig::PAGE_HEAD;
-        page += WebConfig::DEVICE_INFO_OPEN;
-        page += "<p><strong>Device:</strong> " STAC_BOARD_NAME "</p>";
-        page += "<p><strong>SSID:</strong> " + deviceID + "</p>";
-        page += "<p><strong>MAC:</strong> " + macAddress + "</p>";
-        page += "<p><strong>Version:</strong> " + fwVersion + "</p>";
-        page += WebConfig::DEVICE_INFO_CLOSE;
-
-        // Hidden info for modal (accessed by JavaScript)
-        page += "<div id='geek-info' style='display:none;'><pre style='font-family: monospace; font-size: 12px; line-height: 1.4;'>";
-        page += "==========================================";
-        page += "\n                  STAC";
-        page += "\n        A Roland Smart Tally Client";
-        page += "\n             by: Team STAC";
-        page += "\n      github.com/Xylopyrographer/STAC";
-        page += "\n";
-        page += "\n    Device: " STAC_BOARD_NAME;
-        page += "\n    SSID: " + deviceID;
-        page += "\n    Access: http://stac.local";
-        page += "\n        or: http://" + apIP.toString();
-        page += "\n    MAC: " + macAddress;
-        page += "\n    Version: " + fwVersion;
-
-        // Check if device is in peripheral mode (regardless of configuration state)
         bool isPeripheralMode = configMgr.loadPModeEnabled();
 
-        if ( !isConfigured && !isPeripheralMode ) {
-            // Not configured and not in peripheral mode
-            page += "\n  --------------------------------------";
-            page += "\n     >>> DEVICE NOT CONFIGURED <<<";
-        }
-        else if ( isPeripheralMode && !isConfigured ) {
-            // Peripheral mode but not configured for normal mode
-            // Load peripheral-specific settings
-            bool pmCameraMode;
-            uint8_t pmBrightness;
-            configMgr.loadPeripheralSettings( pmCameraMode, pmBrightness );
-
-            page += "\n  --------------------------------------";
-            page += "\n     >>> DEVICE NOT CONFIGURED <<<";
-            page += "\n     Operating in Peripheral Mode";
-            page += "\n    Receiving tally via GROVE port";
-            page += "\n  --------------------------------------";
-            page += "\n    Tally Mode: " + String( pmCameraMode ? "Camera Operator" : "Talent" );
-            page += "\n    Brightness Level: " + String( pmBrightness );
-        }
-        else {
-            // Load WiFi config
-            String wifiSSID, wifiPassword;
-            configMgr.loadWiFiCredentials( wifiSSID, wifiPassword );
-
-            // Load switch config
-            String switchModel;
-            IPAddress switchIPAddr;
-            uint16_t switchPort;
-            String username, password;
-            configMgr.loadSwitchConfig( switchModel, switchIPAddr, switchPort, username, password );
-
-            // Load protocol-specific operations
-            StacOperations ops;
-            if ( switchModel == "V-60HD" ) {
-                configMgr.loadV60HDConfig( ops );
-            }
-            else if ( switchModel == "V-160HD" ) {
-                configMgr.loadV160HDConfig( ops );
-            }
-
-            // Determine tally mode
-            String tallyMode = ops.cameraOperatorMode ? "Camera Operator" : "Talent";
-
-            // Determine operating mode
-            bool isPeripheralMode = configMgr.loadPModeEnabled();
-            String operatingMode = isPeripheralMode ? "Peripheral" : "Normal";
-
-            // For peripheral mode, load peripheral-specific settings
+        char text[ 24 ];
+        JsonObject info( out );
+
+        // Device
+        info.addString( "board", STAC_BOARD_NAME );
+        info.addString( "ssid", deviceID.c_str() );
+        snprintf( text, sizeof( text ), "%u.%u.%u.%u", apIP[ 0 ], apIP[ 1 ], apIP[ 2 ], apIP[ 3 ] );
+        info.addString( "ip", text );
+        info.addString( "mac", macAddress.c_str() );
+        info.addString( "version", BUILD_FULL_VERSION );    // "3.0.0-RC.11 (b826c4)"
+        info.addString( "git", BUILD_GIT_COMMIT " @ " BUILD_DATE );
+        snprintf( text, sizeof( text ), "%d.%d.%d", ESP_ARDUINO_VERSION_MAJOR, ESP_ARDUINO_VERSION_MINOR, ESP_ARDUINO_VERSION_PATCH );
+        info.addString( "core", text );
+        info.addString( "sdk", esp_get_idf_version() );
+
+        info.addBool( "configured", isConfigured );
+        info.addBool( "peripheral", isPeripheralMode );
+
+        if ( !isConfigured ) {
             if ( isPeripheralMode ) {
+                // Peripheral mode but not configured for normal mode
                 bool pmCameraMode;
                 uint8_t pmBrightness;
                 configMgr.loadPeripheralSettings( pmCameraMode, pmBrightness );
-                ops.cameraOperatorMode = pmCameraMode;
-                ops.displayBrightnessLevel = pmBrightness;
-                tallyMode = pmCameraMode ? "Camera Operator" : "Talent";
-            }
-
-            page += "\n  --------------------------------------";
-            page += "\n    WiFi Network SSID: " + wifiSSID;
-            page += "\n    Switch IP: " + switchIPAddr.toString();
-            page += "\n    Switch Port #: " + String( switchPort );
-            page += "\n  =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=";
-            page += "\n    Configured for Model: " + switchModel;
-
-            // Display channel info based on model
-            if ( ops.isV60HD() ) {
-                page += "\n    Active Tally Channel: " + String( ops.tallyChannel );
-                page += "\n    Max Tally Channel: " + String( ops.maxChannelCount );
-            }
-            else if ( ops.isV160HD() ) {
-                // V-160HD shows HDMI/SDI format
-                if ( ops.tallyChannel > 8 ) {
-                    page += "\n    Active Tally Channel: SDI " + String( ops.tallyChannel - 8 );
-                }
-                else {
-                    page += "\n    Active Tally Channel: HDMI " + String( ops.tallyChannel );
-                }
-                page += "\n    Max HDMI Tally Channel: " + String( ops.maxHDMIChannel );
-                page += "\n    Max SDI Tally Channel: " + String( ops.maxSDIChannel );
+                info.addString( "tallyMode", pmCameraMode ? "Camera Operator" : "Talent" );
+                info.addNumber( "brightness", pmBrightness );
             }
+            info.close();
+            return;
+        }
 
-            page += "\n    Tally Mode: " + tallyMode;
-            page += "\n    Auto start: " + String( ops.autoStartEnabled ? "Enabled" : "Disabled" );
-            page += "\n    Brightness Level: " + String( ops.displayBrightnessLevel );
-            page += "\n    Polling Interval: " + String( ops.statusPollInterval ) + " ms";
-            page += "\n    Operating mode: " + operatingMode;
+        // Load WiFi config
+        String wifiSSID, wifiPassword;
+        configMgr.loadWiFiCredentials( wifiSSID, wifiPassword );
+
+        // Load switch config
+        String switchModel;
+        IPAddress switchIPAddr;
+        uint16_t switchPort = 0;
+        String username, password;
+        configMgr.loadSwitchConfig( switchModel, switchIPAddr, switchPort, username, password );
+
+        // Load protocol-specific operations
+        StacOperations ops;
+        if ( switchModel == "V-60HD" ) {
+            configMgr.loadV60HDConfig( ops );
+        }
+        else if ( switchModel == "V-160HD" ) {
+            configMgr.loadV160HDConfig( ops );
         }
 
-        page += "\n  =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=";
-        page += "\n    Git: " + gitInfo;
-        page += "\n    Core: " + coreVersion;
-        page += "\n    SDK: " + sdkVersion;
-        page += "\n==========================================";
-        page += "</pre></div>";
+        // For peripheral mode, show peripheral-specific settings
+        if ( isPeripheralMode ) {
+            bool pmCameraMode;
+            uint8_t pmBrightness;
+            configMgr.loadPeripheralSettings( pmCameraMode, pmBrightness );
+            ops.cameraOperatorMode = pmCameraMode;
+            ops.displayBrightnessLevel = pmBrightness;
+        }
 
-        page += WebConfig::LANDING_PAGE;
-        page += WebConfig::TAB_BUTTONS;
-        page += WebConfig::TAB_SETUP;
-        page += WebConfig::TAB_MAINTENANCE;
-        page += WebConfig::PAGE_SCRIPT;
-        page += WebConfig::PAGE_FOOTER;
+        info.addString( "wifiSsid", wifiSSID.c_str() );
+        snprintf( text, sizeof( text ), "%u.%u.%u.%u", switchIPAddr[ 0 ], switchIPAddr[ 1 ], switchIPAddr[ 2 ], switchIPAddr[ 3 ] );
+        info.addString( "switchIp", text );
+        info.addNumber( "switchPort", switchPort );
+        info.addString( "model", switchModel.c_str() );
+
+        // Channel info based on model
+        if ( ops.isV60HD() ) {
+            snprintf( text, sizeof( text ), "%d", ops.tallyChannel );
+            info.addString( "channel", text );
+            info.addNumber( "maxChannel", ops.maxChannelCount );
+        }
+        else if ( ops.isV160HD() ) {
+            // V-160HD shows HDMI/SDI format
+            if ( ops.tallyChannel > 8 ) {
+                snprintf( text, sizeof( text ), "SDI %d", ops.tallyChannel - 8 );
+            }
+            else {
+                snprintf( text, sizeof( text ), "HDMI %d", ops.tallyChannel );
+            }
+            info.addString( "channel", text );
+            info.addNumber( "maxHdmi", ops.maxHDMIChannel );
+            info.addNumber( "maxSdi", ops.maxSDIChannel );
+        }
 
-        return page;
+        info.addString( "tallyMode", ops.cameraOperatorMode ? "Camera Operator" : "Talent" );
+        info.addBool( "autoStart", ops.autoStartEnabled );
+        info.addNumber( "brightness", ops.displayBrightnessLevel );
+        info.addNumber( "pollInterval", static_cast<long>( ops.statusPollInterval ) );
+        info.addString( "mode", isPeripheralMode ? "Peripheral" : "Normal" );
+        info.close();
     }
 
     String WebConfigServer::buildOTAResultPage() const {
@@ -533,18 +674,23 @@ namespace Net {
 
         page += WebConfig::OTA_PAGE_OPEN;
 
-        if ( result.otaResult.success ) {
+        if ( uploadResult.success ) {
             page += "<h1 class=\"success\">&#10004; Update Successful</h1>";
-            page += "<p>Firmware file: <span class=\"filename\">" + result.otaResult.filename + "</span></p>";
-            page += "<p>Bytes written: " + String( result.otaResult.bytesWritten ) + "</p>";
+            page += "<p>Firmware file: <span class=\"filename\">" + uploadResult.filename + "</span></p>";
+            page += "<p>Bytes written: " + String( uploadResult.bytesWritten ) + "</p>";
+            if ( uploadResult.delta ) {
+                page += "<p>Delta patch: " + String( uploadResult.bytesReceived ) + " bytes</p>";
+            }
+            page += "<p>Time: " + String( uploadResult.durationMs / 1000.0f, 1 ) + " s</p>";
+            page += "<p>SHA-256: <span class=\"filename\">" + uploadResult.sha256 + "</span></p>";
             page += "<p><strong>STAC is restarting...</strong></p>";
             page += "<p>Please wait for the device to reboot.</p>";
         }
         else {
             page += "<h1 class=\"error\">&#10008; Update Failed</h1>";
-            page += "<p class=\"error\">" + result.otaResult.statusMessage + "</p>";
-            page += "<p>Firmware file: <span class=\"filename\">" + result.otaResult.filename + "</span></p>";
-            page += "<p>Bytes written: " + String( result.otaResult.bytesWritten ) + "</p>";
+            page += "<p class=\"error\">" + uploadResult.statusMessage + "</p>";
+            page += "<p>Firmware file: <span class=\"filename\">" + uploadResult.filename + "</span></p>";
+            page += "<p>Bytes written: " + String( uploadResult.bytesWritten ) + "</p>";
             page += "<p><a href=\"/\">Return to Portal</a></p>";
         }
 
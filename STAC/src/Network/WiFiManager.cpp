@@ -1,15 +1,73 @@
 #include "Network/WiFiManager.h"
 #include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_random.h>
+#include <esp_rom_crc.h>
+#include <esp_wifi.h>
+#include <cstring>
+#include "Utils/BootProfiler.h"
 
 namespace Net {
 
+    namespace {
+
+        constexpr uint32_t LINK_MAGIC = 0x53544C4B;        // "STLK"
+
+        struct LinkSnapshot {
+            uint32_t magic;
+            WiFiLink link;
+            uint32_t crc;
+        };
+
+        // Not cleared by the startup code, so a restart reconnects without NVS
+        RTC_NOINIT_ATTR LinkSnapshot rtcLink;
+
+        uint32_t linkCRC( const WiFiLink &link ) {
+            return esp_rom_crc32_le( 0, reinterpret_cast<const uint8_t *>( &link ), sizeof( link ) );
+        }
+
+        void saveRtcLink( const WiFiLink &link ) {
+            rtcLink.link = link;
+            rtcLink.crc = linkCRC( link );
+            rtcLink.magic = LINK_MAGIC;
+        }
+
+        uint32_t hashSSID( const String &ssid ) {
+            uint32_t hash = esp_rom_crc32_le( 0, reinterpret_cast<const uint8_t *>( ssid.c_str() ), ssid.length() );
+            return hash != 0 ? hash : 1;    // 0 marks "no link"
+        }
+
+    } // namespace
+
     WiFiManager::WiFiManager()
         : state( WiFiState::DISCONNECTED )
         , currentSSID( "" )
         , currentPassword( "" )
         , hostname( "STAC" )
         , apMode( false )
-        , lastConnectionAttempt( 0 ) {
+        , connectStartedAt( 0 )
+        , connectTimeoutMs( 0 )
+        , attemptStartedAt( 0 )
+        , connectPath( WiFiConnectPath::NONE )
+        , link()
+        , linkUpdated( false )
+        , eventQueue( nullptr )
+        , eventNotifier( nullptr )
+        , eventNotifierContext( nullptr )
+        , retryPending( false )
+        , retryAt( 0 )
+        , retryCount( 0 )
+        , linkLostAt( 0 )
+        , rssiAverageX16( 0 )
+        , lastRssiSampleAt( 0 )
+        , pollHistory( 0 )
+        , roamStage( RoamStage::IDLE )
+        , roamStartedAt( 0 )
+        , lastRoamScanAt( 0 )
+        , listenInterval( 0 ) {
+        if ( rtcLink.magic == LINK_MAGIC && rtcLink.crc == linkCRC( rtcLink.link ) ) {
+            link = rtcLink.link;
+        }
     }
 
     bool WiFiManager::begin() {
@@ -17,11 +75,63 @@ namespace Net {
         WiFi.mode( WIFI_OFF );
         delay( 100 );
 
+        if ( !eventQueue ) {
+            eventQueue = xQueueCreateStatic( EVENT_QUEUE_CAPACITY, sizeof( QueuedEvent ), eventQueueStorage,
+                                             &eventQueueControl );
+            if ( !eventQueue ) {
+                log_e( "Failed to create WiFi event queue" );
+                return false;
+            }
+
+            // Runs on the WiFi event task: translate and queue, nothing else
+            WiFi.onEvent( [ this ]( arduino_event_id_t event, arduino_event_info_t info ) {
+                switch ( event ) {
+                    case ARDUINO_EVENT_WIFI_STA_CONNECTED:
+                        postEvent( WiFiEventKind::ASSOCIATED );
+                        break;
+                    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+                        postEvent( WiFiEventKind::GOT_IP );
+                        break;
+                    case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+                        postEvent( WiFiEventKind::LOST_IP );
+                        break;
+                    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+                        postEvent( WiFiEventKind::DISCONNECTED, info.wifi_sta_disconnected.reason );
+                        break;
+                    default:
+                        break;
+                }
+            } );
+        }
+
+        // Reconnection is ours (with backoff), not the driver's
+        WiFi.setAutoReconnect( false );
+
+        // A full scan looks at every channel and joins the strongest access point for the SSID
+        WiFi.setScanMethod( WIFI_ALL_CHANNEL_SCAN );
+        WiFi.setSortMethod( WIFI_CONNECT_AP_BY_SIGNAL );
+
         log_i( "WiFi Manager initialized" );
         return true;
     }
 
-    bool WiFiManager::connect( const String &ssid, const String &password, unsigned long timeoutMs ) {
+    bool WiFiManager::connectAsync( const String &ssid, const String &password, unsigned long timeoutMs ) {
+        if ( state == WiFiState::CONNECTING && ssid == currentSSID ) {
+            // Join the attempt already running, with a fresh timeout
+            connectStartedAt = millis();
+            connectTimeoutMs = timeoutMs;
+            notifyState();
+            return true;
+        }
+        if ( isConnected() && ssid == currentSSID ) {
+            // Already connected (the early attempt finished first)
+            notifyState();
+            return true;
+        }
+        return startConnection( ssid, password, timeoutMs );
+    }
+
+    bool WiFiManager::startConnection( const String &ssid, const String &password, unsigned long timeoutMs ) {
         if ( ssid.isEmpty() ) {
             log_e( "Cannot connect: SSID is empty" );
             state = WiFiState::FAILED;
@@ -36,8 +146,10 @@ namespace Net {
         }
 
         // Set to station mode
-        WiFi.mode( WIFI_STA );
-        delay( 100 );
+        if ( WiFi.getMode() != WIFI_STA ) {
+            WiFi.mode( WIFI_STA );
+            delay( 100 );
+        }
 
         // Store credentials for reconnection
         currentSSID = ssid;
@@ -48,39 +160,310 @@ namespace Net {
             WiFi.setHostname( hostname.c_str() );
         }
 
-        // Start connection
-        state = WiFiState::CONNECTING;
-        if ( stateCallback ) {
-            stateCallback( state );
+        // Start connection: straight to the last access point when we know it
+        retryPending = false;
+        if ( state != WiFiState::CONNECTING ) {
+            state = WiFiState::CONNECTING;
+            notifyState();
         }
-        WiFi.begin( ssid.c_str(), password.c_str() );
+        if ( link.isValid() && link.ssidHash == hashSSID( ssid ) ) {
+            bool staticLease = Config::Net::REUSE_DHCP_LEASE && link.ip != 0;
+            useStaticLease( staticLease );
+            connectPath = staticLease ? WiFiConnectPath::DIRECTED_STATIC : WiFiConnectPath::DIRECTED;
+            log_i( "  Directed connect: %02X:%02X:%02X:%02X:%02X:%02X on channel %u%s",
+                   link.bssid[ 0 ], link.bssid[ 1 ], link.bssid[ 2 ], link.bssid[ 3 ], link.bssid[ 4 ], link.bssid[ 5 ],
+                   link.channel, staticLease ? ", static lease" : "" );
+            beginStation( ssid.c_str(), password.c_str(), link.channel, link.bssid );
+        }
+        else {
+            useStaticLease( false );
+            connectPath = WiFiConnectPath::SCAN;
+            beginStation( ssid.c_str(), password.c_str() );
+        }
+        attemptStartedAt = millis();
+        connectStartedAt = attemptStartedAt;
+        connectTimeoutMs = timeoutMs;
+        return true;
+    }
+
+    void WiFiManager::fallBackToScan() {
+        log_w( "Directed connect failed after %lu ms - falling back to a full scan", millis() - attemptStartedAt );
 
-        // Wait for connection with timeout
-        unsigned long startTime = millis();
-        while ( WiFi.status() != WL_CONNECTED ) {
-            if ( millis() - startTime > timeoutMs ) {
-                log_e( "WiFi connection timeout" );
-                state = WiFiState::FAILED;
-                if ( stateCallback ) {
-                    stateCallback( state );
+        // Forget the link everywhere, so the next boot doesn't try it first either
+        link = WiFiLink{};
+        linkUpdated = true;
+        saveRtcLink( link );
+
+        WiFi.disconnect();
+        useStaticLease( false );
+        connectPath = WiFiConnectPath::FALLBACK_SCAN;
+        beginStation( currentSSID.c_str(), currentPassword.c_str() );
+    }
+
+    void WiFiManager::recordLink( bool persist ) {
+        WiFiLink fresh = {};
+        fresh.ssidHash = hashSSID( currentSSID );
+        const uint8_t *bssid = WiFi.BSSID();
+        if ( bssid ) {
+            memcpy( fresh.bssid, bssid, sizeof( fresh.bssid ) );
+        }
+        fresh.channel = static_cast<uint8_t>( WiFi.channel() );
+        fresh.ip = static_cast<uint32_t>( WiFi.localIP() );
+        fresh.gateway = static_cast<uint32_t>( WiFi.gatewayIP() );
+        fresh.subnet = static_cast<uint32_t>( WiFi.subnetMask() );
+        fresh.dns = static_cast<uint32_t>( WiFi.dnsIP() );
+
+        if ( memcmp( &fresh, &link, sizeof( fresh ) ) != 0 ) {
+            link = fresh;
+            linkUpdated = linkUpdated || persist;
+            saveRtcLink( link );
+        }
+    }
+
+    void WiFiManager::setListenInterval( uint16_t beacons ) {
+        listenInterval = beacons;
+    }
+
+    void WiFiManager::beginStation( const char *ssid, const char *password, int32_t channel, const uint8_t *bssid ) {
+        if ( listenInterval == 0 ) {
+            WiFi.begin( ssid, password, channel, bssid );
+            return;
+        }
+
+        // The listen interval is sent in the association request, so it goes in between configuring and connecting
+        WiFi.begin( ssid, password, channel, bssid, false );
+        wifi_config_t conf;
+        if ( esp_wifi_get_config( WIFI_IF_STA, &conf ) == ESP_OK ) {
+            conf.sta.listen_interval = listenInterval;
+            esp_wifi_set_config( WIFI_IF_STA, &conf );
+        }
+        esp_wifi_connect();
+    }
+
+    void WiFiManager::useStaticLease( bool enable ) {
+        if ( enable ) {
+            WiFi.config( IPAddress( link.ip ), IPAddress( link.gateway ), IPAddress( link.subnet ), IPAddress( link.dns ) );
+        }
+        else if ( Config::Net::REUSE_DHCP_LEASE ) {
+            // An all-zero address turns DHCP back on
+            WiFi.config( IPAddress(), IPAddress(), IPAddress() );
+        }
+    }
+
+    void WiFiManager::handleEvent( const QueuedEvent &event ) {
+        switch ( event.kind ) {
+            case WiFiEventKind::ASSOCIATED:
+                log_d( "WiFi associated, waiting for an address" );
+                break;
+
+            case WiFiEventKind::GOT_IP:
+                if ( state == WiFiState::CONNECTING ) {
+                    onConnected();
                 }
-                WiFi.disconnect();
-                return false;
-            }
-            delay( 100 );
+                else if ( state == WiFiState::CONNECTED && roamStage == RoamStage::REASSOCIATING ) {
+                    onRoamed();
+                }
+                break;
+
+            case WiFiEventKind::LOST_IP:
+            case WiFiEventKind::DISCONNECTED:
+                if ( event.kind == WiFiEventKind::DISCONNECTED ) {
+                    // Our own disconnect (timeout, fallback, disconnect()) has nothing to recover from
+                    if ( event.reason == WIFI_REASON_ASSOC_LEAVE ) {
+                        break;
+                    }
+                    stats.lastDisconnectReason = event.reason;
+                }
+
+                if ( state == WiFiState::CONNECTED ) {
+                    if ( roamStage == RoamStage::REASSOCIATING ) {
+                        log_w( "Roam failed (reason %u)", event.reason );
+                    }
+                    roamStage = RoamStage::IDLE;
+                    stats.disconnects++;
+                    linkLostAt = millis();
+                    log_w( "WiFi connection lost (%s, reason %u) - reconnecting in background",
+                           event.kind == WiFiEventKind::LOST_IP ? "lost address" : "disconnected", event.reason );
+                    if ( event.kind == WiFiEventKind::LOST_IP ) {
+                        WiFi.disconnect();      // Re-associate from scratch to get a new lease
+                    }
+                    state = WiFiState::DISCONNECTED;
+                    retryCount = 0;
+                    scheduleRetry();
+                    notifyState();
+                }
+                else if ( state == WiFiState::CONNECTING && !retryPending ) {
+                    if ( connectPath == WiFiConnectPath::DIRECTED || connectPath == WiFiConnectPath::DIRECTED_STATIC ) {
+                        fallBackToScan();
+                    }
+                    else {
+                        log_d( "WiFi attempt failed (reason %u)", event.reason );
+                        scheduleRetry();
+                    }
+                }
+                break;
         }
+    }
+
+    void WiFiManager::onConnected() {
+        unsigned long now = millis();
+        unsigned long elapsed = now - attemptStartedAt;
 
         state = WiFiState::CONNECTED;
-        if ( stateCallback ) {
-            stateCallback( state );
-        }
-        lastConnectionAttempt = millis();
+        retryPending = false;
+        retryCount = 0;
+        recordLink();
+        Utils::BootProfiler::mark( Utils::BootPhase::WIFI_CONNECTED );
+        Utils::BootProfiler::noteWiFiConnect( connectPath, elapsed );
 
-        log_i( "WiFi connected!" );
+        resetLinkQuality( now );
+
+        log_i( "WiFi connected via %s in %lu ms", Utils::BootProfiler::wifiPathName( connectPath ), elapsed );
         log_i( "  IP address: %s", WiFi.localIP().toString().c_str() );
-        log_i( "  RSSI: %d dBm", WiFi.RSSI() );
+        log_i( "  RSSI: %d dBm, channel %ld", stats.rssiAverage, static_cast<long>( WiFi.channel() ) );
+        if ( linkLostAt != 0 ) {
+            stats.lastOutageMs = now - linkLostAt;
+            linkLostAt = 0;
+            log_i( "  Restored after a %lu ms outage (%lu lost so far)",
+                   static_cast<unsigned long>( stats.lastOutageMs ), static_cast<unsigned long>( stats.disconnects ) );
+        }
 
-        return true;
+        notifyState();
+    }
+
+    void WiFiManager::scheduleRetry() {
+        unsigned long backoff = Config::Net::RECONNECT_BACKOFF_BASE_MS << ( retryCount < 5 ? retryCount : 5 );
+        if ( backoff > Config::Net::RECONNECT_BACKOFF_MAX_MS ) {
+            backoff = Config::Net::RECONNECT_BACKOFF_MAX_MS;
+        }
+
+        // Half fixed, half random, so units that lost the same access point don't retry in step
+        unsigned long wait = backoff / 2 + esp_random() % ( backoff / 2 + 1 );
+        if ( retryCount < UINT8_MAX ) {
+            retryCount++;
+        }
+        retryAt = millis() + wait;
+        retryPending = true;
+        log_i( "WiFi retry %u in %lu ms", retryCount, wait );
+    }
+
+    void WiFiManager::resetLinkQuality( unsigned long now ) {
+        int32_t rssi = WiFi.RSSI();
+        rssiAverageX16 = rssi * 16;
+        stats.rssiAverage = static_cast<int8_t>( rssi );
+        lastRssiSampleAt = now;
+        pollHistory = 0;
+        stats.pollErrorPercent = 0;
+    }
+
+    void WiFiManager::sampleRSSI() {
+        int32_t rssi = WiFi.RSSI();
+        if ( rssi == 0 ) {
+            return;     // Not associated
+        }
+
+        // Exponential moving average, weight 1/8
+        rssiAverageX16 += ( rssi * 16 - rssiAverageX16 ) / 8;
+        stats.rssiAverage = static_cast<int8_t>( rssiAverageX16 / 16 );
+    }
+
+    void WiFiManager::notePollResult( bool ok ) {
+        pollHistory = static_cast<uint8_t>( ( pollHistory << 1 ) | ( ok ? 0 : 1 ) );
+
+        // Share of the whole window: polls not made yet count as good, so one early failure is not a poor link
+        stats.pollErrorPercent = static_cast<uint8_t>( __builtin_popcount( pollHistory ) * 100 / 8 );
+    }
+
+    bool WiFiManager::isLinkPoor( int8_t rssiAverage, uint8_t pollErrorPercent ) {
+        return ( rssiAverage != 0 && rssiAverage < Config::Net::ROAM_RSSI_THRESHOLD_DBM ) ||
+               pollErrorPercent >= Config::Net::ROAM_POLL_ERROR_PERCENT;
+    }
+
+    bool WiFiManager::isBetterAccessPoint( int32_t candidateRssi, int8_t rssiAverage ) {
+        return candidateRssi >= rssiAverage + Config::Net::ROAM_HYSTERESIS_DB;
+    }
+
+    void WiFiManager::updateRoaming( unsigned long now ) {
+        if ( roamStage == RoamStage::SCANNING ) {
+            int16_t found = WiFi.scanComplete();
+            if ( found == WIFI_SCAN_RUNNING ) {
+                return;
+            }
+            roamStage = RoamStage::IDLE;
+            if ( found < 0 ) {
+                log_w( "Roam scan failed" );
+                return;
+            }
+
+            // Strongest other access point carrying our SSID
+            const uint8_t *current = WiFi.BSSID();
+            int16_t best = -1;
+            int32_t bestRssi = INT32_MIN;
+            for ( int16_t i = 0; i < found; i++ ) {
+                const uint8_t *bssid = WiFi.BSSID( i );
+                if ( WiFi.SSID( i ) != currentSSID || !bssid || ( current && memcmp( bssid, current, 6 ) == 0 ) ) {
+                    continue;
+                }
+                if ( WiFi.RSSI( i ) > bestRssi ) {
+                    bestRssi = WiFi.RSSI( i );
+                    best = i;
+                }
+            }
+
+            if ( best < 0 || !isBetterAccessPoint( bestRssi, stats.rssiAverage ) ) {
+                log_i( "Roam scan: no better access point (%d found, best %ld dBm, link %d dBm)",
+                       found, best < 0 ? 0L : static_cast<long>( bestRssi ), stats.rssiAverage );
+                WiFi.scanDelete();
+                return;
+            }
+
+            uint8_t bssid[ 6 ];
+            memcpy( bssid, WiFi.BSSID( best ), sizeof( bssid ) );
+            int32_t channel = WiFi.channel( best );
+            WiFi.scanDelete();
+
+            log_i( "Roaming to %02X:%02X:%02X:%02X:%02X:%02X on channel %ld (%ld dBm, link %d dBm)",
+                   bssid[ 0 ], bssid[ 1 ], bssid[ 2 ], bssid[ 3 ], bssid[ 4 ], bssid[ 5 ],
+                   static_cast<long>( channel ), static_cast<long>( bestRssi ), stats.rssiAverage );
+            roamStage = RoamStage::REASSOCIATING;
+            roamStartedAt = now;
+            beginStation( currentSSID.c_str(), currentPassword.c_str(), channel, bssid );
+            return;
+        }
+
+        if ( now - lastRoamScanAt < Config::Net::ROAM_SCAN_INTERVAL_MS ||
+                !isLinkPoor( stats.rssiAverage, stats.pollErrorPercent ) ) {
+            return;
+        }
+
+        lastRoamScanAt = now;
+        log_i( "Link poor (RSSI %d dBm, %u%% poll errors) - scanning for a better access point",
+               stats.rssiAverage, stats.pollErrorPercent );
+        if ( WiFi.scanNetworks( true, false, false, Config::Net::ROAM_SCAN_DWELL_MS, 0, currentSSID.c_str() ) ==
+                WIFI_SCAN_FAILED ) {
+            log_w( "Roam scan could not start" );
+            return;
+        }
+        stats.roamScans++;
+        roamStage = RoamStage::SCANNING;
+    }
+
+    void WiFiManager::onRoamed() {
+        unsigned long now = millis();
+        roamStage = RoamStage::IDLE;
+        stats.roams++;
+
+        // Kept in RTC memory only: a camera walking the venue would otherwise rewrite NVS on every move
+        recordLink( false );
+        resetLinkQuality( now );
+        log_i( "Roamed in %lu ms - RSSI %d dBm, IP %s", now - roamStartedAt, stats.rssiAverage,
+               WiFi.localIP().toString().c_str() );
+    }
+
+    void WiFiManager::notifyState() {
+        if ( stateCallback ) {
+            stateCallback( state );
+        }
     }
 
     bool WiFiManager::startAP( const String &ssid, const String &password ) {
@@ -130,6 +513,10 @@ namespace Net {
         state = WiFiState::DISCONNECTED;
         currentSSID = "";
         currentPassword = "";
+        retryPending = false;
+        linkLostAt = 0;
+        roamStage = RoamStage::IDLE;
+        WiFi.scanDelete();
     }
 
     void WiFiManager::stopAP() {
@@ -191,31 +578,103 @@ namespace Net {
         stateCallback = callback;
     }
 
-    void WiFiManager::update() {
-        // Check if we should attempt reconnection
-        if ( state == WiFiState::CONNECTED && WiFi.status() != WL_CONNECTED ) {
-            log_w( "WiFi connection lost" );
-            state = WiFiState::DISCONNECTED;
+    void WiFiManager::setEventNotifier( WiFiEventNotifier notifier, void *context ) {
+        eventNotifierContext = context;
+        eventNotifier = notifier;
+    }
+
+    void WiFiManager::postEvent( WiFiEventKind kind, uint8_t reason ) {
+        QueuedEvent event = { kind, reason };
+        if ( !eventQueue || xQueueSend( eventQueue, &event, 0 ) != pdTRUE ) {
+            stats.droppedEvents++;
+            return;
         }
 
-        // Attempt reconnection if we have credentials
-        if ( state == WiFiState::DISCONNECTED && !currentSSID.isEmpty() ) {
-            attemptReconnect();
+        if ( eventNotifier ) {
+            eventNotifier( eventNotifierContext );
         }
     }
 
-    void WiFiManager::attemptReconnect() {
-        unsigned long now = millis();
+    void WiFiManager::setSavedLink( const WiFiLink &saved ) {
+        if ( !link.isValid() ) {
+            link = saved;
+        }
+    }
 
-        // Don't retry too frequently
-        if ( now - lastConnectionAttempt < RECONNECT_INTERVAL_MS ) {
-            return;
+    bool WiFiManager::getNewLink( WiFiLink &updated ) {
+        if ( !linkUpdated ) {
+            return false;
+        }
+        linkUpdated = false;
+        updated = link;
+        return true;
+    }
+
+    WiFiConnectPath WiFiManager::getConnectPath() const {
+        return connectPath;
+    }
+
+    void WiFiManager::update() {
+        // Driver events, in the order they happened
+        QueuedEvent event;
+        while ( eventQueue && xQueueReceive( eventQueue, &event, 0 ) == pdTRUE ) {
+            handleEvent( event );
         }
 
-        log_i( "Attempting to reconnect to WiFi..." );
-        lastConnectionAttempt = now;
+        unsigned long now = millis();
+        switch ( state ) {
+            case WiFiState::CONNECTING:
+                if ( ( connectPath == WiFiConnectPath::DIRECTED || connectPath == WiFiConnectPath::DIRECTED_STATIC ) &&
+                        now - attemptStartedAt > Config::Net::FAST_CONNECT_TIMEOUT_MS ) {
+                    fallBackToScan();
+                }
+                else if ( now - connectStartedAt > connectTimeoutMs ) {
+                    log_e( "WiFi connection timeout" );
+                    state = WiFiState::FAILED;
+                    WiFi.disconnect();
+                    scheduleRetry();
+                    notifyState();
+                }
+                else if ( retryPending && static_cast<long>( now - retryAt ) >= 0 ) {
+                    // Same attempt, the driver gave up on the last try
+                    retryPending = false;
+                    beginStation( currentSSID.c_str(), currentPassword.c_str() );
+                }
+                break;
+
+            case WiFiState::DISCONNECTED:
+            case WiFiState::FAILED:
+                if ( retryPending && !currentSSID.isEmpty() && !apMode && static_cast<long>( now - retryAt ) >= 0 ) {
+                    stats.reconnects++;
+                    log_i( "Reconnecting to WiFi (retry %u)", retryCount );
+                    startConnection( currentSSID, currentPassword, Config::Net::RECONNECT_TIMEOUT_MS );
+                }
+                break;
+
+            case WiFiState::CONNECTED:
+                if ( roamStage == RoamStage::REASSOCIATING ) {
+                    // Between access points; GOT_IP or a disconnect ends it
+                    if ( now - roamStartedAt > Config::Net::ROAM_REASSOC_TIMEOUT_MS ) {
+                        log_w( "Roam timed out" );
+                        handleEvent( { WiFiEventKind::DISCONNECTED, 0 } );
+                    }
+                }
+                else if ( WiFi.status() != WL_CONNECTED ) {
+                    // Its event was dropped (queue full); handle the loss now
+                    handleEvent( { WiFiEventKind::DISCONNECTED, 0 } );
+                }
+                else {
+                    if ( now - lastRssiSampleAt >= Config::Net::RSSI_SAMPLE_MS ) {
+                        lastRssiSampleAt = now;
+                        sampleRSSI();
+                    }
+                    updateRoaming( now );
+                }
+                break;
 
-        connect( currentSSID, currentPassword, 10000 ); // 10 second timeout for reconnect
+            default:
+                break;
+        }
     }
 
 } // namespace Net
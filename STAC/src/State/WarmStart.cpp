@@ -0,0 +1,80 @@
+#include "State/WarmStart.h"
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+
+
+namespace State {
+
+    namespace {
+
+        constexpr uint32_t SNAPSHOT_MAGIC = 0x5354574D;    // "STWM"
+
+        struct Snapshot {
+            uint32_t magic;
+            uint8_t tally;
+            uint8_t check;          // ~tally, catches RTC contents that only match the magic
+        };
+
+        // Not cleared by the startup code, so it survives an unplanned reset
+        RTC_NOINIT_ATTR Snapshot snapshot;
+
+        bool warm = false;
+
+        bool isUnplannedReset( esp_reset_reason_t reason ) {
+            switch ( reason ) {
+                case ESP_RST_PANIC:
+                case ESP_RST_INT_WDT:
+                case ESP_RST_TASK_WDT:
+                case ESP_RST_WDT:
+                case ESP_RST_BROWNOUT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool snapshotValid() {
+            return snapshot.magic == SNAPSHOT_MAGIC &&
+                   snapshot.check == static_cast<uint8_t>( ~snapshot.tally ) &&
+                   snapshot.tally <= static_cast<uint8_t>( TallyState::ERROR );
+        }
+
+    } // namespace
+
+    bool WarmStart::begin() {
+        esp_reset_reason_t reason = esp_reset_reason();
+        warm = isUnplannedReset( reason ) && snapshotValid();
+
+        if ( warm ) {
+            log_w( "Unplanned reset (reason %d) - warm start with saved tally state %d",
+                   static_cast<int>( reason ), snapshot.tally );
+        }
+        else if ( !snapshotValid() ) {
+            clear();
+        }
+        return warm;
+    }
+
+    bool WarmStart::isWarm() {
+        return warm;
+    }
+
+    void WarmStart::save( TallyState tally ) {
+        snapshot.tally = static_cast<uint8_t>( tally );
+        snapshot.check = static_cast<uint8_t>( ~snapshot.tally );
+        snapshot.magic = SNAPSHOT_MAGIC;
+    }
+
+    void WarmStart::clear() {
+        snapshot.magic = 0;
+    }
+
+    TallyState WarmStart::getTallyState() {
+        return snapshotValid() ? static_cast<TallyState>( snapshot.tally ) : TallyState::NO_TALLY;
+    }
+
+} // namespace State
+
+
+//  --- EOF --- //
@@ -1,173 +1,344 @@
 #include "Storage/ConfigManager.h"
 #include <Arduino.h>
 #include <esp_mac.h>
+#include <esp_rom_crc.h>
+#include <cstring>
 
 using namespace Config::Storage;
 
 namespace Storage {
 
-    ConfigManager::ConfigManager() {
+    namespace {
+
+        // ========================================================================
+        // Record layout (NOM v5 / PM v3)
+        //
+        // One blob per namespace: header, payload, CRC32 of header + payload.
+        // Fields are only ever appended to a payload, so a shorter (older)
+        // payload fills the fields it has and the rest keep their defaults,
+        // and a longer (newer) one is read up to the fields known here.
+        // ========================================================================
+
+        constexpr uint8_t RECORD_LAYOUT = 1;
+        constexpr size_t MAX_RECORD_SIZE = 512;
+
+        struct __attribute__( ( packed ) ) RecordHeader {
+            uint8_t layout;             // RECORD_LAYOUT when written
+            uint8_t reserved;
+            uint16_t length;            // Payload bytes that follow
+        };
+
+        struct __attribute__( ( packed ) ) WiFiRecord {
+            uint8_t version = 0;        // Global NOM_PREFS_VERSION, 0 until credentials are saved
+            uint8_t hasSSID = 0;
+            uint8_t pmEnabled = 0;
+            char ssid[ 33 ] = "";
+            char password[ 129 ] = "";  // Obfuscated
+            char updateURL[ Config::FleetOTA::MAX_URL_LENGTH + 1 ] = "";
+            uint32_t linkSSIDHash = 0;  // Last association, 0 = none
+            uint8_t linkBSSID[ 6 ] = {};
+            uint8_t linkChannel = 0;
+            uint32_t linkIP = 0;
+            uint32_t linkGateway = 0;
+            uint32_t linkSubnet = 0;
+            uint32_t linkDNS = 0;
+            uint8_t powerProfile = 0;   // PowerProfile, 0 = BALANCED
+        };
+
+        struct __attribute__( ( packed ) ) SwitchRecord {
+            uint8_t hasModel = 0;
+            char model[ 16 ] = "";
+            uint32_t ip = 0;
+            uint16_t port = 80;
+            char username[ 33 ] = "";
+            char password[ 129 ] = "";  // Obfuscated
+        };
+
+        struct __attribute__( ( packed ) ) V60HDRecord {
+            uint8_t tallyChannel = 1;
+            uint8_t maxChannel = 8;
+            uint8_t autoStart = 0;
+            uint8_t camOpMode = 1;
+            uint8_t brightness = 1;
+            uint32_t pollInterval = 300;
+        };
+
+        struct __attribute__( ( packed ) ) V160HDRecord {
+            uint8_t tallyChannel = 1;
+            uint8_t maxHDMI = 8;
+            uint8_t maxSDI = 8;
+            char channelBank[ 8 ] = "hdmi_";
+            uint8_t autoStart = 0;
+            uint8_t camOpMode = 1;
+            uint8_t brightness = 1;
+            uint32_t pollInterval = 300;
+        };
+
+        struct __attribute__( ( packed ) ) IdentityRecord {
+            char stacID[ 24 ] = "";
+        };
+
+        struct __attribute__( ( packed ) ) PeripheralRecord {
+            uint8_t version = 0;        // PM_PREFS_VERSION
+            uint8_t cameraMode = 0;
+            uint8_t brightness = 1;
+        };
+
+        template<typename T>
+        bool readRecord( Preferences &prefs, const char *key, T &payload ) {
+            static_assert( sizeof( RecordHeader ) + sizeof( T ) + sizeof( uint32_t ) <= MAX_RECORD_SIZE,
+                           "Record too large" );
+
+            size_t size = prefs.getBytesLength( key );
+            if ( size < sizeof( RecordHeader ) + sizeof( uint32_t ) || size > MAX_RECORD_SIZE ) {
+                return false;
+            }
+
+            uint8_t buffer[ MAX_RECORD_SIZE ];
+            if ( prefs.getBytes( key, buffer, size ) != size ) {
+                return false;
+            }
+
+            RecordHeader header;
+            memcpy( &header, buffer, sizeof( header ) );
+            size_t covered = sizeof( header ) + header.length;
+            if ( covered + sizeof( uint32_t ) != size ) {
+                log_w( "Config record '%s' has a bad length", key );
+                return false;
+            }
+
+            uint32_t crc;
+            memcpy( &crc, buffer + covered, sizeof( crc ) );
+            if ( crc != esp_rom_crc32_le( 0, buffer, covered ) ) {
+                log_w( "Config record '%s' failed CRC check", key );
+                return false;
+            }
+
+            memcpy( &payload, buffer + sizeof( header ), header.length < sizeof( T ) ? header.length : sizeof( T ) );
+            return true;
+        }
+
+        template<typename T>
+        bool writeRecord( Preferences &prefs, const char *key, const T &payload ) {
+            uint8_t buffer[ sizeof( RecordHeader ) + sizeof( T ) + sizeof( uint32_t ) ];
+
+            RecordHeader header = { RECORD_LAYOUT, 0, static_cast<uint16_t>( sizeof( T ) ) };
+            memcpy( buffer, &header, sizeof( header ) );
+            memcpy( buffer + sizeof( header ), &payload, sizeof( T ) );
+            uint32_t crc = esp_rom_crc32_le( 0, buffer, sizeof( header ) + sizeof( T ) );
+            memcpy( buffer + sizeof( header ) + sizeof( T ), &crc, sizeof( crc ) );
+
+            return prefs.putBytes( key, buffer, sizeof( buffer ) ) == sizeof( buffer );
+        }
+
+        /**
+         * @brief Check for a record that exists but failed readRecord()
+         *
+         * Such a namespace must not be treated as the per-key layout: the
+         * migration would overwrite it. It is logged and left in flash, and
+         * the cache keeps its defaults until the namespace is saved again.
+         */
+        bool isDamagedRecord( Preferences &prefs, const char *key, const char *ns ) {
+            if ( !prefs.isKey( key ) ) {
+                return false;
+            }
+            log_e( "Config record in '%s' is damaged; using defaults and leaving flash unchanged", ns );
+            return true;
+        }
+
+        template<size_t N>
+        void setField( char ( &field )[ N ], const String &value ) {
+            if ( value.length() >= N ) {
+                log_w( "Config value truncated to %d characters", static_cast<int>( N - 1 ) );
+            }
+            strlcpy( field, value.c_str(), N );
+        }
+
+        template<size_t N>
+        String getField( const char ( &field )[ N ] ) {
+            char value[ N ];
+            memcpy( value, field, N );
+            value[ N - 1 ] = '\0';
+            return String( value );
+        }
+
+    } // namespace
+
+    ConfigManager::ConfigManager()
+        : dirty( 0 )
+        , legacy( 0 )
+        , deferCommit( false ) {
     }
 
     bool ConfigManager::begin() {
-        log_i( "Config Manager initialized" );
+        stats = NvsStats();
+        loadCache();
+        log_i( "Config Manager initialized (%d NVS opens)", stats.opens );
 
         // Check NVS schema version
         checkSchemaVersion();
 
+        // Rewrite anything still in the per-key layout as records
+        if ( legacy ) {
+            if ( cache.wifi.version != 0 && cache.wifi.version < Config::NVS::NOM_PREFS_VERSION ) {
+                cache.wifi.version = Config::NVS::NOM_PREFS_VERSION;
+            }
+            dirty |= legacy;
+            if ( commit() ) {
+                log_i( "NVS configuration migrated to record layout" );
+            }
+        }
+
         return true;
     }
 
     bool ConfigManager::saveWiFiCredentials( const String &ssid, const String &password ) {
-        if ( !prefs.begin( NS_WIFI, READ_WRITE ) ) {
-            log_e( "Failed to open WiFi preferences" );
-            return false;
+        auto &wifi = cache.wifi;
+        if ( wifi.hasSSIDKey && wifi.ssid == ssid && wifi.password == password &&
+                wifi.version == Config::NVS::NOM_PREFS_VERSION ) {
+            log_i( "WiFi credentials unchanged" );
+            return true;
         }
 
-        prefs.putString( KEY_SSID, ssid );
-        prefs.putString( KEY_PASSWORD, obfuscatePassword( password ) );
-        prefs.putUChar( KEY_VERSION, Config::NVS::NOM_PREFS_VERSION );
-        prefs.end();
+        wifi.stored = true;
+        wifi.hasSSIDKey = true;
+        wifi.ssid = ssid;
+        wifi.password = password;
+        wifi.version = Config::NVS::NOM_PREFS_VERSION;
+        if ( !markDirty( DIRTY_WIFI ) ) {
+            return false;
+        }
 
         log_i( "WiFi credentials saved" );
         return true;
     }
 
     bool ConfigManager::loadWiFiCredentials( String &ssid, String &password ) {
-        if ( !prefs.begin( NS_WIFI, READ_ONLY ) ) {
+        if ( !cache.wifi.stored ) {
             log_w( "No WiFi preferences found" );
             return false;
         }
 
-        ssid = prefs.getString( KEY_SSID, "" );
-        String obfuscated = prefs.getString( KEY_PASSWORD, "" );
-        prefs.end();
-
+        ssid = cache.wifi.ssid;
         if ( ssid.isEmpty() ) {
             log_w( "No WiFi credentials stored" );
             return false;
         }
 
-        password = deobfuscatePassword( obfuscated );
+        password = cache.wifi.password;
         log_i( "WiFi credentials loaded: %s", ssid.c_str() );
         return true;
     }
 
     bool ConfigManager::hasWiFiCredentials() {
-        if ( !prefs.begin( NS_WIFI, READ_ONLY ) ) {
-            return false;
-        }
-
-        String ssid = prefs.getString( KEY_SSID, "" );
-        prefs.end();
-
-        return !ssid.isEmpty();
+        return !cache.wifi.ssid.isEmpty();
     }
 
     bool ConfigManager::isProvisioned() {
-        // Check for WiFi credentials
-        if ( !prefs.begin( NS_WIFI, true ) ) {
-            return false;
-        }
-        bool hasSSID = prefs.isKey( KEY_SSID );
-        prefs.end();
-
-        if ( !hasSSID ) {
-            return false;
-        }
-
-        // Check for switch configuration
-        if ( !prefs.begin( NS_SWITCH, READ_ONLY ) ) {
-            return false;
-        }
-        bool hasSwitch = prefs.isKey( KEY_MODEL );
-        prefs.end();
-
-        return hasSwitch;
+        // WiFi credentials and switch configuration
+        return cache.wifi.hasSSIDKey && cache.sw.hasModelKey;
     }
 
     void ConfigManager::clearWiFiCredentials() {
-        prefs.begin( NS_WIFI, READ_WRITE );
-        prefs.clear();
-        prefs.end();
+        if ( openNamespace( NS_WIFI, READ_WRITE ) ) {
+            prefs.clear();
+            prefs.end();
+        }
+
+        // Clearing the namespace also drops the version and PMode flag
+        cache.wifi = decltype( cache.wifi )();
+        cache.wifi.stored = true;
+        dirty &= ~DIRTY_WIFI;
+        legacy &= ~DIRTY_WIFI;
         log_i( "WiFi credentials cleared" );
     }
 
     bool ConfigManager::saveSwitchConfig( const String &model, const IPAddress& ipAddress, uint16_t port,
                                           const String &username, const String &password ) {
-        if ( !prefs.begin( NS_SWITCH, READ_WRITE ) ) {
-            log_e( "Failed to open switch preferences" );
-            return false;
+        auto &sw = cache.sw;
+        uint32_t ip = ( uint32_t )ipAddress;
+        if ( !( sw.hasModelKey && sw.model == model && sw.ip == ip && sw.port == port &&
+                sw.username == username && sw.password == password ) ) {
+            sw.stored = true;
+            sw.hasModelKey = true;
+            sw.model = model;
+            sw.ip = ip;
+            sw.port = port;
+            sw.username = username;
+            sw.password = password;
+            if ( !markDirty( DIRTY_SWITCH ) ) {
+                return false;
+            }
         }
 
-        prefs.putString( KEY_MODEL, model );
-        prefs.putUInt( KEY_IP, ( uint32_t )ipAddress );
-        prefs.putUShort( KEY_PORT, port );
-        prefs.putString( KEY_USERNAME, username );
-        prefs.putString( KEY_PASSWORD, obfuscatePassword( password ) );
-        prefs.putUChar( KEY_VERSION, Config::NVS::NOM_PREFS_VERSION );
-        prefs.end();
-
         log_i( "Switch config saved: %s @ %s:%d", model.c_str(), ipAddress.toString().c_str(), port );
         return true;
     }
 
     bool ConfigManager::loadSwitchConfig( String &model, IPAddress& ipAddress, uint16_t &port,
                                           String &username, String &password ) {
-        if ( !prefs.begin( NS_SWITCH, READ_ONLY ) ) {
+        const auto &sw = cache.sw;
+        if ( !sw.stored ) {
             log_w( "No switch preferences found" );
             return false;
         }
 
-        model = prefs.getString( KEY_MODEL, "" );
-        uint32_t ip = prefs.getUInt( KEY_IP, 0 );
-        port = prefs.getUShort( KEY_PORT, 80 );
-        username = prefs.getString( KEY_USERNAME, "" );
-        String obfuscated = prefs.getString( KEY_PASSWORD, "" );
-        prefs.end();
+        model = sw.model;
+        port = sw.port;
+        username = sw.username;
 
-        if ( model.isEmpty() || ip == 0 ) {
+        if ( model.isEmpty() || sw.ip == 0 ) {
             log_w( "No switch configuration stored" );
             return false;
         }
 
-        password = deobfuscatePassword( obfuscated );
-        ipAddress = IPAddress( ip );
+        password = sw.password;
+        ipAddress = IPAddress( sw.ip );
         log_i( "Switch config loaded: %s @ %s:%d", model.c_str(), ipAddress.toString().c_str(), port );
         return true;
     }
 
     bool ConfigManager::saveV60HDConfig( const StacOperations& ops ) {
-        if ( !prefs.begin( NS_V60HD, READ_WRITE ) ) {
-            log_e( "Failed to open V-60HD preferences" );
-            return false;
+        auto &v60 = cache.v60hd;
+        bool changed = !v60.hasTallyKey ||
+                       v60.tallyChannel != ops.tallyChannel ||
+                       v60.maxChannel != ops.maxChannelCount ||
+                       v60.autoStart != ops.autoStartEnabled ||
+                       v60.camOpMode != ops.cameraOperatorMode ||
+                       v60.brightness != ops.displayBrightnessLevel ||
+                       v60.pollInterval != ops.statusPollInterval;
+        if ( changed ) {
+            v60.stored = true;
+            v60.hasTallyKey = true;
+            v60.tallyChannel = ops.tallyChannel;
+            v60.maxChannel = ops.maxChannelCount;
+            v60.autoStart = ops.autoStartEnabled;
+            v60.camOpMode = ops.cameraOperatorMode;
+            v60.brightness = ops.displayBrightnessLevel;
+            v60.pollInterval = ops.statusPollInterval;
+            if ( !markDirty( DIRTY_V60HD ) ) {
+                return false;
+            }
         }
 
-        prefs.putUChar( KEY_TALLY_CHANNEL, ops.tallyChannel );
-        prefs.putUChar( KEY_MAX_CHANNEL, ops.maxChannelCount );
-        prefs.putUChar( KEY_AUTO_START, ops.autoStartEnabled );
-        prefs.putBool( KEY_CAM_OP_MODE, ops.cameraOperatorMode );
-        prefs.putUChar( KEY_BRIGHTNESS, ops.displayBrightnessLevel );
-        prefs.putULong( KEY_POLL_INTERVAL, ops.statusPollInterval );
-        prefs.end();
-
-        log_i( "V-60HD configuration saved" );
+        log_i( "V-60HD configuration saved%s", changed ? "" : " (unchanged)" );
         return true;
     }
 
     bool ConfigManager::loadV60HDConfig( StacOperations& ops ) {
-        if ( !prefs.begin( NS_V60HD, READ_ONLY ) ) {
+        const auto &v60 = cache.v60hd;
+        if ( !v60.stored ) {
             log_w( "No V-60HD configuration found" );
             return false;
         }
 
         ops.switchModel = "V-60HD";
-        ops.tallyChannel = prefs.getUChar( KEY_TALLY_CHANNEL, 1 );
-        ops.maxChannelCount = prefs.getUChar( KEY_MAX_CHANNEL, 8 );
-        ops.autoStartEnabled = prefs.getBool( KEY_AUTO_START, false );
-        ops.cameraOperatorMode = prefs.getBool( KEY_CAM_OP_MODE, true );
-        ops.displayBrightnessLevel = prefs.getUChar( KEY_BRIGHTNESS, 1 );
-        ops.statusPollInterval = prefs.getULong( KEY_POLL_INTERVAL, 300 );
+        ops.tallyChannel = v60.tallyChannel;
+        ops.maxChannelCount = v60.maxChannel;
+        ops.autoStartEnabled = v60.autoStart;
+        ops.cameraOperatorMode = v60.camOpMode;
+        ops.displayBrightnessLevel = v60.brightness;
+        ops.statusPollInterval = v60.pollInterval;
 
         // V-60HD doesn't use these fields
         ops.channelBank = "";
@@ -180,47 +351,57 @@ namespace Storage {
             log_w( "Invalid maxChannelCount for V-60HD, set to 8" );
         }
 
-        prefs.end();
-
         log_i( "V-60HD configuration loaded" );
         return true;
     }
 
     bool ConfigManager::saveV160HDConfig( const StacOperations& ops ) {
-        if ( !prefs.begin( NS_V160HD, READ_WRITE ) ) {
-            log_e( "Failed to open V-160HD preferences" );
-            return false;
+        auto &v160 = cache.v160hd;
+        bool changed = !v160.hasTallyKey ||
+                       v160.tallyChannel != ops.tallyChannel ||
+                       v160.maxHDMI != ops.maxHDMIChannel ||
+                       v160.maxSDI != ops.maxSDIChannel ||
+                       v160.channelBank != ops.channelBank ||
+                       v160.autoStart != ops.autoStartEnabled ||
+                       v160.camOpMode != ops.cameraOperatorMode ||
+                       v160.brightness != ops.displayBrightnessLevel ||
+                       v160.pollInterval != ops.statusPollInterval;
+        if ( changed ) {
+            v160.stored = true;
+            v160.hasTallyKey = true;
+            v160.tallyChannel = ops.tallyChannel;
+            v160.maxHDMI = ops.maxHDMIChannel;
+            v160.maxSDI = ops.maxSDIChannel;
+            v160.channelBank = ops.channelBank;
+            v160.autoStart = ops.autoStartEnabled;
+            v160.camOpMode = ops.cameraOperatorMode;
+            v160.brightness = ops.displayBrightnessLevel;
+            v160.pollInterval = ops.statusPollInterval;
+            if ( !markDirty( DIRTY_V160HD ) ) {
+                return false;
+            }
         }
 
-        prefs.putUChar( KEY_TALLY_CHANNEL, ops.tallyChannel );
-        prefs.putUChar( KEY_MAX_HDMI, ops.maxHDMIChannel );
-        prefs.putUChar( KEY_MAX_SDI, ops.maxSDIChannel );
-        prefs.putString( KEY_CHANNEL_BANK, ops.channelBank );
-        prefs.putBool( KEY_AUTO_START, ops.autoStartEnabled );
-        prefs.putBool( KEY_CAM_OP_MODE, ops.cameraOperatorMode );
-        prefs.putUChar( KEY_BRIGHTNESS, ops.displayBrightnessLevel );
-        prefs.putULong( KEY_POLL_INTERVAL, ops.statusPollInterval );
-        prefs.end();
-
-        log_i( "V-160HD configuration saved" );
+        log_i( "V-160HD configuration saved%s", changed ? "" : " (unchanged)" );
         return true;
     }
 
     bool ConfigManager::loadV160HDConfig( StacOperations& ops ) {
-        if ( !prefs.begin( NS_V160HD, READ_ONLY ) ) {
+        const auto &v160 = cache.v160hd;
+        if ( !v160.stored ) {
             log_w( "No V-160HD configuration found" );
             return false;
         }
 
         ops.switchModel = "V-160HD";
-        ops.tallyChannel = prefs.getUChar( KEY_TALLY_CHANNEL, 1 );
-        ops.maxHDMIChannel = prefs.getUChar( KEY_MAX_HDMI, 8 );
-        ops.maxSDIChannel = prefs.getUChar( KEY_MAX_SDI, 8 );
-        ops.channelBank = prefs.getString( KEY_CHANNEL_BANK, "hdmi_" );
-        ops.autoStartEnabled = prefs.getBool( KEY_AUTO_START, false );
-        ops.cameraOperatorMode = prefs.getBool( KEY_CAM_OP_MODE, true );
-        ops.displayBrightnessLevel = prefs.getUChar( KEY_BRIGHTNESS, 1 );
-        ops.statusPollInterval = prefs.getULong( KEY_POLL_INTERVAL, 300 );
+        ops.tallyChannel = v160.tallyChannel;
+        ops.maxHDMIChannel = v160.maxHDMI;
+        ops.maxSDIChannel = v160.maxSDI;
+        ops.channelBank = v160.channelBank;
+        ops.autoStartEnabled = v160.autoStart;
+        ops.cameraOperatorMode = v160.camOpMode;
+        ops.displayBrightnessLevel = v160.brightness;
+        ops.statusPollInterval = v160.pollInterval;
 
         // V-160HD doesn't use maxChannelCount
         ops.maxChannelCount = 0;
@@ -233,63 +414,42 @@ namespace Storage {
             ops.channelBank = "hdmi_";
         }
 
-        prefs.end();
-
         log_i( "V-160HD configuration loaded" );
         return true;
     }
 
     String ConfigManager::getActiveProtocol() {
-        String model;
-        IPAddress ip;
-        uint16_t port;
-        String username, password;
-
-        if ( loadSwitchConfig( model, ip, port, username, password ) ) {
-            return model;
+        if ( cache.sw.stored && !cache.sw.model.isEmpty() && cache.sw.ip != 0 ) {
+            return cache.sw.model;
         }
 
         return "";
     }
 
     bool ConfigManager::hasProtocolConfig( const String &protocol ) {
-        bool exists = false;
         if ( protocol == "V-60HD" ) {
-            if ( prefs.begin( NS_V60HD, READ_ONLY ) ) {
-                exists = prefs.isKey( KEY_TALLY_CHANNEL );
-                prefs.end();
-            }
+            return cache.v60hd.hasTallyKey;
         }
         else if ( protocol == "V-160HD" ) {
-            if ( prefs.begin( NS_V160HD, READ_ONLY ) ) {
-                exists = prefs.isKey( KEY_TALLY_CHANNEL );
-                prefs.end();
-            }
+            return cache.v160hd.hasTallyKey;
         }
-        return exists;
+        return false;
     }
 
     bool ConfigManager::saveStacID( const String &stacID ) {
-        if ( !prefs.begin( NS_IDENTITY, READ_WRITE ) ) {
-            log_e( "Failed to open identity preferences" );
-            return false;
+        if ( cache.identity.stacID != stacID ) {
+            cache.identity.stacID = stacID;
+            if ( !markDirty( DIRTY_IDENTITY ) ) {
+                return false;
+            }
         }
 
-        prefs.putString( KEY_STAC_ID, stacID );
-        prefs.end();
-
         log_i( "STAC ID saved: %s", stacID.c_str() );
         return true;
     }
 
     bool ConfigManager::loadStacID( String &stacID ) {
-        if ( !prefs.begin( NS_IDENTITY, READ_ONLY ) ) {
-            return false;
-        }
-
-        stacID = prefs.getString( KEY_STAC_ID, "" );
-        prefs.end();
-
+        stacID = cache.identity.stacID;
         return !stacID.isEmpty();
     }
 
@@ -317,32 +477,31 @@ namespace Storage {
     }
 
     bool ConfigManager::savePeripheralSettings( bool cameraMode, uint8_t brightnessLevel ) {
-        if ( !prefs.begin( NS_PERIPHERAL, READ_WRITE ) ) {
-            log_e( "Failed to open peripheral preferences" );
-            return false;
+        auto &pm = cache.peripheral;
+        if ( !( pm.stored && pm.cameraMode == cameraMode && pm.brightness == brightnessLevel ) ) {
+            pm.stored = true;
+            pm.cameraMode = cameraMode;
+            pm.brightness = brightnessLevel;
+            if ( !markDirty( DIRTY_PERIPHERAL ) ) {
+                return false;
+            }
         }
 
-        prefs.putBool( KEY_PM_CAMERA_MODE, cameraMode );
-        prefs.putUChar( KEY_PM_BRIGHTNESS, brightnessLevel );
-        prefs.putUChar( KEY_VERSION, Config::NVS::PM_PREFS_VERSION );
-        prefs.end();
-
         log_i( "Peripheral settings saved: mode=%s, brightness=%d",
                cameraMode ? "Camera" : "Talent", brightnessLevel );
         return true;
     }
 
     bool ConfigManager::loadPeripheralSettings( bool& cameraMode, uint8_t &brightnessLevel ) {
-        if ( !prefs.begin( NS_PERIPHERAL, READ_ONLY ) ) {
+        if ( !cache.peripheral.stored ) {
             log_w( "No peripheral settings found, using defaults" );
             cameraMode = false;  // Default to Talent mode
             brightnessLevel = 1;  // Default to brightness level 1
             return false;
         }
 
-        cameraMode = prefs.getBool( KEY_PM_CAMERA_MODE, false );
-        brightnessLevel = prefs.getUChar( KEY_PM_BRIGHTNESS, 1 );
-        prefs.end();
+        cameraMode = cache.peripheral.cameraMode;
+        brightnessLevel = cache.peripheral.brightness;
 
         log_i( "Peripheral settings loaded: mode=%s, brightness=%d",
                cameraMode ? "Camera" : "Talent", brightnessLevel );
@@ -350,29 +509,85 @@ namespace Storage {
     }
 
     bool ConfigManager::savePModeEnabled( bool enabled ) {
-        if ( !prefs.begin( NS_WIFI, READ_WRITE ) ) {
-            log_e( "Failed to open wifi preferences" );
-            return false;
+        if ( !( cache.wifi.stored && cache.wifi.pmEnabled == enabled ) ) {
+            cache.wifi.stored = true;
+            cache.wifi.pmEnabled = enabled;
+            if ( !markDirty( DIRTY_WIFI ) ) {
+                return false;
+            }
         }
 
-        prefs.putBool( KEY_PM_ENABLED, enabled );
-        prefs.end();
-
         log_i( "PMode enabled saved: %s", enabled ? "true" : "false" );
         return true;
     }
 
     bool ConfigManager::loadPModeEnabled() {
-        if ( !prefs.begin( NS_WIFI, READ_ONLY ) ) {
+        if ( !cache.wifi.stored ) {
             log_d( "No wifi preferences found, defaulting to normal mode" );
             return false;
         }
 
-        bool enabled = prefs.getBool( KEY_PM_ENABLED, false );
-        prefs.end();
+        log_i( "PMode enabled loaded: %s", cache.wifi.pmEnabled ? "true" : "false" );
+        return cache.wifi.pmEnabled;
+    }
+
+    bool ConfigManager::saveUpdateURL( const String &url ) {
+        if ( url.length() > Config::FleetOTA::MAX_URL_LENGTH ) {
+            log_e( "Update server URL longer than %u characters", static_cast<unsigned>( Config::FleetOTA::MAX_URL_LENGTH ) );
+            return false;
+        }
+
+        if ( !( cache.wifi.stored && cache.wifi.updateURL == url ) ) {
+            cache.wifi.stored = true;
+            cache.wifi.updateURL = url;
+            if ( !markDirty( DIRTY_WIFI ) ) {
+                return false;
+            }
+        }
+
+        log_i( "Update server URL saved: %s", url.isEmpty() ? "(none)" : url.c_str() );
+        return true;
+    }
 
-        log_i( "PMode enabled loaded: %s", enabled ? "true" : "false" );
-        return enabled;
+    String ConfigManager::loadUpdateURL() {
+        return cache.wifi.updateURL;
+    }
+
+    bool ConfigManager::saveWiFiLink( const WiFiLink &link ) {
+        if ( cache.wifi.stored && memcmp( &cache.wifi.link, &link, sizeof( link ) ) == 0 ) {
+            return true;
+        }
+
+        cache.wifi.stored = true;
+        cache.wifi.link = link;
+        if ( !markDirty( DIRTY_WIFI ) ) {
+            return false;
+        }
+
+        log_d( "WiFi link saved: channel %u", link.channel );
+        return true;
+    }
+
+    bool ConfigManager::loadWiFiLink( WiFiLink &link ) {
+        link = cache.wifi.link;
+        return link.isValid();
+    }
+
+    bool ConfigManager::savePowerProfile( PowerProfile profile ) {
+        if ( !( cache.wifi.stored && cache.wifi.powerProfile == profile ) ) {
+            cache.wifi.stored = true;
+            cache.wifi.powerProfile = profile;
+            if ( !markDirty( DIRTY_WIFI ) ) {
+                return false;
+            }
+        }
+
+        log_i( "Power profile saved: %d", static_cast<int>( profile ) );
+        return true;
+    }
+
+    PowerProfile ConfigManager::loadPowerProfile() {
+        return cache.wifi.powerProfile;
     }
 
     bool ConfigManager::isConfigured() {
@@ -382,6 +597,11 @@ namespace Storage {
     bool ConfigManager::clearAll() {
         log_i( "Clearing all NVS configuration data" );
 
+        // Whatever happens below, nothing cached should be written back
+        cache = CachedConfig();
+        dirty = 0;
+        legacy = 0;
+
         // Use esp-idf functions to erase entire NVS partition
         // This is simpler, faster, and more reliable than clearing each namespace individually
         esp_err_t err = nvs_flash_erase();
@@ -401,13 +621,375 @@ namespace Storage {
     }
 
     uint8_t ConfigManager::getConfigVersion() {
-        // Read global NOM version from wifi namespace
-        if ( prefs.begin( NS_WIFI, READ_ONLY ) ) {
-            uint8_t version = prefs.getUChar( KEY_VERSION, 0 );
+        // Global NOM version lives in the wifi namespace; 0 = no config exists
+        return cache.wifi.version;
+    }
+
+    bool ConfigManager::setDeferredCommit( bool defer ) {
+        deferCommit = defer;
+        if ( defer ) {
+            return true;
+        }
+        return commit();
+    }
+
+    bool ConfigManager::commit() {
+        bool ok = true;
+        for ( uint8_t flag = DIRTY_WIFI; flag <= DIRTY_PERIPHERAL; flag <<= 1 ) {
+            if ( dirty & flag ) {
+                if ( commitNamespace( flag ) ) {
+                    dirty &= ~flag;
+                }
+                else {
+                    ok = false;     // Stays dirty for the next commit
+                }
+            }
+        }
+        return ok;
+    }
+
+    bool ConfigManager::hasPendingChanges() const {
+        return dirty != 0;
+    }
+
+    const NvsStats &ConfigManager::getNvsStats() const {
+        return stats;
+    }
+
+    void ConfigManager::loadCache() {
+        cache = CachedConfig();
+        dirty = 0;
+        legacy = 0;
+
+        // Each namespace holds one record; a namespace without a record
+        // is read key by key (NOM v3/v4, PM v1/v2 layout) and queued for
+        // migration. Keys missing from an older layout keep their defaults.
+        // A record that is present but damaged is never migrated.
+
+        if ( openNamespace( NS_WIFI, READ_ONLY ) ) {
+            auto &wifi = cache.wifi;
+            wifi.stored = true;
+            WiFiRecord rec;
+            if ( readRecord( prefs, KEY_RECORD, rec ) ) {
+                wifi.hasSSIDKey = rec.hasSSID;
+                wifi.version = rec.version;
+                wifi.ssid = getField( rec.ssid );
+                wifi.password = deobfuscatePassword( getField( rec.password ) );
+                wifi.pmEnabled = rec.pmEnabled;
+                wifi.updateURL = getField( rec.updateURL );
+                wifi.link.ssidHash = rec.linkSSIDHash;
+                memcpy( wifi.link.bssid, rec.linkBSSID, sizeof( wifi.link.bssid ) );
+                wifi.link.channel = rec.linkChannel;
+                wifi.link.ip = rec.linkIP;
+                wifi.link.gateway = rec.linkGateway;
+                wifi.link.subnet = rec.linkSubnet;
+                wifi.link.dns = rec.linkDNS;
+                wifi.powerProfile = rec.powerProfile <= static_cast<uint8_t>( PowerProfile::BATTERY_SAVER ) ?
+                                    static_cast<PowerProfile>( rec.powerProfile ) : PowerProfile::BALANCED;
+            }
+            else if ( !isDamagedRecord( prefs, KEY_RECORD, NS_WIFI ) ) {
+                wifi.hasSSIDKey = prefs.isKey( KEY_SSID );
+                wifi.version = prefs.getUChar( KEY_VERSION, 0 );
+                wifi.ssid = prefs.getString( KEY_SSID, "" );
+                wifi.password = deobfuscatePassword( prefs.getString( KEY_PASSWORD, "" ) );
+                wifi.pmEnabled = prefs.getBool( KEY_PM_ENABLED, false );
+                legacy |= DIRTY_WIFI;
+            }
+            prefs.end();
+        }
+
+        if ( openNamespace( NS_SWITCH, READ_ONLY ) ) {
+            auto &sw = cache.sw;
+            sw.stored = true;
+            SwitchRecord rec;
+            if ( readRecord( prefs, KEY_RECORD, rec ) ) {
+                sw.hasModelKey = rec.hasModel;
+                sw.model = getField( rec.model );
+                sw.ip = rec.ip;
+                sw.port = rec.port;
+                sw.username = getField( rec.username );
+                sw.password = deobfuscatePassword( getField( rec.password ) );
+            }
+            else if ( !isDamagedRecord( prefs, KEY_RECORD, NS_SWITCH ) ) {
+                sw.hasModelKey = prefs.isKey( KEY_MODEL );
+                sw.model = prefs.getString( KEY_MODEL, "" );
+                sw.ip = prefs.getUInt( KEY_IP, 0 );
+                sw.port = prefs.getUShort( KEY_PORT, 80 );
+                sw.username = prefs.getString( KEY_USERNAME, "" );
+                sw.password = deobfuscatePassword( prefs.getString( KEY_PASSWORD, "" ) );
+                legacy |= DIRTY_SWITCH;
+            }
+            prefs.end();
+        }
+
+        if ( openNamespace( NS_V60HD, READ_ONLY ) ) {
+            auto &v60 = cache.v60hd;
+            v60.stored = true;
+            V60HDRecord rec;
+            if ( readRecord( prefs, KEY_RECORD, rec ) ) {
+                v60.hasTallyKey = true;
+                v60.tallyChannel = rec.tallyChannel;
+                v60.maxChannel = rec.maxChannel;
+                v60.autoStart = rec.autoStart;
+                v60.camOpMode = rec.camOpMode;
+                v60.brightness = rec.brightness;
+                v60.pollInterval = rec.pollInterval;
+            }
+            else if ( !isDamagedRecord( prefs, KEY_RECORD, NS_V60HD ) ) {
+                v60.hasTallyKey = prefs.isKey( KEY_TALLY_CHANNEL );
+                v60.tallyChannel = prefs.getUChar( KEY_TALLY_CHANNEL, 1 );
+                v60.maxChannel = prefs.getUChar( KEY_MAX_CHANNEL, 8 );
+                v60.autoStart = prefs.getBool( KEY_AUTO_START, false );
+                v60.camOpMode = prefs.getBool( KEY_CAM_OP_MODE, true );
+                v60.brightness = prefs.getUChar( KEY_BRIGHTNESS, 1 );
+                v60.pollInterval = prefs.getULong( KEY_POLL_INTERVAL, 300 );
+                legacy |= DIRTY_V60HD;
+            }
+            prefs.end();
+        }
+
+        if ( openNamespace( NS_V160HD, READ_ONLY ) ) {
+            auto &v160 = cache.v160hd;
+            v160.stored = true;
+            V160HDRecord rec;
+            if ( readRecord( prefs, KEY_RECORD, rec ) ) {
+                v160.hasTallyKey = true;
+                v160.tallyChannel = rec.tallyChannel;
+                v160.maxHDMI = rec.maxHDMI;
+                v160.maxSDI = rec.maxSDI;
+                v160.channelBank = getField( rec.channelBank );
+                v160.autoStart = rec.autoStart;
+                v160.camOpMode = rec.camOpMode;
+                v160.brightness = rec.brightness;
+                v160.pollInterval = rec.pollInterval;
+            }
+            else if ( !isDamagedRecord( prefs, KEY_RECORD, NS_V160HD ) ) {
+                v160.hasTallyKey = prefs.isKey( KEY_TALLY_CHANNEL );
+                v160.tallyChannel = prefs.getUChar( KEY_TALLY_CHANNEL, 1 );
+                v160.maxHDMI = prefs.getUChar( KEY_MAX_HDMI, 8 );
+                v160.maxSDI = prefs.getUChar( KEY_MAX_SDI, 8 );
+                v160.channelBank = prefs.getString( KEY_CHANNEL_BANK, "hdmi_" );
+                v160.autoStart = prefs.getBool( KEY_AUTO_START, false );
+                v160.camOpMode = prefs.getBool( KEY_CAM_OP_MODE, true );
+                v160.brightness = prefs.getUChar( KEY_BRIGHTNESS, 1 );
+                v160.pollInterval = prefs.getULong( KEY_POLL_INTERVAL, 300 );
+                legacy |= DIRTY_V160HD;
+            }
             prefs.end();
-            return version;
         }
-        return 0;  // No config exists
+
+        if ( openNamespace( NS_IDENTITY, READ_ONLY ) ) {
+            IdentityRecord rec;
+            if ( readRecord( prefs, KEY_RECORD, rec ) ) {
+                cache.identity.stacID = getField( rec.stacID );
+            }
+            else if ( !isDamagedRecord( prefs, KEY_RECORD, NS_IDENTITY ) ) {
+                cache.identity.stacID = prefs.getString( KEY_STAC_ID, "" );
+                legacy |= DIRTY_IDENTITY;
+            }
+            prefs.end();
+        }
+
+        if ( openNamespace( NS_PERIPHERAL, READ_ONLY ) ) {
+            auto &pm = cache.peripheral;
+            pm.stored = true;
+            PeripheralRecord rec;
+            if ( readRecord( prefs, KEY_RECORD, rec ) ) {
+                pm.cameraMode = rec.cameraMode;
+                pm.brightness = rec.brightness;
+            }
+            else if ( !isDamagedRecord( prefs, KEY_RECORD, NS_PERIPHERAL ) ) {
+                pm.cameraMode = prefs.getBool( KEY_PM_CAMERA_MODE, false );
+                pm.brightness = prefs.getUChar( KEY_PM_BRIGHTNESS, 1 );
+                legacy |= DIRTY_PERIPHERAL;
+            }
+            prefs.end();
+        }
+    }
+
+    bool ConfigManager::openNamespace( const char *ns, bool readOnly ) {
+        stats.opens++;
+        return prefs.begin( ns, readOnly );
+    }
+
+    bool ConfigManager::markDirty( uint8_t flags ) {
+        dirty |= flags;
+        if ( deferCommit ) {
+            return true;
+        }
+        return commit();
+    }
+
+    bool ConfigManager::commitNamespace( uint8_t flag ) {
+        const char *ns = nullptr;
+        switch ( flag ) {
+            case DIRTY_WIFI:
+                ns = NS_WIFI;
+                break;
+            case DIRTY_SWITCH:
+                ns = NS_SWITCH;
+                break;
+            case DIRTY_V60HD:
+                ns = NS_V60HD;
+                break;
+            case DIRTY_V160HD:
+                ns = NS_V160HD;
+                break;
+            case DIRTY_IDENTITY:
+                ns = NS_IDENTITY;
+                break;
+            case DIRTY_PERIPHERAL:
+                ns = NS_PERIPHERAL;
+                break;
+            default:
+                return false;
+        }
+
+        if ( !openNamespace( ns, READ_WRITE ) ) {
+            log_e( "Failed to open %s preferences", ns );
+            return false;
+        }
+
+        bool written = false;
+        switch ( flag ) {
+            case DIRTY_WIFI: {
+                const auto &wifi = cache.wifi;
+                WiFiRecord rec;
+                rec.version = wifi.version;
+                rec.hasSSID = wifi.hasSSIDKey;
+                rec.pmEnabled = wifi.pmEnabled;
+                setField( rec.ssid, wifi.ssid );
+                setField( rec.updateURL, wifi.updateURL );
+                setField( rec.password, obfuscatePassword( wifi.password ) );
+                rec.linkSSIDHash = wifi.link.ssidHash;
+                memcpy( rec.linkBSSID, wifi.link.bssid, sizeof( rec.linkBSSID ) );
+                rec.linkChannel = wifi.link.channel;
+                rec.linkIP = wifi.link.ip;
+                rec.linkGateway = wifi.link.gateway;
+                rec.linkSubnet = wifi.link.subnet;
+                rec.linkDNS = wifi.link.dns;
+                rec.powerProfile = static_cast<uint8_t>( wifi.powerProfile );
+                written = writeRecord( prefs, KEY_RECORD, rec );
+                break;
+            }
+            case DIRTY_SWITCH: {
+                const auto &sw = cache.sw;
+                SwitchRecord rec;
+                rec.hasModel = sw.hasModelKey;
+                setField( rec.model, sw.model );
+                rec.ip = sw.ip;
+                rec.port = sw.port;
+                setField( rec.username, sw.username );
+                setField( rec.password, obfuscatePassword( sw.password ) );
+                written = writeRecord( prefs, KEY_RECORD, rec );
+                break;
+            }
+            case DIRTY_V60HD: {
+                const auto &v60 = cache.v60hd;
+                V60HDRecord rec;
+                rec.tallyChannel = v60.tallyChannel;
+                rec.maxChannel = v60.maxChannel;
+                rec.autoStart = v60.autoStart;
+                rec.camOpMode = v60.camOpMode;
+                rec.brightness = v60.brightness;
+                rec.pollInterval = v60.pollInterval;
+                written = writeRecord( prefs, KEY_RECORD, rec );
+                break;
+            }
+            case DIRTY_V160HD: {
+                const auto &v160 = cache.v160hd;
+                V160HDRecord rec;
+                rec.tallyChannel = v160.tallyChannel;
+                rec.maxHDMI = v160.maxHDMI;
+                rec.maxSDI = v160.maxSDI;
+                setField( rec.channelBank, v160.channelBank );
+                rec.autoStart = v160.autoStart;
+                rec.camOpMode = v160.camOpMode;
+                rec.brightness = v160.brightness;
+                rec.pollInterval = v160.pollInterval;
+                written = writeRecord( prefs, KEY_RECORD, rec );
+                break;
+            }
+            case DIRTY_IDENTITY: {
+                IdentityRecord rec;
+                setField( rec.stacID, cache.identity.stacID );
+                written = writeRecord( prefs, KEY_RECORD, rec );
+                break;
+            }
+            case DIRTY_PERIPHERAL: {
+                PeripheralRecord rec;
+                rec.version = Config::NVS::PM_PREFS_VERSION;
+                rec.cameraMode = cache.peripheral.cameraMode;
+                rec.brightness = cache.peripheral.brightness;
+                written = writeRecord( prefs, KEY_RECORD, rec );
+                break;
+            }
+        }
+
+        // The old per-key entries go only once the record is in flash, so
+        // a failed write or a power loss leaves them to migrate from again
+        if ( written && ( legacy & flag ) ) {
+            removeLegacyKeys( flag );
+            legacy &= ~flag;
+        }
+        prefs.end();
+
+        if ( !written ) {
+            log_e( "Failed to write %s record", ns );
+            return false;
+        }
+
+        stats.commits++;
+        log_d( "Committed %s record", ns );
+        return true;
+    }
+
+    void ConfigManager::removeLegacyKeys( uint8_t flag ) {
+        static const char *const WIFI_KEYS[] = { KEY_VERSION, KEY_SSID, KEY_PASSWORD, KEY_PM_ENABLED };
+        static const char *const SWITCH_KEYS[] = { KEY_VERSION, KEY_MODEL, KEY_IP, KEY_PORT, KEY_USERNAME, KEY_PASSWORD };
+        static const char *const V60HD_KEYS[] = { KEY_TALLY_CHANNEL, KEY_MAX_CHANNEL, KEY_AUTO_START, KEY_CAM_OP_MODE,
+                                                  KEY_BRIGHTNESS, KEY_POLL_INTERVAL };
+        static const char *const V160HD_KEYS[] = { KEY_TALLY_CHANNEL, KEY_MAX_HDMI, KEY_MAX_SDI, KEY_CHANNEL_BANK,
+                                                   KEY_AUTO_START, KEY_CAM_OP_MODE, KEY_BRIGHTNESS, KEY_POLL_INTERVAL };
+        static const char *const IDENTITY_KEYS[] = { KEY_STAC_ID };
+        static const char *const PERIPHERAL_KEYS[] = { KEY_VERSION, KEY_PM_CAMERA_MODE, KEY_PM_BRIGHTNESS };
+
+        const char *const *keys = nullptr;
+        size_t count = 0;
+        switch ( flag ) {
+            case DIRTY_WIFI:
+                keys = WIFI_KEYS;
+                count = sizeof( WIFI_KEYS ) / sizeof( WIFI_KEYS[ 0 ] );
+                break;
+            case DIRTY_SWITCH:
+                keys = SWITCH_KEYS;
+                count = sizeof( SWITCH_KEYS ) / sizeof( SWITCH_KEYS[ 0 ] );
+                break;
+            case DIRTY_V60HD:
+                keys = V60HD_KEYS;
+                count = sizeof( V60HD_KEYS ) / sizeof( V60HD_KEYS[ 0 ] );
+                break;
+            case DIRTY_V160HD:
+                keys = V160HD_KEYS;
+                count = sizeof( V160HD_KEYS ) / sizeof( V160HD_KEYS[ 0 ] );
+                break;
+            case DIRTY_IDENTITY:
+                keys = IDENTITY_KEYS;
+                count = sizeof( IDENTITY_KEYS ) / sizeof( IDENTITY_KEYS[ 0 ] );
+                break;
+            case DIRTY_PERIPHERAL:
+                keys = PERIPHERAL_KEYS;
+                count = sizeof( PERIPHERAL_KEYS ) / sizeof( PERIPHERAL_KEYS[ 0 ] );
+                break;
+        }
+
+        // Keys an older layout never wrote are simply not found. Any left
+        // behind are harmless: the record is read first from now on.
+        for ( size_t i = 0; i < count; i++ ) {
+            if ( prefs.isKey( keys[ i ] ) && !prefs.remove( keys[ i ] ) ) {
+                log_w( "Failed to remove legacy key '%s'", keys[ i ] );
+            }
+        }
     }
 
     bool ConfigManager::checkSchemaVersion() {
@@ -418,6 +1000,12 @@ namespace Storage {
             return true;  // Fresh device, no mismatch
         }
 
+        if ( storedVersion < Config::NVS::NOM_PREFS_VERSION ) {
+            // Older layouts are migrated field by field in begin()
+            log_i( "NVS schema version %d, migrating to %d", storedVersion, Config::NVS::NOM_PREFS_VERSION );
+            return true;
+        }
+
         if ( storedVersion != Config::NVS::NOM_PREFS_VERSION ) {
             log_w( "========================================" );
             log_w( "NVS SCHEMA VERSION MISMATCH" );
@@ -0,0 +1,244 @@
+#include "Utils/BootProfiler.h"
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <cstring>
+
+
+namespace Utils {
+
+    namespace {
+
+        constexpr uint32_t HISTORY_MAGIC = 0x53544251;     // "STBQ" (bumped when BootProfile changes)
+        constexpr uint8_t PHASE_COUNT = static_cast<uint8_t>( BootPhase::COUNT );
+
+        struct BootHistory {
+            uint32_t magic;
+            uint32_t bootCount;
+            uint8_t newest;         // Slot of the current boot
+            uint8_t count;          // Valid slots
+            BootProfile profiles[ BootProfiler::HISTORY_SIZE ];
+        };
+
+        // A warm restart reads the history left by the previous firmware: any layout change needs a new magic
+        static_assert( sizeof( BootProfile ) == 44, "BootProfile layout changed - bump HISTORY_MAGIC and this size" );
+
+        // Not cleared by the startup code, so earlier boots survive a restart
+        RTC_NOINIT_ATTR BootHistory history;
+
+        bool started = false;
+
+        const char *resetReasonName( uint8_t reason ) {
+            switch ( static_cast<esp_reset_reason_t>( reason ) ) {
+                case ESP_RST_POWERON:
+                    return "power-on";
+                case ESP_RST_EXT:
+                    return "external";
+                case ESP_RST_SW:
+                    return "software";
+                case ESP_RST_PANIC:
+                    return "panic";
+                case ESP_RST_INT_WDT:
+                case ESP_RST_TASK_WDT:
+                case ESP_RST_WDT:
+                    return "watchdog";
+                case ESP_RST_DEEPSLEEP:
+                    return "deep-sleep";
+                case ESP_RST_BROWNOUT:
+                    return "brownout";
+                default:
+                    return "unknown";
+            }
+        }
+
+    } // namespace
+
+    void BootProfiler::begin() {
+        if ( started ) {
+            return;
+        }
+        started = true;
+
+        if ( history.magic != HISTORY_MAGIC || history.newest >= HISTORY_SIZE || history.count > HISTORY_SIZE ) {
+            memset( &history, 0, sizeof( history ) );
+            history.magic = HISTORY_MAGIC;
+            history.newest = HISTORY_SIZE - 1;
+        }
+
+        history.newest = ( history.newest + 1 ) % HISTORY_SIZE;
+        if ( history.count < HISTORY_SIZE ) {
+            history.count++;
+        }
+        history.bootCount++;
+
+        BootProfile &profile = history.profiles[ history.newest ];
+        memset( &profile, 0, sizeof( profile ) );
+        profile.bootNumber = history.bootCount;
+        profile.resetReason = static_cast<uint8_t>( esp_reset_reason() );
+
+        mark( BootPhase::SETUP_START );
+    }
+
+    void BootProfiler::mark( BootPhase phase ) {
+        if ( !started || phase >= BootPhase::COUNT ) {
+            return;
+        }
+
+        uint32_t &stamp = history.profiles[ history.newest ].phaseUs[ static_cast<uint8_t>( phase ) ];
+        if ( stamp == 0 ) {
+            stamp = static_cast<uint32_t>( esp_timer_get_time() );
+            log_d( "Boot phase %s at %lu ms", phaseName( phase ), static_cast<unsigned long>( stamp / 1000 ) );
+        }
+    }
+
+    void BootProfiler::noteWarmStart() {
+        if ( started ) {
+            history.profiles[ history.newest ].warmStart = 1;
+        }
+    }
+
+    void BootProfiler::noteWiFiConnect( WiFiConnectPath path, uint32_t ms ) {
+        if ( !started ) {
+            return;
+        }
+
+        BootProfile &profile = history.profiles[ history.newest ];
+        if ( profile.wifiPath == static_cast<uint8_t>( WiFiConnectPath::NONE ) ) {
+            profile.wifiPath = static_cast<uint8_t>( path );
+            profile.wifiConnectMs = ms > UINT16_MAX ? UINT16_MAX : static_cast<uint16_t>( ms );
+        }
+    }
+
+    uint8_t BootProfiler::getCount() {
+        return started ? history.count : 0;
+    }
+
+    const BootProfile *BootProfiler::getProfile( uint8_t age ) {
+        if ( age >= getCount() ) {
+            return nullptr;
+        }
+        return &history.profiles[ ( history.newest + HISTORY_SIZE - age ) % HISTORY_SIZE ];
+    }
+
+    const char *BootProfiler::phaseName( BootPhase phase ) {
+        switch ( phase ) {
+            case BootPhase::SETUP_START:
+                return "setup_start";
+            case BootPhase::HARDWARE_READY:
+                return "hardware_ready";
+            case BootPhase::STORAGE_READY:
+                return "storage_ready";
+            case BootPhase::MODE_SELECTED:
+                return "mode_selected";
+            case BootPhase::APP_READY:
+                return "app_ready";
+            case BootPhase::STARTUP_DONE:
+                return "startup_done";
+            case BootPhase::WIFI_CONNECTED:
+                return "wifi_connected";
+            case BootPhase::FIRST_TALLY:
+                return "first_tally";
+            default:
+                return "unknown";
+        }
+    }
+
+    const char *BootProfiler::wifiPathName( WiFiConnectPath path ) {
+        switch ( path ) {
+            case WiFiConnectPath::SCAN:
+                return "scan";
+            case WiFiConnectPath::DIRECTED:
+                return "directed";
+            case WiFiConnectPath::DIRECTED_STATIC:
+                return "directed_static";
+            case WiFiConnectPath::FALLBACK_SCAN:
+                return "fallback_scan";
+            default:
+                return "none";
+        }
+    }
+
+    void BootProfiler::printReport() {
+        for ( uint8_t age = 0; age < getCount(); age++ ) {
+            const BootProfile *profile = getProfile( age );
+            Serial.printf( "    Boot #%lu (%s reset, %s start)%s\r\n",
+                           static_cast<unsigned long>( profile->bootNumber ),
+                           resetReasonName( profile->resetReason ),
+                           profile->warmStart ? "warm" : "cold",
+                           age == 0 ? " - this boot" : "" );
+
+            // Reached phases sorted by time (insertion sort, at most PHASE_COUNT entries)
+            uint8_t order[ PHASE_COUNT ];
+            uint8_t reached = 0;
+            for ( uint8_t i = 0; i < PHASE_COUNT; i++ ) {
+                if ( profile->phaseUs[ i ] == 0 ) {
+                    continue;
+                }
+                uint8_t j = reached++;
+                while ( j > 0 && profile->phaseUs[ order[ j - 1 ] ] > profile->phaseUs[ i ] ) {
+                    order[ j ] = order[ j - 1 ];
+                    j--;
+                }
+                order[ j ] = i;
+            }
+
+            uint32_t previousUs = 0;
+            for ( uint8_t k = 0; k < reached; k++ ) {
+                uint32_t us = profile->phaseUs[ order[ k ] ];
+                Serial.printf( "      %-15s %7lu ms  (+%lu)\r\n", phaseName( static_cast<BootPhase>( order[ k ] ) ),
+                               static_cast<unsigned long>( us / 1000 ),
+                               static_cast<unsigned long>( ( us - previousUs ) / 1000 ) );
+                previousUs = us;
+            }
+
+            if ( profile->wifiPath != static_cast<uint8_t>( WiFiConnectPath::NONE ) ) {
+                Serial.printf( "      WiFi connect    %7u ms  (%s)\r\n", profile->wifiConnectMs,
+                               wifiPathName( static_cast<WiFiConnectPath>( profile->wifiPath ) ) );
+            }
+        }
+        Serial.flush();
+    }
+
+    String BootProfiler::toJSON() {
+        String json = "{\"boots\":[";
+        char buffer[ 80 ];      // Longest boot header is 68 bytes (10-digit boot number, "deep-sleep", "false")
+
+        for ( uint8_t age = 0; age < getCount(); age++ ) {
+            const BootProfile *profile = getProfile( age );
+            snprintf( buffer, sizeof( buffer ), "%s{\"boot\":%lu,\"reset\":\"%s\",\"warm\":%s,\"phases_ms\":{",
+                      age == 0 ? "" : ",",
+                      static_cast<unsigned long>( profile->bootNumber ),
+                      resetReasonName( profile->resetReason ),
+                      profile->warmStart ? "true" : "false" );
+            json += buffer;
+
+            bool first = true;
+            for ( uint8_t i = 0; i < PHASE_COUNT; i++ ) {
+                if ( profile->phaseUs[ i ] == 0 ) {
+                    continue;
+                }
+                snprintf( buffer, sizeof( buffer ), "%s\"%s\":%lu", first ? "" : ",",
+                          phaseName( static_cast<BootPhase>( i ) ),
+                          static_cast<unsigned long>( profile->phaseUs[ i ] / 1000 ) );
+                json += buffer;
+                first = false;
+            }
+            json += "}";
+
+            if ( profile->wifiPath != static_cast<uint8_t>( WiFiConnectPath::NONE ) ) {
+                snprintf( buffer, sizeof( buffer ), ",\"wifi\":{\"path\":\"%s\",\"ms\":%u}",
+                          wifiPathName( static_cast<WiFiConnectPath>( profile->wifiPath ) ),
+                          profile->wifiConnectMs );
+                json += buffer;
+            }
+            json += "}";
+        }
+
+        json += "]}";
+        return json;
+    }
+
+} // namespace Utils
+
+
+//  --- EOF --- //
@@ -0,0 +1,116 @@
+#ifndef STAC_TEST_FAKE_ARDUINO_H
+#define STAC_TEST_FAKE_ARDUINO_H
+
+/**
+ * @brief Host stand-in for the Arduino-ESP32 core, enough for the sources built in [env:native]
+ *
+ * Time comes from FakeClock; delay() also yields, so std::threads standing
+ * in for other tasks get to run while code under test waits for them.
+ * log_x() output is dropped unless the test is built with -DSTAC_TEST_LOG.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <thread>
+#include "FakeClock.h"
+#include "WString.h"
+#include "IPAddress.h"
+#include "esp_timer.h"
+
+#if defined(STAC_TEST_LOG)
+    #define STAC_FAKE_LOG( level, format, ... ) printf( "[" level "] " format "\n", ##__VA_ARGS__ )
+#else
+    #define STAC_FAKE_LOG( level, format, ... ) do { if ( 0 ) printf( format, ##__VA_ARGS__ ); } while ( 0 )
+#endif
+
+#define log_e( format, ... ) STAC_FAKE_LOG( "E", format, ##__VA_ARGS__ )
+#define log_w( format, ... ) STAC_FAKE_LOG( "W", format, ##__VA_ARGS__ )
+#define log_i( format, ... ) STAC_FAKE_LOG( "I", format, ##__VA_ARGS__ )
+#define log_d( format, ... ) STAC_FAKE_LOG( "D", format, ##__VA_ARGS__ )
+#define log_v( format, ... ) STAC_FAKE_LOG( "V", format, ##__VA_ARGS__ )
+
+#define DEC 10
+#define HEX 16
+
+using std::min;
+using std::max;
+
+/**
+ * @brief Only there to be handed to APIs that report errors on it; output is dropped
+ */
+class HardwareSerial {
+  public:
+    int printf( const char *format, ... ) {
+        ( void )format;
+        return 0;
+    }
+
+    void flush() {
+    }
+};
+
+inline HardwareSerial Serial;
+
+#if defined(__GLIBC__) && ( __GLIBC__ < 2 || ( __GLIBC__ == 2 && __GLIBC_MINOR__ < 38 ) )
+// newlib on the ESP32 has strlcpy; older glibc does not
+inline size_t strlcpy( char *dst, const char *src, size_t size ) {
+    size_t len = strlen( src );
+    if ( size > 0 ) {
+        size_t copy = len < size - 1 ? len : size - 1;
+        memcpy( dst, src, copy );
+        dst[ copy ] = '\0';
+    }
+    return len;
+}
+#endif
+
+inline unsigned long millis() {
+    return static_cast<unsigned long>( FakeClock::nowUs() / 1000 );
+}
+
+inline unsigned long micros() {
+    return static_cast<unsigned long>( FakeClock::nowUs() );
+}
+
+inline void delay( uint32_t ms ) {
+    FakeClock::advanceMillis( ms );
+    std::this_thread::yield();
+}
+
+inline void delayMicroseconds( uint32_t us ) {
+    FakeClock::advanceMicros( us );
+}
+
+inline void yield() {
+}
+
+/**
+ * @brief CPU clock as last set, so tests can check frequency scaling
+ */
+namespace FakeCpu {
+
+    inline uint32_t &mhz() {
+        static uint32_t current = 240;
+        return current;
+    }
+
+} // namespace FakeCpu
+
+inline uint32_t getCpuFrequencyMhz() {
+    return FakeCpu::mhz();
+}
+
+inline bool setCpuFrequencyMhz( uint32_t mhz ) {
+    FakeCpu::mhz() = mhz;
+    return true;
+}
+
+
+#endif // STAC_TEST_FAKE_ARDUINO_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,128 @@
+#ifndef STAC_TEST_FAKE_ARDUINO_GFX_LIBRARY_H
+#define STAC_TEST_FAKE_ARDUINO_GFX_LIBRARY_H
+
+#include <Arduino.h>
+#include <cstdint>
+
+
+/**
+ * @brief Host stand-in for the parts of Arduino_GFX that PaletteCanvas builds on
+ *
+ * Arduino_G is the panel-side interface (begin and bitmap push).
+ * Arduino_GFX adds clipping drawing calls that end in the
+ * write*Preclipped virtuals, as the library does.
+ */
+
+#define GFX_NOT_DEFINED -1
+#define GFX_SKIP_OUTPUT_BEGIN -2
+
+class Arduino_G {
+  public:
+    Arduino_G( int16_t w, int16_t h ) : WIDTH( w ), HEIGHT( h ) {}
+    virtual ~Arduino_G() = default;
+
+    virtual bool begin( int32_t speed = GFX_NOT_DEFINED ) = 0;
+    virtual void draw16bitRGBBitmap( int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h ) = 0;
+
+  protected:
+    int16_t WIDTH;
+    int16_t HEIGHT;
+};
+
+class Arduino_GFX : public Arduino_G {
+  public:
+    Arduino_GFX( int16_t w, int16_t h ) : Arduino_G( w, h ), _width( w ), _height( h ) {}
+
+    bool begin( int32_t speed = GFX_NOT_DEFINED ) override {
+        ( void )speed;
+        return true;
+    }
+
+    void draw16bitRGBBitmap( int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h ) override {
+        for ( int16_t row = 0; row < h; row++ ) {
+            for ( int16_t col = 0; col < w; col++ ) {
+                drawPixel( x + col, y + row, bitmap[ row * w + col ] );
+            }
+        }
+    }
+
+    virtual void writePixelPreclipped( int16_t x, int16_t y, uint16_t color ) = 0;
+
+    virtual void writeFillRectPreclipped( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color ) {
+        for ( int16_t row = y; row < y + h; row++ ) {
+            for ( int16_t col = x; col < x + w; col++ ) {
+                writePixelPreclipped( col, row, color );
+            }
+        }
+    }
+
+    virtual void writeFastVLine( int16_t x, int16_t y, int16_t h, uint16_t color ) {
+        fillRect( x, y, 1, h, color );
+    }
+
+    virtual void writeFastHLine( int16_t x, int16_t y, int16_t w, uint16_t color ) {
+        fillRect( x, y, w, 1, color );
+    }
+
+    void startWrite() {
+    }
+
+    void endWrite() {
+    }
+
+    void drawPixel( int16_t x, int16_t y, uint16_t color ) {
+        if ( x >= 0 && y >= 0 && x < _width && y < _height ) {
+            writePixelPreclipped( x, y, color );
+        }
+    }
+
+    void fillRect( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color ) {
+        if ( w < 0 ) {
+            x += w + 1;
+            w = -w;
+        }
+        if ( h < 0 ) {
+            y += h + 1;
+            h = -h;
+        }
+        if ( x < 0 ) {
+            w += x;
+            x = 0;
+        }
+        if ( y < 0 ) {
+            h += y;
+            y = 0;
+        }
+        if ( x + w > _width ) {
+            w = _width - x;
+        }
+        if ( y + h > _height ) {
+            h = _height - y;
+        }
+        if ( w > 0 && h > 0 ) {
+            writeFillRectPreclipped( x, y, w, h, color );
+        }
+    }
+
+    void fillScreen( uint16_t color ) {
+        fillRect( 0, 0, _width, _height, color );
+    }
+
+    int16_t width() const {
+        return _width;
+    }
+
+    int16_t height() const {
+        return _height;
+    }
+
+  protected:
+    int16_t _width;
+    int16_t _height;
+};
+
+
+#endif // STAC_TEST_FAKE_ARDUINO_GFX_LIBRARY_H
+
+
+//  --- EOF --- //
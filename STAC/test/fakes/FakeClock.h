@@ -0,0 +1,38 @@
+#ifndef STAC_TEST_FAKE_CLOCK_H
+#define STAC_TEST_FAKE_CLOCK_H
+
+#include <cstdint>
+
+
+/**
+ * @brief Virtual clock behind millis(), micros(), delay() and esp_timer_get_time()
+ *
+ * Time only moves when a test (or code under test calling delay()) moves it,
+ * so timing behaviour is exact and runs take no wall-clock time.
+ */
+namespace FakeClock {
+
+    inline int64_t &nowUs() {
+        static int64_t now = 0;
+        return now;
+    }
+
+    inline void setMillis( uint32_t ms ) {
+        nowUs() = static_cast<int64_t>( ms ) * 1000;
+    }
+
+    inline void advanceMillis( uint32_t ms ) {
+        nowUs() += static_cast<int64_t>( ms ) * 1000;
+    }
+
+    inline void advanceMicros( uint32_t us ) {
+        nowUs() += us;
+    }
+
+} // namespace FakeClock
+
+
+#endif // STAC_TEST_FAKE_CLOCK_H
+
+
+//  --- EOF --- //
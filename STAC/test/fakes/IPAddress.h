@@ -0,0 +1,75 @@
+#ifndef STAC_TEST_FAKE_IPADDRESS_H
+#define STAC_TEST_FAKE_IPADDRESS_H
+
+#include <cstdint>
+#include <cstdio>
+#include "WString.h"
+
+
+/**
+ * @brief Host stand-in for the Arduino IPv4 address class
+ */
+class IPAddress {
+  public:
+    IPAddress() : IPAddress( 0, 0, 0, 0 ) {}
+
+    IPAddress( uint8_t a, uint8_t b, uint8_t c, uint8_t d ) : octets{ a, b, c, d } {}
+
+    IPAddress( uint32_t address ) {
+        // Same byte order as the ESP32 core: first octet in the low byte
+        for ( int i = 0; i < 4; i++ ) {
+            octets[ i ] = static_cast<uint8_t>( address >> ( 8 * i ) );
+        }
+    }
+
+    operator uint32_t() const {
+        return static_cast<uint32_t>( octets[ 0 ] ) | ( static_cast<uint32_t>( octets[ 1 ] ) << 8 ) |
+               ( static_cast<uint32_t>( octets[ 2 ] ) << 16 ) | ( static_cast<uint32_t>( octets[ 3 ] ) << 24 );
+    }
+
+    uint8_t operator[]( int index ) const {
+        return octets[ index ];
+    }
+
+    uint8_t &operator[]( int index ) {
+        return octets[ index ];
+    }
+
+    bool operator==( const IPAddress &other ) const {
+        return static_cast<uint32_t>( *this ) == static_cast<uint32_t>( other );
+    }
+
+    bool operator!=( const IPAddress &other ) const {
+        return !( *this == other );
+    }
+
+    bool fromString( const char *text ) {
+        unsigned int a, b, c, d;
+        char tail;
+        if ( text == nullptr || sscanf( text, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail ) != 4 ||
+                a > 255 || b > 255 || c > 255 || d > 255 ) {
+            return false;
+        }
+        *this = IPAddress( a, b, c, d );
+        return true;
+    }
+
+    bool fromString( const String &text ) {
+        return fromString( text.c_str() );
+    }
+
+    String toString() const {
+        char text[ 16 ];
+        snprintf( text, sizeof( text ), "%u.%u.%u.%u", octets[ 0 ], octets[ 1 ], octets[ 2 ], octets[ 3 ] );
+        return String( text );
+    }
+
+  private:
+    uint8_t octets[ 4 ];
+};
+
+
+#endif // STAC_TEST_FAKE_IPADDRESS_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,141 @@
+#ifndef STAC_TEST_FAKE_LITELED_H
+#define STAC_TEST_FAKE_LITELED_H
+
+#include <cstdint>
+#include <vector>
+#include "esp_err.h"
+
+
+typedef enum {
+    LED_STRIP_WS2812,
+    LED_STRIP_SK6812,
+    LED_STRIP_APA106,
+    LED_STRIP_SM16703,
+    LED_STRIP_WS2812_RGB
+} led_strip_type_t;
+
+typedef uint32_t crgb_t;
+
+
+/**
+ * @brief Host stand-in for a LiteLED strip
+ *
+ * Keeps the pixel buffer and records what each show() would have put on
+ * the wire: the colour bytes in the strip type's order, each scaled by
+ * the brightness the way LiteLED does it (FastLED's scale8_video). The
+ * strip most recently begun is reachable through LiteLED::last(), so a
+ * test can inspect the strip a display owns.
+ */
+class LiteLED {
+  public:
+    LiteLED( led_strip_type_t type, bool isRGBW )
+        : type( type )
+        , isRGBW( isRGBW ) {
+    }
+
+    esp_err_t begin( uint8_t pin, size_t length ) {
+        this->pin = pin;
+        pixels.assign( length, 0 );
+        last() = this;
+        return ESP_OK;
+    }
+
+    esp_err_t setPixel( size_t index, crgb_t color, bool show = false ) {
+        if ( index >= pixels.size() ) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        pixels[ index ] = color;
+        return show ? this->show() : ESP_OK;
+    }
+
+    esp_err_t fill( crgb_t color, bool show = false ) {
+        pixels.assign( pixels.size(), color );
+        return show ? this->show() : ESP_OK;
+    }
+
+    esp_err_t clear( bool show = false ) {
+        return fill( 0, show );
+    }
+
+    esp_err_t brightness( uint8_t level, bool show = false ) {
+        bright = level;
+        return show ? this->show() : ESP_OK;
+    }
+
+    uint8_t getBrightness() const {
+        return bright;
+    }
+
+    esp_err_t show() {
+        showCount++;
+        shownPixels = pixels;
+        shownBrightness = bright;
+        wirePixels.clear();
+        for ( crgb_t color : pixels ) {
+            uint8_t r = scale( ( color >> 16 ) & 0xFF );
+            uint8_t g = scale( ( color >> 8 ) & 0xFF );
+            uint8_t b = scale( color & 0xFF );
+            bool grb = type == LED_STRIP_WS2812 || type == LED_STRIP_SK6812;
+            wirePixels.push_back( grb ? ( ( uint32_t )g << 16 ) | ( ( uint32_t )r << 8 ) | b :
+                                  ( ( uint32_t )r << 16 ) | ( ( uint32_t )g << 8 ) | b );
+        }
+        return ESP_OK;
+    }
+
+    // --- Test inspection ---
+
+    static LiteLED *&last() {
+        static LiteLED *strip = nullptr;
+        return strip;
+    }
+
+    uint32_t getShowCount() const {
+        return showCount;
+    }
+
+    /**
+     * @brief Colour of a pixel as last shown, before the strip's brightness is applied
+     */
+    crgb_t getShownPixel( size_t index ) const {
+        return index < shownPixels.size() ? shownPixels[ index ] : 0;
+    }
+
+    uint8_t getShownBrightness() const {
+        return shownBrightness;
+    }
+
+    /**
+     * @brief Bytes a pixel last went out as, brightness applied, first out in bits 23-16
+     */
+    uint32_t getWirePixel( size_t index ) const {
+        return index < wirePixels.size() ? wirePixels[ index ] : 0;
+    }
+
+    led_strip_type_t getType() const {
+        return type;
+    }
+
+  private:
+    led_strip_type_t type;
+    bool isRGBW;
+    uint8_t pin = 0;
+    uint8_t bright = 255;
+    uint8_t shownBrightness = 0;
+    uint32_t showCount = 0;
+    std::vector<crgb_t> pixels;
+    std::vector<crgb_t> shownPixels;
+    std::vector<uint32_t> wirePixels;
+
+    uint8_t scale( uint8_t channel ) const {
+        if ( bright == 255 ) {
+            return channel;
+        }
+        return static_cast<uint8_t>( ( ( channel * bright ) >> 8 ) + ( ( channel && bright ) ? 1 : 0 ) );
+    }
+};
+
+
+#endif // STAC_TEST_FAKE_LITELED_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,252 @@
+#ifndef STAC_TEST_FAKE_PREFERENCES_H
+#define STAC_TEST_FAKE_PREFERENCES_H
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include "WString.h"
+
+
+/**
+ * @brief In-memory NVS behind the Preferences fake
+ *
+ * Namespaces survive across Preferences objects (and ConfigManager
+ * instances), as flash survives a reboot. Tests seed it, inspect it and
+ * read the operation counters.
+ */
+namespace FakeNvs {
+
+    enum class Type : uint8_t { U8, U16, U32, STR, BLOB };     // Bools are stored as U8, as on the device
+
+    struct Entry {
+        Type type;
+        std::vector<uint8_t> data;
+    };
+
+    using Namespace = std::map<std::string, Entry>;
+
+    struct Counters {
+        uint32_t opens = 0;         ///< Successful begin() calls
+        uint32_t reads = 0;         ///< get*, getBytesLength and isKey calls
+        uint32_t writes = 0;        ///< put*, remove and clear calls that changed flash
+    };
+
+    inline std::map<std::string, Namespace> &store() {
+        static std::map<std::string, Namespace> namespaces;
+        return namespaces;
+    }
+
+    inline Counters &counters() {
+        static Counters count;
+        return count;
+    }
+
+    /**
+     * @brief Make every write fail (flash full or worn) while set
+     */
+    inline bool &failWrites() {
+        static bool fail = false;
+        return fail;
+    }
+
+    /**
+     * @brief Writes left before failWrites() sets itself, as a power loss part way through would; -1 = no limit
+     */
+    inline int &writesBeforeFailure() {
+        static int left = -1;
+        return left;
+    }
+
+    inline void noteWrite() {
+        counters().writes++;
+        if ( writesBeforeFailure() > 0 && --writesBeforeFailure() == 0 ) {
+            failWrites() = true;
+        }
+    }
+
+    inline void reset() {
+        store().clear();
+        counters() = Counters();
+        failWrites() = false;
+        writesBeforeFailure() = -1;
+    }
+
+    inline void resetCounters() {
+        counters() = Counters();
+    }
+
+} // namespace FakeNvs
+
+
+/**
+ * @brief Host stand-in for the Arduino-ESP32 Preferences class
+ */
+class Preferences {
+  public:
+    bool begin( const char *name, bool readOnly = false, const char *partitionLabel = nullptr ) {
+        ( void )partitionLabel;
+        if ( started ) {
+            return false;
+        }
+        auto &namespaces = FakeNvs::store();
+        if ( namespaces.find( name ) == namespaces.end() ) {
+            if ( readOnly ) {
+                return false;       // nvs_open() of a missing namespace fails read-only
+            }
+            namespaces[ name ];
+        }
+        ns = name;
+        this->readOnly = readOnly;
+        started = true;
+        FakeNvs::counters().opens++;
+        return true;
+    }
+
+    void end() {
+        started = false;
+    }
+
+    bool clear() {
+        if ( !canWrite() ) {
+            return false;
+        }
+        space().clear();
+        FakeNvs::noteWrite();
+        return true;
+    }
+
+    bool remove( const char *key ) {
+        if ( !canWrite() || space().erase( key ) == 0 ) {
+            return false;
+        }
+        FakeNvs::noteWrite();
+        return true;
+    }
+
+    bool isKey( const char *key ) {
+        FakeNvs::counters().reads++;
+        return started && space().count( key ) != 0;
+    }
+
+    size_t putUChar( const char *key, uint8_t value ) {
+        return put( key, FakeNvs::Type::U8, &value, sizeof( value ) );
+    }
+
+    size_t putBool( const char *key, bool value ) {
+        uint8_t byte = value ? 1 : 0;
+        return put( key, FakeNvs::Type::U8, &byte, sizeof( byte ) );
+    }
+
+    size_t putUShort( const char *key, uint16_t value ) {
+        return put( key, FakeNvs::Type::U16, &value, sizeof( value ) );
+    }
+
+    size_t putUInt( const char *key, uint32_t value ) {
+        return put( key, FakeNvs::Type::U32, &value, sizeof( value ) );
+    }
+
+    size_t putULong( const char *key, uint32_t value ) {
+        return put( key, FakeNvs::Type::U32, &value, sizeof( value ) );     // 32-bit on the ESP32
+    }
+
+    size_t putString( const char *key, const String &value ) {
+        return put( key, FakeNvs::Type::STR, value.c_str(), value.length() ) ? value.length() : 0;
+    }
+
+    size_t putBytes( const char *key, const void *value, size_t len ) {
+        return put( key, FakeNvs::Type::BLOB, value, len );
+    }
+
+    uint8_t getUChar( const char *key, uint8_t defaultValue = 0 ) {
+        return get( key, FakeNvs::Type::U8, defaultValue );
+    }
+
+    bool getBool( const char *key, bool defaultValue = false ) {
+        return get<uint8_t>( key, FakeNvs::Type::U8, defaultValue ? 1 : 0 ) == 1;
+    }
+
+    uint16_t getUShort( const char *key, uint16_t defaultValue = 0 ) {
+        return get( key, FakeNvs::Type::U16, defaultValue );
+    }
+
+    uint32_t getUInt( const char *key, uint32_t defaultValue = 0 ) {
+        return get( key, FakeNvs::Type::U32, defaultValue );
+    }
+
+    uint32_t getULong( const char *key, uint32_t defaultValue = 0 ) {
+        return get( key, FakeNvs::Type::U32, defaultValue );
+    }
+
+    String getString( const char *key, const String &defaultValue = String() ) {
+        const FakeNvs::Entry *entry = find( key, FakeNvs::Type::STR );
+        if ( !entry ) {
+            return defaultValue;
+        }
+        return String( std::string( entry->data.begin(), entry->data.end() ) );
+    }
+
+    size_t getBytesLength( const char *key ) {
+        const FakeNvs::Entry *entry = find( key, FakeNvs::Type::BLOB );
+        return entry ? entry->data.size() : 0;
+    }
+
+    size_t getBytes( const char *key, void *buffer, size_t maxLen ) {
+        const FakeNvs::Entry *entry = find( key, FakeNvs::Type::BLOB );
+        if ( !entry || entry->data.size() > maxLen ) {
+            return 0;
+        }
+        memcpy( buffer, entry->data.data(), entry->data.size() );
+        return entry->data.size();
+    }
+
+  private:
+    std::string ns;
+    bool readOnly = false;
+    bool started = false;
+
+    FakeNvs::Namespace &space() {
+        return FakeNvs::store()[ ns ];
+    }
+
+    bool canWrite() const {
+        return started && !readOnly && !FakeNvs::failWrites();
+    }
+
+    size_t put( const char *key, FakeNvs::Type type, const void *value, size_t len ) {
+        if ( !canWrite() ) {
+            return 0;
+        }
+        const uint8_t *bytes = static_cast<const uint8_t *>( value );
+        space()[ key ] = FakeNvs::Entry{ type, std::vector<uint8_t>( bytes, bytes + len ) };
+        FakeNvs::noteWrite();
+        return len;
+    }
+
+    const FakeNvs::Entry *find( const char *key, FakeNvs::Type type ) {
+        FakeNvs::counters().reads++;
+        if ( !started ) {
+            return nullptr;
+        }
+        auto it = space().find( key );
+        return ( it != space().end() && it->second.type == type ) ? &it->second : nullptr;
+    }
+
+    template<typename T>
+    T get( const char *key, FakeNvs::Type type, T defaultValue ) {
+        const FakeNvs::Entry *entry = find( key, type );
+        if ( !entry || entry->data.size() != sizeof( T ) ) {
+            return defaultValue;
+        }
+        T value;
+        memcpy( &value, entry->data.data(), sizeof( T ) );
+        return value;
+    }
+};
+
+
+#endif // STAC_TEST_FAKE_PREFERENCES_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,89 @@
+#ifndef STAC_TEST_FAKE_UPDATE_H
+#define STAC_TEST_FAKE_UPDATE_H
+
+#include <Arduino.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+
+/**
+ * @brief Host stand-in for the Arduino Update library: keeps the image written to the "OTA partition"
+ *
+ * end() marks the image installed; abort() discards it. The image and
+ * the call counts stay readable after either, until reset().
+ */
+class UpdateClass {
+  public:
+    static constexpr size_t PARTITION_SIZE = 0x140000;
+
+    bool begin( size_t size = UPDATE_SIZE_UNKNOWN ) {
+        ( void )size;
+        begins++;
+        image.clear();
+        running = true;
+        installed = false;
+        return true;
+    }
+
+    size_t write( uint8_t *data, size_t length ) {
+        if ( !running || image.size() + length > PARTITION_SIZE ) {
+            return 0;
+        }
+        image.insert( image.end(), data, data + length );
+        return length;
+    }
+
+    bool end( bool evenIfRemaining = false ) {
+        ( void )evenIfRemaining;
+        if ( !running ) {
+            return false;
+        }
+        running = false;
+        installed = true;
+        return true;
+    }
+
+    void abort() {
+        if ( running ) {
+            aborts++;
+        }
+        running = false;
+    }
+
+    size_t size() const {
+        return PARTITION_SIZE;
+    }
+
+    const char *errorString() const {
+        return "Fake update error";
+    }
+
+    void printError( HardwareSerial &out ) const {
+        ( void )out;
+    }
+
+    void reset() {
+        image.clear();
+        running = false;
+        installed = false;
+        begins = 0;
+        aborts = 0;
+    }
+
+    std::vector<uint8_t> image;     ///< Bytes written since begin()
+    bool running = false;
+    bool installed = false;         ///< end() accepted the image
+    uint32_t begins = 0;
+    uint32_t aborts = 0;
+};
+
+inline UpdateClass Update;
+
+
+#endif // STAC_TEST_FAKE_UPDATE_H
+
+
+//  --- EOF --- //
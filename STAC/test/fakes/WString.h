@@ -0,0 +1,173 @@
+#ifndef STAC_TEST_FAKE_WSTRING_H
+#define STAC_TEST_FAKE_WSTRING_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+#include <string>
+
+
+/**
+ * @brief Host stand-in for the Arduino String class
+ *
+ * Backed by std::string; covers the members the firmware uses.
+ */
+class String {
+  public:
+    String() = default;
+    String( const char *text ) : value( text ? text : "" ) {}
+    String( const std::string &text ) : value( text ) {}
+    String( char c ) : value( 1, c ) {}
+    explicit String( int number ) : value( std::to_string( number ) ) {}
+    explicit String( unsigned int number ) : value( std::to_string( number ) ) {}
+    explicit String( long number ) : value( std::to_string( number ) ) {}
+    explicit String( unsigned long number ) : value( std::to_string( number ) ) {}
+
+    explicit String( unsigned char number, unsigned char base = 10 ) {
+        char text[ 9 ];
+        snprintf( text, sizeof( text ), base == 16 ? "%x" : "%u", number );
+        value = text;
+    }
+
+    const char *c_str() const {
+        return value.c_str();
+    }
+
+    unsigned int length() const {
+        return static_cast<unsigned int>( value.size() );
+    }
+
+    bool isEmpty() const {
+        return value.empty();
+    }
+
+    void reserve( unsigned int size ) {
+        value.reserve( size );
+    }
+
+    char operator[]( unsigned int index ) const {
+        return index < value.size() ? value[ index ] : 0;
+    }
+
+    char charAt( unsigned int index ) const {
+        return ( *this )[ index ];
+    }
+
+    bool equals( const String &other ) const {
+        return value == other.value;
+    }
+
+    bool equalsIgnoreCase( const String &other ) const {
+        return strcasecmp( value.c_str(), other.value.c_str() ) == 0;
+    }
+
+    bool startsWith( const String &prefix ) const {
+        return value.compare( 0, prefix.value.size(), prefix.value ) == 0;
+    }
+
+    bool endsWith( const String &suffix ) const {
+        return value.size() >= suffix.value.size() &&
+               value.compare( value.size() - suffix.value.size(), suffix.value.size(), suffix.value ) == 0;
+    }
+
+    int indexOf( char c, unsigned int from = 0 ) const {
+        size_t pos = value.find( c, from );
+        return pos == std::string::npos ? -1 : static_cast<int>( pos );
+    }
+
+    int indexOf( const String &text, unsigned int from = 0 ) const {
+        size_t pos = value.find( text.value, from );
+        return pos == std::string::npos ? -1 : static_cast<int>( pos );
+    }
+
+    String substring( unsigned int from ) const {
+        return from < value.size() ? String( value.substr( from ) ) : String();
+    }
+
+    String substring( unsigned int from, unsigned int to ) const {
+        if ( from > to ) {
+            std::swap( from, to );
+        }
+        return from < value.size() ? String( value.substr( from, to - from ) ) : String();
+    }
+
+    void trim() {
+        size_t first = value.find_first_not_of( " \t\r\n" );
+        size_t last = value.find_last_not_of( " \t\r\n" );
+        value = first == std::string::npos ? std::string() : value.substr( first, last - first + 1 );
+    }
+
+    void toUpperCase() {
+        for ( char &c : value ) {
+            c = static_cast<char>( toupper( static_cast<unsigned char>( c ) ) );
+        }
+    }
+
+    void toLowerCase() {
+        for ( char &c : value ) {
+            c = static_cast<char>( tolower( static_cast<unsigned char>( c ) ) );
+        }
+    }
+
+    long toInt() const {
+        return strtol( value.c_str(), nullptr, 10 );
+    }
+
+    String &operator+=( const String &other ) {
+        value += other.value;
+        return *this;
+    }
+
+    String &operator+=( const char *text ) {
+        value += text ? text : "";
+        return *this;
+    }
+
+    String &operator+=( char c ) {
+        value += c;
+        return *this;
+    }
+
+    bool concat( const char *text ) {
+        *this += text;
+        return true;
+    }
+
+    friend String operator+( const String &a, const String &b ) {
+        return String( a.value + b.value );
+    }
+
+    friend String operator+( const String &a, const char *b ) {
+        return String( a.value + ( b ? b : "" ) );
+    }
+
+    friend String operator+( const char *a, const String &b ) {
+        return String( std::string( a ? a : "" ) + b.value );
+    }
+
+    bool operator==( const String &other ) const {
+        return value == other.value;
+    }
+
+    bool operator==( const char *text ) const {
+        return value == ( text ? text : "" );
+    }
+
+    bool operator!=( const String &other ) const {
+        return value != other.value;
+    }
+
+    bool operator!=( const char *text ) const {
+        return !( *this == text );
+    }
+
+  private:
+    std::string value;
+};
+
+
+#endif // STAC_TEST_FAKE_WSTRING_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,321 @@
+#ifndef STAC_TEST_FAKE_WIFI_H
+#define STAC_TEST_FAKE_WIFI_H
+
+#include <Arduino.h>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+#include "esp_wifi.h"
+
+#define WIFI_SCAN_RUNNING ( -1 )
+#define WIFI_SCAN_FAILED ( -2 )
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3,
+} wifi_mode_t;
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6,
+} wl_status_t;
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_READY = 0,
+    ARDUINO_EVENT_WIFI_STA_START,
+    ARDUINO_EVENT_WIFI_STA_STOP,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+    ARDUINO_EVENT_WIFI_STA_LOST_IP,
+} arduino_event_id_t;
+
+typedef struct {
+    uint8_t ssid[ 32 ];
+    uint8_t ssid_len;
+    uint8_t bssid[ 6 ];
+    uint8_t reason;
+    int8_t rssi;
+} wifi_event_sta_disconnected_t;
+
+typedef union {
+    wifi_event_sta_disconnected_t wifi_sta_disconnected;
+} arduino_event_info_t;
+
+
+/**
+ * @brief Host stand-in for the Arduino WiFi object: a station the test joins, drops and scans for
+ *
+ * Nothing happens on its own. begin() only records the attempt; the test
+ * then plays the driver with join(), drop() and loseAddress(), which set
+ * the station state and raise the events the real driver would, on the
+ * calling thread. A roam scan stays running until finishScan().
+ */
+class WiFiClass {
+  public:
+    using EventHandler = std::function<void( arduino_event_id_t, arduino_event_info_t )>;
+
+    /**
+     * @brief One WiFi.begin() call
+     */
+    struct BeginCall {
+        String ssid;
+        int32_t channel;            ///< 0 = any
+        bool directed;              ///< A BSSID was given
+        uint8_t bssid[ 6 ];
+        bool connect;
+    };
+
+    /**
+     * @brief One access point in the scan results
+     */
+    struct ScanEntry {
+        String ssid;
+        uint8_t bssid[ 6 ];
+        int32_t channel;
+        int32_t rssi;
+    };
+
+    // --- Driver side, played by the test ---
+
+    /**
+     * @brief Associate with an access point and get an address (CONNECTED, then GOT_IP)
+     */
+    void join( const uint8_t *bssid, int32_t channel, int32_t signal ) {
+        memcpy( apBssid, bssid, sizeof( apBssid ) );
+        apChannel = channel;
+        rssi = signal;
+        staStatus = WL_CONNECTED;
+        raise( ARDUINO_EVENT_WIFI_STA_CONNECTED );
+        raise( ARDUINO_EVENT_WIFI_STA_GOT_IP );
+    }
+
+    /**
+     * @brief Leave or fail to join the access point
+     */
+    void drop( uint8_t reason ) {
+        staStatus = WL_DISCONNECTED;
+        rssi = 0;
+        raise( ARDUINO_EVENT_WIFI_STA_DISCONNECTED, reason );
+    }
+
+    /**
+     * @brief The DHCP lease ran out; the station stays associated
+     */
+    void loseAddress() {
+        raise( ARDUINO_EVENT_WIFI_STA_LOST_IP );
+    }
+
+    void raise( arduino_event_id_t event, uint8_t reason = 0 ) {
+        arduino_event_info_t info = {};
+        info.wifi_sta_disconnected.reason = reason;
+        for ( auto &handler : handlers ) {
+            handler( event, info );
+        }
+    }
+
+    void finishScan() {
+        scanState = static_cast<int16_t>( scanResults.size() );
+    }
+
+    // --- Arduino API ---
+
+    void onEvent( EventHandler handler ) {
+        handlers.push_back( handler );
+    }
+
+    bool mode( wifi_mode_t newMode ) {
+        currentMode = newMode;
+        return true;
+    }
+
+    wifi_mode_t getMode() {
+        return currentMode;
+    }
+
+    bool setAutoReconnect( bool enable ) {
+        autoReconnect = enable;
+        return true;
+    }
+
+    void setScanMethod( wifi_scan_method_t method ) {
+        scanMethod = method;
+    }
+
+    void setSortMethod( wifi_sort_method_t method ) {
+        ( void )method;
+    }
+
+    bool setSleep( wifi_ps_type_t type ) {
+        return esp_wifi_set_ps( type ) == ESP_OK;
+    }
+
+    bool setHostname( const char *name ) {
+        hostname = name;
+        return true;
+    }
+
+    wl_status_t begin( const char *ssid, const char *password = nullptr, int32_t channel = 0,
+                       const uint8_t *bssid = nullptr, bool connect = true ) {
+        ( void )password;
+        BeginCall call = { ssid, channel, bssid != nullptr, {}, connect };
+        if ( bssid ) {
+            memcpy( call.bssid, bssid, sizeof( call.bssid ) );
+        }
+        begins.push_back( call );
+        return staStatus;
+    }
+
+    bool config( IPAddress local, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress() ) {
+        ( void )gateway;
+        ( void )subnet;
+        ( void )dns1;
+        staticIP = local;
+        return true;
+    }
+
+    bool disconnect( bool wifiOff = false ) {
+        ( void )wifiOff;
+        disconnects++;
+        if ( staStatus == WL_CONNECTED ) {
+            drop( WIFI_REASON_ASSOC_LEAVE );
+        }
+        return true;
+    }
+
+    wl_status_t status() {
+        return staStatus;
+    }
+
+    int8_t RSSI() {
+        return static_cast<int8_t>( staStatus == WL_CONNECTED ? rssi : 0 );
+    }
+
+    uint8_t *BSSID() {
+        return staStatus == WL_CONNECTED ? apBssid : nullptr;
+    }
+
+    int32_t channel() {
+        return apChannel;
+    }
+
+    IPAddress localIP() {
+        return staStatus == WL_CONNECTED ? address : IPAddress();
+    }
+
+    IPAddress gatewayIP() {
+        return IPAddress( 192, 168, 1, 1 );
+    }
+
+    IPAddress subnetMask() {
+        return IPAddress( 255, 255, 255, 0 );
+    }
+
+    IPAddress dnsIP() {
+        return IPAddress( 192, 168, 1, 1 );
+    }
+
+    String macAddress() {
+        return "24:0A:C4:00:00:01";
+    }
+
+    int16_t scanNetworks( bool async = false, bool showHidden = false, bool passive = false,
+                          uint32_t maxMsPerChannel = 300, uint8_t channel = 0, const char *ssid = nullptr ) {
+        ( void )async;
+        ( void )showHidden;
+        ( void )passive;
+        ( void )maxMsPerChannel;
+        ( void )channel;
+        ( void )ssid;
+        if ( failScans ) {
+            return WIFI_SCAN_FAILED;
+        }
+        scans++;
+        scanState = WIFI_SCAN_RUNNING;
+        return WIFI_SCAN_RUNNING;
+    }
+
+    int16_t scanComplete() {
+        return scanState;
+    }
+
+    void scanDelete() {
+        scanState = WIFI_SCAN_FAILED;
+    }
+
+    String SSID( uint8_t index ) {
+        return index < scanResults.size() ? scanResults[ index ].ssid : String();
+    }
+
+    uint8_t *BSSID( uint8_t index ) {
+        return index < scanResults.size() ? scanResults[ index ].bssid : nullptr;
+    }
+
+    int32_t RSSI( uint8_t index ) {
+        return index < scanResults.size() ? scanResults[ index ].rssi : 0;
+    }
+
+    int32_t channel( uint8_t index ) {
+        return index < scanResults.size() ? scanResults[ index ].channel : 0;
+    }
+
+    bool softAP( const char *ssid, const char *password = nullptr ) {
+        ( void )ssid;
+        ( void )password;
+        apRunning = true;
+        return true;
+    }
+
+    bool softAPdisconnect( bool wifiOff = false ) {
+        ( void )wifiOff;
+        apRunning = false;
+        return true;
+    }
+
+    IPAddress softAPIP() {
+        return IPAddress( 192, 168, 6, 14 );
+    }
+
+    void reset() {
+        *this = WiFiClass();
+    }
+
+    // --- State the test sets and reads ---
+
+    wifi_mode_t currentMode = WIFI_OFF;
+    wl_status_t staStatus = WL_DISCONNECTED;
+    int32_t rssi = 0;                       ///< Signal of the joined access point, read by RSSI()
+    uint8_t apBssid[ 6 ] = {};
+    int32_t apChannel = 0;
+    IPAddress address = IPAddress( 192, 168, 1, 50 );
+    IPAddress staticIP;                     ///< Last config() address, 0 = DHCP
+    String hostname;
+    bool autoReconnect = true;
+    wifi_scan_method_t scanMethod = WIFI_FAST_SCAN;
+    bool apRunning = false;
+
+    std::vector<ScanEntry> scanResults;     ///< Returned once finishScan() is called
+    int16_t scanState = WIFI_SCAN_FAILED;   ///< scanComplete(): running, failed/none, or a count
+    bool failScans = false;                 ///< scanNetworks() refuses to start
+
+    std::vector<BeginCall> begins;
+    uint32_t disconnects = 0;
+    uint32_t scans = 0;
+    std::vector<EventHandler> handlers;
+};
+
+inline WiFiClass WiFi;
+
+
+#endif // STAC_TEST_FAKE_WIFI_H
+
+
+//  --- EOF --- //
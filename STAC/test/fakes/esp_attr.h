@@ -0,0 +1,38 @@
+#ifndef STAC_TEST_FAKE_ESP_ATTR_H
+#define STAC_TEST_FAKE_ESP_ATTR_H
+
+#include <cstring>
+
+
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+
+/**
+ * @brief RTC memory that survives a restart: one linker section, so a test can clear it all
+ *
+ * A new object reading it sees what the last one left there, as after a
+ * software restart. FakeRtc::powerCycle() zeroes the section, which every
+ * user reads as "nothing saved" (magic numbers no longer match).
+ */
+#define RTC_NOINIT_ATTR __attribute__( ( section( "stac_rtc_noinit" ) ) )
+
+extern "C" {
+    extern char __start_stac_rtc_noinit[] __attribute__( ( weak ) );
+    extern char __stop_stac_rtc_noinit[] __attribute__( ( weak ) );
+}
+
+namespace FakeRtc {
+
+    inline void powerCycle() {
+        if ( __start_stac_rtc_noinit && __stop_stac_rtc_noinit ) {
+            memset( __start_stac_rtc_noinit, 0, __stop_stac_rtc_noinit - __start_stac_rtc_noinit );
+        }
+    }
+
+} // namespace FakeRtc
+
+
+#endif // STAC_TEST_FAKE_ESP_ATTR_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,22 @@
+#ifndef STAC_TEST_FAKE_ESP_MAC_H
+#define STAC_TEST_FAKE_ESP_MAC_H
+
+#include <cstdint>
+#include <cstring>
+#include "esp_err.h"
+
+
+/**
+ * @brief Fixed station MAC for host tests (IDs and password obfuscation depend on it)
+ */
+inline esp_err_t esp_efuse_mac_get_default( uint8_t *mac ) {
+    static const uint8_t FAKE_MAC[ 6 ] = { 0x24, 0x0A, 0xC4, 0x12, 0x34, 0x56 };
+    memcpy( mac, FAKE_MAC, sizeof( FAKE_MAC ) );
+    return ESP_OK;
+}
+
+
+#endif // STAC_TEST_FAKE_ESP_MAC_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,15 @@
+#ifndef STAC_TEST_FAKE_ESP_OTA_OPS_H
+#define STAC_TEST_FAKE_ESP_OTA_OPS_H
+
+#include "esp_partition.h"
+
+
+inline const esp_partition_t *esp_ota_get_running_partition() {
+    return &FakeFlash::runningPartition();
+}
+
+
+#endif // STAC_TEST_FAKE_ESP_OTA_OPS_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,55 @@
+#ifndef STAC_TEST_FAKE_ESP_PARTITION_H
+#define STAC_TEST_FAKE_ESP_PARTITION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "esp_err.h"
+
+
+typedef struct {
+    uint32_t address;
+    uint32_t size;
+    char label[ 17 ];
+} esp_partition_t;
+
+/**
+ * @brief The running app partition for host tests: the image a test installs, erased (0xFF) after it
+ */
+namespace FakeFlash {
+
+    inline std::vector<uint8_t> &runningImage() {
+        static std::vector<uint8_t> image;
+        return image;
+    }
+
+    inline esp_partition_t &runningPartition() {
+        static esp_partition_t partition = { 0x10000, 0x140000, "app0" };
+        return partition;
+    }
+
+    inline void setRunningImage( const std::vector<uint8_t> &image ) {
+        runningImage() = image;
+    }
+
+} // namespace FakeFlash
+
+
+inline esp_err_t esp_partition_read( const esp_partition_t *partition, size_t offset, void *dst, size_t size ) {
+    if ( !partition || offset + size > partition->size ) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const std::vector<uint8_t> &image = FakeFlash::runningImage();
+    uint8_t *out = static_cast<uint8_t *>( dst );
+    for ( size_t i = 0; i < size; i++ ) {
+        out[ i ] = offset + i < image.size() ? image[ offset + i ] : 0xFF;
+    }
+    return ESP_OK;
+}
+
+
+#endif // STAC_TEST_FAKE_ESP_PARTITION_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,27 @@
+#ifndef STAC_TEST_FAKE_ESP_RANDOM_H
+#define STAC_TEST_FAKE_ESP_RANDOM_H
+
+#include <cstdint>
+
+
+/**
+ * @brief Hardware RNG stand-in that returns whatever the test set, so jitter is repeatable
+ */
+namespace FakeRandom {
+
+    inline uint32_t &value() {
+        static uint32_t next = 0;
+        return next;
+    }
+
+} // namespace FakeRandom
+
+inline uint32_t esp_random() {
+    return FakeRandom::value();
+}
+
+
+#endif // STAC_TEST_FAKE_ESP_RANDOM_H
+
+
+//  --- EOF --- //
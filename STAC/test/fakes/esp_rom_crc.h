@@ -0,0 +1,26 @@
+#ifndef STAC_TEST_FAKE_ESP_ROM_CRC_H
+#define STAC_TEST_FAKE_ESP_ROM_CRC_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * @brief Bitwise CRC-32 (IEEE 802.3), the same values as the ROM routine
+ */
+inline uint32_t esp_rom_crc32_le( uint32_t crc, const uint8_t *buf, uint32_t len ) {
+    crc = ~crc;
+    for ( uint32_t i = 0; i < len; i++ ) {
+        crc ^= buf[ i ];
+        for ( uint8_t bit = 0; bit < 8; bit++ ) {
+            crc = ( crc >> 1 ) ^ ( 0xEDB88320u & ( 0u - ( crc & 1u ) ) );
+        }
+    }
+    return ~crc;
+}
+
+
+#endif // STAC_TEST_FAKE_ESP_ROM_CRC_H
+
+
+//  --- EOF --- //
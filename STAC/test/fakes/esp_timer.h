@@ -0,0 +1,15 @@
+#ifndef STAC_TEST_FAKE_ESP_TIMER_H
+#define STAC_TEST_FAKE_ESP_TIMER_H
+
+#include "FakeClock.h"
+
+
+inline int64_t esp_timer_get_time() {
+    return FakeClock::nowUs();
+}
+
+
+#endif // STAC_TEST_FAKE_ESP_TIMER_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,111 @@
+#ifndef STAC_TEST_FAKE_ESP_WIFI_H
+#define STAC_TEST_FAKE_ESP_WIFI_H
+
+#include <cstdint>
+#include "esp_err.h"
+
+
+typedef enum {
+    WIFI_IF_STA = 0,
+    WIFI_IF_AP,
+} wifi_interface_t;
+
+typedef enum {
+    WIFI_PS_NONE,
+    WIFI_PS_MIN_MODEM,
+    WIFI_PS_MAX_MODEM,
+} wifi_ps_type_t;
+
+typedef enum {
+    WIFI_FAST_SCAN = 0,
+    WIFI_ALL_CHANNEL_SCAN,
+} wifi_scan_method_t;
+
+typedef enum {
+    WIFI_CONNECT_AP_BY_SIGNAL = 0,
+    WIFI_CONNECT_AP_BY_SECURITY,
+} wifi_sort_method_t;
+
+typedef enum {
+    WIFI_REASON_UNSPECIFIED = 1,
+    WIFI_REASON_AUTH_EXPIRE = 2,
+    WIFI_REASON_ASSOC_LEAVE = 8,
+    WIFI_REASON_BEACON_TIMEOUT = 200,
+    WIFI_REASON_NO_AP_FOUND = 201,
+    WIFI_REASON_AUTH_FAIL = 202,
+    WIFI_REASON_ASSOC_FAIL = 203,
+    WIFI_REASON_HANDSHAKE_TIMEOUT = 204,
+    WIFI_REASON_CONNECTION_FAIL = 205,
+} wifi_err_reason_t;
+
+typedef struct {
+    uint8_t ssid[ 32 ];
+    uint8_t password[ 64 ];
+    uint8_t bssid[ 6 ];
+    uint8_t channel;
+    uint16_t listen_interval;
+} wifi_sta_config_t;
+
+typedef union {
+    wifi_sta_config_t sta;
+} wifi_config_t;
+
+
+/**
+ * @brief What the station interface was configured with, and how often it was told to connect
+ */
+namespace FakeEspWifi {
+
+    struct State {
+        wifi_config_t staConfig = {};
+        wifi_ps_type_t powerSave = WIFI_PS_MIN_MODEM;
+        uint32_t connects = 0;
+    };
+
+    inline State &state() {
+        static State current;
+        return current;
+    }
+
+    inline void reset() {
+        state() = State();
+    }
+
+} // namespace FakeEspWifi
+
+inline esp_err_t esp_wifi_get_config( wifi_interface_t interface, wifi_config_t *conf ) {
+    if ( interface != WIFI_IF_STA ) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *conf = FakeEspWifi::state().staConfig;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_wifi_set_config( wifi_interface_t interface, wifi_config_t *conf ) {
+    if ( interface != WIFI_IF_STA ) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    FakeEspWifi::state().staConfig = *conf;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_wifi_connect() {
+    FakeEspWifi::state().connects++;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_wifi_set_ps( wifi_ps_type_t type ) {
+    FakeEspWifi::state().powerSave = type;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_wifi_get_ps( wifi_ps_type_t *type ) {
+    *type = FakeEspWifi::state().powerSave;
+    return ESP_OK;
+}
+
+
+#endif // STAC_TEST_FAKE_ESP_WIFI_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,24 @@
+#ifndef STAC_TEST_FAKE_FREERTOS_H
+#define STAC_TEST_FAKE_FREERTOS_H
+
+#include <cstdint>
+
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE      1
+#define pdFALSE     0
+#define pdPASS      pdTRUE
+#define pdFAIL      pdFALSE
+
+#define portMAX_DELAY           static_cast<TickType_t>( 0xFFFFFFFFUL )
+#define portTICK_PERIOD_MS      1
+#define pdMS_TO_TICKS( ms )     static_cast<TickType_t>( ms )
+
+
+#endif // STAC_TEST_FAKE_FREERTOS_H
+
+
+//  --- EOF --- //
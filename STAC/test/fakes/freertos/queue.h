@@ -0,0 +1,78 @@
+#ifndef STAC_TEST_FAKE_FREERTOS_QUEUE_H
+#define STAC_TEST_FAKE_FREERTOS_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include "FreeRTOS.h"
+
+
+/**
+ * @brief Host stand-in for a statically allocated FreeRTOS queue
+ *
+ * Items are copied into the caller's storage, as on the device. Blocking
+ * receives wait on a condition variable in real time (one tick = 1 ms),
+ * so producers on std::threads behave like producers on other tasks.
+ */
+struct StaticQueue_t {
+    std::mutex lock;
+    std::condition_variable notEmpty;
+    uint8_t *storage = nullptr;
+    UBaseType_t length = 0;
+    UBaseType_t itemSize = 0;
+    UBaseType_t head = 0;
+    UBaseType_t count = 0;
+};
+
+typedef StaticQueue_t *QueueHandle_t;
+
+
+inline QueueHandle_t xQueueCreateStatic( UBaseType_t length, UBaseType_t itemSize, uint8_t *storage, StaticQueue_t *queue ) {
+    queue->storage = storage;
+    queue->length = length;
+    queue->itemSize = itemSize;
+    queue->head = 0;
+    queue->count = 0;
+    return queue;
+}
+
+inline BaseType_t xQueueSend( QueueHandle_t queue, const void *item, TickType_t ticksToWait ) {
+    ( void )ticksToWait;    // Producers here never block
+    {
+        std::lock_guard<std::mutex> guard( queue->lock );
+        if ( queue->count == queue->length ) {
+            return pdFALSE;
+        }
+        UBaseType_t tail = ( queue->head + queue->count ) % queue->length;
+        memcpy( queue->storage + tail * queue->itemSize, item, queue->itemSize );
+        queue->count++;
+    }
+    queue->notEmpty.notify_one();
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive( QueueHandle_t queue, void *item, TickType_t ticksToWait ) {
+    std::unique_lock<std::mutex> guard( queue->lock );
+    auto hasItem = [ queue ]() {
+        return queue->count > 0;
+    };
+    if ( !queue->notEmpty.wait_for( guard, std::chrono::milliseconds( ticksToWait ), hasItem ) ) {
+        return pdFALSE;
+    }
+    memcpy( item, queue->storage + queue->head * queue->itemSize, queue->itemSize );
+    queue->head = ( queue->head + 1 ) % queue->length;
+    queue->count--;
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting( QueueHandle_t queue ) {
+    std::lock_guard<std::mutex> guard( queue->lock );
+    return queue->count;
+}
+
+
+#endif // STAC_TEST_FAKE_FREERTOS_QUEUE_H
+
+
+//  --- EOF --- //
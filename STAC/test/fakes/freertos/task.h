@@ -0,0 +1,69 @@
+#ifndef STAC_TEST_FAKE_FREERTOS_TASK_H
+#define STAC_TEST_FAKE_FREERTOS_TASK_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include "FreeRTOS.h"
+
+
+/**
+ * @brief Host stand-in for FreeRTOS task creation and delays
+ *
+ * Each task runs on a detached std::thread; vTaskDelay() sleeps in real
+ * time (one tick = 1 ms). A task deleting itself just returns from its
+ * body. Deleting a task from outside is counted, so tests can check that
+ * code under test never does it.
+ */
+typedef void *TaskHandle_t;
+typedef void ( *TaskFunction_t )( void * );
+
+namespace FakeTasks {
+
+    inline std::atomic<uint32_t> &created() {
+        static std::atomic<uint32_t> count( 0 );
+        return count;
+    }
+
+    inline std::atomic<uint32_t> &externalDeletes() {
+        static std::atomic<uint32_t> count( 0 );
+        return count;
+    }
+
+    inline void reset() {
+        created() = 0;
+        externalDeletes() = 0;
+    }
+
+} // namespace FakeTasks
+
+
+inline BaseType_t xTaskCreate( TaskFunction_t task, const char *name, uint32_t stackSize, void *param,
+                               UBaseType_t priority, TaskHandle_t *handle ) {
+    ( void )name;
+    ( void )stackSize;
+    ( void )priority;
+    uint32_t id = ++FakeTasks::created();
+    std::thread( task, param ).detach();
+    if ( handle ) {
+        *handle = reinterpret_cast<TaskHandle_t>( static_cast<uintptr_t>( id ) );
+    }
+    return pdPASS;
+}
+
+inline void vTaskDelete( TaskHandle_t task ) {
+    if ( task ) {
+        FakeTasks::externalDeletes()++;
+    }
+}
+
+inline void vTaskDelay( TickType_t ticks ) {
+    std::this_thread::sleep_for( std::chrono::milliseconds( ticks ) );
+}
+
+
+#endif // STAC_TEST_FAKE_FREERTOS_TASK_H
+
+
+//  --- EOF --- //
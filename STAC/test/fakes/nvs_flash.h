@@ -0,0 +1,22 @@
+#ifndef STAC_TEST_FAKE_NVS_FLASH_H
+#define STAC_TEST_FAKE_NVS_FLASH_H
+
+#include "esp_err.h"
+#include "Preferences.h"
+
+
+inline esp_err_t nvs_flash_erase() {
+    FakeNvs::store().clear();
+    FakeNvs::counters().writes++;
+    return ESP_OK;
+}
+
+inline esp_err_t nvs_flash_init() {
+    return ESP_OK;
+}
+
+
+#endif // STAC_TEST_FAKE_NVS_FLASH_H
+
+
+//  --- EOF --- //
@@ -0,0 +1,134 @@
+#ifndef STAC_TEST_FAKE_ROM_MINIZ_H
+#define STAC_TEST_FAKE_ROM_MINIZ_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <zlib.h>
+
+
+/**
+ * @brief Host stand-in for the tinfl decompressor in the ESP32 ROM, backed by zlib
+ *
+ * Same call contract as the ROM: tinfl_decompress() consumes what it can
+ * of the input, writes at most *pOut_buf_size bytes at pOut_buf_next and
+ * reports both counts back. Raw deflate only (no zlib header flag).
+ * zlib keeps its own history, so the output window is never read back;
+ * the code under test still has to advance and wrap it correctly for
+ * the bytes it passes on to come out in order. The zlib stream lives
+ * outside the struct (which callers may malloc() and never construct),
+ * keyed by its address, and is released when the stream ends or fails
+ * or the same decompressor starts a new one.
+ */
+typedef unsigned char mz_uint8;
+typedef uint32_t mz_uint32;
+
+enum {
+    TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+    TINFL_FLAG_HAS_MORE_INPUT = 2,
+    TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+    TINFL_FLAG_COMPUTE_ADLER32 = 8
+};
+
+typedef enum {
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+typedef struct {
+    mz_uint32 m_state;      // 0 = start a new stream
+} tinfl_decompressor;
+
+#define tinfl_init( r ) do { ( r )->m_state = 0; } while ( 0 )
+
+namespace FakeTinfl {
+
+    inline std::map<const tinfl_decompressor *, z_stream> &streams() {
+        static std::map<const tinfl_decompressor *, z_stream> open;
+        return open;
+    }
+
+    inline std::mutex &lock() {
+        static std::mutex streamsLock;
+        return streamsLock;
+    }
+
+    inline void close( const tinfl_decompressor *r ) {
+        auto it = streams().find( r );
+        if ( it != streams().end() ) {
+            inflateEnd( &it->second );
+            streams().erase( it );
+        }
+    }
+
+} // namespace FakeTinfl
+
+inline tinfl_status tinfl_decompress( tinfl_decompressor *r, const mz_uint8 *pIn_buf_next, size_t *pIn_buf_size,
+                                      mz_uint8 *pOut_buf_start, mz_uint8 *pOut_buf_next, size_t *pOut_buf_size,
+                                      const mz_uint32 decomp_flags ) {
+    ( void )pOut_buf_start;
+    if ( decomp_flags & TINFL_FLAG_PARSE_ZLIB_HEADER ) {
+        *pIn_buf_size = 0;
+        *pOut_buf_size = 0;
+        return TINFL_STATUS_BAD_PARAM;
+    }
+
+    std::lock_guard<std::mutex> guard( FakeTinfl::lock() );
+    if ( r->m_state == 0 ) {
+        FakeTinfl::close( r );
+        z_stream &fresh = FakeTinfl::streams()[ r ];
+        fresh = z_stream();
+        inflateInit2( &fresh, -15 );
+        r->m_state = 1;
+    }
+
+    auto it = FakeTinfl::streams().find( r );
+    if ( it == FakeTinfl::streams().end() ) {
+        *pIn_buf_size = 0;
+        *pOut_buf_size = 0;
+        return TINFL_STATUS_FAILED;     // Called again after the stream ended
+    }
+    z_stream &stream = it->second;
+
+    stream.next_in = const_cast<mz_uint8 *>( pIn_buf_next );
+    stream.avail_in = static_cast<uInt>( *pIn_buf_size );
+    stream.next_out = pOut_buf_next;
+    stream.avail_out = static_cast<uInt>( *pOut_buf_size );
+
+    int result = inflate( &stream, Z_NO_FLUSH );
+
+    *pIn_buf_size -= stream.avail_in;
+    *pOut_buf_size -= stream.avail_out;
+
+    tinfl_status status;
+    if ( result == Z_STREAM_END ) {
+        status = TINFL_STATUS_DONE;
+    }
+    else if ( result != Z_OK && result != Z_BUF_ERROR ) {
+        status = TINFL_STATUS_FAILED;
+    }
+    else if ( stream.avail_out == 0 ) {
+        status = TINFL_STATUS_HAS_MORE_OUTPUT;
+    }
+    else {
+        status = ( decomp_flags & TINFL_FLAG_HAS_MORE_INPUT ) ? TINFL_STATUS_NEEDS_MORE_INPUT : TINFL_STATUS_FAILED;
+    }
+
+    if ( status <= TINFL_STATUS_DONE ) {
+        FakeTinfl::close( r );
+    }
+    return status;
+}
+
+
+#endif // STAC_TEST_FAKE_ROM_MINIZ_H
+
+
+//  --- EOF --- //
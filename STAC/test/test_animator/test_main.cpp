@@ -0,0 +1,211 @@
+// Host tests for Display::Animator, driven by a virtual clock through update( now )
+//
+// Run with: pio test -e native -f test_animator
+
+#include <unity.h>
+#include <climits>
+#include "Hardware/Display/Animator.h"
+#include "Hardware/Display/Framebuffer/FramebufferDisplay.h"
+
+using namespace Display;
+
+
+namespace {
+
+    const uint8_t DOT_GLYPH[ 25 ] = {
+        0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+    };
+
+    FramebufferDisplay *display = nullptr;
+    Animator *animator = nullptr;
+
+    uint32_t shows() {
+        return display->getCounters().showCalls;
+    }
+
+} // namespace
+
+
+void setUp() {
+    display = new FramebufferDisplay( 5, 5 );
+    display->begin();
+    display->setBrightness( 40, false );
+    display->resetCounters();
+    animator = new Animator( display );
+}
+
+void tearDown() {
+    delete animator;
+    delete display;
+}
+
+void test_first_keyframe_applies_on_play() {
+    Animation animation;
+    animation.fill( StandardColors::RED, 100 );
+
+    animator->play( animation, 5000 );
+
+    TEST_ASSERT_TRUE( animator->isRunning() );
+    TEST_ASSERT_EQUAL_UINT32( 1, shows() );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::RED, display->getShownPixel( 0, 0 ) );
+}
+
+void test_keyframes_start_at_accumulated_times() {
+    Animation animation;
+    animation.fill( StandardColors::RED, 100 )
+    .fill( StandardColors::GREEN, 200 )
+    .fill( StandardColors::BLUE, 300 );
+
+    animator->play( animation, 1000 );
+
+    animator->update( 1099 );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::RED, display->getShownPixel( 0, 0 ) );
+    animator->update( 1100 );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::GREEN, display->getShownPixel( 0, 0 ) );
+    animator->update( 1299 );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::GREEN, display->getShownPixel( 0, 0 ) );
+    animator->update( 1300 );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BLUE, display->getShownPixel( 0, 0 ) );
+
+    // Still running until the last keyframe's hold time is over
+    TEST_ASSERT_TRUE( animator->update( 1599 ) );
+    TEST_ASSERT_FALSE( animator->update( 1600 ) );
+    TEST_ASSERT_EQUAL_UINT32( 3, shows() );
+}
+
+void test_late_update_does_not_drift() {
+    Animation animation;
+    animation.fill( StandardColors::RED, 100 )
+    .fill( StandardColors::GREEN, 100 )
+    .fill( StandardColors::BLUE, 100 )
+    .fill( StandardColors::WHITE, 100 );
+
+    animator->play( animation, 0 );
+
+    // The loop stalls for 250 ms: GREEN and BLUE are both due, one show()
+    animator->update( 250 );
+    TEST_ASSERT_EQUAL_UINT32( 2, shows() );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BLUE, display->getShownPixel( 0, 0 ) );
+
+    // WHITE is still due at 300, not 250 + 100
+    animator->update( 300 );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::WHITE, display->getShownPixel( 0, 0 ) );
+}
+
+void test_flash_timeline() {
+    Animation animation;
+    animation.glyph( DOT_GLYPH, StandardColors::GREEN, StandardColors::BLACK, 500 ).flash( 2, 250, 60 );
+    TEST_ASSERT_EQUAL_UINT32( 500 + 4 * 250, animation.durationMs() );
+
+    animator->play( animation, 0 );
+
+    const struct {
+        unsigned long atMs;
+        uint8_t brightness;
+    } expected[] = {
+        { 0, 40 }, { 499, 40 }, { 500, 0 }, { 749, 0 }, { 750, 60 }, { 1000, 0 }, { 1250, 60 }, { 1499, 60 }
+    };
+    for ( const auto &step : expected ) {
+        animator->update( step.atMs );
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( step.brightness, display->getShownBrightness(), "brightness at step" );
+    }
+    TEST_ASSERT_FALSE( animator->update( 1500 ) );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::GREEN, display->getShownPixel( 2, 2 ) );
+}
+
+void test_repeat_count() {
+    Animation animation;
+    animation.fill( StandardColors::RED, 100 ).fill( StandardColors::BLUE, 100 );
+
+    animator->play( animation, 0, 3 );
+
+    for ( unsigned long now = 10; now < 600; now += 10 ) {
+        TEST_ASSERT_TRUE( animator->update( now ) );
+    }
+    TEST_ASSERT_FALSE( animator->update( 600 ) );
+    TEST_ASSERT_EQUAL_UINT32( 6, shows() );
+}
+
+void test_repeat_forever_until_stopped() {
+    Animation animation;
+    animation.corners( DOT_GLYPH, true, StandardColors::BRIGHT_GREEN, 500 )
+    .corners( DOT_GLYPH, false, StandardColors::BRIGHT_GREEN, 500 );
+
+    animator->play( animation, 0, Animator::REPEAT_FOREVER );
+
+    for ( unsigned long now = 0; now <= 60000; now += 10 ) {
+        TEST_ASSERT_TRUE( animator->update( now ) );
+    }
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BRIGHT_GREEN, display->getShownPixel( 2, 2 ) );
+
+    animator->stop();
+    TEST_ASSERT_FALSE( animator->isRunning() );
+    TEST_ASSERT_FALSE( animator->update( 60010 ) );
+}
+
+void test_stop_restores_brightness() {
+    Animation animation;
+    animation.flash( 3, 250, 60 );
+
+    animator->play( animation, 0 );
+    TEST_ASSERT_EQUAL_UINT8( 0, display->getBrightness() );
+
+    animator->stop();
+    TEST_ASSERT_EQUAL_UINT8( 40, display->getBrightness() );
+}
+
+void test_zero_length_forever_plays_once() {
+    Animation animation;
+    animation.fill( StandardColors::RED, 0 ).overlay( DOT_GLYPH, StandardColors::WHITE, 0 );
+
+    animator->play( animation, 0, Animator::REPEAT_FOREVER );
+
+    TEST_ASSERT_FALSE( animator->isRunning() );
+    TEST_ASSERT_EQUAL_UINT32( 1, shows() );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::WHITE, display->getShownPixel( 2, 2 ) );
+}
+
+void test_clock_wraparound() {
+    Animation animation;
+    animation.fill( StandardColors::RED, 100 ).fill( StandardColors::GREEN, 100 );
+
+    unsigned long start = ULONG_MAX - 50;
+    animator->play( animation, start );
+
+    animator->update( start + 99 );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::RED, display->getShownPixel( 0, 0 ) );
+    animator->update( start + 100 );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::GREEN, display->getShownPixel( 0, 0 ) );
+    TEST_ASSERT_FALSE( animator->update( start + 200 ) );
+}
+
+void test_capacity() {
+    Animation animation;
+    for ( uint8_t i = 0; i < Animation::MAX_KEYFRAMES; i++ ) {
+        TEST_ASSERT_TRUE( animation.add( { KeyframeAction::HOLD, nullptr, 0, 0, Keyframe::KEEP_BRIGHTNESS, 10 } ) );
+    }
+    TEST_ASSERT_FALSE( animation.add( { KeyframeAction::HOLD, nullptr, 0, 0, Keyframe::KEEP_BRIGHTNESS, 10 } ) );
+    TEST_ASSERT_EQUAL_UINT8( Animation::MAX_KEYFRAMES, animation.size() );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_first_keyframe_applies_on_play );
+    RUN_TEST( test_keyframes_start_at_accumulated_times );
+    RUN_TEST( test_late_update_does_not_drift );
+    RUN_TEST( test_flash_timeline );
+    RUN_TEST( test_repeat_count );
+    RUN_TEST( test_repeat_forever_until_stopped );
+    RUN_TEST( test_stop_restores_brightness );
+    RUN_TEST( test_zero_length_forever_plays_once );
+    RUN_TEST( test_clock_wraparound );
+    RUN_TEST( test_capacity );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
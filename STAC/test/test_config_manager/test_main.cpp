@@ -0,0 +1,458 @@
+// Host tests for Storage::ConfigManager against an in-memory NVS
+//
+// Run with: pio test -e native -f test_config_manager
+//
+// FakeNvs keeps its namespaces across ConfigManager instances, so a new
+// instance calling begin() is a reboot. Its counters show how many NVS
+// opens, reads and writes a code path costs.
+
+#include <unity.h>
+#include <Preferences.h>
+#include <esp_mac.h>
+#include <vector>
+#include "Storage/ConfigManager.h"
+
+using namespace Storage;
+
+
+namespace {
+
+    constexpr uint8_t NAMESPACES = 6;
+
+    StacOperations v60Ops( uint8_t brightness ) {
+        StacOperations ops;
+        ops.switchModel = "V-60HD";
+        ops.tallyChannel = 3;
+        ops.maxChannelCount = 6;
+        ops.displayBrightnessLevel = brightness;
+        return ops;
+    }
+
+    /**
+     * @brief Put a configuration in every namespace, then start counting from zero
+     */
+    void provision() {
+        ConfigManager config;
+        config.begin();
+        config.saveWiFiCredentials( "StudioNet", "secret" );
+        config.saveSwitchConfig( "V-60HD", IPAddress( 192, 168, 1, 20 ), 80 );
+        config.saveV60HDConfig( v60Ops( 2 ) );
+        config.saveV160HDConfig( StacOperations() );
+        config.saveStacID( "STAC-563412" );
+        config.savePeripheralSettings( true, 3 );
+        FakeNvs::resetCounters();
+    }
+
+    /**
+     * @brief Password as the per-key layout stored it: XOR with the MAC, hex-encoded
+     */
+    String legacyPassword( const char *plain ) {
+        uint8_t mac[ 6 ];
+        esp_efuse_mac_get_default( mac );
+        String encoded;
+        for ( size_t i = 0; plain[ i ] != '\0'; i++ ) {
+            char hex[ 3 ];
+            snprintf( hex, sizeof( hex ), "%02x", static_cast<uint8_t>( plain[ i ] ^ mac[ i % 6 ] ) );
+            encoded += hex;
+        }
+        return encoded;
+    }
+
+    /**
+     * @brief Write a configuration the way NOM v3/v4 and PM v1/v2 firmware did, one key per value
+     * @param nomVersion 3 or 4; v3 had no switch credentials
+     */
+    void seedPerKeyLayout( uint8_t nomVersion ) {
+        Preferences prefs;
+
+        prefs.begin( "wifi" );
+        prefs.putString( "ssid", "StudioNet" );
+        prefs.putString( "password", legacyPassword( "secret" ) );
+        prefs.putUChar( "version", nomVersion );
+        prefs.putBool( "pmEnabled", true );
+        prefs.end();
+
+        prefs.begin( "switch" );
+        prefs.putString( "model", "V-160HD" );
+        prefs.putUInt( "ip", static_cast<uint32_t>( IPAddress( 10, 0, 0, 7 ) ) );
+        prefs.putUShort( "port", 8080 );
+        if ( nomVersion >= 4 ) {
+            prefs.putString( "username", "user" );
+            prefs.putString( "password", legacyPassword( "roland" ) );
+        }
+        prefs.putUChar( "version", nomVersion );
+        prefs.end();
+
+        prefs.begin( "v60hd" );
+        prefs.putUChar( "tallyChannel", 4 );
+        prefs.putUChar( "maxChannel", 6 );
+        prefs.putUChar( "autoStart", 1 );       // Written with putUChar by v4
+        prefs.putBool( "camOpMode", false );
+        prefs.putUChar( "brightness", 3 );
+        prefs.putULong( "pollInterval", 500 );
+        prefs.end();
+
+        prefs.begin( "v160hd" );
+        prefs.putUChar( "tallyChannel", 12 );
+        prefs.putUChar( "maxHDMI", 6 );
+        prefs.putUChar( "maxSDI", 10 );
+        prefs.putString( "channelBank", "sdi_" );
+        prefs.putBool( "autoStart", false );
+        prefs.putBool( "camOpMode", true );
+        prefs.putUChar( "brightness", 2 );
+        prefs.putULong( "pollInterval", 250 );
+        prefs.end();
+
+        prefs.begin( "identity" );
+        prefs.putString( "stacid", "STAC-ABCDEF" );
+        prefs.end();
+
+        prefs.begin( "peripheral" );
+        prefs.putBool( "pmCamMode", true );
+        prefs.putUChar( "pmBrightness", 4 );
+        prefs.putUChar( "version", 2 );
+        prefs.end();
+
+        FakeNvs::resetCounters();
+    }
+
+    /**
+     * @brief Check a ConfigManager loaded what seedPerKeyLayout() wrote
+     */
+    void checkSeededValues( ConfigManager &config, uint8_t nomVersion ) {
+        String ssid, password;
+        TEST_ASSERT_TRUE( config.loadWiFiCredentials( ssid, password ) );
+        TEST_ASSERT_EQUAL_STRING( "StudioNet", ssid.c_str() );
+        TEST_ASSERT_EQUAL_STRING( "secret", password.c_str() );
+        TEST_ASSERT_TRUE( config.loadPModeEnabled() );
+
+        String model, username, swPassword;
+        IPAddress ip;
+        uint16_t port = 0;
+        TEST_ASSERT_TRUE( config.loadSwitchConfig( model, ip, port, username, swPassword ) );
+        TEST_ASSERT_EQUAL_STRING( "V-160HD", model.c_str() );
+        TEST_ASSERT_TRUE( ip == IPAddress( 10, 0, 0, 7 ) );
+        TEST_ASSERT_EQUAL_UINT16( 8080, port );
+        TEST_ASSERT_EQUAL_STRING( nomVersion >= 4 ? "user" : "", username.c_str() );
+        TEST_ASSERT_EQUAL_STRING( nomVersion >= 4 ? "roland" : "", swPassword.c_str() );
+
+        StacOperations v60;
+        TEST_ASSERT_TRUE( config.loadV60HDConfig( v60 ) );
+        TEST_ASSERT_EQUAL_UINT8( 4, v60.tallyChannel );
+        TEST_ASSERT_EQUAL_UINT8( 6, v60.maxChannelCount );
+        TEST_ASSERT_TRUE( v60.autoStartEnabled );
+        TEST_ASSERT_FALSE( v60.cameraOperatorMode );
+        TEST_ASSERT_EQUAL_UINT8( 3, v60.displayBrightnessLevel );
+        TEST_ASSERT_EQUAL_UINT32( 500, v60.statusPollInterval );
+
+        StacOperations v160;
+        TEST_ASSERT_TRUE( config.loadV160HDConfig( v160 ) );
+        TEST_ASSERT_EQUAL_UINT8( 12, v160.tallyChannel );
+        TEST_ASSERT_EQUAL_UINT8( 6, v160.maxHDMIChannel );
+        TEST_ASSERT_EQUAL_UINT8( 10, v160.maxSDIChannel );
+        TEST_ASSERT_EQUAL_STRING( "sdi_", v160.channelBank.c_str() );
+        TEST_ASSERT_FALSE( v160.autoStartEnabled );
+        TEST_ASSERT_EQUAL_UINT8( 2, v160.displayBrightnessLevel );
+        TEST_ASSERT_EQUAL_UINT32( 250, v160.statusPollInterval );
+
+        String stacID;
+        TEST_ASSERT_TRUE( config.loadStacID( stacID ) );
+        TEST_ASSERT_EQUAL_STRING( "STAC-ABCDEF", stacID.c_str() );
+
+        bool cameraMode = false;
+        uint8_t brightness = 0;
+        TEST_ASSERT_TRUE( config.loadPeripheralSettings( cameraMode, brightness ) );
+        TEST_ASSERT_TRUE( cameraMode );
+        TEST_ASSERT_EQUAL_UINT8( 4, brightness );
+    }
+
+    void checkMigratedLayout( uint8_t nomVersion ) {
+        seedPerKeyLayout( nomVersion );
+
+        ConfigManager config;
+        config.begin();
+
+        // Every namespace now holds just its record
+        for ( const auto &ns : FakeNvs::store() ) {
+            TEST_ASSERT_EQUAL_MESSAGE( 1, ns.second.size(), ns.first.c_str() );
+            TEST_ASSERT_EQUAL_MESSAGE( 1, ns.second.count( "record" ), ns.first.c_str() );
+        }
+        TEST_ASSERT_EQUAL_UINT16( NAMESPACES, config.getNvsStats().commits );
+        TEST_ASSERT_EQUAL_UINT8( Config::NVS::NOM_PREFS_VERSION, config.getConfigVersion() );
+
+        ConfigManager rebooted;
+        FakeNvs::resetCounters();
+        rebooted.begin();
+        TEST_ASSERT_EQUAL_UINT32( 0, FakeNvs::counters().writes );
+        checkSeededValues( rebooted, nomVersion );
+    }
+
+} // namespace
+
+
+void setUp() {
+    FakeNvs::reset();
+}
+
+void tearDown() {
+}
+
+void test_fresh_boot_writes_nothing() {
+    ConfigManager config;
+    TEST_ASSERT_TRUE( config.begin() );
+
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeNvs::counters().writes );
+    TEST_ASSERT_EQUAL_UINT16( NAMESPACES, config.getNvsStats().opens );
+    TEST_ASSERT_EQUAL_UINT16( 0, config.getNvsStats().commits );
+    TEST_ASSERT_FALSE( config.isProvisioned() );
+}
+
+void test_provisioned_boot_reads_one_record_per_namespace() {
+    provision();
+
+    ConfigManager config;
+    config.begin();
+
+    // One open, one length query and one blob read per namespace, no writes
+    TEST_ASSERT_EQUAL_UINT32( NAMESPACES, FakeNvs::counters().opens );
+    TEST_ASSERT_EQUAL_UINT32( 2 * NAMESPACES, FakeNvs::counters().reads );
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeNvs::counters().writes );
+    TEST_ASSERT_EQUAL_UINT16( 0, config.getNvsStats().commits );
+    TEST_ASSERT_TRUE( config.isProvisioned() );
+}
+
+void test_unchanged_save_does_not_write() {
+    provision();
+    ConfigManager config;
+    config.begin();
+    FakeNvs::resetCounters();
+
+    TEST_ASSERT_TRUE( config.saveV60HDConfig( v60Ops( 2 ) ) );
+    TEST_ASSERT_TRUE( config.savePeripheralSettings( true, 3 ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeNvs::counters().opens );
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeNvs::counters().writes );
+}
+
+void test_deferred_saves_write_once() {
+    provision();
+    ConfigManager config;
+    config.begin();
+    FakeNvs::resetCounters();
+
+    // What the startup brightness menu does while the user steps through levels
+    TEST_ASSERT_TRUE( config.setDeferredCommit( true ) );
+    for ( uint8_t level = 1; level <= 6; level++ ) {
+        TEST_ASSERT_TRUE( config.saveV60HDConfig( v60Ops( level ) ) );
+    }
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeNvs::counters().writes );
+    TEST_ASSERT_TRUE( config.hasPendingChanges() );
+
+    TEST_ASSERT_TRUE( config.setDeferredCommit( false ) );
+    TEST_ASSERT_EQUAL_UINT32( 1, FakeNvs::counters().opens );
+    TEST_ASSERT_EQUAL_UINT32( 1, FakeNvs::counters().writes );
+    TEST_ASSERT_FALSE( config.hasPendingChanges() );
+}
+
+void test_failed_deferred_commit_is_reported_and_kept() {
+    provision();
+    ConfigManager config;
+    config.begin();
+
+    config.setDeferredCommit( true );
+    config.saveV60HDConfig( v60Ops( 5 ) );
+
+    FakeNvs::failWrites() = true;
+    TEST_ASSERT_FALSE( config.setDeferredCommit( false ) );
+    TEST_ASSERT_TRUE( config.hasPendingChanges() );
+
+    FakeNvs::failWrites() = false;
+    TEST_ASSERT_TRUE( config.commit() );
+
+    ConfigManager rebooted;
+    rebooted.begin();
+    StacOperations ops;
+    TEST_ASSERT_TRUE( rebooted.loadV60HDConfig( ops ) );
+    TEST_ASSERT_EQUAL_UINT8( 5, ops.displayBrightnessLevel );
+}
+
+void test_every_field_round_trips() {
+    WiFiLink link = {};
+    link.ip = static_cast<uint32_t>( IPAddress( 192, 168, 1, 50 ) );
+    link.gateway = static_cast<uint32_t>( IPAddress( 192, 168, 1, 1 ) );
+    link.subnet = static_cast<uint32_t>( IPAddress( 255, 255, 255, 0 ) );
+    link.dns = static_cast<uint32_t>( IPAddress( 192, 168, 1, 2 ) );
+    link.ssidHash = 0x12345678;
+    const uint8_t bssid[ 6 ] = { 0xAA, 0xBB, 0xCC, 0x01, 0x02, 0x03 };
+    memcpy( link.bssid, bssid, sizeof( bssid ) );
+    link.channel = 11;
+
+    StacOperations v60 = v60Ops( 4 );
+    v60.autoStartEnabled = true;
+    v60.cameraOperatorMode = false;
+    v60.statusPollInterval = 750;
+
+    StacOperations v160;
+    v160.switchModel = "V-160HD";
+    v160.tallyChannel = 14;
+    v160.maxHDMIChannel = 7;
+    v160.maxSDIChannel = 9;
+    v160.channelBank = "sdi_";
+    v160.autoStartEnabled = true;
+    v160.cameraOperatorMode = true;
+    v160.displayBrightnessLevel = 5;
+    v160.statusPollInterval = 1000;
+
+    {
+        ConfigManager config;
+        config.begin();
+        TEST_ASSERT_TRUE( config.saveWiFiCredentials( "Studio Net 5G", "p@ss word" ) );
+        TEST_ASSERT_TRUE( config.savePModeEnabled( true ) );
+        TEST_ASSERT_TRUE( config.saveUpdateURL( "http://10.0.0.2:8000" ) );
+        TEST_ASSERT_TRUE( config.saveWiFiLink( link ) );
+        TEST_ASSERT_TRUE( config.savePowerProfile( PowerProfile::BATTERY_SAVER ) );
+        TEST_ASSERT_TRUE( config.saveSwitchConfig( "V-160HD", IPAddress( 10, 1, 2, 3 ), 8080, "admin", "pw" ) );
+        TEST_ASSERT_TRUE( config.saveV60HDConfig( v60 ) );
+        TEST_ASSERT_TRUE( config.saveV160HDConfig( v160 ) );
+        TEST_ASSERT_TRUE( config.saveStacID( "STAC-0A0B0C" ) );
+        TEST_ASSERT_TRUE( config.savePeripheralSettings( true, 6 ) );
+    }
+
+    ConfigManager config;
+    config.begin();
+
+    String ssid, password;
+    TEST_ASSERT_TRUE( config.loadWiFiCredentials( ssid, password ) );
+    TEST_ASSERT_EQUAL_STRING( "Studio Net 5G", ssid.c_str() );
+    TEST_ASSERT_EQUAL_STRING( "p@ss word", password.c_str() );
+    TEST_ASSERT_EQUAL_UINT8( Config::NVS::NOM_PREFS_VERSION, config.getConfigVersion() );
+    TEST_ASSERT_TRUE( config.loadPModeEnabled() );
+    TEST_ASSERT_EQUAL_STRING( "http://10.0.0.2:8000", config.loadUpdateURL().c_str() );
+    TEST_ASSERT_TRUE( config.loadPowerProfile() == PowerProfile::BATTERY_SAVER );
+
+    WiFiLink loaded;
+    TEST_ASSERT_TRUE( config.loadWiFiLink( loaded ) );
+    TEST_ASSERT_EQUAL_MEMORY( &link, &loaded, sizeof( link ) );
+
+    String model, username, swPassword;
+    IPAddress ip;
+    uint16_t port = 0;
+    TEST_ASSERT_TRUE( config.loadSwitchConfig( model, ip, port, username, swPassword ) );
+    TEST_ASSERT_EQUAL_STRING( "V-160HD", model.c_str() );
+    TEST_ASSERT_TRUE( ip == IPAddress( 10, 1, 2, 3 ) );
+    TEST_ASSERT_EQUAL_UINT16( 8080, port );
+    TEST_ASSERT_EQUAL_STRING( "admin", username.c_str() );
+    TEST_ASSERT_EQUAL_STRING( "pw", swPassword.c_str() );
+    TEST_ASSERT_TRUE( config.isProvisioned() );
+
+    StacOperations ops;
+    TEST_ASSERT_TRUE( config.loadV60HDConfig( ops ) );
+    TEST_ASSERT_EQUAL_UINT8( v60.tallyChannel, ops.tallyChannel );
+    TEST_ASSERT_EQUAL_UINT8( v60.maxChannelCount, ops.maxChannelCount );
+    TEST_ASSERT_TRUE( ops.autoStartEnabled );
+    TEST_ASSERT_FALSE( ops.cameraOperatorMode );
+    TEST_ASSERT_EQUAL_UINT8( v60.displayBrightnessLevel, ops.displayBrightnessLevel );
+    TEST_ASSERT_EQUAL_UINT32( v60.statusPollInterval, ops.statusPollInterval );
+
+    TEST_ASSERT_TRUE( config.loadV160HDConfig( ops ) );
+    TEST_ASSERT_EQUAL_UINT8( v160.tallyChannel, ops.tallyChannel );
+    TEST_ASSERT_EQUAL_UINT8( v160.maxHDMIChannel, ops.maxHDMIChannel );
+    TEST_ASSERT_EQUAL_UINT8( v160.maxSDIChannel, ops.maxSDIChannel );
+    TEST_ASSERT_EQUAL_STRING( "sdi_", ops.channelBank.c_str() );
+    TEST_ASSERT_TRUE( ops.autoStartEnabled );
+    TEST_ASSERT_TRUE( ops.cameraOperatorMode );
+    TEST_ASSERT_EQUAL_UINT8( v160.displayBrightnessLevel, ops.displayBrightnessLevel );
+    TEST_ASSERT_EQUAL_UINT32( v160.statusPollInterval, ops.statusPollInterval );
+
+    String stacID;
+    TEST_ASSERT_TRUE( config.loadStacID( stacID ) );
+    TEST_ASSERT_EQUAL_STRING( "STAC-0A0B0C", stacID.c_str() );
+
+    bool cameraMode = false;
+    uint8_t brightness = 0;
+    TEST_ASSERT_TRUE( config.loadPeripheralSettings( cameraMode, brightness ) );
+    TEST_ASSERT_TRUE( cameraMode );
+    TEST_ASSERT_EQUAL_UINT8( 6, brightness );
+}
+
+void test_migrates_v4_per_key_layout() {
+    checkMigratedLayout( 4 );
+}
+
+void test_migrates_v3_per_key_layout() {
+    checkMigratedLayout( 3 );
+}
+
+void test_interrupted_migration_keeps_the_legacy_values() {
+    seedPerKeyLayout( 4 );
+    const size_t wifiKeys = FakeNvs::store()[ "wifi" ].size();
+
+    // Power is lost right after the first record reaches flash
+    FakeNvs::writesBeforeFailure() = 1;
+    ConfigManager config;
+    config.begin();
+    TEST_ASSERT_TRUE( config.hasPendingChanges() );
+    TEST_ASSERT_EQUAL_UINT32( wifiKeys + 1, FakeNvs::store()[ "wifi" ].size() );
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeNvs::store()[ "switch" ].count( "record" ) );
+
+    // The wifi namespace now loads from its record, the rest migrate again
+    FakeNvs::failWrites() = false;
+    ConfigManager rebooted;
+    rebooted.begin();
+    TEST_ASSERT_FALSE( rebooted.hasPendingChanges() );
+    TEST_ASSERT_EQUAL_UINT16( NAMESPACES - 1, rebooted.getNvsStats().commits );
+    checkSeededValues( rebooted, 4 );
+}
+
+void test_damaged_record_is_left_in_flash() {
+    provision();
+    std::vector<uint8_t> &blob = FakeNvs::store()[ "wifi" ][ "record" ].data;
+    blob[ blob.size() / 2 ] ^= 0xFF;    // Fails the CRC check
+    const std::vector<uint8_t> damaged = blob;
+
+    ConfigManager config;
+    config.begin();
+
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeNvs::counters().writes );
+    TEST_ASSERT_EQUAL_UINT16( 0, config.getNvsStats().commits );
+    TEST_ASSERT_FALSE( config.hasPendingChanges() );
+    TEST_ASSERT_TRUE( FakeNvs::store()[ "wifi" ][ "record" ].data == damaged );
+
+    // The damaged namespace runs on defaults; the others load normally
+    TEST_ASSERT_FALSE( config.hasWiFiCredentials() );
+    String stacID;
+    TEST_ASSERT_TRUE( config.loadStacID( stacID ) );
+    TEST_ASSERT_EQUAL_STRING( "STAC-563412", stacID.c_str() );
+}
+
+void test_truncated_record_is_left_in_flash() {
+    provision();
+    std::vector<uint8_t> &blob = FakeNvs::store()[ "switch" ][ "record" ].data;
+    blob.resize( blob.size() - 6 );     // Fails the length check
+
+    ConfigManager config;
+    config.begin();
+
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeNvs::counters().writes );
+    TEST_ASSERT_EQUAL_UINT32( 1, FakeNvs::store()[ "switch" ].size() );
+    TEST_ASSERT_FALSE( config.isProvisioned() );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_fresh_boot_writes_nothing );
+    RUN_TEST( test_provisioned_boot_reads_one_record_per_namespace );
+    RUN_TEST( test_unchanged_save_does_not_write );
+    RUN_TEST( test_deferred_saves_write_once );
+    RUN_TEST( test_failed_deferred_commit_is_reported_and_kept );
+    RUN_TEST( test_every_field_round_trips );
+    RUN_TEST( test_migrates_v4_per_key_layout );
+    RUN_TEST( test_migrates_v3_per_key_layout );
+    RUN_TEST( test_interrupted_migration_keeps_the_legacy_values );
+    RUN_TEST( test_damaged_record_is_left_in_flash );
+    RUN_TEST( test_truncated_record_is_left_in_flash );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
@@ -0,0 +1,365 @@
+// Host tests for Net::DeltaPatcher: patch parsing, ADD_DEFLATE inflation and base checks
+//
+// Run with: pio test -e native -f test_delta_patcher
+//
+// Patches are built here the way scripts/make_delta.py builds them and
+// applied through the real OTAPipeline, against a fake running partition
+// (FakeFlash) and a fake Update that keeps the installed image.
+
+#include <unity.h>
+#include <Update.h>
+#include <vector>
+#include <zlib.h>
+#include "Network/DeltaPatcher.h"
+
+using namespace Net;
+
+
+namespace {
+
+    using Bytes = std::vector<uint8_t>;
+
+    constexpr int WINDOW_BITS = 13;     // As make_delta.py; 2^13 = DeltaPatcher::INFLATE_WINDOW
+
+    Bytes sha256( const Bytes &data ) {
+        mbedtls_sha256_context sha;
+        mbedtls_sha256_init( &sha );
+        mbedtls_sha256_starts( &sha, 0 );
+        mbedtls_sha256_update( &sha, data.data(), data.size() );
+        Bytes digest( 32 );
+        mbedtls_sha256_finish( &sha, digest.data() );
+        return digest;
+    }
+
+    void putU32( Bytes &out, uint32_t value ) {
+        for ( int i = 0; i < 4; i++ ) {
+            out.push_back( static_cast<uint8_t>( value >> ( i * 8 ) ) );
+        }
+    }
+
+    Bytes deflateRaw( const Bytes &data ) {
+        z_stream stream = {};
+        deflateInit2( &stream, 9, Z_DEFLATED, -WINDOW_BITS, 8, Z_DEFAULT_STRATEGY );
+        Bytes packed( deflateBound( &stream, data.size() ) );
+        stream.next_in = const_cast<uint8_t *>( data.data() );
+        stream.avail_in = static_cast<uInt>( data.size() );
+        stream.next_out = packed.data();
+        stream.avail_out = static_cast<uInt>( packed.size() );
+        deflate( &stream, Z_FINISH );
+        packed.resize( stream.total_out );
+        deflateEnd( &stream );
+        return packed;
+    }
+
+    /**
+     * @brief Patch writer mirroring scripts/make_delta.py
+     */
+    class PatchBuilder {
+      public:
+        PatchBuilder( const Bytes &oldImage, const Bytes &newImage, uint8_t version = DeltaPatcher::FORMAT_VERSION ) {
+            const char magic[ 4 ] = { 'S', 'T', 'D', 'P' };
+            patch.insert( patch.end(), magic, magic + 4 );
+            patch.push_back( version );
+            patch.push_back( 0 );
+            patch.push_back( 0 );
+            patch.push_back( 0 );
+            putU32( patch, static_cast<uint32_t>( oldImage.size() ) );
+            putU32( patch, static_cast<uint32_t>( newImage.size() ) );
+            Bytes oldSha = sha256( oldImage );
+            Bytes newSha = sha256( newImage );
+            patch.insert( patch.end(), oldSha.begin(), oldSha.end() );
+            patch.insert( patch.end(), newSha.begin(), newSha.end() );
+        }
+
+        PatchBuilder &copy( uint32_t offset, uint32_t length ) {
+            patch.push_back( 0x01 );
+            putU32( patch, offset );
+            putU32( patch, length );
+            return *this;
+        }
+
+        PatchBuilder &add( const Bytes &data ) {
+            patch.push_back( 0x02 );
+            putU32( patch, static_cast<uint32_t>( data.size() ) );
+            patch.insert( patch.end(), data.begin(), data.end() );
+            return *this;
+        }
+
+        PatchBuilder &addDeflate( const Bytes &data ) {
+            return addPacked( static_cast<uint32_t>( data.size() ), deflateRaw( data ) );
+        }
+
+        PatchBuilder &addPacked( uint32_t length, const Bytes &packed ) {
+            patch.push_back( 0x03 );
+            putU32( patch, length );
+            putU32( patch, static_cast<uint32_t>( packed.size() ) );
+            patch.insert( patch.end(), packed.begin(), packed.end() );
+            return *this;
+        }
+
+        Bytes end() {
+            patch.push_back( 0x00 );
+            return patch;
+        }
+
+      private:
+        Bytes patch;
+    };
+
+    // Firmware-like content: a small vocabulary of 4-byte words, so it deflates as code does
+    Bytes makeImage( size_t size, uint32_t seed ) {
+        Bytes image( size );
+        uint32_t state = seed;
+        for ( size_t i = 0; i < size; i += 4 ) {
+            state = state * 1103515245u + 12345u;
+            uint32_t word = 0x40000000u + ( ( state >> 16 ) % 48 ) * 0x01010101u;
+            for ( size_t b = 0; b < 4 && i + b < size; b++ ) {
+                image[ i + b ] = static_cast<uint8_t>( word >> ( b * 8 ) );
+            }
+        }
+        return image;
+    }
+
+    Bytes slice( const Bytes &data, size_t from, size_t length ) {
+        return Bytes( data.begin() + from, data.begin() + from + length );
+    }
+
+    // Old image, and a new one with changed code in the middle and appended code at the end
+    Bytes oldImage;
+    Bytes newImage;
+    Bytes changed;
+    Bytes appended;
+
+    constexpr size_t OLD_SIZE = 64 * 1024;
+    constexpr size_t CHANGE_AT = 20000;
+    constexpr size_t CHANGE_SIZE = 3000;
+    constexpr size_t APPEND_SIZE = 24 * 1024;       // Larger than the inflate window: the window wraps
+
+    Bytes standardPatch( uint8_t version = DeltaPatcher::FORMAT_VERSION ) {
+        return PatchBuilder( oldImage, newImage, version )
+               .copy( 0, CHANGE_AT )
+               .addDeflate( changed )
+               .copy( CHANGE_AT + CHANGE_SIZE, OLD_SIZE - CHANGE_AT - CHANGE_SIZE )
+               .add( slice( appended, 0, 10 ) )
+               .addDeflate( slice( appended, 10, APPEND_SIZE - 10 ) )
+               .end();
+    }
+
+    /**
+     * @brief Feed a patch in pieces of a fixed size
+     * @return false as soon as write() refuses a piece
+     */
+    bool feed( DeltaPatcher &patcher, const Bytes &patch, size_t pieceSize ) {
+        for ( size_t offset = 0; offset < patch.size(); offset += pieceSize ) {
+            size_t length = min( pieceSize, patch.size() - offset );
+            if ( !patcher.write( patch.data() + offset, length ) ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+
+void setUp() {
+    oldImage = makeImage( OLD_SIZE, 1 );
+    changed = makeImage( CHANGE_SIZE, 2 );
+    appended = makeImage( APPEND_SIZE, 3 );
+
+    newImage = oldImage;
+    std::copy( changed.begin(), changed.end(), newImage.begin() + CHANGE_AT );
+    newImage.insert( newImage.end(), appended.begin(), appended.end() );
+
+    FakeFlash::setRunningImage( oldImage );
+    Update.reset();
+}
+
+void tearDown() {
+}
+
+void test_sha256_fake_matches_known_digest() {
+    const char *text = "abc";
+    Bytes digest = sha256( Bytes( text, text + 3 ) );
+    const uint8_t expected[ 32 ] = {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+        0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+    };
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( expected, digest.data(), 32 );
+}
+
+void test_deflated_adds_rebuild_the_image() {
+    OTAPipeline ota;
+    DeltaPatcher patcher( ota );
+    Bytes patch = standardPatch();
+
+    patcher.begin();
+    TEST_ASSERT_TRUE( patcher.write( patch.data(), patch.size() ) );
+    TEST_ASSERT_TRUE( patcher.finish() );
+
+    TEST_ASSERT_TRUE( Update.installed );
+    TEST_ASSERT_EQUAL_UINT32( newImage.size(), Update.image.size() );
+    TEST_ASSERT_TRUE( Update.image == newImage );
+    TEST_ASSERT_EQUAL_UINT32( patch.size(), patcher.getPatchBytes() );
+
+    // The deflated ADDs are what make the patch small
+    TEST_ASSERT_LESS_THAN_UINT32( ( CHANGE_SIZE + APPEND_SIZE ) / 2, patch.size() );
+}
+
+void test_patch_split_into_any_chunk_size() {
+    const size_t pieceSizes[] = { 1, 3, 7, 64, 1000, 4096 };
+    Bytes patch = standardPatch();
+
+    for ( size_t pieceSize : pieceSizes ) {
+        Update.reset();
+        OTAPipeline ota;
+        DeltaPatcher patcher( ota );
+        patcher.begin();
+
+        TEST_ASSERT_TRUE_MESSAGE( feed( patcher, patch, pieceSize ), "write refused a piece" );
+        TEST_ASSERT_TRUE_MESSAGE( patcher.finish(), "finish failed" );
+        TEST_ASSERT_TRUE_MESSAGE( Update.image == newImage, "rebuilt image differs" );
+    }
+}
+
+void test_version_1_patch_is_still_accepted() {
+    OTAPipeline ota;
+    DeltaPatcher patcher( ota );
+    Bytes patch = PatchBuilder( oldImage, newImage, 1 )
+                  .copy( 0, CHANGE_AT )
+                  .add( changed )
+                  .copy( CHANGE_AT + CHANGE_SIZE, OLD_SIZE - CHANGE_AT - CHANGE_SIZE )
+                  .add( appended )
+                  .end();
+
+    patcher.begin();
+    TEST_ASSERT_TRUE( patcher.write( patch.data(), patch.size() ) );
+    TEST_ASSERT_TRUE( patcher.finish() );
+    TEST_ASSERT_TRUE( Update.image == newImage );
+}
+
+void test_wrong_base_is_refused_before_writing() {
+    Bytes otherBase = oldImage;
+    otherBase[ 1234 ] ^= 0x01;
+    FakeFlash::setRunningImage( otherBase );
+
+    OTAPipeline ota;
+    DeltaPatcher patcher( ota );
+    Bytes patch = standardPatch();
+
+    patcher.begin();
+    TEST_ASSERT_FALSE( feed( patcher, patch, 512 ) );
+    TEST_ASSERT_EQUAL_STRING( "Delta patch was made for a different release", patcher.getError() );
+    TEST_ASSERT_FALSE( patcher.finish() );
+
+    TEST_ASSERT_EQUAL_UINT32( 0, Update.begins );
+    TEST_ASSERT_FALSE( Update.installed );
+}
+
+void test_truncated_patch_is_not_installed() {
+    Bytes patch = standardPatch();
+    const size_t header = 4 + 4 + 8 + 64;
+    const size_t cuts[] = {
+        header / 2,                 // Inside the header
+        header + 5,                 // Inside the first COPY's arguments
+        header + 9 + 9 + 40,        // Inside the first ADD_DEFLATE stream
+        patch.size() - 50,          // Inside the last ADD_DEFLATE stream
+        patch.size() - 1            // Only the END op missing
+    };
+
+    for ( size_t cut : cuts ) {
+        Update.reset();
+        OTAPipeline ota;
+        DeltaPatcher patcher( ota );
+        patcher.begin();
+
+        TEST_ASSERT_TRUE_MESSAGE( patcher.write( patch.data(), cut ), "a prefix is not an error yet" );
+        TEST_ASSERT_FALSE_MESSAGE( patcher.finish(), "truncated patch finished" );
+        TEST_ASSERT_EQUAL_STRING( "Delta patch is incomplete", patcher.getError() );
+        TEST_ASSERT_FALSE( Update.installed );
+    }
+}
+
+void test_deflate_stream_shorter_than_declared_fails() {
+    Bytes packed = deflateRaw( changed );
+    packed.resize( packed.size() - 8 );     // Packed length covers only part of the stream
+
+    OTAPipeline ota;
+    DeltaPatcher patcher( ota );
+    Bytes patch = PatchBuilder( oldImage, newImage )
+                  .copy( 0, CHANGE_AT )
+                  .addPacked( CHANGE_SIZE, packed )
+                  .end();
+
+    patcher.begin();
+    TEST_ASSERT_FALSE( feed( patcher, patch, 100 ) );
+    TEST_ASSERT_FALSE( patcher.finish() );
+    TEST_ASSERT_FALSE( Update.installed );
+}
+
+void test_deflate_length_mismatch_fails() {
+    OTAPipeline ota;
+    DeltaPatcher patcher( ota );
+    Bytes patch = PatchBuilder( oldImage, newImage )
+                  .addPacked( CHANGE_SIZE - 1, deflateRaw( changed ) )
+                  .end();
+
+    patcher.begin();
+    TEST_ASSERT_FALSE( patcher.write( patch.data(), patch.size() ) );
+    TEST_ASSERT_EQUAL_STRING( "Corrupt delta patch (deflate data too long)", patcher.getError() );
+    TEST_ASSERT_FALSE( patcher.finish() );
+    TEST_ASSERT_FALSE( Update.installed );
+}
+
+void test_corrupt_deflate_data_fails() {
+    Bytes packed( 64, 0xFF );               // Reserved block type
+
+    OTAPipeline ota;
+    DeltaPatcher patcher( ota );
+    Bytes patch = PatchBuilder( oldImage, newImage )
+                  .addPacked( 100, packed )
+                  .end();
+
+    patcher.begin();
+    TEST_ASSERT_FALSE( patcher.write( patch.data(), patch.size() ) );
+    TEST_ASSERT_EQUAL_STRING( "Corrupt delta patch (bad deflate data)", patcher.getError() );
+    TEST_ASSERT_FALSE( patcher.finish() );
+}
+
+void test_wrong_rebuilt_image_is_not_installed() {
+    Bytes wrong = changed;
+    wrong[ 10 ] ^= 0xFF;
+
+    OTAPipeline ota;
+    DeltaPatcher patcher( ota );
+    Bytes patch = PatchBuilder( oldImage, newImage )
+                  .copy( 0, CHANGE_AT )
+                  .addDeflate( wrong )
+                  .copy( CHANGE_AT + CHANGE_SIZE, OLD_SIZE - CHANGE_AT - CHANGE_SIZE )
+                  .addDeflate( appended )
+                  .end();
+
+    patcher.begin();
+    TEST_ASSERT_TRUE( patcher.write( patch.data(), patch.size() ) );
+    TEST_ASSERT_FALSE( patcher.finish() );
+    TEST_ASSERT_EQUAL_STRING( "SHA-256 mismatch - image not installed", patcher.getError() );
+    TEST_ASSERT_FALSE( Update.installed );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_sha256_fake_matches_known_digest );
+    RUN_TEST( test_deflated_adds_rebuild_the_image );
+    RUN_TEST( test_patch_split_into_any_chunk_size );
+    RUN_TEST( test_version_1_patch_is_still_accepted );
+    RUN_TEST( test_wrong_base_is_refused_before_writing );
+    RUN_TEST( test_truncated_patch_is_not_installed );
+    RUN_TEST( test_deflate_stream_shorter_than_declared_fails );
+    RUN_TEST( test_deflate_length_mismatch_fails );
+    RUN_TEST( test_corrupt_deflate_data_fails );
+    RUN_TEST( test_wrong_rebuilt_image_is_not_installed );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
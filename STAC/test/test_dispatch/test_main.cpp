@@ -0,0 +1,133 @@
+// Host tests and per-call benchmark for the two STAC_STATIC_DISPATCH modes
+//
+// Run with: pio test -e native -f test_dispatch
+//
+// The benchmark makes the same display calls through an IDisplay pointer
+// (STAC_STATIC_DISPATCH 0) and through the final Display5x5 type
+// (STAC_STATIC_DISPATCH 1) and prints the host time per call for each.
+// Code size is compared on the device build instead: uncomment the
+// atom-matrix-virtual env in platformio.ini and build both.
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <LiteLED.h>
+#include "Hardware/Display/Matrix5x5/Display5x5.h"
+
+using namespace Display;
+
+
+namespace {
+
+    constexpr uint8_t LEDS = 25;
+    constexpr uint32_t ITERATIONS = 2000000;
+
+    const uint8_t DOT_GLYPH[ LEDS ] = {
+        0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+    };
+
+    Display5x5 *display = nullptr;
+
+    // Read back through a volatile so the compiler cannot see the dynamic type
+    IDisplay *volatile interfacePtr = nullptr;
+
+    volatile uint32_t sink = 0;
+
+    template <typename Fn>
+    double nanosPerCall( uint32_t iterations, Fn fn ) {
+        auto start = std::chrono::steady_clock::now();
+        for ( uint32_t i = 0; i < iterations; i++ ) {
+            fn( i );
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+
+    void report( const char *call, double virtualNs, double staticNs ) {
+        char line[ 128 ];
+        snprintf( line, sizeof( line ), "%-14s interface %6.2f ns, static %6.2f ns per call (host CPU)",
+                  call, virtualNs, staticNs );
+        TEST_MESSAGE( line );
+    }
+
+} // namespace
+
+
+void setUp() {
+    display = new Display5x5( PIN_DISPLAY_DATA, LEDS, DISPLAY_LED_TYPE );
+    display->begin();
+    interfacePtr = display;
+}
+
+void tearDown() {
+    interfacePtr = nullptr;
+    delete display;
+    display = nullptr;
+}
+
+void test_both_modes_draw_the_same_frame() {
+    IDisplay *iface = interfacePtr;
+    Display5x5 &board = *display;
+
+    iface->drawGlyph( DOT_GLYPH, StandardColors::GREEN, StandardColors::BLUE, false );
+    iface->setPixelXY( 0, 0, StandardColors::RED, true );
+    uint32_t viaInterface[ LEDS ];
+    for ( uint8_t i = 0; i < LEDS; i++ ) {
+        viaInterface[ i ] = LiteLED::last()->getShownPixel( i );
+    }
+
+    board.clear( true );
+    board.drawGlyph( DOT_GLYPH, StandardColors::GREEN, StandardColors::BLUE, false );
+    board.setPixelXY( 0, 0, StandardColors::RED, true );
+    for ( uint8_t i = 0; i < LEDS; i++ ) {
+        TEST_ASSERT_EQUAL_HEX32( viaInterface[ i ], LiteLED::last()->getShownPixel( i ) );
+    }
+    TEST_ASSERT_EQUAL_UINT8( iface->getPixelCount(), board.getPixelCount() );
+}
+
+void test_dispatch_benchmark() {
+    Display5x5 &board = *display;
+
+    double virtualNs = nanosPerCall( ITERATIONS, []( uint32_t i ) {
+        sink = sink + interfacePtr->getPixelCount() + i;
+    } );
+    double staticNs = nanosPerCall( ITERATIONS, [ &board ]( uint32_t i ) {
+        sink = sink + board.getPixelCount() + i;
+    } );
+    report( "getPixelCount", virtualNs, staticNs );
+
+    virtualNs = nanosPerCall( ITERATIONS, []( uint32_t i ) {
+        interfacePtr->setPixel( i % LEDS, StandardColors::RED, false );
+    } );
+    staticNs = nanosPerCall( ITERATIONS, [ &board ]( uint32_t i ) {
+        board.setPixel( i % LEDS, StandardColors::RED, false );
+    } );
+    report( "setPixel", virtualNs, staticNs );
+
+    virtualNs = nanosPerCall( ITERATIONS / 10, []( uint32_t i ) {
+        ( void )i;
+        interfacePtr->drawGlyph( DOT_GLYPH, StandardColors::GREEN, StandardColors::BLACK, false );
+    } );
+    staticNs = nanosPerCall( ITERATIONS / 10, [ &board ]( uint32_t i ) {
+        ( void )i;
+        board.drawGlyph( DOT_GLYPH, StandardColors::GREEN, StandardColors::BLACK, false );
+    } );
+    report( "drawGlyph", virtualNs, staticNs );
+
+    // Nothing above asked for a show
+    TEST_ASSERT_EQUAL_UINT32( 1, display->getStats().showRequests );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_both_modes_draw_the_same_frame );
+    RUN_TEST( test_dispatch_benchmark );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
@@ -0,0 +1,199 @@
+// Host tests and throughput harness for Application::EventBus
+//
+// Run with: pio test -e native -f test_event_bus
+//
+// Producers run on std::threads against the fake FreeRTOS queue, the way
+// the button timer and WiFi event tasks post on the device, while the
+// test thread plays the application loop: receive() then dispatch().
+// The harness prints events per second through the bus and checks that
+// the counters add up exactly under contention.
+
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <FakeClock.h>
+#include "Application/EventBus.h"
+
+using namespace Application;
+
+
+namespace {
+
+    constexpr uint8_t PRODUCERS = 3;
+
+    EventBus *bus = nullptr;
+
+    struct Tally {
+        uint32_t calls = 0;
+        uint32_t perProducer[ PRODUCERS ] = {};
+    };
+
+    void countEvent( const AppEvent &event, void *context ) {
+        Tally *tally = static_cast<Tally *>( context );
+        tally->calls++;
+        if ( event.value < PRODUCERS ) {
+            tally->perProducer[ event.value ]++;
+        }
+    }
+
+    /**
+     * @brief Receive and dispatch until the producers are done and the queue is drained
+     */
+    void runLoop( const std::atomic<uint8_t> &producersLeft ) {
+        AppEvent event;
+        while ( true ) {
+            if ( bus->receive( event, 10 ) ) {
+                bus->dispatch( event, OperatingMode::NORMAL );
+            }
+            else if ( producersLeft.load() == 0 ) {
+                break;
+            }
+        }
+    }
+
+} // namespace
+
+
+void setUp() {
+    bus = new EventBus();
+    TEST_ASSERT_TRUE( bus->begin() );
+}
+
+void tearDown() {
+    delete bus;
+    bus = nullptr;
+}
+
+void test_dispatch_reaches_only_the_current_mode() {
+    Tally normal;
+    Tally peripheral;
+    bus->subscribe( OperatingMode::NORMAL, AppEventType::BUTTON_PRESSED, countEvent, &normal );
+    bus->subscribe( OperatingMode::PERIPHERAL, AppEventType::BUTTON_PRESSED, countEvent, &peripheral );
+
+    TEST_ASSERT_TRUE( bus->post( AppEventType::BUTTON_PRESSED ) );
+    AppEvent event;
+    TEST_ASSERT_TRUE( bus->receive( event, 0 ) );
+    TEST_ASSERT_EQUAL_UINT8( 1, bus->dispatch( event, OperatingMode::NORMAL ) );
+
+    // No subscriber: not counted as dispatched
+    TEST_ASSERT_EQUAL_UINT8( 0, bus->dispatch( EventBus::makeEvent( AppEventType::TALLY_RESULT ), OperatingMode::NORMAL ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 1, normal.calls );
+    TEST_ASSERT_EQUAL_UINT32( 0, peripheral.calls );
+    EventBusStats stats = bus->getStats();
+    TEST_ASSERT_EQUAL_UINT32( 1, stats.posted );
+    TEST_ASSERT_EQUAL_UINT32( 1, stats.dispatched );
+}
+
+void test_full_queue_drops_and_counts() {
+    for ( uint8_t i = 0; i < EventBus::QUEUE_CAPACITY; i++ ) {
+        TEST_ASSERT_TRUE( bus->post( AppEventType::TIMER_TICK, i ) );
+    }
+    TEST_ASSERT_FALSE( bus->post( AppEventType::TIMER_TICK ) );
+
+    EventBusStats stats = bus->getStats();
+    TEST_ASSERT_EQUAL_UINT32( EventBus::QUEUE_CAPACITY, stats.posted );
+    TEST_ASSERT_EQUAL_UINT32( 1, stats.dropped );
+
+    // Order is kept
+    AppEvent event;
+    TEST_ASSERT_TRUE( bus->receive( event, 0 ) );
+    TEST_ASSERT_EQUAL_UINT32( 0, event.value );
+}
+
+void test_receive_times_out_when_empty() {
+    AppEvent event;
+    TEST_ASSERT_FALSE( bus->receive( event, 5 ) );
+}
+
+void test_latency_is_measured_from_post() {
+    bus->post( AppEventType::WIFI_EVENT );
+    FakeClock::advanceMicros( 1500 );
+
+    AppEvent event;
+    TEST_ASSERT_TRUE( bus->receive( event, 0 ) );
+    bus->dispatch( event, OperatingMode::NORMAL );
+    TEST_ASSERT_EQUAL_UINT32( 1500, bus->getStats().maxLatencyUs );
+}
+
+void test_concurrent_burst_counters_add_up() {
+    Tally tally;
+    bus->subscribe( OperatingMode::NORMAL, AppEventType::BUTTON_PRESSED, countEvent, &tally );
+
+    const uint32_t perProducer = 20000;
+    std::atomic<uint8_t> producersLeft( PRODUCERS );
+    std::vector<std::thread> producers;
+    for ( uint8_t p = 0; p < PRODUCERS; p++ ) {
+        producers.emplace_back( [ p, &producersLeft ]() {
+            for ( uint32_t i = 0; i < perProducer; i++ ) {
+                bus->post( AppEventType::BUTTON_PRESSED, p );   // Drops allowed
+            }
+            producersLeft--;
+        } );
+    }
+    runLoop( producersLeft );
+    for ( std::thread &producer : producers ) {
+        producer.join();
+    }
+
+    EventBusStats stats = bus->getStats();
+    TEST_ASSERT_EQUAL_UINT32( PRODUCERS * perProducer, stats.posted + stats.dropped );
+    TEST_ASSERT_EQUAL_UINT32( stats.posted, stats.dispatched );
+    TEST_ASSERT_EQUAL_UINT32( stats.posted, tally.calls );
+}
+
+void test_throughput_harness() {
+    Tally tally;
+    bus->subscribe( OperatingMode::NORMAL, AppEventType::BUTTON_PRESSED, countEvent, &tally );
+
+    const uint32_t perProducer = 50000;
+    std::atomic<uint8_t> producersLeft( PRODUCERS );
+    std::vector<std::thread> producers;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( uint8_t p = 0; p < PRODUCERS; p++ ) {
+        producers.emplace_back( [ p, &producersLeft ]() {
+            // Retry on a full queue so every event gets through
+            for ( uint32_t i = 0; i < perProducer; i++ ) {
+                while ( !bus->post( AppEventType::BUTTON_PRESSED, p ) ) {
+                    std::this_thread::yield();
+                }
+            }
+            producersLeft--;
+        } );
+    }
+    runLoop( producersLeft );
+    for ( std::thread &producer : producers ) {
+        producer.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    EventBusStats stats = bus->getStats();
+    char line[ 160 ];
+    snprintf( line, sizeof( line ), "%u producers: %.0f events/s delivered, %lu full-queue retries (host)",
+              PRODUCERS, stats.dispatched / elapsed.count(), static_cast<unsigned long>( stats.dropped ) );
+    TEST_MESSAGE( line );
+
+    TEST_ASSERT_EQUAL_UINT32( PRODUCERS * perProducer, stats.posted );
+    TEST_ASSERT_EQUAL_UINT32( PRODUCERS * perProducer, stats.dispatched );
+    for ( uint8_t p = 0; p < PRODUCERS; p++ ) {
+        TEST_ASSERT_EQUAL_UINT32( perProducer, tally.perProducer[ p ] );
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_dispatch_reaches_only_the_current_mode );
+    RUN_TEST( test_full_queue_drops_and_counts );
+    RUN_TEST( test_receive_times_out_when_empty );
+    RUN_TEST( test_latency_is_measured_from_post );
+    RUN_TEST( test_concurrent_burst_counters_add_up );
+    RUN_TEST( test_throughput_harness );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
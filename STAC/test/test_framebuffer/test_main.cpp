@@ -0,0 +1,181 @@
+// Host tests for Display::FramebufferDisplay
+//
+// Run with: pio test -e native -f test_framebuffer
+
+#include <unity.h>
+#include <cstdio>
+#include "Hardware/Display/Framebuffer/FramebufferDisplay.h"
+
+using namespace Display;
+
+
+namespace {
+
+    // 5x5 bitmap, one byte per pixel: a plus sign
+    const uint8_t PLUS_GLYPH[ 25 ] = {
+        0, 0, 1, 0, 0,
+        0, 0, 1, 0, 0,
+        1, 1, 1, 1, 1,
+        0, 0, 1, 0, 0,
+        0, 0, 1, 0, 0,
+    };
+
+    // 5x5 corners overlay
+    const uint8_t CORNERS_GLYPH[ 25 ] = {
+        1, 0, 0, 0, 1,
+        0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+        1, 0, 0, 0, 1,
+    };
+
+} // namespace
+
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void test_board_geometry() {
+    std::unique_ptr<FramebufferDisplay> display = FramebufferDisplay::createForBoard();
+
+    TEST_ASSERT_EQUAL( DISPLAY_MATRIX_WIDTH, display->getWidth() );
+    TEST_ASSERT_EQUAL( DISPLAY_MATRIX_HEIGHT, display->getHeight() );
+    TEST_ASSERT_EQUAL( DISPLAY_MATRIX_WIDTH * DISPLAY_MATRIX_HEIGHT, display->getPixelCount() );
+}
+
+void test_drawing_reaches_the_panel_only_on_show() {
+    FramebufferDisplay display( 5, 5 );
+    display.begin();
+
+    display.fill( StandardColors::RED, false );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BLACK, display.getShownPixel( 2, 2 ) );
+
+    display.show();
+    for ( uint16_t y = 0; y < 5; y++ ) {
+        for ( uint16_t x = 0; x < 5; x++ ) {
+            TEST_ASSERT_EQUAL_HEX32( StandardColors::RED, display.getShownPixel( x, y ) );
+        }
+    }
+}
+
+void test_matrix_glyph_and_overlay() {
+    FramebufferDisplay display( 5, 5 );
+    display.begin();
+
+    display.drawGlyph( PLUS_GLYPH, StandardColors::GREEN, StandardColors::BLUE, false );
+    display.drawGlyphOverlay( CORNERS_GLYPH, StandardColors::WHITE, true );
+
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::GREEN, display.getShownPixel( 2, 0 ) );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::GREEN, display.getShownPixel( 0, 2 ) );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BLUE, display.getShownPixel( 1, 1 ) );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::WHITE, display.getShownPixel( 0, 0 ) );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::WHITE, display.getShownPixel( 4, 4 ) );
+}
+
+void test_counters() {
+    FramebufferDisplay display( 5, 5 );
+    display.begin();
+    display.resetCounters();
+
+    display.fill( StandardColors::RED, false );
+    display.setPixelXY( 1, 1, StandardColors::BLUE, false );
+    display.setPixel( 24, StandardColors::GREEN, true );
+
+    const FramebufferDisplay::RenderCounters &counters = display.getCounters();
+    TEST_ASSERT_EQUAL_UINT32( 3, counters.drawCalls );
+    TEST_ASSERT_EQUAL_UINT32( 25 + 1 + 1, counters.pixelsWritten );
+    TEST_ASSERT_EQUAL_UINT32( 1, counters.showCalls );
+    TEST_ASSERT_EQUAL_UINT32( 1, display.getStats().showRequests );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BLUE, display.getShownPixel( 1, 1 ) );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::GREEN, display.getShownPixel( 4, 4 ) );
+}
+
+void test_out_of_range_pixels_are_ignored() {
+    FramebufferDisplay display( 5, 5 );
+    display.begin();
+    display.resetCounters();
+
+    display.setPixelXY( 5, 0, StandardColors::RED, false );
+    display.setPixel( 25, StandardColors::RED, true );
+
+    TEST_ASSERT_EQUAL_UINT32( 0, display.getCounters().pixelsWritten );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BLACK, display.getShownPixel( 5, 0 ) );
+}
+
+void test_flash_ends_at_requested_brightness() {
+    FramebufferDisplay display( 5, 5 );
+    display.begin();
+    display.resetCounters();
+
+    display.flash( 3, 100, 60 );
+
+    TEST_ASSERT_EQUAL_UINT32( 6, display.getCounters().showCalls );
+    TEST_ASSERT_EQUAL_UINT8( 60, display.getShownBrightness() );
+}
+
+void test_tft_geometry_stub_glyphs() {
+    FramebufferDisplay display( 135, 240 );
+    display.begin();
+    TEST_ASSERT_EQUAL_UINT8( 255, display.getPixelCount() );
+
+    const uint8_t glyphIndex[ 1 ] = { 7 };
+    display.drawGlyph( glyphIndex, StandardColors::WHITE, StandardColors::RED, true );
+
+    TEST_ASSERT_EQUAL_UINT8( 7, display.getLastGlyphIndex() );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::RED, display.getShownPixel( 0, 0 ) );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::WHITE, display.getShownPixel( 67, 120 ) );
+}
+
+void test_tft_corners_go_through_show() {
+    FramebufferDisplay display( 135, 240 );
+    display.begin();
+    display.fill( StandardColors::BLUE, true );
+    display.resetCounters();
+
+    display.pulseCorners( nullptr, true, StandardColors::BRIGHT_GREEN );
+
+    TEST_ASSERT_EQUAL_UINT32( 1, display.getStats().showRequests );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BRIGHT_GREEN, display.getShownPixel( 0, 0 ) );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BRIGHT_GREEN, display.getShownPixel( 134, 239 ) );
+    TEST_ASSERT_EQUAL_HEX32( StandardColors::BLUE, display.getShownPixel( 67, 120 ) );
+}
+
+void test_dump_ppm() {
+    FramebufferDisplay display( 5, 5 );
+    display.begin();
+    display.drawGlyph( PLUS_GLYPH, StandardColors::RED, StandardColors::BLACK, true );
+
+    FILE *file = tmpfile();
+    TEST_ASSERT_NOT_NULL( file );
+    TEST_ASSERT_TRUE( display.dumpPPM( file, 4 ) );
+
+    long size = ftell( file );
+    rewind( file );
+    char header[ 16 ] = {};
+    TEST_ASSERT_NOT_NULL( fgets( header, sizeof( header ), file ) );
+    TEST_ASSERT_EQUAL_STRING( "P6\n", header );
+    fclose( file );
+
+    // "P6\n20 20\n255\n" + 20 * 20 RGB triplets
+    TEST_ASSERT_EQUAL( 13 + 20 * 20 * 3, size );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_board_geometry );
+    RUN_TEST( test_drawing_reaches_the_panel_only_on_show );
+    RUN_TEST( test_matrix_glyph_and_overlay );
+    RUN_TEST( test_counters );
+    RUN_TEST( test_out_of_range_pixels_are_ignored );
+    RUN_TEST( test_flash_ends_at_requested_brightness );
+    RUN_TEST( test_tft_geometry_stub_glyphs );
+    RUN_TEST( test_tft_corners_go_through_show );
+    RUN_TEST( test_dump_ppm );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
@@ -0,0 +1,263 @@
+// Host tests for the LED matrix show() path (DisplayBase) and ColorTable against a fake LiteLED strip
+//
+// Run with: pio test -e native -f test_led_matrix
+
+#include <unity.h>
+#include <LiteLED.h>
+#include "Hardware/Display/Matrix5x5/Display5x5.h"
+
+using namespace Display;
+
+
+namespace {
+
+    constexpr uint8_t LEDS = 25;
+    constexpr uint32_t FRAME_US = LEDS * 30 + 300;      // Wire time + latch, as DisplayBase models it
+
+    const uint8_t DOT_GLYPH[ LEDS ] = {
+        0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+    };
+
+    // Every named colour, looked up in ColorTable by value
+    const color_t NAMED_COLORS[] = {
+        StandardColors::BLACK, StandardColors::WHITE, StandardColors::RED, StandardColors::GREEN,
+        StandardColors::BLUE, StandardColors::LIGHT_GREEN, StandardColors::BRIGHT_GREEN, StandardColors::PURPLE,
+        StandardColors::ORANGE, StandardColors::YELLOW, StandardColors::DARK_BLUE, StandardColors::DARK_GREEN,
+        StandardColors::DARK_ORANGE, StandardColors::DARK_PURPLE, StandardColors::TEAL, StandardColors::DARK_TEAL,
+        StandardColors::PINK,
+        STACColors::PROGRAM, STACColors::PREVIEW, STACColors::UNSELECTED, STACColors::WARNING,
+        STACColors::ALERT, STACColors::GTG, STACColors::POWER_ON, STACColors::HDMI_VALUE,
+        STACColors::SDI_VALUE, STACColors::AUTOSTART_PULSE
+    };
+
+    Display5x5 *display = nullptr;
+    LiteLED *strip = nullptr;
+
+    // What LiteLED itself puts on the wire for a colour at a brightness
+    uint32_t liteLEDWire( color_t color, uint8_t brightness, led_strip_type_t type ) {
+        LiteLED reference( type, false );
+        reference.begin( 0, 1 );
+        reference.brightness( brightness );
+        reference.setPixel( 0, color );
+        reference.show();
+        return reference.getWirePixel( 0 );
+    }
+
+    // DisplayTFT::colorToRGB565() before ColorTable
+    uint16_t legacyRGB565( color_t color ) {
+        uint8_t r = ( color >> 16 ) & 0xFF;
+        uint8_t g = ( color >> 8 ) & 0xFF;
+        uint8_t b = color & 0xFF;
+
+        return ( ( r & 0xF8 ) << 8 ) | ( ( g & 0xFC ) << 3 ) | ( b >> 3 );
+    }
+
+} // namespace
+
+
+void setUp() {
+    FakeClock::setMillis( 1000 );
+    display = new Display5x5( PIN_DISPLAY_DATA, LEDS, DISPLAY_LED_TYPE );
+    display->begin();
+    strip = LiteLED::last();
+
+    // Start every test with the begin() frame already on the LEDs
+    FakeClock::advanceMillis( 10 );
+}
+
+void tearDown() {
+    delete display;
+    display = nullptr;
+    strip = nullptr;
+}
+
+void test_begin_sends_one_frame() {
+    TEST_ASSERT_NOT_NULL( strip );
+    TEST_ASSERT_EQUAL_UINT32( 1, strip->getShowCount() );
+
+    DisplayStats stats = display->getStats();
+    TEST_ASSERT_EQUAL_UINT32( 1, stats.showRequests );
+    TEST_ASSERT_EQUAL_UINT32( 1, stats.framesSent );
+    TEST_ASSERT_EQUAL_UINT32( 0, stats.framesSkipped );
+    TEST_ASSERT_EQUAL_UINT32( 0, stats.framesCoalesced );
+}
+
+void test_identical_redraws_are_skipped() {
+    display->fill( StandardColors::RED, true );
+    uint32_t shows = strip->getShowCount();
+
+    // What the tally poll loop does on every unchanged poll
+    for ( int i = 0; i < 5; i++ ) {
+        FakeClock::advanceMillis( 100 );
+        display->fill( StandardColors::RED, true );
+    }
+
+    TEST_ASSERT_EQUAL_UINT32( shows, strip->getShowCount() );
+    DisplayStats stats = display->getStats();
+    TEST_ASSERT_EQUAL_UINT32( 7, stats.showRequests );
+    TEST_ASSERT_EQUAL_UINT32( 2, stats.framesSent );
+    TEST_ASSERT_EQUAL_UINT32( 5, stats.framesSkipped );
+}
+
+void test_redraw_with_same_content_via_other_calls_is_skipped() {
+    display->drawGlyph( DOT_GLYPH, StandardColors::GREEN, StandardColors::BLACK, true );
+    FakeClock::advanceMillis( 10 );
+
+    // Same pixels, built differently
+    display->clear( false );
+    display->setPixel( 12, StandardColors::GREEN, true );
+
+    TEST_ASSERT_EQUAL_UINT32( 1, display->getStats().framesSkipped );
+}
+
+void test_brightness_change_is_not_skipped() {
+    display->fill( StandardColors::BLUE, true );
+    FakeClock::advanceMillis( 10 );
+
+    display->setBrightness( 40, true );
+
+    DisplayStats stats = display->getStats();
+    TEST_ASSERT_EQUAL_UINT32( 3, stats.framesSent );
+    TEST_ASSERT_EQUAL_UINT32( 0, stats.framesSkipped );
+}
+
+void test_frame_during_transfer_waits_for_fence() {
+    display->fill( StandardColors::RED, true );
+    TEST_ASSERT_FALSE( display->isTransferComplete() );
+
+    int64_t sentAt = FakeClock::nowUs();
+    FakeClock::advanceMicros( 200 );
+    display->fill( StandardColors::GREEN, true );
+
+    // The second frame went out only once the first had finished clocking out
+    TEST_ASSERT_EQUAL( sentAt + FRAME_US, FakeClock::nowUs() );
+    DisplayStats stats = display->getStats();
+    TEST_ASSERT_EQUAL_UINT32( 3, stats.framesSent );
+    TEST_ASSERT_EQUAL_UINT32( 1, stats.framesCoalesced );
+}
+
+void test_frame_after_transfer_does_not_wait() {
+    display->fill( StandardColors::RED, true );
+    FakeClock::advanceMicros( FRAME_US );
+    TEST_ASSERT_TRUE( display->isTransferComplete() );
+
+    int64_t before = FakeClock::nowUs();
+    display->fill( StandardColors::GREEN, true );
+
+    TEST_ASSERT_EQUAL( before, FakeClock::nowUs() );
+    TEST_ASSERT_EQUAL_UINT32( 0, display->getStats().framesCoalesced );
+}
+
+void test_skipped_frame_does_not_wait() {
+    display->fill( StandardColors::RED, true );
+
+    int64_t before = FakeClock::nowUs();
+    display->fill( StandardColors::RED, true );
+
+    TEST_ASSERT_EQUAL( before, FakeClock::nowUs() );
+    DisplayStats stats = display->getStats();
+    TEST_ASSERT_EQUAL_UINT32( 1, stats.framesSkipped );
+    TEST_ASSERT_EQUAL_UINT32( 0, stats.framesCoalesced );
+}
+
+void test_strip_passes_table_bytes_through() {
+    // The GRB bytes come from ColorTable, so LiteLED must neither reorder nor scale them
+    TEST_ASSERT_EQUAL( LED_STRIP_WS2812_RGB, strip->getType() );
+    TEST_ASSERT_EQUAL_UINT8( 255, strip->getShownBrightness() );
+}
+
+void test_strip_receives_frame_content() {
+    display->setBrightness( 255, false );
+    display->drawGlyph( DOT_GLYPH, StandardColors::GREEN, StandardColors::BLUE, true );
+
+    TEST_ASSERT_EQUAL_HEX32( liteLEDWire( StandardColors::GREEN, 255, LED_STRIP_WS2812 ), strip->getWirePixel( 12 ) );
+    TEST_ASSERT_EQUAL_HEX32( liteLEDWire( StandardColors::BLUE, 255, LED_STRIP_WS2812 ), strip->getWirePixel( 0 ) );
+    TEST_ASSERT_EQUAL_HEX32( liteLEDWire( StandardColors::BLUE, 255, LED_STRIP_WS2812 ), strip->getWirePixel( 24 ) );
+}
+
+void test_brightness_change_swaps_the_table_row() {
+    display->setBrightness( 40, false );
+    display->fill( StandardColors::ORANGE, true );
+    TEST_ASSERT_EQUAL_HEX32( liteLEDWire( StandardColors::ORANGE, 40, LED_STRIP_WS2812 ), strip->getWirePixel( 7 ) );
+
+    FakeClock::advanceMillis( 10 );
+    display->setBrightness( 0, true );
+    TEST_ASSERT_EQUAL_HEX32( 0, strip->getWirePixel( 7 ) );
+}
+
+void test_tables_match_liteled_at_every_level() {
+    const led_strip_type_t types[] = { LED_STRIP_WS2812_RGB, LED_STRIP_WS2812 };   // WireOrder::RGB, GRB
+    for ( uint8_t order = 0; order < ColorTable::ORDER_COUNT; order++ ) {
+        for ( uint8_t level = 0; level <= Config::Display::BRIGHTNESS_LEVELS; level++ ) {
+            uint8_t brightness = Config::Display::BRIGHTNESS_MAP[ level ];
+            const uint32_t *row = ColorTable::wireRow( brightness, static_cast<WireOrder>( order ) );
+            TEST_ASSERT_NOT_NULL( row );
+            for ( color_t color : NAMED_COLORS ) {
+                int8_t index = ColorTable::paletteIndex( color );
+                TEST_ASSERT_TRUE( index >= 0 );
+                TEST_ASSERT_EQUAL_HEX32( liteLEDWire( color, brightness, types[ order ] ), row[ index ] );
+            }
+        }
+    }
+}
+
+void test_display_sends_table_values_at_every_level() {
+    for ( uint8_t level = 0; level <= Config::Display::BRIGHTNESS_LEVELS; level++ ) {
+        uint8_t brightness = Config::Display::BRIGHTNESS_MAP[ level ];
+        display->setBrightness( brightness, false );
+        for ( color_t color : NAMED_COLORS ) {
+            display->fill( color, true );
+            TEST_ASSERT_EQUAL_HEX32( liteLEDWire( color, brightness, LED_STRIP_WS2812 ), strip->getWirePixel( 3 ) );
+        }
+    }
+}
+
+void test_off_map_values_fall_back_to_scaling() {
+    // Pulse dimming uses brightness values that are not in the map
+    display->setBrightness( 15, false );
+    display->fill( StandardColors::ORANGE, true );
+    TEST_ASSERT_EQUAL_HEX32( liteLEDWire( StandardColors::ORANGE, 15, LED_STRIP_WS2812 ), strip->getWirePixel( 0 ) );
+
+    // And colours outside the palette
+    const color_t custom = makeRGB( 0x12, 0x34, 0x56 );
+    display->setBrightness( Config::Display::BRIGHTNESS_MAP[ 1 ], false );
+    display->fill( custom, true );
+    TEST_ASSERT_EQUAL_HEX32( liteLEDWire( custom, Config::Display::BRIGHTNESS_MAP[ 1 ], LED_STRIP_WS2812 ),
+                             strip->getWirePixel( 0 ) );
+}
+
+void test_rgb565_table_matches_old_conversion_at_every_level() {
+    for ( uint8_t level = 0; level <= Config::Display::BRIGHTNESS_LEVELS; level++ ) {
+        const uint16_t *row = ColorTable::rgb565Row( Config::Display::BRIGHTNESS_MAP[ level ] );
+        for ( color_t color : NAMED_COLORS ) {
+            TEST_ASSERT_EQUAL_HEX16( legacyRGB565( color ), row[ ColorTable::paletteIndex( color ) ] );
+        }
+    }
+    TEST_ASSERT_EQUAL_HEX16( legacyRGB565( makeRGB( 0x12, 0x34, 0x56 ) ), toRGB565( makeRGB( 0x12, 0x34, 0x56 ) ) );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_begin_sends_one_frame );
+    RUN_TEST( test_identical_redraws_are_skipped );
+    RUN_TEST( test_redraw_with_same_content_via_other_calls_is_skipped );
+    RUN_TEST( test_brightness_change_is_not_skipped );
+    RUN_TEST( test_frame_during_transfer_waits_for_fence );
+    RUN_TEST( test_frame_after_transfer_does_not_wait );
+    RUN_TEST( test_skipped_frame_does_not_wait );
+    RUN_TEST( test_strip_passes_table_bytes_through );
+    RUN_TEST( test_strip_receives_frame_content );
+    RUN_TEST( test_brightness_change_swaps_the_table_row );
+    RUN_TEST( test_tables_match_liteled_at_every_level );
+    RUN_TEST( test_display_sends_table_values_at_every_level );
+    RUN_TEST( test_off_map_values_fall_back_to_scaling );
+    RUN_TEST( test_rgb565_table_matches_old_conversion_at_every_level );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
@@ -0,0 +1,217 @@
+// Host tests and flush benchmark for Display::PaletteCanvas
+//
+// Run with: pio test -e native -f test_palette_canvas
+//
+// The benchmark prints, per panel size, the CPU time flush() spends
+// expanding the 4-bit canvas into RGB565 bands, next to the time the same
+// frame takes on the SPI wire. An RGB565 canvas pushes its buffer as-is,
+// so the expansion is the whole CPU cost PaletteCanvas adds. Host CPU time
+// is a relative figure; run the same code on a device for absolute numbers.
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "Hardware/Display/TFT/PaletteCanvas.h"
+
+using namespace Display;
+
+
+namespace {
+
+    constexpr uint16_t RED565 = 0xF800;
+    constexpr uint16_t GREEN565 = 0x07E0;
+    constexpr uint16_t BLUE565 = 0x001F;
+    constexpr uint16_t WHITE565 = 0xFFFF;
+    constexpr uint32_t BENCH_SPI_HZ = 40000000;     // Typical TFT write clock
+
+    /**
+     * @brief Panel that keeps the pushed frame and counts transfers
+     */
+    class RecordingPanel : public Arduino_G {
+      public:
+        RecordingPanel( int16_t w, int16_t h, bool keepPixels = true )
+            : Arduino_G( w, h )
+            , keep( keepPixels )
+            , pixels( keepPixels ? static_cast<size_t>( w ) * h : 0, 0 ) {
+        }
+
+        bool begin( int32_t speed ) override {
+            ( void )speed;
+            return true;
+        }
+
+        void draw16bitRGBBitmap( int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h ) override {
+            pushes++;
+            pixelsPushed += static_cast<uint32_t>( w ) * h;
+            if ( !keep ) {
+                checksum += bitmap[ 0 ];
+                return;
+            }
+            for ( int16_t row = 0; row < h; row++ ) {
+                for ( int16_t col = 0; col < w; col++ ) {
+                    pixels[ ( y + row ) * WIDTH + x + col ] = bitmap[ row * w + col ];
+                }
+            }
+        }
+
+        uint16_t at( int16_t x, int16_t y ) const {
+            return pixels[ y * WIDTH + x ];
+        }
+
+        bool keep;
+        std::vector<uint16_t> pixels;
+        uint32_t pushes = 0;
+        uint32_t pixelsPushed = 0;
+        uint32_t checksum = 0;
+    };
+
+    template <typename Fn>
+    double microsPerCall( uint32_t iterations, Fn fn ) {
+        auto start = std::chrono::steady_clock::now();
+        for ( uint32_t i = 0; i < iterations; i++ ) {
+            fn();
+        }
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+
+    // A typical tally frame: solid background, power dot, corner markers
+    template <typename Canvas>
+    void drawTallyFrame( Canvas &canvas, int16_t w, int16_t h ) {
+        canvas.fillRect( 0, 0, w, h, RED565 );
+        canvas.fillRect( w / 2 - 8, h / 2 - 8, 17, 17, GREEN565 );
+        canvas.fillRect( 0, 0, 15, 15, WHITE565 );
+        canvas.fillRect( w - 15, h - 15, 15, 15, WHITE565 );
+    }
+
+} // namespace
+
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void test_flush_reproduces_the_frame() {
+    RecordingPanel panel( 135, 240 );
+    PaletteCanvas canvas( 135, 240, &panel );
+    TEST_ASSERT_TRUE( canvas.begin() );
+
+    drawTallyFrame( canvas, 135, 240 );
+    canvas.drawPixel( 134, 239, BLUE565 );     // Odd width: last pixel of a row is a low nibble
+    canvas.drawPixel( 133, 0, BLUE565 );
+    canvas.flush();
+
+    TEST_ASSERT_EQUAL_UINT16( WHITE565, panel.at( 0, 0 ) );
+    TEST_ASSERT_EQUAL_UINT16( RED565, panel.at( 20, 20 ) );
+    TEST_ASSERT_EQUAL_UINT16( GREEN565, panel.at( 67, 120 ) );
+    TEST_ASSERT_EQUAL_UINT16( BLUE565, panel.at( 134, 239 ) );
+    TEST_ASSERT_EQUAL_UINT16( BLUE565, panel.at( 133, 0 ) );
+    TEST_ASSERT_EQUAL_UINT16( RED565, panel.at( 134, 0 ) );
+    TEST_ASSERT_EQUAL_UINT8( 4, canvas.getPaletteCount() );
+}
+
+void test_flush_pushes_whole_frame_in_bands() {
+    RecordingPanel panel( 135, 240 );
+    PaletteCanvas canvas( 135, 240, &panel );
+    canvas.begin();
+
+    canvas.fillScreen( BLUE565 );
+    canvas.flush();
+
+    TEST_ASSERT_EQUAL_UINT32( ( 240 + PaletteCanvas::BAND_ROWS - 1 ) / PaletteCanvas::BAND_ROWS, panel.pushes );
+    TEST_ASSERT_EQUAL_UINT32( 135u * 240u, panel.pixelsPushed );
+}
+
+void test_full_fill_resets_palette() {
+    RecordingPanel panel( 128, 128 );
+    PaletteCanvas canvas( 128, 128, &panel );
+    canvas.begin();
+
+    for ( uint16_t i = 0; i < 10; i++ ) {
+        canvas.drawPixel( i, 0, static_cast<uint16_t>( 0x0841 * ( i + 1 ) ) );
+    }
+    TEST_ASSERT_EQUAL_UINT8( 11, canvas.getPaletteCount() );
+
+    canvas.fillScreen( GREEN565 );
+    TEST_ASSERT_EQUAL_UINT8( 1, canvas.getPaletteCount() );
+}
+
+void test_palette_overflow_uses_nearest_colour() {
+    RecordingPanel panel( 32, 8 );
+    PaletteCanvas canvas( 32, 8, &panel );
+    canvas.begin();
+
+    canvas.fillScreen( 0x0000 );
+    for ( uint16_t i = 1; i < PaletteCanvas::PALETTE_SIZE; i++ ) {
+        canvas.drawPixel( i, 0, static_cast<uint16_t>( i << 11 ) );     // Reds 1..15
+    }
+    TEST_ASSERT_EQUAL_UINT8( PaletteCanvas::PALETTE_SIZE, canvas.getPaletteCount() );
+
+    canvas.drawPixel( 20, 0, static_cast<uint16_t>( 30 << 11 ) );       // Brightest red nearest to 15
+    canvas.flush();
+    TEST_ASSERT_EQUAL_UINT16( static_cast<uint16_t>( 15 << 11 ), panel.at( 20, 0 ) );
+}
+
+void test_buffer_sizes() {
+    const struct {
+        int16_t w;
+        int16_t h;
+        size_t bytes;
+    } sizes[] = {
+        { 135, 240, 16320 + 2160 },
+        { 240, 135, 16200 + 3840 },
+        { 128, 128, 8192 + 2048 },
+    };
+    for ( const auto &size : sizes ) {
+        RecordingPanel panel( size.w, size.h, false );
+        PaletteCanvas canvas( size.w, size.h, &panel );
+        canvas.begin();
+        TEST_ASSERT_EQUAL_UINT32( size.bytes, canvas.getBufferBytes() );
+    }
+}
+
+void test_flush_benchmark() {
+    const struct {
+        int16_t w;
+        int16_t h;
+    } panels[] = { { 135, 240 }, { 240, 135 }, { 128, 128 } };
+    const uint32_t iterations = 500;
+
+    for ( const auto &size : panels ) {
+        RecordingPanel panel( size.w, size.h, false );
+
+        PaletteCanvas palette( size.w, size.h, &panel );
+        palette.begin();
+        drawTallyFrame( palette, size.w, size.h );
+        double paletteUs = microsPerCall( iterations, [ &palette ]() {
+            palette.flush();
+        } );
+
+        double spiUs = static_cast<double>( size.w ) * size.h * 16 * 1e6 / BENCH_SPI_HZ;
+
+        char line[ 160 ];
+        snprintf( line, sizeof( line ),
+                  "%dx%d flush: expansion %.1f us (host CPU), %lu band pushes; SPI %.0f us @ %lu MHz",
+                  size.w, size.h, paletteUs, static_cast<unsigned long>( panel.pushes / iterations ),
+                  spiUs, static_cast<unsigned long>( BENCH_SPI_HZ / 1000000 ) );
+        TEST_MESSAGE( line );
+        TEST_ASSERT_EQUAL_UINT32( iterations * size.w * size.h, panel.pixelsPushed );
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_flush_reproduces_the_frame );
+    RUN_TEST( test_flush_pushes_whole_frame_in_bands );
+    RUN_TEST( test_full_fill_resets_palette );
+    RUN_TEST( test_palette_overflow_uses_nearest_colour );
+    RUN_TEST( test_buffer_sizes );
+    RUN_TEST( test_flush_benchmark );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
@@ -0,0 +1,172 @@
+// Host tests for the PowerManager energy model and its duty-cycle accounting
+//
+// Run with: pio test -e native -f test_power_manager
+//
+// Average current in mA is the same number as mAh used per hour, so an
+// hour of polls on the virtual clock gives the model's mAh directly.
+
+#include <unity.h>
+#include <climits>
+#include <esp_wifi.h>
+#include "Config/Constants.h"
+#include "Hardware/Power/PowerManager.h"
+
+using namespace Hardware;
+
+
+namespace {
+
+    constexpr float TOLERANCE_MA = 0.01f;
+    constexpr unsigned long HOUR_MS = 60UL * 60 * 1000;
+    constexpr uint32_t POLL_INTERVAL_MS = 500;
+    constexpr uint32_t REPLY_MS = 30;           // Request out to reply in
+
+    // From the Config::Power figures: CPU + radio, awake and between polls
+    constexpr float AWAKE_MA = 120.0f;
+    constexpr float BALANCED_IDLE_MA = 58.0f;
+    constexpr float SAVER_IDLE_MA = 28.0f;
+
+    // What the loop does around each tally poll, for one hour
+    void pollForAnHour( PowerManager &power ) {
+        uint32_t lead = power.getWakeLeadMs();
+        for ( unsigned long elapsed = 0; elapsed < HOUR_MS; elapsed += POLL_INTERVAL_MS ) {
+            FakeClock::advanceMillis( POLL_INTERVAL_MS - REPLY_MS - lead );
+            power.update( lead );
+            FakeClock::advanceMillis( lead + REPLY_MS );
+            power.pollDone();
+        }
+    }
+
+    // Charge used over a report, in mAh
+    float milliampHours( const EnergyReport &report ) {
+        return report.modelMilliamps * report.elapsedMs / HOUR_MS;
+    }
+
+} // namespace
+
+
+void setUp() {
+    FakeClock::setMillis( 5000 );
+    FakeCpu::mhz() = 240;
+    FakeEspWifi::reset();
+}
+
+void tearDown() {
+}
+
+void test_model_at_the_ends_of_the_duty_cycle() {
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, AWAKE_MA, PowerManager::estimateMilliamps( PowerProfile::LOW_LATENCY, 0.0f ) );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, BALANCED_IDLE_MA, PowerManager::estimateMilliamps( PowerProfile::BALANCED, 0.0f ) );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, SAVER_IDLE_MA, PowerManager::estimateMilliamps( PowerProfile::BATTERY_SAVER, 0.0f ) );
+
+    // Fully awake, every profile draws the same
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, AWAKE_MA, PowerManager::estimateMilliamps( PowerProfile::LOW_LATENCY, 1.0f ) );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, AWAKE_MA, PowerManager::estimateMilliamps( PowerProfile::BALANCED, 1.0f ) );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, AWAKE_MA, PowerManager::estimateMilliamps( PowerProfile::BATTERY_SAVER, 1.0f ) );
+}
+
+void test_model_mixes_linearly_with_the_awake_share() {
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, 0.25f * AWAKE_MA + 0.75f * BALANCED_IDLE_MA,
+                              PowerManager::estimateMilliamps( PowerProfile::BALANCED, 0.25f ) );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, 0.1f * AWAKE_MA + 0.9f * SAVER_IDLE_MA,
+                              PowerManager::estimateMilliamps( PowerProfile::BATTERY_SAVER, 0.1f ) );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, AWAKE_MA,
+                              PowerManager::estimateMilliamps( PowerProfile::LOW_LATENCY, 0.37f ) );
+}
+
+void test_awake_share_is_clamped() {
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, BALANCED_IDLE_MA, PowerManager::estimateMilliamps( PowerProfile::BALANCED, -0.5f ) );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, AWAKE_MA, PowerManager::estimateMilliamps( PowerProfile::BATTERY_SAVER, 1.5f ) );
+}
+
+void test_saver_below_balanced_below_low_latency() {
+    for ( int percent = 0; percent < 100; percent += 5 ) {
+        float share = percent / 100.0f;
+        float saver = PowerManager::estimateMilliamps( PowerProfile::BATTERY_SAVER, share );
+        float balanced = PowerManager::estimateMilliamps( PowerProfile::BALANCED, share );
+        float lowLatency = PowerManager::estimateMilliamps( PowerProfile::LOW_LATENCY, share );
+        TEST_ASSERT_TRUE( saver < balanced );
+        TEST_ASSERT_TRUE( balanced < lowLatency );
+    }
+}
+
+void test_balanced_hour_of_polls() {
+    PowerManager power( PowerProfile::BALANCED );
+    power.begin();
+    TEST_ASSERT_EQUAL( WIFI_PS_MIN_MODEM, FakeEspWifi::state().powerSave );
+
+    pollForAnHour( power );
+
+    // Awake from the wake lead to the reply: 50 ms of every 500
+    EnergyReport report = power.getReport();
+    TEST_ASSERT_EQUAL_UINT32( HOUR_MS, report.elapsedMs );
+    TEST_ASSERT_EQUAL_UINT16( 100, report.awakePermille );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, 0.1f * AWAKE_MA + 0.9f * BALANCED_IDLE_MA, report.modelMilliamps );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, 64.2f, milliampHours( report ) );
+    TEST_ASSERT_EQUAL( WIFI_PS_MIN_MODEM, FakeEspWifi::state().powerSave );
+}
+
+void test_battery_saver_hour_of_polls() {
+    PowerManager power( PowerProfile::BATTERY_SAVER );
+    power.begin();
+    TEST_ASSERT_EQUAL( WIFI_PS_MAX_MODEM, FakeEspWifi::state().powerSave );
+    TEST_ASSERT_EQUAL_UINT32( Config::Power::SAVER_CPU_MHZ, getCpuFrequencyMhz() );
+
+    // Full clock and no modem sleep for the poll window only
+    power.update( power.getWakeLeadMs() );
+    TEST_ASSERT_TRUE( power.isAwake() );
+    TEST_ASSERT_EQUAL( WIFI_PS_NONE, FakeEspWifi::state().powerSave );
+    TEST_ASSERT_EQUAL_UINT32( 240, getCpuFrequencyMhz() );
+    power.pollDone();
+    TEST_ASSERT_EQUAL_UINT32( Config::Power::SAVER_CPU_MHZ, getCpuFrequencyMhz() );
+
+    pollForAnHour( power );
+
+    EnergyReport report = power.getReport();
+    TEST_ASSERT_EQUAL_UINT16( 100, report.awakePermille );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, 0.1f * AWAKE_MA + 0.9f * SAVER_IDLE_MA, report.modelMilliamps );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, 37.2f, milliampHours( report ) );
+}
+
+void test_low_latency_never_sleeps() {
+    PowerManager power( PowerProfile::LOW_LATENCY );
+    power.begin();
+    TEST_ASSERT_EQUAL( WIFI_PS_NONE, FakeEspWifi::state().powerSave );
+    TEST_ASSERT_EQUAL_UINT32( 0, power.getWakeLeadMs() );
+
+    pollForAnHour( power );
+
+    // Never in a separate poll window, but the idle draw is the awake draw
+    EnergyReport report = power.getReport();
+    TEST_ASSERT_EQUAL_UINT16( 0, report.awakePermille );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, AWAKE_MA, milliampHours( report ) );
+}
+
+void test_half_hour_report_is_half_the_charge() {
+    PowerManager power( PowerProfile::BALANCED );
+    power.begin();
+
+    // Idle for half an hour: no polls, the radio never wakes
+    power.update( ULONG_MAX );
+    FakeClock::advanceMillis( HOUR_MS / 2 );
+
+    EnergyReport report = power.getReport();
+    TEST_ASSERT_EQUAL_UINT16( 0, report.awakePermille );
+    TEST_ASSERT_FLOAT_WITHIN( TOLERANCE_MA, BALANCED_IDLE_MA / 2, milliampHours( report ) );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_model_at_the_ends_of_the_duty_cycle );
+    RUN_TEST( test_model_mixes_linearly_with_the_awake_share );
+    RUN_TEST( test_awake_share_is_clamped );
+    RUN_TEST( test_saver_below_balanced_below_low_latency );
+    RUN_TEST( test_balanced_hour_of_polls );
+    RUN_TEST( test_battery_saver_hour_of_polls );
+    RUN_TEST( test_low_latency_never_sleeps );
+    RUN_TEST( test_half_hour_report_is_half_the_charge );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
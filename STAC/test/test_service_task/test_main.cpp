@@ -0,0 +1,175 @@
+// Host concurrency tests for Net::ServiceTask, the task runner behind the portal servers
+//
+// Run with: pio test -e native -f test_service_task
+//
+// Tasks run on real threads (see test/fakes/freertos/task.h). A "request"
+// here is a poll call that takes a while, standing in for
+// WebServer::handleClient() serving one client from accept to close.
+
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "Network/ServiceTask.h"
+
+using namespace Net;
+
+
+namespace {
+
+    /**
+     * @brief A server whose requests take a set time; counts requests started and finished
+     */
+    struct SlowServer {
+        explicit SlowServer( uint32_t requestMs )
+            : requestMs( requestMs ) {
+        }
+
+        void handleClient() {
+            started++;
+            std::this_thread::sleep_for( std::chrono::milliseconds( requestMs ) );
+            finished++;
+        }
+
+        uint32_t requestMs;
+        std::atomic<uint32_t> started{ 0 };
+        std::atomic<uint32_t> finished{ 0 };
+    };
+
+    template <typename Condition>
+    bool waitFor( Condition condition, uint32_t timeoutMs = 2000 ) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( timeoutMs );
+        while ( !condition() ) {
+            if ( std::chrono::steady_clock::now() > deadline ) {
+                return false;
+            }
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        }
+        return true;
+    }
+
+} // namespace
+
+
+void setUp() {
+    FakeTasks::reset();
+}
+
+void tearDown() {
+}
+
+void test_polls_until_stopped() {
+    std::atomic<uint32_t> calls( 0 );
+    ServiceTask task( "test", [ &calls ]() {
+        calls++;
+    } );
+
+    TEST_ASSERT_TRUE( task.start( 4096, 1, 1 ) );
+    TEST_ASSERT_TRUE( task.isRunning() );
+    TEST_ASSERT_TRUE( waitFor( [ &calls ]() {
+        return calls >= 5;
+    } ) );
+
+    task.stop();
+    TEST_ASSERT_FALSE( task.isRunning() );
+
+    uint32_t afterStop = calls;
+    std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    TEST_ASSERT_EQUAL_UINT32( afterStop, calls.load() );
+    TEST_ASSERT_EQUAL_UINT32( afterStop, task.getPollCount() );
+}
+
+void test_stop_lets_the_request_in_hand_finish() {
+    SlowServer upload( 150 );
+    ServiceTask task( "upload", [ &upload ]() {
+        upload.handleClient();
+    } );
+    task.start( 4096, 1, 1 );
+
+    TEST_ASSERT_TRUE( waitFor( [ &upload ]() {
+        return upload.started >= 1;
+    } ) );
+    task.stop();
+
+    // The request was completed, not cut off, and the task was not deleted from outside
+    TEST_ASSERT_EQUAL_UINT32( upload.started.load(), upload.finished.load() );
+    TEST_ASSERT_FALSE( task.isRunning() );
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeTasks::externalDeletes().load() );
+}
+
+void test_slow_upload_does_not_hold_up_pages_or_dns() {
+    SlowServer upload( 300 );
+    std::atomic<uint32_t> pageRequests( 0 );
+    std::atomic<uint32_t> dnsQueries( 0 );
+
+    ServiceTask uploadTask( "upload", [ &upload ]() {
+        upload.handleClient();
+    } );
+    ServiceTask webTask( "web", [ &pageRequests ]() {
+        pageRequests++;
+    } );
+    ServiceTask dnsTask( "dns", [ &dnsQueries ]() {
+        dnsQueries++;
+    } );
+    uploadTask.start( 4096, 1, 1 );
+    webTask.start( 4096, 1, 1 );
+    dnsTask.start( 4096, 1, 1 );
+
+    TEST_ASSERT_TRUE( waitFor( [ &upload ]() {
+        return upload.started >= 1;
+    } ) );
+    uint32_t pagesAtStart = pageRequests;
+    uint32_t dnsAtStart = dnsQueries;
+
+    // Both keep being served while the upload is still in progress
+    TEST_ASSERT_TRUE( waitFor( [ & ]() {
+        return pageRequests >= pagesAtStart + 20 && dnsQueries >= dnsAtStart + 20;
+    }, 250 ) );
+    TEST_ASSERT_EQUAL_UINT32( 0, upload.finished.load() );
+
+    uploadTask.requestStop();
+    webTask.requestStop();
+    dnsTask.requestStop();
+    uploadTask.stop();
+    webTask.stop();
+    dnsTask.stop();
+
+    TEST_ASSERT_EQUAL_UINT32( 1, upload.finished.load() );
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeTasks::externalDeletes().load() );
+}
+
+void test_stop_without_start_returns() {
+    ServiceTask task( "idle", []() {} );
+    task.stop();
+    TEST_ASSERT_FALSE( task.isRunning() );
+    TEST_ASSERT_EQUAL_UINT32( 0, FakeTasks::created().load() );
+}
+
+void test_destructor_stops_the_task() {
+    std::atomic<uint32_t> calls( 0 );
+    {
+        ServiceTask task( "scoped", [ &calls ]() {
+            calls++;
+        } );
+        task.start( 4096, 1, 1 );
+        waitFor( [ &calls ]() {
+            return calls >= 1;
+        } );
+    }
+    uint32_t afterScope = calls;
+    std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    TEST_ASSERT_EQUAL_UINT32( afterScope, calls.load() );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_polls_until_stopped );
+    RUN_TEST( test_stop_lets_the_request_in_hand_finish );
+    RUN_TEST( test_slow_upload_does_not_hold_up_pages_or_dns );
+    RUN_TEST( test_stop_without_start_returns );
+    RUN_TEST( test_destructor_stops_the_task );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
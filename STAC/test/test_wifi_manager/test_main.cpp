@@ -0,0 +1,307 @@
+// Host tests for Net::WiFiManager: reconnect backoff, directed-connect fallback and the event queue
+//
+// Run with: pio test -e native -f test_wifi_manager
+//
+// The fake WiFi object plays the driver: join(), drop() and loseAddress()
+// raise the events the real one would, and the manager handles them on
+// the next update(), as it does from the loop task on the device.
+
+#include <unity.h>
+#include <esp_attr.h>
+#include <esp_random.h>
+#include <WiFi.h>
+#include <vector>
+#include "Network/WiFiManager.h"
+
+using namespace Net;
+
+
+namespace {
+
+    const char *SSID = "VenueNet";
+    const char *PASSWORD = "secret123";
+    const uint8_t AP_BSSID[ 6 ] = { 0x24, 0x0A, 0xC4, 0x11, 0x22, 0x33 };
+    constexpr int32_t AP_CHANNEL = 6;
+    constexpr unsigned long LONG_TIMEOUT_MS = 120000;
+    constexpr uint8_t QUEUE_CAPACITY = 8;       // WiFiManager::EVENT_QUEUE_CAPACITY
+
+    WiFiManager *manager = nullptr;
+    std::vector<WiFiState> reported;
+    uint32_t notifications = 0;
+
+    void countNotification( void *context ) {
+        ( void )context;
+        notifications++;
+    }
+
+    WiFiManager *newManager() {
+        WiFiManager *created = new WiFiManager();
+        created->begin();
+        created->setStateCallback( []( WiFiState state ) {
+            reported.push_back( state );
+        } );
+        created->setEventNotifier( countNotification, nullptr );
+        return created;
+    }
+
+    void connectByScan() {
+        manager->connectAsync( SSID, PASSWORD, LONG_TIMEOUT_MS );
+        WiFi.join( AP_BSSID, AP_CHANNEL, -55 );
+        manager->update();
+    }
+
+    // Time between consecutive WiFi.begin() calls while the driver keeps failing
+    std::vector<unsigned long> retryGaps( uint8_t failures, uint8_t reason ) {
+        std::vector<unsigned long> gaps;
+        for ( uint8_t i = 0; i < failures; i++ ) {
+            size_t begins = WiFi.begins.size();
+            unsigned long failedAt = millis();
+            WiFi.drop( reason );
+            manager->update();
+            while ( WiFi.begins.size() == begins && millis() - failedAt < 60000 ) {
+                FakeClock::advanceMillis( 1 );
+                manager->update();
+            }
+            gaps.push_back( millis() - failedAt );
+        }
+        return gaps;
+    }
+
+} // namespace
+
+
+void setUp() {
+    FakeRtc::powerCycle();
+    FakeClock::setMillis( 1000 );
+    FakeRandom::value() = 0;
+    FakeEspWifi::reset();
+    WiFi.reset();
+    reported.clear();
+    notifications = 0;
+    manager = newManager();
+}
+
+void tearDown() {
+    delete manager;
+    manager = nullptr;
+}
+
+void test_scan_connect_reports_connected_from_update() {
+    TEST_ASSERT_FALSE( WiFi.autoReconnect );
+    TEST_ASSERT_EQUAL( WIFI_ALL_CHANNEL_SCAN, WiFi.scanMethod );
+
+    manager->connectAsync( SSID, PASSWORD, LONG_TIMEOUT_MS );
+    TEST_ASSERT_EQUAL( WiFiState::CONNECTING, manager->getState() );
+    TEST_ASSERT_EQUAL( 1, WiFi.begins.size() );
+    TEST_ASSERT_FALSE( WiFi.begins[ 0 ].directed );
+
+    // Events only queue; nothing changes until the loop runs update()
+    WiFi.join( AP_BSSID, AP_CHANNEL, -55 );
+    TEST_ASSERT_EQUAL( WiFiState::CONNECTING, manager->getState() );
+    TEST_ASSERT_EQUAL_UINT32( 2, notifications );
+
+    manager->update();
+    TEST_ASSERT_TRUE( manager->isConnected() );
+    TEST_ASSERT_EQUAL( WiFiConnectPath::SCAN, manager->getConnectPath() );
+    TEST_ASSERT_EQUAL( 2, reported.size() );
+    TEST_ASSERT_EQUAL( WiFiState::CONNECTED, reported.back() );
+
+    WiFiLink link;
+    TEST_ASSERT_TRUE( manager->getNewLink( link ) );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( AP_BSSID, link.bssid, 6 );
+    TEST_ASSERT_EQUAL_UINT8( AP_CHANNEL, link.channel );
+    TEST_ASSERT_EQUAL_INT8( -55, manager->getLinkStats().rssiAverage );
+}
+
+void test_failed_attempts_back_off_exponentially_to_the_cap() {
+    manager->connectAsync( SSID, PASSWORD, LONG_TIMEOUT_MS );
+
+    // No jitter: each wait is half the backoff, which doubles up to the cap
+    std::vector<unsigned long> gaps = retryGaps( 7, WIFI_REASON_NO_AP_FOUND );
+
+    const unsigned long base = Config::Net::RECONNECT_BACKOFF_BASE_MS;
+    const unsigned long cap = Config::Net::RECONNECT_BACKOFF_MAX_MS;
+    const unsigned long expected[] = {
+        base / 2, base, base * 2, base * 4, base * 8, cap / 2, cap / 2
+    };
+    for ( size_t i = 0; i < gaps.size(); i++ ) {
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE( expected[ i ], gaps[ i ], "retry gap" );
+    }
+    TEST_ASSERT_EQUAL( WiFiState::CONNECTING, manager->getState() );
+    TEST_ASSERT_EQUAL_UINT8( WIFI_REASON_NO_AP_FOUND, manager->getLinkStats().lastDisconnectReason );
+}
+
+void test_jitter_stays_within_the_backoff() {
+    manager->connectAsync( SSID, PASSWORD, LONG_TIMEOUT_MS );
+
+    const unsigned long half = Config::Net::RECONNECT_BACKOFF_BASE_MS / 2;
+    FakeRandom::value() = half;             // Largest jitter for the first retry
+    TEST_ASSERT_EQUAL_UINT32( 2 * half, retryGaps( 1, WIFI_REASON_NO_AP_FOUND )[ 0 ] );
+
+    FakeRandom::value() = 0xFFFFFFFF;
+    unsigned long gap = retryGaps( 1, WIFI_REASON_NO_AP_FOUND )[ 0 ];
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32( 2 * half, gap );
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32( 4 * half, gap );
+}
+
+void test_connect_timeout_reports_failed_and_keeps_retrying() {
+    manager->connectAsync( SSID, PASSWORD, 5000 );
+
+    FakeClock::advanceMillis( 5001 );
+    manager->update();
+    TEST_ASSERT_EQUAL( WiFiState::FAILED, manager->getState() );
+    TEST_ASSERT_EQUAL( WiFiState::FAILED, reported.back() );
+
+    FakeClock::advanceMillis( Config::Net::RECONNECT_BACKOFF_BASE_MS / 2 );
+    manager->update();
+    TEST_ASSERT_EQUAL( WiFiState::CONNECTING, manager->getState() );
+    TEST_ASSERT_EQUAL_UINT32( 1, manager->getLinkStats().reconnects );
+    TEST_ASSERT_EQUAL( 2, WiFi.begins.size() );
+
+    WiFi.join( AP_BSSID, AP_CHANNEL, -60 );
+    manager->update();
+    TEST_ASSERT_TRUE( manager->isConnected() );
+}
+
+void test_directed_connect_uses_the_saved_link() {
+    connectByScan();
+    WiFiLink saved;
+    TEST_ASSERT_TRUE( manager->getNewLink( saved ) );
+
+    // Power cycle: RTC memory is gone, the link comes back from NVS
+    delete manager;
+    FakeRtc::powerCycle();
+    WiFi.reset();
+    manager = newManager();
+    manager->setSavedLink( saved );
+
+    manager->connectAsync( SSID, PASSWORD, LONG_TIMEOUT_MS );
+    TEST_ASSERT_EQUAL( WiFiConnectPath::DIRECTED, manager->getConnectPath() );
+    TEST_ASSERT_TRUE( WiFi.begins.back().directed );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( AP_BSSID, WiFi.begins.back().bssid, 6 );
+    TEST_ASSERT_EQUAL_INT32( AP_CHANNEL, WiFi.begins.back().channel );
+
+    WiFi.join( AP_BSSID, AP_CHANNEL, -55 );
+    manager->update();
+    TEST_ASSERT_TRUE( manager->isConnected() );
+    TEST_ASSERT_EQUAL( WiFiConnectPath::DIRECTED, manager->getConnectPath() );
+}
+
+void test_directed_connect_falls_back_to_scan_after_fast_timeout() {
+    connectByScan();
+    WiFiLink saved;
+    manager->getNewLink( saved );
+    manager->disconnect();
+
+    manager->connectAsync( SSID, PASSWORD, LONG_TIMEOUT_MS );
+    TEST_ASSERT_EQUAL( WiFiConnectPath::DIRECTED, manager->getConnectPath() );
+
+    // The access point moved: no event at all, just silence
+    FakeClock::advanceMillis( Config::Net::FAST_CONNECT_TIMEOUT_MS );
+    manager->update();
+    TEST_ASSERT_EQUAL( WiFiConnectPath::DIRECTED, manager->getConnectPath() );
+
+    FakeClock::advanceMillis( 1 );
+    manager->update();
+    TEST_ASSERT_EQUAL( WiFiConnectPath::FALLBACK_SCAN, manager->getConnectPath() );
+    TEST_ASSERT_FALSE( WiFi.begins.back().directed );
+    TEST_ASSERT_EQUAL( WiFiState::CONNECTING, manager->getState() );
+
+    // The stale link is forgotten, so the next boot scans too
+    WiFiLink forgotten;
+    TEST_ASSERT_TRUE( manager->getNewLink( forgotten ) );
+    TEST_ASSERT_FALSE( forgotten.isValid() );
+
+    const uint8_t movedBssid[ 6 ] = { 0x24, 0x0A, 0xC4, 0x44, 0x55, 0x66 };
+    WiFi.join( movedBssid, 11, -58 );
+    manager->update();
+    TEST_ASSERT_TRUE( manager->isConnected() );
+    TEST_ASSERT_EQUAL( WiFiConnectPath::FALLBACK_SCAN, manager->getConnectPath() );
+    TEST_ASSERT_TRUE( manager->getNewLink( saved ) );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( movedBssid, saved.bssid, 6 );
+}
+
+void test_directed_connect_falls_back_at_once_on_failure() {
+    connectByScan();
+    manager->disconnect();
+
+    manager->connectAsync( SSID, PASSWORD, LONG_TIMEOUT_MS );
+    size_t begins = WiFi.begins.size();
+    WiFi.drop( WIFI_REASON_NO_AP_FOUND );
+    manager->update();
+
+    // No backoff wait: the full scan starts on the same update()
+    TEST_ASSERT_EQUAL( WiFiConnectPath::FALLBACK_SCAN, manager->getConnectPath() );
+    TEST_ASSERT_EQUAL( begins + 1, WiFi.begins.size() );
+    TEST_ASSERT_FALSE( WiFi.begins.back().directed );
+}
+
+void test_lost_ip_reconnects_in_background() {
+    connectByScan();
+    reported.clear();
+    uint32_t driverDisconnects = WiFi.disconnects;
+
+    WiFi.loseAddress();
+    manager->update();
+
+    TEST_ASSERT_EQUAL( WiFiState::DISCONNECTED, manager->getState() );
+    TEST_ASSERT_EQUAL_UINT32( 1, manager->getLinkStats().disconnects );
+    TEST_ASSERT_EQUAL_UINT32( driverDisconnects + 1, WiFi.disconnects );
+    // The ASSOC_LEAVE our own disconnect raised is not taken for a driver failure
+    TEST_ASSERT_EQUAL_UINT8( 0, manager->getLinkStats().lastDisconnectReason );
+    TEST_ASSERT_EQUAL( 1, reported.size() );
+
+    FakeClock::advanceMillis( Config::Net::RECONNECT_BACKOFF_BASE_MS / 2 );
+    manager->update();
+    TEST_ASSERT_EQUAL( WiFiState::CONNECTING, manager->getState() );
+    TEST_ASSERT_EQUAL_UINT32( 1, manager->getLinkStats().reconnects );
+    TEST_ASSERT_TRUE( WiFi.begins.back().directed );        // Straight back to the same access point
+
+    FakeClock::advanceMillis( 250 );
+    WiFi.join( AP_BSSID, AP_CHANNEL, -55 );
+    manager->update();
+    TEST_ASSERT_TRUE( manager->isConnected() );
+    TEST_ASSERT_EQUAL_UINT32( Config::Net::RECONNECT_BACKOFF_BASE_MS / 2 + 250, manager->getLinkStats().lastOutageMs );
+}
+
+void test_full_queue_drops_events_and_update_recovers() {
+    connectByScan();
+    uint32_t notified = notifications;
+
+    for ( uint8_t i = 0; i < QUEUE_CAPACITY; i++ ) {
+        manager->postEvent( WiFiEventKind::ASSOCIATED );
+    }
+    WiFi.drop( WIFI_REASON_BEACON_TIMEOUT );        // Nowhere to put it
+    TEST_ASSERT_EQUAL_UINT32( 1, manager->getLinkStats().droppedEvents );
+    TEST_ASSERT_EQUAL_UINT32( notified + QUEUE_CAPACITY, notifications );
+
+    // The loss is still noticed, from the station status
+    manager->update();
+    TEST_ASSERT_EQUAL( WiFiState::DISCONNECTED, manager->getState() );
+    TEST_ASSERT_EQUAL_UINT32( 1, manager->getLinkStats().disconnects );
+
+    // update() drained the queue: events get through again
+    FakeClock::advanceMillis( Config::Net::RECONNECT_BACKOFF_BASE_MS / 2 );
+    manager->update();
+    WiFi.join( AP_BSSID, AP_CHANNEL, -55 );
+    manager->update();
+    TEST_ASSERT_TRUE( manager->isConnected() );
+    TEST_ASSERT_EQUAL_UINT32( 1, manager->getLinkStats().droppedEvents );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_scan_connect_reports_connected_from_update );
+    RUN_TEST( test_failed_attempts_back_off_exponentially_to_the_cap );
+    RUN_TEST( test_jitter_stays_within_the_backoff );
+    RUN_TEST( test_connect_timeout_reports_failed_and_keeps_retrying );
+    RUN_TEST( test_directed_connect_uses_the_saved_link );
+    RUN_TEST( test_directed_connect_falls_back_to_scan_after_fast_timeout );
+    RUN_TEST( test_directed_connect_falls_back_at_once_on_failure );
+    RUN_TEST( test_lost_ip_reconnects_in_background );
+    RUN_TEST( test_full_queue_drops_events_and_update_recovers );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //
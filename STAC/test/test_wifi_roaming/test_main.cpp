@@ -0,0 +1,228 @@
+// Host tests for WiFiManager roaming: RSSI and tally poll traces in, background scans and roams out
+//
+// Run with: pio test -e native -f test_wifi_roaming
+//
+// Each trace step is one second of the loop: the fake station reports
+// the step's RSSI (or a poll result is noted), the clock moves on by
+// Config::Net::RSSI_SAMPLE_MS and update() runs.
+
+#include <unity.h>
+#include <esp_attr.h>
+#include <WiFi.h>
+#include <vector>
+#include "Network/WiFiManager.h"
+
+using namespace Net;
+
+
+namespace {
+
+    const char *SSID = "VenueNet";
+    const uint8_t AP_NEAR[ 6 ] = { 0x24, 0x0A, 0xC4, 0x00, 0x00, 0x0A };
+    const uint8_t AP_FAR[ 6 ] = { 0x24, 0x0A, 0xC4, 0x00, 0x00, 0x0B };
+    const uint8_t AP_OTHER[ 6 ] = { 0x24, 0x0A, 0xC4, 0x00, 0x00, 0x0C };
+    constexpr int32_t NEAR_CHANNEL = 1;
+    constexpr int32_t FAR_CHANNEL = 11;
+    constexpr int32_t GOOD_RSSI = -55;
+
+    WiFiManager *manager = nullptr;
+
+    const WiFiLinkStats &stats() {
+        return manager->getLinkStats();
+    }
+
+    void step() {
+        FakeClock::advanceMillis( Config::Net::RSSI_SAMPLE_MS );
+        manager->update();
+    }
+
+    // Returns the 1-based step on which a roam scan started, 0 if none did
+    int playRSSI( const std::vector<int32_t> &trace ) {
+        uint32_t scans = stats().roamScans;
+        for ( size_t i = 0; i < trace.size(); i++ ) {
+            WiFi.rssi = trace[ i ];
+            step();
+            if ( stats().roamScans != scans ) {
+                return static_cast<int>( i + 1 );
+            }
+        }
+        return 0;
+    }
+
+    // Same for polls: 'o' replied, 'x' failed
+    int playPolls( const char *trace ) {
+        uint32_t scans = stats().roamScans;
+        for ( int i = 0; trace[ i ] != '\0'; i++ ) {
+            manager->notePollResult( trace[ i ] == 'o' );
+            step();
+            if ( stats().roamScans != scans ) {
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+
+    std::vector<int32_t> repeat( int32_t rssi, size_t count ) {
+        return std::vector<int32_t>( count, rssi );
+    }
+
+    void scanFinds( const uint8_t *bssid, int32_t channel, int32_t rssi, const char *ssid = SSID ) {
+        WiFiClass::ScanEntry entry = { ssid, {}, channel, rssi };
+        memcpy( entry.bssid, bssid, sizeof( entry.bssid ) );
+        WiFi.scanResults.push_back( entry );
+    }
+
+} // namespace
+
+
+void setUp() {
+    FakeRtc::powerCycle();
+    FakeClock::setMillis( 60000 );      // Past the first ROAM_SCAN_INTERVAL_MS after boot
+    WiFi.reset();
+    manager = new WiFiManager();
+    manager->begin();
+
+    manager->connectAsync( SSID, "secret123", 30000 );
+    WiFi.join( AP_NEAR, NEAR_CHANNEL, GOOD_RSSI );
+    manager->update();
+
+    WiFiLink link;
+    manager->getNewLink( link );
+}
+
+void tearDown() {
+    delete manager;
+    manager = nullptr;
+}
+
+void test_good_link_never_scans() {
+    TEST_ASSERT_EQUAL( 0, playRSSI( repeat( GOOD_RSSI, 120 ) ) );
+    TEST_ASSERT_EQUAL( 0, playPolls( "oooooooooooooooo" ) );
+    TEST_ASSERT_EQUAL_UINT32( 0, WiFi.scans );
+}
+
+void test_weak_signal_scans_once_the_average_crosses_the_threshold() {
+    // -55 to -80 dBm: the 1/8 moving average drops below -72 dBm on the 10th second
+    int scanAt = playRSSI( repeat( -80, 20 ) );
+    TEST_ASSERT_EQUAL( 10, scanAt );
+    TEST_ASSERT_LESS_THAN( Config::Net::ROAM_RSSI_THRESHOLD_DBM, stats().rssiAverage );
+    TEST_ASSERT_EQUAL_UINT32( 1, WiFi.scans );
+}
+
+void test_short_fade_is_smoothed_out() {
+    std::vector<int32_t> trace = repeat( -90, 3 );
+    std::vector<int32_t> recovered = repeat( GOOD_RSSI, 30 );
+    trace.insert( trace.end(), recovered.begin(), recovered.end() );
+
+    TEST_ASSERT_EQUAL( 0, playRSSI( trace ) );
+}
+
+void test_scans_are_spaced_by_the_scan_interval() {
+    int first = playRSSI( repeat( -80, 20 ) );
+    TEST_ASSERT_NOT_EQUAL( 0, first );
+    WiFi.finishScan();      // Nothing else around
+
+    // Still weak: the next scan waits out the interval from the last one
+    int next = playRSSI( repeat( -80, 60 ) );
+    TEST_ASSERT_EQUAL( Config::Net::ROAM_SCAN_INTERVAL_MS / Config::Net::RSSI_SAMPLE_MS, next );
+    TEST_ASSERT_EQUAL_UINT32( 2, stats().roamScans );
+    TEST_ASSERT_EQUAL_UINT32( 0, stats().roams );
+}
+
+void test_roams_to_a_stronger_access_point() {
+    TEST_ASSERT_NOT_EQUAL( 0, playRSSI( repeat( -80, 20 ) ) );
+    int8_t average = stats().rssiAverage;
+
+    // The current access point and another network don't count
+    scanFinds( AP_NEAR, NEAR_CHANNEL, -40 );
+    scanFinds( AP_OTHER, 6, -30, "GuestNet" );
+    scanFinds( AP_FAR, FAR_CHANNEL, average + Config::Net::ROAM_HYSTERESIS_DB );
+    size_t begins = WiFi.begins.size();
+
+    // Results are judged against the average as it stands (no new sample in between)
+    WiFi.finishScan();
+    manager->update();
+    TEST_ASSERT_EQUAL( begins + 1, WiFi.begins.size() );
+    TEST_ASSERT_TRUE( WiFi.begins.back().directed );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( AP_FAR, WiFi.begins.back().bssid, 6 );
+    TEST_ASSERT_EQUAL_INT32( FAR_CHANNEL, WiFi.begins.back().channel );
+
+    FakeClock::advanceMillis( 400 );
+    WiFi.join( AP_FAR, FAR_CHANNEL, -58 );
+    manager->update();
+    TEST_ASSERT_EQUAL_UINT32( 1, stats().roams );
+    TEST_ASSERT_EQUAL_INT8( -58, stats().rssiAverage );
+    TEST_ASSERT_TRUE( manager->isConnected() );
+    TEST_ASSERT_EQUAL_UINT32( 0, stats().disconnects );
+
+    // Kept in RTC memory only, not handed out for NVS
+    WiFiLink link;
+    TEST_ASSERT_FALSE( manager->getNewLink( link ) );
+
+    // The new link is good: no more scans
+    TEST_ASSERT_EQUAL( 0, playRSSI( repeat( -58, 120 ) ) );
+}
+
+void test_candidate_inside_hysteresis_is_not_taken() {
+    TEST_ASSERT_NOT_EQUAL( 0, playRSSI( repeat( -80, 20 ) ) );
+    int8_t average = stats().rssiAverage;
+    scanFinds( AP_FAR, FAR_CHANNEL, average + Config::Net::ROAM_HYSTERESIS_DB - 1 );
+    size_t begins = WiFi.begins.size();
+
+    WiFi.finishScan();
+    manager->update();
+    TEST_ASSERT_EQUAL( begins, WiFi.begins.size() );
+    TEST_ASSERT_EQUAL_UINT32( 0, stats().roams );
+    TEST_ASSERT_TRUE( manager->isConnected() );
+}
+
+void test_roam_that_never_completes_is_a_lost_link() {
+    TEST_ASSERT_NOT_EQUAL( 0, playRSSI( repeat( -80, 20 ) ) );
+    scanFinds( AP_FAR, FAR_CHANNEL, -50 );
+    WiFi.finishScan();
+    step();
+
+    FakeClock::advanceMillis( Config::Net::ROAM_REASSOC_TIMEOUT_MS );
+    manager->update();
+    TEST_ASSERT_EQUAL( WiFiState::CONNECTED, manager->getState() );
+
+    FakeClock::advanceMillis( 1 );
+    manager->update();
+    TEST_ASSERT_EQUAL( WiFiState::DISCONNECTED, manager->getState() );
+    TEST_ASSERT_EQUAL_UINT32( 1, stats().disconnects );
+    TEST_ASSERT_EQUAL_UINT32( 0, stats().roams );
+}
+
+void test_poll_failures_scan_with_a_strong_signal() {
+    // Three failures out of the window of 8 are not enough, the fourth is
+    TEST_ASSERT_EQUAL( 4, playPolls( "xxxxoooo" ) );
+    TEST_ASSERT_EQUAL_UINT8( 50, stats().pollErrorPercent );
+    TEST_ASSERT_EQUAL_INT8( GOOD_RSSI, stats().rssiAverage );
+}
+
+void test_scattered_poll_failures_scan_when_half_the_window_failed() {
+    TEST_ASSERT_EQUAL( 8, playPolls( "oxoxoxox" ) );
+}
+
+void test_single_poll_failure_after_connecting_does_not_scan() {
+    TEST_ASSERT_EQUAL( 0, playPolls( "xooooooooooo" ) );
+    TEST_ASSERT_EQUAL_UINT8( 0, stats().pollErrorPercent );
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST( test_good_link_never_scans );
+    RUN_TEST( test_weak_signal_scans_once_the_average_crosses_the_threshold );
+    RUN_TEST( test_short_fade_is_smoothed_out );
+    RUN_TEST( test_scans_are_spaced_by_the_scan_interval );
+    RUN_TEST( test_roams_to_a_stronger_access_point );
+    RUN_TEST( test_candidate_inside_hysteresis_is_not_taken );
+    RUN_TEST( test_roam_that_never_completes_is_a_lost_link );
+    RUN_TEST( test_poll_failures_scan_with_a_strong_signal );
+    RUN_TEST( test_scattered_poll_failures_scan_when_half_the_window_failed );
+    RUN_TEST( test_single_poll_failure_after_connecting_does_not_scan );
+    return UNITY_END();
+}
+
+
+//  --- EOF --- //